@@ -211,6 +211,7 @@ static bool boot(void)
         }
 
         led_func(CLR_RED_LED);
+        display_wait();
         cm_disable_interrupts();
         set_vector_table_application();
         application_jump();
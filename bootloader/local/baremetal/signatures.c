@@ -83,19 +83,145 @@ static const uint8_t pubkey[PUBKEYS][PUBKEY_LENGTH] =
 /* === Functions =========================================================== */
 
 /*
- * signatures_ok - checks firmware signatures
+ * signatures_merkle_leaf - hashes a chunk of application code into a Merkle leaf
  *
  * INPUT
+ *     - chunk: chunk of code
+ *     - len: length of chunk
+ *     - leaf: buffer to receive leaf hash
+ *
+ * OUTPUT
  *     none
+ */
+void signatures_merkle_leaf(const uint8_t *chunk, uint32_t len, uint8_t *leaf)
+{
+    static const uint8_t prefix = MERKLE_LEAF_PREFIX;
+    SHA256_CTX ctx;
+
+    sha256_Init(&ctx);
+    sha256_Update(&ctx, &prefix, sizeof(prefix));
+    sha256_Update(&ctx, chunk, len);
+    sha256_Final(&ctx, leaf);
+}
+
+/*
+ * signatures_merkle_root - calculates the Merkle root over leaf hashes
+ *
+ * INPUT
+ *     - leaves: leaf hashes, SHA256_DIGEST_LENGTH bytes each
+ *     - count: number of leaves
+ *     - root: buffer to receive root hash
+ *
+ * OUTPUT
+ *     true/false whether the number of leaves is valid
+ */
+bool signatures_merkle_root(const uint8_t *leaves, uint32_t count, uint8_t *root)
+{
+    static const uint8_t prefix = MERKLE_NODE_PREFIX;
+    uint8_t level[MERKLE_MAX_CHUNKS][SHA256_DIGEST_LENGTH];
+    SHA256_CTX ctx;
+    uint32_t i;
+
+    if(count == 0 || count > MERKLE_MAX_CHUNKS)
+    {
+        return false;
+    }
+
+    memcpy(level, leaves, count * SHA256_DIGEST_LENGTH);
+
+    /* Each level is built in place over the one below it */
+    while(count > 1)
+    {
+        for(i = 0; i < count / 2; i++)
+        {
+            sha256_Init(&ctx);
+            sha256_Update(&ctx, &prefix, sizeof(prefix));
+            sha256_Update(&ctx, level[2 * i], 2 * SHA256_DIGEST_LENGTH);
+            sha256_Final(&ctx, level[i]);
+        }
+
+        if(count & 1)
+        {
+            memcpy(level[count / 2], level[count - 1], SHA256_DIGEST_LENGTH);
+        }
+
+        count = (count + 1) / 2;
+    }
+
+    memcpy(root, level[0], SHA256_DIGEST_LENGTH);
+    return true;
+}
+
+/*
+ * signatures_merkle_digest - calculates the digest signed for a Merkle image,
+ * which binds the image format, code length and meta flags to the root
+ *
+ * INPUT
+ *     - root: Merkle root of the code
+ *     - codelen: length of code
+ *     - flags: meta flags
+ *     - digest: buffer to receive digest
+ *
+ * OUTPUT
+ *     none
+ */
+void signatures_merkle_digest(const uint8_t *root, uint32_t codelen, uint8_t flags,
+                              uint8_t *digest)
+{
+    SHA256_CTX ctx;
+
+    sha256_Init(&ctx);
+    sha256_Update(&ctx, (const uint8_t *)MERKLE_DIGEST_TAG, MERKLE_DIGEST_TAG_LEN);
+    sha256_Update(&ctx, (const uint8_t *)&codelen, sizeof(codelen));
+    sha256_Update(&ctx, &flags, sizeof(flags));
+    sha256_Update(&ctx, root, SHA256_DIGEST_LENGTH);
+    sha256_Final(&ctx, digest);
+}
+
+/*
+ * signatures_legacy_code_ok - checks that code verified by its plain SHA256
+ * is not a Merkle leaf, node or signed digest preimage, whose hashes are
+ * signed for Merkle images
+ *
+ * INPUT
+ *     - code: application code
+ *     - codelen: length of code
+ *
+ * OUTPUT
+ *     true/false whether code may be checked as a legacy image
+ */
+bool signatures_legacy_code_ok(const uint8_t *code, uint32_t codelen)
+{
+    /* A leaf covers at most one chunk, a node two hashes */
+    if(codelen <= 1 + MERKLE_CHUNK_LEN &&
+            (code[0] == MERKLE_LEAF_PREFIX || code[0] == MERKLE_NODE_PREFIX))
+    {
+        return false;
+    }
+
+    if(codelen >= MERKLE_DIGEST_TAG_LEN &&
+            memcmp(code, MERKLE_DIGEST_TAG, MERKLE_DIGEST_TAG_LEN) == 0)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * signatures_verify - checks firmware signatures against an already computed
+ * fingerprint of the application code
+ *
+ * INPUT
+ *     - firmware_fingerprint: SHA256 of the application code
  *
  * OUTPUT
  *     returns 1 if signatures are correct, otherwise 0
  */
-int signatures_ok(uint8_t *store_hash)
+int signatures_verify(const uint8_t *firmware_fingerprint)
 {
 #if !defined(DEBUG_ON) || DEBUG_LINK
-    uint32_t codelen = *((uint32_t *)FLASH_META_CODELEN);
-    uint8_t sigindex1, sigindex2, sigindex3, firmware_fingerprint[32];
+    uint8_t sigindex1, sigindex2, sigindex3;
 
     sigindex1 = *((uint8_t *)FLASH_META_SIGINDEX1);
     sigindex2 = *((uint8_t *)FLASH_META_SIGINDEX2);
@@ -113,13 +239,6 @@ int signatures_ok(uint8_t *store_hash)
 
     if(sigindex2 == sigindex3) { return 0; }  /* Duplicate use */
 
-    sha256_Raw((uint8_t *)FLASH_APP_START, codelen, firmware_fingerprint);
-
-    if(store_hash)
-    {
-        memcpy(store_hash, firmware_fingerprint, 32);
-    }
-
     if(ecdsa_verify_digest(&secp256k1, pubkey[sigindex1 - 1], (uint8_t *)FLASH_META_SIG1,
                            firmware_fingerprint) != 0)   /* Failure */
     {
@@ -139,7 +258,75 @@ int signatures_ok(uint8_t *store_hash)
     }
 
 #else
-    (void)store_hash;
+    (void)firmware_fingerprint;
 #endif
     return 1;
 }
+
+/*
+ * signatures_ok - checks firmware signatures
+ *
+ * INPUT
+ *     - store_hash: optional buffer to receive the firmware fingerprint
+ *
+ * OUTPUT
+ *     returns 1 if signatures are correct, otherwise 0
+ */
+int signatures_ok(uint8_t *store_hash)
+{
+#if !defined(DEBUG_ON) || DEBUG_LINK
+    uint32_t codelen = *((uint32_t *)FLASH_META_CODELEN);
+    uint8_t firmware_fingerprint[32];
+    uint8_t root[SHA256_DIGEST_LENGTH];
+    uint8_t leaves[MERKLE_MAX_CHUNKS][SHA256_DIGEST_LENGTH];
+    uint32_t i, len;
+
+    if(SIG_FLAG & META_FLAG_MERKLE)
+    {
+        /* Signatures are over the Merkle root of the code */
+        if(codelen > FLASH_APP_LEN)
+        {
+            return 0;
+        }
+
+        for(i = 0; i * MERKLE_CHUNK_LEN < codelen; i++)
+        {
+            len = codelen - i * MERKLE_CHUNK_LEN;
+            signatures_merkle_leaf((uint8_t *)FLASH_APP_START + i * MERKLE_CHUNK_LEN,
+                                   len > MERKLE_CHUNK_LEN ? MERKLE_CHUNK_LEN : len, leaves[i]);
+        }
+
+        if(!signatures_merkle_root((const uint8_t *)leaves, i, root))
+        {
+            return 0;
+        }
+
+        signatures_merkle_digest(root, codelen, SIG_FLAG, firmware_fingerprint);
+    }
+    else
+    {
+        if(codelen == 0 || codelen > FLASH_APP_LEN)
+        {
+            return 0;
+        }
+
+        sha256_Raw((uint8_t *)FLASH_APP_START, codelen, firmware_fingerprint);
+    }
+
+    if(store_hash)
+    {
+        memcpy(store_hash, firmware_fingerprint, 32);
+    }
+
+    if(!(SIG_FLAG & META_FLAG_MERKLE) &&
+            !signatures_legacy_code_ok((const uint8_t *)FLASH_APP_START, codelen))
+    {
+        return 0;
+    }
+
+    return(signatures_verify(firmware_fingerprint));
+#else
+    (void)store_hash;
+    return 1;
+#endif
+}
@@ -48,39 +48,562 @@ static uint8_t storage_sav[STOR_FLASH_SECT_LEN];
 static uint8_t firmware_hash[SHA256_DIGEST_LENGTH];
 extern bool reset_msg_stack;
 
+/* Hashes of the image are accumulated from flash as each chunk is written, so
+ * that no second pass over the application region is needed once the upload
+ * completes.  upload_hash_ctx matches memory_firmware_hash() (magic, meta and
+ * code) and upload_code_ctx matches the fingerprint in signatures_ok() (code
+ * only).  upload_hashed_len is the offset from the start of meta hashed so far.
+ */
+static SHA256_CTX upload_hash_ctx;
+static SHA256_CTX upload_code_ctx;
+static uint32_t upload_hashed_len;
+static bool upload_hash_valid;
+static uint8_t upload_hash[SHA256_DIGEST_LENGTH];
+static uint8_t upload_code_hash[SHA256_DIGEST_LENGTH];
+
+/* Leaf hashes of a Merkle image, received between meta and code.  Signatures
+ * are checked against their root as soon as they are in, and every chunk of
+ * code is checked against its leaf as soon as it has been written. */
+static uint8_t upload_leaves[MERKLE_MAX_CHUNKS][SHA256_DIGEST_LENGTH];
+static uint32_t upload_leaves_len;
+static uint32_t upload_leaves_received;
+static uint32_t upload_chunks;
+static uint32_t upload_chunks_checked;
+static bool upload_merkle;
+static bool upload_merkle_sig_ok;
+
+/* Application sectors a delta image transmits as a bitmap, bit 0 being the
+ * sector holding meta.  Code in other sectors of a delta image is kept from the
+ * installed firmware.  upload_app_erased is set once the sectors the image
+ * does not keep have been erased, which happens before any code is written. */
+static bool upload_app_erased;
+static uint32_t upload_sent;
+static uint32_t upload_sent_received;
+static uint32_t upload_stream_len;
+static bool upload_delta;
+
+/* Offset from start of meta up to which the image is in place in flash */
+static uint32_t upload_offset;
+
+/* Code of a compressed image is a heatshrink stream.  Bits not yet decoded,
+ * decoder state, window of decoded bytes and decoded bytes not yet flashed. */
+static uint32_t upload_hs_bits;
+static uint32_t upload_hs_bit_count;
+static uint32_t upload_hs_index;
+static HeatshrinkState upload_hs_state;
+static uint8_t upload_hs_window[1 << HEATSHRINK_WINDOW_BITS];
+static uint32_t upload_hs_head;
+static uint8_t upload_hs_out[UPLOAD_HS_OUT_LEN];
+static uint32_t upload_hs_out_len;
+static bool upload_compressed;
+
 static const MessagesMap_t MessagesMap[] =
 {
     /* Normal Messages */
-    MSG_IN(MessageType_MessageType_Initialize,              Initialize_fields,          (message_handler_t)(handler_initialize))
-    MSG_IN(MessageType_MessageType_Ping,                    Ping_fields,                (message_handler_t)(handler_ping))
-    MSG_IN(MessageType_MessageType_FirmwareErase,           FirmwareErase_fields,       (message_handler_t)(handler_erase))
-    MSG_IN(MessageType_MessageType_ButtonAck,               ButtonAck_fields,           NO_PROCESS_FUNC)
-    MSG_IN(MessageType_MessageType_Cancel,                  Cancel_fields,              NO_PROCESS_FUNC)
+    MSG_IN(MessageType_MessageType_Initialize,              Initialize,                 (message_handler_t)(handler_initialize))
+    MSG_IN(MessageType_MessageType_Ping,                    Ping,                       (message_handler_t)(handler_ping))
+    MSG_IN(MessageType_MessageType_FirmwareErase,           FirmwareErase,              (message_handler_t)(handler_erase))
+    MSG_IN(MessageType_MessageType_ButtonAck,               ButtonAck,                  NO_PROCESS_FUNC)
+    MSG_IN(MessageType_MessageType_Cancel,                  Cancel,                     NO_PROCESS_FUNC)
 
     /* Normal Raw Messages */
-    RAW_IN(MessageType_MessageType_FirmwareUpload,          FirmwareUpload_fields,      (message_handler_t)(raw_handler_upload))
+    RAW_IN(MessageType_MessageType_FirmwareUpload,          FirmwareUpload,             (message_handler_t)(raw_handler_upload))
 
     /* Normal Out Messages */
-    MSG_OUT(MessageType_MessageType_Features,               Features_fields,            NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_Success,                Success_fields,             NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_Failure,                Failure_fields,             NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_ButtonRequest,          ButtonRequest_fields,       NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Features,               Features,                   NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Success,                Success,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Failure,                Failure,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_ButtonRequest,          ButtonRequest,              NO_PROCESS_FUNC)
 
 #if DEBUG_LINK
     /* Debug Messages */
-    DEBUG_IN(MessageType_MessageType_DebugLinkDecision,     DebugLinkDecision_fields,   NO_PROCESS_FUNC)
-    DEBUG_IN(MessageType_MessageType_DebugLinkGetState,     DebugLinkGetState_fields,   (message_handler_t)(handler_debug_link_get_state))
-    DEBUG_IN(MessageType_MessageType_DebugLinkStop,         DebugLinkStop_fields,       (message_handler_t)(handler_debug_link_stop))
-    DEBUG_IN(MessageType_MessageType_DebugLinkFillConfig,   DebugLinkFillConfig_fields, (message_handler_t)(handler_debug_link_fill_config))
+    DEBUG_IN(MessageType_MessageType_DebugLinkDecision,     DebugLinkDecision,          NO_PROCESS_FUNC)
+    DEBUG_IN(MessageType_MessageType_DebugLinkGetState,     DebugLinkGetState,          (message_handler_t)(handler_debug_link_get_state))
+    DEBUG_IN(MessageType_MessageType_DebugLinkStop,         DebugLinkStop,              (message_handler_t)(handler_debug_link_stop))
+    DEBUG_IN(MessageType_MessageType_DebugLinkFillConfig,   DebugLinkFillConfig,        (message_handler_t)(handler_debug_link_fill_config))
 
     /* Debug Out Messages */
-    DEBUG_OUT(MessageType_MessageType_DebugLinkState,       DebugLinkState_fields,      NO_PROCESS_FUNC)
-    DEBUG_OUT(MessageType_MessageType_DebugLinkLog,         DebugLinkLog_fields,        NO_PROCESS_FUNC)
+    DEBUG_OUT(MessageType_MessageType_DebugLinkState,       DebugLinkState,             NO_PROCESS_FUNC)
+    DEBUG_OUT(MessageType_MessageType_DebugLinkLog,         DebugLinkLog,               NO_PROCESS_FUNC)
 #endif
 };
 
 /* === Private Functions =================================================== */
 
+/*
+ * upload_hash_init() - Start hashing a new firmware image
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+static void upload_hash_init(void)
+{
+    sha256_Init(&upload_hash_ctx);
+    sha256_Init(&upload_code_ctx);
+
+    /* Magic is only written to flash once the image has been verified */
+    sha256_Update(&upload_hash_ctx, (const uint8_t *)META_MAGIC_STR, META_MAGIC_SIZE);
+    upload_hashed_len = META_MAGIC_SIZE;
+    upload_hash_valid = true;
+}
+
+/*
+ * upload_hash_extend() - Hash flashed image up to an offset, stopping at the end
+ * of code as given by the code length in meta once that has been written
+ *
+ * INPUT
+ *     - end: offset from start of meta up to which image has been written
+ * OUTPUT
+ *     none
+ */
+static void upload_hash_extend(uint32_t end)
+{
+    uint32_t codelen, start;
+
+    if(end >= FLASH_META_CODELEN - FLASH_META_START + sizeof(codelen))
+    {
+        codelen = *((uint32_t *)FLASH_META_CODELEN);
+
+        if(codelen > FLASH_APP_LEN)
+        {
+            upload_hash_valid = false;
+            return;
+        }
+
+        if(end > FLASH_META_DESC_LEN + codelen)
+        {
+            end = FLASH_META_DESC_LEN + codelen;
+        }
+    }
+
+    if(end <= upload_hashed_len)
+    {
+        return;
+    }
+
+    start = upload_hashed_len;
+    sha256_Update(&upload_hash_ctx, (const uint8_t *)(FLASH_META_START + start),
+                  end - start);
+
+    if(end > FLASH_META_DESC_LEN)
+    {
+        if(start < FLASH_META_DESC_LEN)
+        {
+            start = FLASH_META_DESC_LEN;
+        }
+
+        sha256_Update(&upload_code_ctx, (const uint8_t *)(FLASH_META_START + start),
+                      end - start);
+    }
+
+    upload_hashed_len = end;
+}
+
+/*
+ * upload_hash_final() - Finish hashing of uploaded image
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+static void upload_hash_final(void)
+{
+    /* Cover any part of code that was not uploaded, same as a full read would */
+    upload_hash_extend(FLASH_META_DESC_LEN + FLASH_APP_LEN);
+
+    sha256_Final(&upload_hash_ctx, upload_hash);
+    sha256_Final(&upload_code_ctx, upload_code_hash);
+}
+
+/*
+ * upload_error() - Abort firmware upload
+ *
+ * INPUT
+ *     - text: failure message
+ * OUTPUT
+ *     none
+ */
+static void upload_error(const char *text)
+{
+    flash_lock();
+    send_failure(FailureType_Failure_FirmwareError, text);
+    upload_state = RAW_MESSAGE_ERROR;
+    dbg_print("Error: %s... \n\r", text);
+}
+
+/*
+ * upload_write() - Write part of image to flash and verify it
+ *
+ * INPUT
+ *     - offset: offset from start of meta
+ *     - data: image data
+ *     - len: length of data
+ * OUTPUT
+ *     true/false whether data was written
+ */
+static bool upload_write(uint32_t offset, uint8_t *data, uint32_t len)
+{
+    /* Check if the image is bigger than allocated space */
+    if(offset + len >= FLASH_APP_LEN + FLASH_META_DESC_LEN)
+    {
+        upload_error("Firmware too large");
+        return(false);
+    }
+
+    /* Word programming, as for storage */
+    if(!flash_write_word(FLASH_APP, offset, len, data))
+    {
+        upload_error("Encountered error while writing to flash");
+        return(false);
+    }
+
+    /* Read back what was written before hashing it */
+    if(memcmp((void *)(FLASH_META_START + offset), data, len) != 0)
+    {
+        upload_error("Encountered error while verifying flash");
+        return(false);
+    }
+
+    upload_hash_extend(offset + len);
+    return(true);
+}
+
+/*
+ * upload_merkle_start() - Check whether the meta that has been written
+ * describes a Merkle image, and if so expect its leaves next
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether meta is usable
+ */
+static bool upload_merkle_start(void)
+{
+    uint32_t codelen = *((uint32_t *)FLASH_META_CODELEN);
+
+    upload_merkle = (SIG_FLAG & META_FLAG_MERKLE) != 0;
+    upload_delta = upload_merkle && (SIG_FLAG & META_FLAG_DELTA);
+    upload_compressed = (SIG_FLAG & META_FLAG_COMPRESSED) != 0;
+
+    if(!upload_merkle)
+    {
+        return(true);
+    }
+
+    if(codelen == 0 || codelen > FLASH_APP_LEN)
+    {
+        upload_error("Not valid firmware");
+        return(false);
+    }
+
+    upload_chunks = (codelen + MERKLE_CHUNK_LEN - 1) / MERKLE_CHUNK_LEN;
+    upload_leaves_len = upload_chunks * SHA256_DIGEST_LENGTH;
+    return(true);
+}
+
+/*
+ * upload_merkle_leaves_done() - Check signatures against the root of the
+ * received leaves
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+static void upload_merkle_leaves_done(void)
+{
+    uint32_t codelen = *((uint32_t *)FLASH_META_CODELEN);
+    uint8_t root[SHA256_DIGEST_LENGTH];
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    upload_merkle_sig_ok = false;
+
+    if(signatures_merkle_root((const uint8_t *)upload_leaves, upload_chunks, root))
+    {
+        signatures_merkle_digest(root, codelen, SIG_FLAG, digest);
+        upload_merkle_sig_ok = (signatures_verify(digest) == 1);
+    }
+}
+
+/*
+ * upload_merkle_check_chunks() - Check every chunk of code that has been
+ * written completely against its leaf
+ *
+ * INPUT
+ *     - offset: offset from start of meta up to which image has been written
+ * OUTPUT
+ *     true/false whether chunks match
+ */
+static bool upload_merkle_check_chunks(uint32_t offset)
+{
+    uint32_t codelen = *((uint32_t *)FLASH_META_CODELEN);
+    uint32_t start, len;
+    uint8_t leaf[SHA256_DIGEST_LENGTH];
+
+    while(upload_merkle && upload_chunks_checked < upload_chunks)
+    {
+        start = upload_chunks_checked * MERKLE_CHUNK_LEN;
+        len = codelen - start;
+
+        if(len > MERKLE_CHUNK_LEN)
+        {
+            len = MERKLE_CHUNK_LEN;
+        }
+
+        if(offset < FLASH_META_DESC_LEN + start + len)
+        {
+            break;
+        }
+
+        signatures_merkle_leaf((const uint8_t *)FLASH_APP_START + start, len, leaf);
+
+        if(memcmp(leaf, upload_leaves[upload_chunks_checked], SHA256_DIGEST_LENGTH) != 0)
+        {
+            dbg_print("Error: chunk %d does not match its leaf\n\r", upload_chunks_checked);
+            upload_error("Firmware chunk failed verification");
+            return(false);
+        }
+
+        upload_chunks_checked++;
+    }
+
+    return(true);
+}
+
+/*
+ * upload_skip_kept() - Move past sectors of a delta image that are kept from
+ * the installed firmware, verifying their code
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether kept code matches the image
+ */
+static bool upload_skip_kept(void)
+{
+    uint32_t code_end = FLASH_META_DESC_LEN + *((uint32_t *)FLASH_META_CODELEN);
+
+    while(upload_delta && upload_offset < code_end &&
+            !(upload_sent & (1u << (upload_offset / APP_FLASH_SECT_LEN))))
+    {
+        upload_offset = (upload_offset / APP_FLASH_SECT_LEN + 1) * APP_FLASH_SECT_LEN;
+
+        if(upload_offset > code_end)
+        {
+            upload_offset = code_end;
+        }
+
+        upload_hash_extend(upload_offset);
+
+        if(!upload_merkle_check_chunks(upload_offset))
+        {
+            return(false);
+        }
+    }
+
+    return(true);
+}
+
+/*
+ * upload_code() - Write code of image to flash, leaving out sectors a delta
+ * image keeps
+ *
+ * INPUT
+ *     - data: code
+ *     - len: length of code
+ * OUTPUT
+ *     true/false whether code was written
+ */
+static bool upload_code(uint8_t *data, uint32_t len)
+{
+    uint32_t n;
+
+    while(len > 0)
+    {
+        if(!upload_skip_kept())
+        {
+            return(false);
+        }
+
+        n = len;
+
+        if(upload_delta)
+        {
+            /* Code for one sector at a time, nothing past the code */
+            if(upload_offset >= FLASH_META_DESC_LEN + *((uint32_t *)FLASH_META_CODELEN))
+            {
+                upload_error("Firmware too large");
+                return(false);
+            }
+
+            if(n > APP_FLASH_SECT_LEN - upload_offset % APP_FLASH_SECT_LEN)
+            {
+                n = APP_FLASH_SECT_LEN - upload_offset % APP_FLASH_SECT_LEN;
+            }
+        }
+
+        if(!upload_write(upload_offset, data, n))
+        {
+            return(false);
+        }
+
+        upload_offset += n;
+
+        if(!upload_merkle_check_chunks(upload_offset))
+        {
+            return(false);
+        }
+
+        data += n;
+        len -= n;
+    }
+
+    return(true);
+}
+
+/*
+ * upload_hs_flush() - Write decoded code to flash
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether code was written
+ */
+static bool upload_hs_flush(void)
+{
+    uint32_t len = upload_hs_out_len;
+
+    upload_hs_out_len = 0;
+    return(upload_code(upload_hs_out, len));
+}
+
+/*
+ * upload_hs_emit() - Output a decoded byte
+ *
+ * INPUT
+ *     - byte: decoded byte
+ * OUTPUT
+ *     true/false whether output could be written
+ */
+static bool upload_hs_emit(uint8_t byte)
+{
+    upload_hs_window[upload_hs_head++ & ((1 << HEATSHRINK_WINDOW_BITS) - 1)] = byte;
+    upload_hs_out[upload_hs_out_len++] = byte;
+
+    return(upload_hs_out_len < sizeof(upload_hs_out) || upload_hs_flush());
+}
+
+/*
+ * upload_inflate() - Decode heatshrink compressed code and write it to flash
+ *
+ * INPUT
+ *     - data: compressed code
+ *     - len: length of compressed code
+ * OUTPUT
+ *     true/false whether code was written
+ */
+static bool upload_inflate(const uint8_t *data, uint32_t len)
+{
+    static const uint8_t needed[] =
+    {
+        [HS_TAG] = 1,
+        [HS_LITERAL] = 8,
+        [HS_BACKREF_INDEX] = HEATSHRINK_WINDOW_BITS,
+        [HS_BACKREF_COUNT] = HEATSHRINK_LOOKAHEAD_BITS
+    };
+    uint32_t value, count;
+
+    while(len > 0)
+    {
+        upload_hs_bits = (upload_hs_bits << 8) | *data++;
+        upload_hs_bit_count += 8;
+        len--;
+
+        /* Bits are taken most significant first */
+        while(upload_hs_bit_count >= needed[upload_hs_state])
+        {
+            upload_hs_bit_count -= needed[upload_hs_state];
+            value = (upload_hs_bits >> upload_hs_bit_count) &
+                    ((1u << needed[upload_hs_state]) - 1);
+
+            switch(upload_hs_state)
+            {
+                case HS_TAG:
+                    upload_hs_state = value ? HS_LITERAL : HS_BACKREF_INDEX;
+                    break;
+
+                case HS_LITERAL:
+                    if(!upload_hs_emit(value))
+                    {
+                        return(false);
+                    }
+
+                    upload_hs_state = HS_TAG;
+                    break;
+
+                case HS_BACKREF_INDEX:
+                    upload_hs_index = value + 1;
+                    upload_hs_state = HS_BACKREF_COUNT;
+                    break;
+
+                case HS_BACKREF_COUNT:
+                default:
+                    for(count = value + 1; count > 0; count--)
+                    {
+                        if(!upload_hs_emit(upload_hs_window[(upload_hs_head - upload_hs_index) &
+                                                            ((1 << HEATSHRINK_WINDOW_BITS) - 1)]))
+                        {
+                            return(false);
+                        }
+                    }
+
+                    upload_hs_state = HS_TAG;
+                    break;
+            }
+        }
+    }
+
+    return(upload_hs_flush());
+}
+
+/*
+ * upload_erase_app() - Erase the application sectors the image does not keep,
+ * all in one go before its code is written, so that no erase stalls the upload
+ * once code is streaming.  The sector holding meta is erased by handler_erase().
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+static void upload_erase_app(void)
+{
+    uint32_t code_end = FLASH_META_DESC_LEN + *((uint32_t *)FLASH_META_CODELEN);
+    uint32_t sector;
+    bool kept;
+
+    if(upload_app_erased)
+    {
+        return;
+    }
+
+    for(sector = 1; sector < FLASH_APP_SECTORS; sector++)
+    {
+        kept = upload_delta && !(upload_sent & (1u << sector)) &&
+               sector * APP_FLASH_SECT_LEN < code_end;
+
+        if(!kept)
+        {
+            flash_erase_sector(FLASH_APP_SECTOR_FIRST + sector, FLASH_CR_PROGRAM_X32);
+        }
+    }
+
+    upload_app_erased = true;
+}
+
 /*
  * check_firmware_hash - Checks flashed firmware's hash
  *
@@ -92,11 +615,8 @@ static const MessagesMap_t MessagesMap[] =
  */
 static bool check_firmware_hash(void)
 {
-    uint8_t flashed_firmware_hash[SHA256_DIGEST_LENGTH];
-
-    memory_firmware_hash(flashed_firmware_hash);
-
-    return(memcmp(firmware_hash, flashed_firmware_hash, SHA256_DIGEST_LENGTH) == 0);
+    return(upload_hash_valid &&
+           memcmp(firmware_hash, upload_hash, SHA256_DIGEST_LENGTH) == 0);
 }
 
 /*
@@ -221,8 +741,21 @@ bool usb_flash_firmware(void)
         {
             case RAW_MESSAGE_COMPLETE:
             {
+                upload_hash_final();
+
+                /* A Merkle image must have arrived complete */
+                if(upload_merkle && upload_chunks_checked < upload_chunks)
+                {
+                    send_failure(FailureType_Failure_FirmwareError, "Firmware incomplete");
+                    goto uff_exit;
+                }
+
                 /* Verify the image is from KeepKey */
-                if((SIG_FLAG == 1) && (signatures_ok(NULL) == 1))
+                if((SIG_FLAG & META_FLAG_RESTORE) && upload_hash_valid &&
+                        (upload_merkle ? upload_merkle_sig_ok :
+                         (signatures_legacy_code_ok((const uint8_t *)FLASH_APP_START,
+                                 *((uint32_t *)FLASH_META_CODELEN)) &&
+                          signatures_verify(upload_code_hash) == 1)))
                 {
                     /* The image is from KeepKey.  Restore storage data */
                     if(!storage_restore())
@@ -436,8 +969,9 @@ void handler_erase(FirmwareErase *msg)
             /* Erase unused sectors */
             flash_erase_word(FLASH_UNUSED0);
 
-            /* Erase application section */
-            flash_erase_word(FLASH_APP);
+            /* Erase the application sector holding meta.  The rest is erased
+             * once the upload knows which sectors a delta image keeps. */
+            flash_erase_sector(FLASH_APP_SECTOR_FIRST, FLASH_CR_PROGRAM_X32);
             flash_lock();
             send_success("Firmware erased");
 
@@ -472,16 +1006,36 @@ void handler_erase(FirmwareErase *msg)
  */
 void raw_handler_upload(RawMessage *msg, uint32_t frame_length)
 {
-    static uint32_t flash_offset;
+    uint32_t len;
 
     /* Check file size is within allocated space */
-    if(frame_length < (FLASH_APP_LEN + FLASH_META_DESC_LEN))
+    if(frame_length < (FLASH_APP_LEN + FLASH_META_DESC_LEN + sizeof(upload_leaves) +
+                       sizeof(upload_sent)))
     {
         /* Start firmware load */
         if(upload_state == RAW_MESSAGE_NOT_STARTED)
         {
             upload_state = RAW_MESSAGE_STARTED;
-            flash_offset = 0;
+            upload_offset = 0;
+            upload_hash_init();
+            upload_merkle = false;
+            upload_merkle_sig_ok = false;
+            upload_leaves_len = 0;
+            upload_leaves_received = 0;
+            upload_chunks = 0;
+            upload_chunks_checked = 0;
+            upload_app_erased = false;
+            upload_sent = 0;
+            upload_sent_received = 0;
+            upload_stream_len = 0;
+            upload_delta = false;
+            upload_compressed = false;
+            upload_hs_bits = 0;
+            upload_hs_bit_count = 0;
+            upload_hs_state = HS_TAG;
+            upload_hs_head = 0;
+            upload_hs_out_len = 0;
+            memset(upload_hs_window, 0, sizeof(upload_hs_window));
 
             /*
              * Parse firmware hash
@@ -498,58 +1052,116 @@ void raw_handler_upload(RawMessage *msg, uint32_t frame_length)
         /* Process firmware upload */
         if(upload_state == RAW_MESSAGE_STARTED)
         {
-            /* Check if the image is bigger than allocated space */
-            if((flash_offset + msg->length) < (FLASH_APP_LEN + FLASH_META_DESC_LEN))
+            if(upload_offset == 0)
+            {
+                /* Check that image is prepared with KeepKey magic */
+                if(memcmp(msg->buffer, META_MAGIC_STR, META_MAGIC_SIZE) == 0)
+                {
+                    msg->length -= META_MAGIC_SIZE;
+                    msg->buffer = (uint8_t *)(msg->buffer + META_MAGIC_SIZE);
+                    upload_offset = META_MAGIC_SIZE;
+                    upload_stream_len = META_MAGIC_SIZE;
+                    /* Unlock the flash for writing */
+                    flash_unlock();
+                }
+                else
+                {
+                    /* Invalid KeepKey magic detected */
+                    send_failure(FailureType_Failure_FirmwareError, "Not valid firmware");
+                    upload_state = RAW_MESSAGE_ERROR;
+                    dbg_print("Error: invalid Magic Key detected... \n\r");
+                    goto rhu_exit;
+                }
+
+            }
+
+            while(msg->length > 0)
             {
-                if(flash_offset == 0)
+                len = msg->length;
+
+                if(upload_offset < FLASH_META_DESC_LEN)
                 {
-                    /* Check that image is prepared with KeepKey magic */
-                    if(memcmp(msg->buffer, META_MAGIC_STR, META_MAGIC_SIZE) == 0)
+                    /* Stop at the end of meta, it tells whether leaves follow */
+                    if(len > FLASH_META_DESC_LEN - upload_offset)
                     {
-                        msg->length -= META_MAGIC_SIZE;
-                        msg->buffer = (uint8_t *)(msg->buffer + META_MAGIC_SIZE);
-                        flash_offset = META_MAGIC_SIZE;
-                        /* Unlock the flash for writing */
-                        flash_unlock();
+                        len = FLASH_META_DESC_LEN - upload_offset;
                     }
-                    else
+
+                    if(!upload_write(upload_offset, msg->buffer, len))
                     {
-                        /* Invalid KeepKey magic detected */
-                        send_failure(FailureType_Failure_FirmwareError, "Not valid firmware");
-                        upload_state = RAW_MESSAGE_ERROR;
-                        dbg_print("Error: invalid Magic Key detected... \n\r");
                         goto rhu_exit;
                     }
 
+                    upload_offset += len;
+
+                    if(upload_offset == FLASH_META_DESC_LEN && !upload_merkle_start())
+                    {
+                        goto rhu_exit;
+                    }
                 }
+                else if(upload_leaves_received < upload_leaves_len)
+                {
+                    /* Merkle leaves are kept in RAM only */
+                    if(len > upload_leaves_len - upload_leaves_received)
+                    {
+                        len = upload_leaves_len - upload_leaves_received;
+                    }
+
+                    memcpy((uint8_t *)upload_leaves + upload_leaves_received, msg->buffer, len);
+                    upload_leaves_received += len;
 
-                /* Begin writing to flash */
-                if(!flash_write(FLASH_APP, flash_offset, msg->length, msg->buffer))
+                    if(upload_leaves_received == upload_leaves_len)
+                    {
+                        upload_merkle_leaves_done();
+                    }
+                }
+                else if(upload_delta && upload_sent_received < sizeof(upload_sent))
                 {
-                    /* Error: flash write error */
-                    flash_lock();
-                    send_failure(FailureType_Failure_FirmwareError,
-                                 "Encountered error while writing to flash");
-                    upload_state = RAW_MESSAGE_ERROR;
-                    dbg_print("Error: flash write error... \n\r");
-                    goto rhu_exit;
+                    /* Sector map of a delta image */
+                    if(len > sizeof(upload_sent) - upload_sent_received)
+                    {
+                        len = sizeof(upload_sent) - upload_sent_received;
+                    }
+
+                    memcpy((uint8_t *)&upload_sent + upload_sent_received, msg->buffer, len);
+                    upload_sent_received += len;
+
+                    if(upload_sent_received == sizeof(upload_sent) && !(upload_sent & 1))
+                    {
+                        upload_error("Not valid firmware");
+                        goto rhu_exit;
+                    }
                 }
+                else
+                {
+                    /* Code takes the rest of the message */
+                    upload_erase_app();
 
-                flash_offset += msg->length;
-            }
-            else
-            {
-                /* Error: frame overrun detected during the image update */
-                flash_lock();
-                send_failure(FailureType_Failure_FirmwareError, "Firmware too large");
-                upload_state = RAW_MESSAGE_ERROR;
-                dbg_print("Error: frame overrun detected during the image update... \n\r");
-                goto rhu_exit;
+                    if(upload_compressed ? !upload_inflate(msg->buffer, len) :
+                            !upload_code(msg->buffer, len))
+                    {
+                        goto rhu_exit;
+                    }
+                }
+
+                msg->length -= len;
+                msg->buffer += len;
+                upload_stream_len += len;
             }
 
             /* Finish firmware update */
-            if(flash_offset >= frame_length - PROTOBUF_FIRMWARE_START)
+            if(upload_stream_len >= frame_length - PROTOBUF_FIRMWARE_START)
             {
+                /* Trailing sectors of a delta image are kept */
+                if(!upload_skip_kept())
+                {
+                    goto rhu_exit;
+                }
+
+                /* Leave no code from the previous firmware behind, even if the
+                 * image had no code */
+                upload_erase_app();
+
                 flash_lock();
                 upload_state = RAW_MESSAGE_COMPLETE;
             }
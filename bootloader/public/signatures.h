@@ -28,6 +28,12 @@
 
 /* === Functions =========================================================== */
 
+void signatures_merkle_leaf(const uint8_t *chunk, uint32_t len, uint8_t *leaf);
+bool signatures_merkle_root(const uint8_t *leaves, uint32_t count, uint8_t *root);
+void signatures_merkle_digest(const uint8_t *root, uint32_t codelen, uint8_t flags,
+                              uint8_t *digest);
+bool signatures_legacy_code_ok(const uint8_t *code, uint32_t codelen);
+int signatures_verify(const uint8_t *firmware_fingerprint);
 int signatures_ok(uint8_t *store_hash);
 
 #endif
@@ -37,6 +37,11 @@
 
 #define FILL_CONFIG_DATA                0xaa
 
+/* Heatshrink parameters of compressed images */
+#define HEATSHRINK_WINDOW_BITS          11
+#define HEATSHRINK_LOOKAHEAD_BITS       4
+#define UPLOAD_HS_OUT_LEN               64
+
 /* === Typedefs ============================================================ */
 
 typedef enum 
@@ -47,6 +52,14 @@ typedef enum
     UPLOAD_ERROR
 } FirmwareUploadState;
 
+typedef enum
+{
+    HS_TAG,
+    HS_LITERAL,
+    HS_BACKREF_INDEX,
+    HS_BACKREF_COUNT
+} HeatshrinkState;
+
 /* Generic message handler callback type */
 typedef void (*message_handler_t)(void* msg_struct); 
 
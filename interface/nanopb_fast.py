@@ -0,0 +1,1005 @@
+#!/usr/bin/python
+
+"""
+Generate straight-line protocol buffer encoders/decoders for hot messages.
+
+nanopb's pb_encode()/pb_decode() walk the pb_field_t descriptor tables with a
+field iterator for every field of every message.  For the messages exchanged
+on every round trip of the signing loop that overhead dominates, so this
+script emits type specialized functions for a chosen set of messages (and
+every submessage they contain).  Their wire behaviour mirrors nanopb 0.2.9:
+fields are encoded in tag order, required fields are tracked with a bitmask,
+known fields are decoded by their declared type whatever wire type they
+arrive with, strings/bytes/arrays are bounds checked against the .options
+limits, defaults come from the constants the nanopb generator emits, and
+submessages are sized with a sizing stream before they are written.
+interface/test/nanopb_fast_test.c checks the output against pb_encode() and
+pb_decode() byte for byte.
+
+Messages that cannot be specialized (callback fields, missing limits) are
+left out and keep using the table-driven path.
+
+The input is a FileDescriptorSet produced with:
+
+    protoc --include_imports --descriptor_set_out=<file> *.proto
+
+It is parsed by hand so that the build does not depend on the python protobuf
+runtime.
+"""
+
+import argparse
+import fnmatch
+import os
+import sys
+
+# === Descriptor wire format ================================================
+
+TYPE_DOUBLE = 1
+TYPE_FLOAT = 2
+TYPE_INT64 = 3
+TYPE_UINT64 = 4
+TYPE_INT32 = 5
+TYPE_FIXED64 = 6
+TYPE_FIXED32 = 7
+TYPE_BOOL = 8
+TYPE_STRING = 9
+TYPE_GROUP = 10
+TYPE_MESSAGE = 11
+TYPE_BYTES = 12
+TYPE_UINT32 = 13
+TYPE_ENUM = 14
+TYPE_SFIXED32 = 15
+TYPE_SFIXED64 = 16
+TYPE_SINT32 = 17
+TYPE_SINT64 = 18
+
+LABEL_OPTIONAL = 1
+LABEL_REQUIRED = 2
+LABEL_REPEATED = 3
+
+def read_varint(data, pos):
+    result = 0
+    shift = 0
+
+    while True:
+        byte = data[pos]
+        pos += 1
+        result |= (byte & 0x7f) << shift
+        shift += 7
+
+        if not byte & 0x80:
+            return result, pos
+
+def parse_message(data):
+    """Split a serialized message into a {field_number: [values]} dict."""
+    data = bytearray(data)
+    fields = {}
+    pos = 0
+
+    while pos < len(data):
+        key, pos = read_varint(data, pos)
+        number = key >> 3
+        wire_type = key & 7
+
+        if wire_type == 0:
+            value, pos = read_varint(data, pos)
+        elif wire_type == 1:
+            value = bytes(data[pos:pos + 8])
+            pos += 8
+        elif wire_type == 2:
+            length, pos = read_varint(data, pos)
+            value = bytes(data[pos:pos + length])
+            pos += length
+        elif wire_type == 5:
+            value = bytes(data[pos:pos + 4])
+            pos += 4
+        else:
+            raise ValueError('Unsupported wire type %d in descriptor' % wire_type)
+
+        fields.setdefault(number, []).append(value)
+
+    return fields
+
+def get_string(fields, number, default = ''):
+    if number in fields:
+        return fields[number][-1].decode('utf-8')
+    return default
+
+def get_int(fields, number, default = 0):
+    if number in fields:
+        return fields[number][-1]
+    return default
+
+# === Model =================================================================
+
+class Field(object):
+    def __init__(self, msg, desc):
+        self.msg = msg
+        self.name = get_string(desc, 1)
+        self.number = get_int(desc, 3)
+        self.label = get_int(desc, 4)
+        self.type = get_int(desc, 5)
+        self.type_name = get_string(desc, 6)
+        self.default = get_string(desc, 7, None)
+        self.max_size = None
+        self.max_count = None
+
+class Message(object):
+    def __init__(self, full_name, cname, proto_file):
+        self.full_name = full_name
+        self.cname = cname
+        self.proto_file = proto_file
+        self.fields = []
+
+class Enum(object):
+    def __init__(self, full_name, cname):
+        self.full_name = full_name
+        self.cname = cname
+
+def collect_types(file_desc, messages, enums):
+    fname = get_string(file_desc, 1)
+    package = get_string(file_desc, 2)
+    prefix = '.' + package if package else ''
+    cprefix = package.split('.') if package else []
+
+    def add_enums(descs, scope, cscope):
+        for raw in descs:
+            desc = parse_message(raw)
+            name = get_string(desc, 1)
+            enums[scope + '.' + name] = Enum(scope + '.' + name,
+                                             '_'.join(cscope + [name]))
+
+    def add_messages(descs, scope, cscope):
+        for raw in descs:
+            desc = parse_message(raw)
+            name = get_string(desc, 1)
+            full_name = scope + '.' + name
+            msg = Message(full_name, '_'.join(cscope + [name]), fname)
+            msg.fields = sorted([Field(msg, parse_message(f)) for f in desc.get(2, [])],
+                                key = lambda f: f.number)
+            messages[full_name] = msg
+
+            add_messages(desc.get(3, []), full_name, cscope + [name])
+            add_enums(desc.get(4, []), full_name, cscope + [name])
+
+    add_messages(file_desc.get(4, []), prefix, cprefix)
+    add_enums(file_desc.get(5, []), prefix, cprefix)
+
+def read_options(paths):
+    """Parse nanopb .options files into a list of (pattern, {option: value})."""
+    options = []
+
+    for path in paths:
+        for line in open(path):
+            line = line.split('#')[0].strip()
+
+            if not line:
+                continue
+
+            parts = line.split()
+            values = {}
+
+            for part in parts[1:]:
+                if ':' in part:
+                    key, value = part.split(':', 1)
+                    values[key] = value
+
+            options.append((parts[0], values))
+
+    return options
+
+def apply_options(messages, options):
+    for msg in messages.values():
+        dotted = msg.full_name.lstrip('.')
+
+        for field in msg.fields:
+            name = dotted + '.' + field.name
+
+            for pattern, values in options:
+                if not fnmatch.fnmatchcase(name, pattern):
+                    continue
+
+                if 'max_size' in values:
+                    field.max_size = int(values['max_size'])
+                if 'max_count' in values:
+                    field.max_count = int(values['max_count'])
+
+# === Code generation =======================================================
+
+VARINT_TYPES = {
+    TYPE_INT32: 'int32_t',
+    TYPE_INT64: 'int64_t',
+    TYPE_UINT32: 'uint32_t',
+    TYPE_UINT64: 'uint64_t',
+}
+
+SVARINT_TYPES = {
+    TYPE_SINT32: 'int32_t',
+    TYPE_SINT64: 'int64_t',
+}
+
+FIXED32_TYPES = (TYPE_FIXED32, TYPE_SFIXED32, TYPE_FLOAT)
+FIXED64_TYPES = (TYPE_FIXED64, TYPE_SFIXED64, TYPE_DOUBLE)
+
+PACKABLE_TYPES = (list(VARINT_TYPES) + list(SVARINT_TYPES) + list(FIXED32_TYPES) +
+                  list(FIXED64_TYPES) + [TYPE_BOOL, TYPE_ENUM])
+
+class Generator(object):
+    def __init__(self, messages, enums):
+        self.messages = messages
+        self.enums = enums
+        self.specializable = {}
+
+    def lookup(self, name):
+        for msg in self.messages.values():
+            if msg.full_name == name or msg.full_name == '.' + name or msg.cname == name:
+                return msg
+        return None
+
+    def can_specialize(self, msg, stack = ()):
+        if msg.full_name in self.specializable:
+            return self.specializable[msg.full_name]
+
+        if msg.full_name in stack:
+            return False
+
+        # Required fields are tracked in a 32-bit mask
+        ok = len([f for f in msg.fields if f.label == LABEL_REQUIRED]) <= 32
+
+        for field in msg.fields:
+            if field.type == TYPE_GROUP:
+                ok = False
+            elif field.label == LABEL_REPEATED and not field.max_count:
+                ok = False
+            elif field.type in (TYPE_STRING, TYPE_BYTES):
+                ok = ok and bool(field.max_size)
+            elif field.type == TYPE_MESSAGE:
+                sub = self.messages.get(field.type_name)
+                ok = ok and sub is not None and \
+                     self.can_specialize(sub, stack + (msg.full_name,))
+
+        self.specializable[msg.full_name] = ok
+        return ok
+
+    def closure(self, roots):
+        """Return roots plus every nested submessage, dependencies first."""
+        order = []
+
+        def visit(msg):
+            if msg in order:
+                return
+            for field in msg.fields:
+                if field.type == TYPE_MESSAGE:
+                    visit(self.messages[field.type_name])
+            order.append(msg)
+
+        for msg in roots:
+            visit(msg)
+
+        return order
+
+    # --- Helpers -----------------------------------------------------------
+
+    def ctype(self, field):
+        if field.type in VARINT_TYPES:
+            return VARINT_TYPES[field.type]
+        if field.type in SVARINT_TYPES:
+            return SVARINT_TYPES[field.type]
+        if field.type == TYPE_BOOL:
+            return 'bool'
+        if field.type == TYPE_ENUM:
+            return self.enums[field.type_name].cname
+        if field.type == TYPE_MESSAGE:
+            return self.messages[field.type_name].cname
+        return None
+
+    def wire_type(self, field):
+        if field.type in FIXED32_TYPES:
+            return 'PB_WT_32BIT'
+        if field.type in FIXED64_TYPES:
+            return 'PB_WT_64BIT'
+        if field.type in (TYPE_STRING, TYPE_BYTES, TYPE_MESSAGE):
+            return 'PB_WT_STRING'
+        return 'PB_WT_VARINT'
+
+    # --- Init --------------------------------------------------------------
+
+    def gen_init(self, msg):
+        out = []
+        out.append('static void fast_init_%s(%s *msg)' % (msg.cname, msg.cname))
+        out.append('{')
+
+        for field in msg.fields:
+            name = 'msg->' + field.name
+
+            if field.label == LABEL_REPEATED:
+                out.append('    %s_count = 0;' % name)
+                continue
+
+            if field.label == LABEL_OPTIONAL:
+                out.append('    msg->has_%s = false;' % field.name)
+
+            if field.type == TYPE_MESSAGE:
+                out.append('    fast_init_%s(&%s);' % (self.messages[field.type_name].cname, name))
+            elif field.default is not None:
+                # The default constants emitted by the nanopb generator
+                default = '%s_%s_default' % (msg.cname, field.name)
+                if field.type == TYPE_STRING:
+                    out.append('    memcpy(%s, %s, sizeof(%s));' % (name, default, name))
+                else:
+                    out.append('    %s = %s;' % (name, default))
+            else:
+                out.append('    memset(&%s, 0, sizeof(%s));' % (name, name))
+
+        if not msg.fields:
+            out.append('    (void)msg;')
+
+        out.append('}')
+        return out
+
+    # --- Decode ------------------------------------------------------------
+
+    def decode_value(self, field, stream, dest, indent):
+        """Lines decoding one value of field from stream into lvalue dest."""
+        pad = ' ' * indent
+        out = []
+
+        if field.type in VARINT_TYPES or field.type in (TYPE_BOOL, TYPE_ENUM):
+            out.append(pad + 'if(!pb_decode_varint(%s, &value))' % stream)
+            out.append(pad + '{')
+            out.append(pad + '    return(false);')
+            out.append(pad + '}')
+            if field.type in (TYPE_INT32, TYPE_INT64, TYPE_BOOL, TYPE_ENUM):
+                # Stored through the signed integer of the field's size, as pb_dec_varint()
+                out.append(pad + 'fast_store_varint(&%s, sizeof(%s), value);' % (dest, dest))
+            else:
+                out.append(pad + '%s = (%s)value;' % (dest, self.ctype(field)))
+        elif field.type in SVARINT_TYPES:
+            out.append(pad + 'if(!pb_decode_svarint(%s, &svalue))' % stream)
+            out.append(pad + '{')
+            out.append(pad + '    return(false);')
+            out.append(pad + '}')
+            out.append(pad + '%s = (%s)svalue;' % (dest, self.ctype(field)))
+        elif field.type in FIXED32_TYPES:
+            out.append(pad + 'if(!pb_decode_fixed32(%s, &%s))' % (stream, dest))
+            out.append(pad + '{')
+            out.append(pad + '    return(false);')
+            out.append(pad + '}')
+        elif field.type in FIXED64_TYPES:
+            out.append(pad + 'if(!pb_decode_fixed64(%s, &%s))' % (stream, dest))
+            out.append(pad + '{')
+            out.append(pad + '    return(false);')
+            out.append(pad + '}')
+        elif field.type == TYPE_STRING:
+            out.append(pad + 'if(!fast_decode_string(%s, %s, sizeof(%s)))' % (stream, dest, dest))
+            out.append(pad + '{')
+            out.append(pad + '    return(false);')
+            out.append(pad + '}')
+        elif field.type == TYPE_BYTES:
+            out.append(pad + 'if(!fast_decode_bytes(%s, &%s.size, %s.bytes, FAST_BYTES_MAX(%s)))'
+                       % (stream, dest, dest, dest))
+            out.append(pad + '{')
+            out.append(pad + '    return(false);')
+            out.append(pad + '}')
+        elif field.type == TYPE_MESSAGE:
+            sub = self.messages[field.type_name]
+            if field.label == LABEL_REPEATED:
+                out.append(pad + 'fast_init_%s(&%s);' % (sub.cname, dest))
+            out.append(pad + 'if(!fast_decode_submessage(%s, fast_decode_%s, &%s))'
+                       % (stream, sub.cname, dest))
+            out.append(pad + '{')
+            out.append(pad + '    return(false);')
+            out.append(pad + '}')
+
+        return out
+
+    def gen_decode(self, msg):
+        required = [f for f in msg.fields if f.label == LABEL_REQUIRED]
+        uses_value = any(f.type in VARINT_TYPES or f.type in (TYPE_BOOL, TYPE_ENUM)
+                         for f in msg.fields)
+        uses_svalue = any(f.type in SVARINT_TYPES for f in msg.fields)
+        uses_packed = any(f.label == LABEL_REPEATED and f.type in PACKABLE_TYPES
+                          for f in msg.fields)
+
+        out = []
+        out.append('static bool fast_decode_%s(pb_istream_t *stream, void *dest)' % msg.cname)
+        out.append('{')
+        out.append('    %s *msg = (%s *)dest;' % (msg.cname, msg.cname))
+        out.append('    pb_wire_type_t wire_type;')
+        out.append('    uint32_t tag;')
+        out.append('    bool eof;')
+        if required:
+            out.append('    uint32_t required = 0;')
+        if uses_value:
+            out.append('    uint64_t value;')
+        if uses_svalue:
+            out.append('    int64_t svalue;')
+        if uses_packed:
+            out.append('    pb_istream_t substream;')
+        out.append('')
+        out.append('    while(stream->bytes_left)')
+        out.append('    {')
+        out.append('        if(!pb_decode_tag(stream, &wire_type, &tag, &eof))')
+        out.append('        {')
+        out.append('            if(eof)')
+        out.append('            {')
+        out.append('                break;')
+        out.append('            }')
+        out.append('')
+        out.append('            return(false);')
+        out.append('        }')
+        out.append('')
+        out.append('        switch(tag)')
+        out.append('        {')
+
+        for field in msg.fields:
+            name = 'msg->' + field.name
+
+            out.append('            case %d: /* %s */' % (field.number, field.name))
+
+            if field.label == LABEL_REPEATED:
+                item = '%s[%s_count]' % (name, name)
+
+                if field.type in PACKABLE_TYPES:
+                    out.append('                if(wire_type == PB_WT_STRING)')
+                    out.append('                {')
+                    out.append('                    if(!pb_make_string_substream(stream, &substream))')
+                    out.append('                    {')
+                    out.append('                        return(false);')
+                    out.append('                    }')
+                    out.append('')
+                    out.append('                    while(substream.bytes_left > 0 &&')
+                    out.append('                          %s_count < %d)' % (name, field.max_count))
+                    out.append('                    {')
+                    out += self.decode_value(field, '&substream', item, 24)
+                    out.append('                        %s_count++;' % name)
+                    out.append('                    }')
+                    out.append('')
+                    out.append('                    pb_close_string_substream(stream, &substream);')
+                    out.append('')
+                    out.append('                    if(substream.bytes_left != 0)')
+                    out.append('                    {')
+                    out.append('                        PB_RETURN_ERROR(stream, "array overflow");')
+                    out.append('                    }')
+                    out.append('')
+                    out.append('                    break;')
+                    out.append('                }')
+                    out.append('')
+
+                out.append('                if(%s_count >= %d)' % (name, field.max_count))
+                out.append('                {')
+                out.append('                    PB_RETURN_ERROR(stream, "array overflow");')
+                out.append('                }')
+                out.append('')
+                out += self.decode_value(field, 'stream', item, 16)
+                out.append('                %s_count++;' % name)
+            else:
+                out += self.decode_value(field, 'stream', name, 16)
+
+                if field.label == LABEL_OPTIONAL:
+                    out.append('                msg->has_%s = true;' % field.name)
+                else:
+                    out.append('                required |= 1u << %d;' % required.index(field))
+
+            out.append('                break;')
+            out.append('')
+
+        out.append('            default:')
+        out.append('                if(!pb_skip_field(stream, wire_type))')
+        out.append('                {')
+        out.append('                    return(false);')
+        out.append('                }')
+        out.append('')
+        out.append('                break;')
+        out.append('        }')
+        out.append('    }')
+        out.append('')
+
+        if required:
+            mask = (1 << len(required)) - 1
+            out.append('    if(required != 0x%xu)' % mask)
+            out.append('    {')
+            out.append('        PB_RETURN_ERROR(stream, "missing required field");')
+            out.append('    }')
+            out.append('')
+
+        out.append('    return(true);')
+        out.append('}')
+        return out
+
+    # --- Encode ------------------------------------------------------------
+
+    def encode_value(self, field, src, indent):
+        """Lines encoding one value (without tag) of field from src."""
+        pad = ' ' * indent
+
+        if field.type in (TYPE_INT32, TYPE_INT64, TYPE_BOOL, TYPE_ENUM):
+            call = 'pb_encode_varint(stream, (uint64_t)fast_load_varint(&%s, sizeof(%s)))' % (src, src)
+        elif field.type in (TYPE_UINT32, TYPE_UINT64):
+            call = 'pb_encode_varint(stream, (uint64_t)%s)' % src
+        elif field.type in SVARINT_TYPES:
+            call = 'pb_encode_svarint(stream, (int64_t)%s)' % src
+        elif field.type in FIXED32_TYPES:
+            call = 'pb_encode_fixed32(stream, &%s)' % src
+        elif field.type in FIXED64_TYPES:
+            call = 'pb_encode_fixed64(stream, &%s)' % src
+        elif field.type == TYPE_STRING:
+            call = 'fast_encode_string(stream, %s, sizeof(%s))' % (src, src)
+        elif field.type == TYPE_BYTES:
+            call = 'fast_encode_bytes(stream, %s.size, %s.bytes, FAST_BYTES_MAX(%s))' % (src, src, src)
+        else:
+            call = 'fast_encode_submessage(stream, fast_encode_%s, &%s)' % (
+                self.messages[field.type_name].cname, src)
+
+        return [pad + 'if(!%s)' % call,
+                pad + '{',
+                pad + '    return(false);',
+                pad + '}']
+
+    def encode_tag(self, field, wire, indent):
+        pad = ' ' * indent
+        return [pad + 'if(!pb_encode_tag(stream, %s, %d))' % (wire, field.number),
+                pad + '{',
+                pad + '    return(false);',
+                pad + '}']
+
+    def gen_encode(self, msg):
+        # Like nanopb, arrays are always packed when the type allows it
+        packed = [f for f in msg.fields if f.label == LABEL_REPEATED and
+                  f.type in PACKABLE_TYPES]
+        sized = [f for f in packed if f.type not in FIXED32_TYPES + FIXED64_TYPES]
+        repeated = [f for f in msg.fields if f.label == LABEL_REPEATED]
+
+        out = []
+        out.append('static bool fast_encode_%s(pb_ostream_t *stream, const void *src)' % msg.cname)
+        out.append('{')
+        out.append('    const %s *msg = (const %s *)src;' % (msg.cname, msg.cname))
+        if repeated:
+            out.append('    size_t i;')
+        if sized:
+            out.append('    pb_ostream_t sizestream;')
+        if packed:
+            out.append('    size_t size;')
+        out.append('')
+
+        for field in msg.fields:
+            name = 'msg->' + field.name
+            out.append('    /* %s */' % field.name)
+
+            if field.label == LABEL_REPEATED:
+                out.append('    if(%s_count > %d)' % (name, field.max_count))
+                out.append('    {')
+                out.append('        PB_RETURN_ERROR(stream, "array max size exceeded");')
+                out.append('    }')
+                out.append('')
+
+                if field in packed:
+                    out.append('    if(%s_count > 0)' % name)
+                    out.append('    {')
+                    out += self.encode_tag(field, 'PB_WT_STRING', 8)
+                    out.append('')
+                    if field in sized:
+                        out.append('        sizestream = (pb_ostream_t)PB_OSTREAM_SIZING;')
+                        out.append('')
+                        out.append('        for(i = 0; i < %s_count; i++)' % name)
+                        out.append('        {')
+                        out += [l.replace('(stream,', '(&sizestream,')
+                                for l in self.encode_value(field, '%s[i]' % name, 12)]
+                        out.append('        }')
+                        out.append('')
+                        out.append('        size = sizestream.bytes_written;')
+                    else:
+                        width = 4 if field.type in FIXED32_TYPES else 8
+                        out.append('        size = %d * %s_count;' % (width, name))
+                    out.append('')
+                    out.append('        if(!pb_encode_varint(stream, (uint64_t)size))')
+                    out.append('        {')
+                    out.append('            return(false);')
+                    out.append('        }')
+                    out.append('')
+                    out.append('        if(stream->callback == NULL)')
+                    out.append('        {')
+                    out.append('            if(!pb_write(stream, NULL, size))')
+                    out.append('            {')
+                    out.append('                return(false);')
+                    out.append('            }')
+                    out.append('        }')
+                    out.append('        else')
+                    out.append('        {')
+                    out.append('            for(i = 0; i < %s_count; i++)' % name)
+                    out.append('            {')
+                    out += self.encode_value(field, '%s[i]' % name, 16)
+                    out.append('            }')
+                    out.append('        }')
+                    out.append('    }')
+                else:
+                    out.append('    for(i = 0; i < %s_count; i++)' % name)
+                    out.append('    {')
+                    out += self.encode_tag(field, self.wire_type(field), 8)
+                    out.append('')
+                    out += self.encode_value(field, '%s[i]' % name, 8)
+                    out.append('    }')
+            elif field.label == LABEL_OPTIONAL:
+                out.append('    if(msg->has_%s)' % field.name)
+                out.append('    {')
+                out += self.encode_tag(field, self.wire_type(field), 8)
+                out.append('')
+                out += self.encode_value(field, name, 8)
+                out.append('    }')
+            else:
+                out += self.encode_tag(field, self.wire_type(field), 4)
+                out.append('')
+                out += self.encode_value(field, name, 4)
+
+            out.append('')
+
+        out.append('    return(true);')
+        out.append('}')
+        return out
+
+    # --- Top level ---------------------------------------------------------
+
+    def gen_entry(self, msg):
+        out = []
+        out.append('static bool fast_pb_decode_%s(pb_istream_t *stream, void *dest)' % msg.cname)
+        out.append('{')
+        out.append('    fast_init_%s((%s *)dest);' % (msg.cname, msg.cname))
+        out.append('    return(fast_decode_%s(stream, dest));' % msg.cname)
+        out.append('}')
+        return out
+
+    def generate(self, basename, roots):
+        hot = [m for m in roots if self.can_specialize(m)]
+        skipped = [m for m in roots if m not in hot]
+        order = self.closure(hot)
+        includes = []
+
+        for msg in order:
+            header = os.path.splitext(os.path.basename(msg.proto_file))[0] + '.pb.h'
+            if header not in includes:
+                includes.append(header)
+
+        guard = basename.upper().replace('.', '_') + '_PB_H'
+
+        h = []
+        h.append('/* Automatically generated by nanopb_fast.py.  Do not edit. */')
+        h.append('')
+        h.append('#ifndef %s' % guard)
+        h.append('#define %s' % guard)
+        h.append('')
+        h.append('#include <pb.h>')
+        h.append('#include <pb_encode.h>')
+        h.append('#include <pb_decode.h>')
+        for header in includes:
+            h.append('#include "%s"' % header)
+        h.append('')
+        h.append('/* Specialized codec for one message, keyed by its nanopb field table */')
+        h.append('typedef struct')
+        h.append('{')
+        h.append('    const pb_field_t *fields;')
+        h.append('    bool (*decode)(pb_istream_t *stream, void *dest);')
+        h.append('    bool (*encode)(pb_ostream_t *stream, const void *src);')
+        h.append('} pb_fast_codec_t;')
+        h.append('')
+        h.append('const pb_fast_codec_t *pb_fast_codec(const pb_field_t fields[]);')
+        h.append('')
+        h.append('#endif')
+
+        c = []
+        c.append('/* Automatically generated by nanopb_fast.py.  Do not edit. */')
+        c.append('')
+        c.append('#include <stddef.h>')
+        c.append('#include <string.h>')
+        c.append('#include "%s.pb.h"' % basename)
+        c.append('')
+        for msg in skipped:
+            c.append('/* %s uses the table-driven codec (not specializable) */' % msg.cname)
+        if skipped:
+            c.append('')
+        c.append(HELPERS)
+
+        for msg in order:
+            c.append('static void fast_init_%s(%s *msg);' % (msg.cname, msg.cname))
+            c.append('static bool fast_decode_%s(pb_istream_t *stream, void *dest);' % msg.cname)
+            c.append('static bool fast_encode_%s(pb_ostream_t *stream, const void *src);' % msg.cname)
+        c.append('')
+
+        for msg in order:
+            c += self.gen_init(msg)
+            c.append('')
+            c += self.gen_decode(msg)
+            c.append('')
+            c += self.gen_encode(msg)
+            c.append('')
+
+        for msg in hot:
+            c += self.gen_entry(msg)
+            c.append('')
+
+        c.append('static const pb_fast_codec_t fast_codecs[] =')
+        c.append('{')
+        for msg in hot:
+            c.append('    { %s_fields, fast_pb_decode_%s, fast_encode_%s },'
+                     % (msg.cname, msg.cname, msg.cname))
+        c.append('    { NULL, NULL, NULL }')
+        c.append('};')
+        c.append('')
+        c.append('const pb_fast_codec_t *pb_fast_codec(const pb_field_t fields[])')
+        c.append('{')
+        c.append('    const pb_fast_codec_t *codec;')
+        c.append('')
+        c.append('    for(codec = fast_codecs; codec->fields != NULL; codec++)')
+        c.append('    {')
+        c.append('        if(codec->fields == fields)')
+        c.append('        {')
+        c.append('            return(codec);')
+        c.append('        }')
+        c.append('    }')
+        c.append('')
+        c.append('    return(NULL);')
+        c.append('}')
+
+        return '\n'.join(h) + '\n', '\n'.join(c) + '\n'
+
+HELPERS = '''/* Bytes capacity as nanopb computes it, including any tail padding of the struct */
+#define FAST_BYTES_MAX(field) (sizeof(field) - offsetof(pb_bytes_array_t, bytes))
+
+/* Same truncation and overflow rules as nanopb's private pb_decode_varint32() */
+static bool fast_decode_varint32(pb_istream_t *stream, uint32_t *dest)
+{
+    uint8_t byte;
+    uint8_t bitpos = 7;
+    uint32_t result;
+
+    if(!pb_read(stream, &byte, 1))
+    {
+        return(false);
+    }
+
+    result = byte & 0x7F;
+
+    while(byte & 0x80)
+    {
+        if(bitpos >= 32)
+        {
+            PB_RETURN_ERROR(stream, "varint overflow");
+        }
+
+        if(!pb_read(stream, &byte, 1))
+        {
+            return(false);
+        }
+
+        result |= (uint32_t)(byte & 0x7F) << bitpos;
+        bitpos = (uint8_t)(bitpos + 7);
+    }
+
+    *dest = result;
+    return(true);
+}
+
+/* int32/int64/bool/enum values, stored and loaded like pb_dec_varint()/pb_enc_varint() */
+static inline void fast_store_varint(void *dest, size_t size, uint64_t value)
+{
+    switch(size)
+    {
+        case 1:
+            *(int8_t *)dest = (int8_t)value;
+            break;
+
+        case 2:
+            *(int16_t *)dest = (int16_t)value;
+            break;
+
+        case 4:
+            *(int32_t *)dest = (int32_t)value;
+            break;
+
+        default:
+            *(int64_t *)dest = (int64_t)value;
+            break;
+    }
+}
+
+static inline int64_t fast_load_varint(const void *src, size_t size)
+{
+    switch(size)
+    {
+        case 1:
+            return(*(const int8_t *)src);
+
+        case 2:
+            return(*(const int16_t *)src);
+
+        case 4:
+            return(*(const int32_t *)src);
+
+        default:
+            return(*(const int64_t *)src);
+    }
+}
+
+static bool fast_decode_string(pb_istream_t *stream, char *dest, size_t max)
+{
+    uint32_t size;
+    bool status;
+
+    if(!fast_decode_varint32(stream, &size))
+    {
+        return(false);
+    }
+
+    /* Space for null terminator */
+    if(size >= max)
+    {
+        PB_RETURN_ERROR(stream, "string overflow");
+    }
+
+    status = pb_read(stream, (uint8_t *)dest, size);
+    dest[size] = 0;
+    return(status);
+}
+
+static bool fast_decode_bytes(pb_istream_t *stream, size_t *size, uint8_t *dest, size_t max)
+{
+    uint32_t len;
+
+    if(!fast_decode_varint32(stream, &len))
+    {
+        return(false);
+    }
+
+    if(len > max)
+    {
+        PB_RETURN_ERROR(stream, "bytes overflow");
+    }
+
+    *size = len;
+    return(pb_read(stream, dest, len));
+}
+
+static bool fast_decode_submessage(pb_istream_t *stream,
+                                   bool (*decode)(pb_istream_t *, void *), void *dest)
+{
+    pb_istream_t substream;
+    bool status;
+
+    if(!pb_make_string_substream(stream, &substream))
+    {
+        return(false);
+    }
+
+    status = decode(&substream, dest);
+    pb_close_string_substream(stream, &substream);
+    return(status);
+}
+
+static bool fast_encode_string(pb_ostream_t *stream, const char *src, size_t max)
+{
+    size_t size = 0;
+
+    while(size < max && src[size] != '\\0')
+    {
+        size++;
+    }
+
+    return(pb_encode_string(stream, (const uint8_t *)src, size));
+}
+
+static bool fast_encode_bytes(pb_ostream_t *stream, size_t size, const uint8_t *src,
+                              size_t max)
+{
+    if(size > max)
+    {
+        PB_RETURN_ERROR(stream, "bytes size exceeded");
+    }
+
+    return(pb_encode_string(stream, src, size));
+}
+
+static bool fast_encode_submessage(pb_ostream_t *stream,
+                                   bool (*encode)(pb_ostream_t *, const void *),
+                                   const void *src)
+{
+    /* First calculate the message size using a non-writing substream. */
+    pb_ostream_t substream = PB_OSTREAM_SIZING;
+    size_t size;
+    bool status;
+
+    if(!encode(&substream, src))
+    {
+#ifndef PB_NO_ERRMSG
+        stream->errmsg = substream.errmsg;
+#endif
+        return(false);
+    }
+
+    size = substream.bytes_written;
+
+    if(!pb_encode_varint(stream, (uint64_t)size))
+    {
+        return(false);
+    }
+
+    if(stream->callback == NULL)
+    {
+        return(pb_write(stream, NULL, size)); /* Just sizing */
+    }
+
+    if(stream->bytes_written + size > stream->max_size)
+    {
+        PB_RETURN_ERROR(stream, "stream full");
+    }
+
+    substream.callback = stream->callback;
+    substream.state = stream->state;
+    substream.max_size = size;
+    substream.bytes_written = 0;
+#ifndef PB_NO_ERRMSG
+    substream.errmsg = NULL;
+#endif
+
+    status = encode(&substream, src);
+
+    stream->bytes_written += substream.bytes_written;
+    stream->state = substream.state;
+#ifndef PB_NO_ERRMSG
+    stream->errmsg = substream.errmsg;
+#endif
+
+    if(substream.bytes_written != size)
+    {
+        PB_RETURN_ERROR(stream, "submsg size changed");
+    }
+
+    return(status);
+}
+'''
+
+# === Main ==================================================================
+
+def main():
+    parser = argparse.ArgumentParser(description = 'Generate specialized nanopb codecs.')
+    parser.add_argument('-o', '--output', help = 'Output base name (<output>.pb.c/.pb.h).',
+                        required = True)
+    parser.add_argument('-m', '--messages', help = 'Comma separated list of hot messages.',
+                        required = True)
+    parser.add_argument('descriptor', help = 'FileDescriptorSet from protoc --descriptor_set_out.')
+    parser.add_argument('options', nargs = '*', help = 'nanopb .options files.')
+    args = parser.parse_args()
+
+    with open(args.descriptor, 'rb') as f:
+        fdset = parse_message(f.read())
+
+    messages = {}
+    enums = {}
+
+    for raw in fdset.get(1, []):
+        collect_types(parse_message(raw), messages, enums)
+
+    apply_options(messages, read_options(args.options))
+
+    gen = Generator(messages, enums)
+    roots = []
+
+    for name in args.messages.split(','):
+        msg = gen.lookup(name.strip())
+
+        if msg is None:
+            sys.stderr.write('nanopb_fast: unknown message %s\n' % name)
+            return 1
+
+        roots.append(msg)
+
+    header, source = gen.generate(args.output, roots)
+
+    with open(args.output + '.pb.h', 'w') as f:
+        f.write(header)
+
+    with open(args.output + '.pb.c', 'w') as f:
+        f.write(source)
+
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -21,6 +21,7 @@
 #define INTERFACE_H
 
 #include "messages.pb.h"
+#include "messages_fast.pb.h"
 #include "storage.pb.h"
 #include "types.pb.h"
 #include "trezor_transport.h"
@@ -0,0 +1,781 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host test for the codecs generated by interface/nanopb_fast.py.
+ *
+ * Every specialized message is round tripped through both pb_fast_codec()
+ * and pb_encode()/pb_decode().  Encoded bytes must be identical, and decoding
+ * must agree on success/failure and on the resulting struct.  Decoder inputs
+ * include valid encodings, truncations, bit flips and generated streams with
+ * unknown fields, wire type mismatches, invalid wire types, overlong varints
+ * and length prefixes around the .options limits.
+ *
+ * Built and run on the build host by the "b" helper script.
+ */
+
+/* === Includes ============================================================ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <pb.h>
+#include <pb_encode.h>
+#include <pb_decode.h>
+
+#include "messages_fast.pb.h"
+
+/* === Private Variables =================================================== */
+
+#define ITERATIONS      20000
+#define MAX_DEPTH       4
+#define STREAM_SIZE     (64 * 1024)
+
+typedef struct
+{
+    const char *name;
+    const pb_field_t *fields;
+    size_t size;
+} TestMessage;
+
+#define TEST_MESSAGE(msg) { #msg, msg##_fields, sizeof(msg) }
+
+static const TestMessage test_messages[] =
+{
+    TEST_MESSAGE(TxAck),
+    TEST_MESSAGE(TxRequest),
+    TEST_MESSAGE(EthereumTxAck),
+    TEST_MESSAGE(EthereumTxRequest),
+    TEST_MESSAGE(Address)
+};
+
+static uint32_t rng_state = 0x4b4b4b4b;
+static unsigned int failures;
+
+static uint8_t input[STREAM_SIZE];
+static uint8_t output_slow[STREAM_SIZE];
+static uint8_t output_fast[STREAM_SIZE];
+
+/* === Private Functions =================================================== */
+
+/*
+ * rnd() - Deterministic xorshift generator
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     next pseudo random value
+ */
+static uint32_t rnd(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return(rng_state);
+}
+
+static uint32_t rnd_below(uint32_t n)
+{
+    return(n ? rnd() % n : 0);
+}
+
+static bool chance(uint32_t percent)
+{
+    return(rnd_below(100) < percent);
+}
+
+/* Random 64 bit value with a random bit width, so short varints are common */
+static uint64_t rnd_value(void)
+{
+    uint64_t value = ((uint64_t)rnd() << 32) | rnd();
+    unsigned int bits = rnd_below(65);
+
+    return(bits == 64 ? value : value & (((uint64_t)1 << bits) - 1));
+}
+
+/* === Field walking ======================================================= */
+
+/*
+ * Mirrors nanopb's field iterator: each field's data is found relative to
+ * the previous field's data, its has/count member relative to its own data.
+ */
+typedef struct
+{
+    const pb_field_t *field;
+    uint8_t *data;
+    void *size;
+} FieldPos;
+
+static bool field_first(const pb_field_t *fields, void *msg, FieldPos *pos)
+{
+    pos->field = fields;
+    pos->data = (uint8_t *)msg + fields->data_offset;
+    pos->size = pos->data + fields->size_offset;
+    return(fields->tag != 0);
+}
+
+static bool field_next(FieldPos *pos)
+{
+    const pb_field_t *prev = pos->field;
+    size_t prev_size = prev->data_size;
+
+    if(PB_ATYPE(prev->type) == PB_ATYPE_STATIC &&
+            PB_HTYPE(prev->type) == PB_HTYPE_REPEATED)
+    {
+        prev_size *= prev->array_size;
+    }
+
+    pos->field++;
+    pos->data += prev_size + pos->field->data_offset;
+    pos->size = pos->data + pos->field->size_offset;
+    return(pos->field->tag != 0);
+}
+
+static size_t bytes_max(const pb_field_t *field)
+{
+    return(field->data_size - offsetof(pb_bytes_array_t, bytes));
+}
+
+static const pb_field_t *find_field(const pb_field_t *fields, uint32_t tag)
+{
+    for(; fields->tag != 0; fields++)
+    {
+        if(fields->tag == tag)
+        {
+            return(fields);
+        }
+    }
+
+    return(NULL);
+}
+
+/* === Random structs ====================================================== */
+
+static void fill_message(const pb_field_t *fields, void *msg, unsigned int depth);
+
+static void fill_value(const pb_field_t *field, uint8_t *data, unsigned int depth)
+{
+    uint64_t value = rnd_value();
+    size_t i, len;
+
+    switch(PB_LTYPE(field->type))
+    {
+        case PB_LTYPE_VARINT:
+            if(field->data_size == 1)
+            {
+                /* bool */
+                value &= 1;
+            }
+        /* fall through */
+        case PB_LTYPE_UVARINT:
+        case PB_LTYPE_SVARINT:
+        case PB_LTYPE_FIXED32:
+        case PB_LTYPE_FIXED64:
+            memcpy(data, &value, field->data_size);
+            break;
+
+        case PB_LTYPE_BYTES:
+        {
+            pb_bytes_array_t *bytes = (pb_bytes_array_t *)data;
+
+            len = rnd_below(bytes_max(field) + 1);
+
+            /* Occasionally claim more than fits to exercise the size check */
+            bytes->size = chance(2) ? bytes_max(field) + 1 + rnd_below(4) : len;
+
+            for(i = 0; i < len; i++)
+            {
+                bytes->bytes[i] = (uint8_t)rnd();
+            }
+
+            break;
+        }
+
+        case PB_LTYPE_STRING:
+            len = rnd_below(field->data_size);
+
+            for(i = 0; i < len; i++)
+            {
+                data[i] = (uint8_t)(' ' + rnd_below(95));
+            }
+
+            data[len] = '\0';
+
+            /* Occasionally leave the buffer unterminated */
+            if(chance(3))
+            {
+                memset(data, 'x', field->data_size);
+            }
+
+            break;
+
+        case PB_LTYPE_SUBMESSAGE:
+            fill_message((const pb_field_t *)field->ptr, data, depth + 1);
+            break;
+    }
+}
+
+static void fill_message(const pb_field_t *fields, void *msg, unsigned int depth)
+{
+    FieldPos pos;
+    size_t i, count;
+
+    if(!field_first(fields, msg, &pos))
+    {
+        return;
+    }
+
+    do
+    {
+        const pb_field_t *field = pos.field;
+
+        switch(PB_HTYPE(field->type))
+        {
+            case PB_HTYPE_REQUIRED:
+                fill_value(field, pos.data, depth);
+                break;
+
+            case PB_HTYPE_OPTIONAL:
+                *(bool *)pos.size = depth < MAX_DEPTH && chance(60);
+                fill_value(field, pos.data, depth);
+                break;
+
+            case PB_HTYPE_REPEATED:
+                count = depth < MAX_DEPTH ? rnd_below(field->array_size + 1) : 0;
+
+                if(count > 2 && chance(50))
+                {
+                    /* Keep large messages the exception */
+                    count = rnd_below(3);
+                }
+
+                for(i = 0; i < count; i++)
+                {
+                    fill_value(field, pos.data + i * field->data_size, depth);
+                }
+
+                /* Occasionally overflow the array to exercise the count check */
+                *(size_t *)pos.size = chance(1) ? (size_t)field->array_size + 1 : count;
+                break;
+        }
+    } while(field_next(&pos));
+}
+
+/* === Struct comparison =================================================== */
+
+static bool equal_message(const pb_field_t *fields, void *a, void *b);
+
+static bool equal_value(const pb_field_t *field, uint8_t *a, uint8_t *b)
+{
+    switch(PB_LTYPE(field->type))
+    {
+        case PB_LTYPE_BYTES:
+        {
+            const pb_bytes_array_t *x = (const pb_bytes_array_t *)a;
+            const pb_bytes_array_t *y = (const pb_bytes_array_t *)b;
+
+            return(x->size == y->size && memcmp(x->bytes, y->bytes, x->size) == 0);
+        }
+
+        case PB_LTYPE_STRING:
+            return(strncmp((const char *)a, (const char *)b, field->data_size) == 0);
+
+        case PB_LTYPE_SUBMESSAGE:
+            return(equal_message((const pb_field_t *)field->ptr, a, b));
+
+        default:
+            return(memcmp(a, b, field->data_size) == 0);
+    }
+}
+
+/* Compares what a decoder defines: has flags, counts, values and defaults */
+static bool equal_message(const pb_field_t *fields, void *a, void *b)
+{
+    FieldPos pa, pb;
+    size_t i, count;
+
+    if(!field_first(fields, a, &pa))
+    {
+        return(true);
+    }
+
+    field_first(fields, b, &pb);
+
+    do
+    {
+        const pb_field_t *field = pa.field;
+
+        switch(PB_HTYPE(field->type))
+        {
+            case PB_HTYPE_OPTIONAL:
+                if(*(bool *)pa.size != *(bool *)pb.size)
+                {
+                    return(false);
+                }
+
+            /* fall through */
+            case PB_HTYPE_REQUIRED:
+                if(!equal_value(field, pa.data, pb.data))
+                {
+                    return(false);
+                }
+
+                break;
+
+            case PB_HTYPE_REPEATED:
+                count = *(size_t *)pa.size;
+
+                if(count != *(size_t *)pb.size)
+                {
+                    return(false);
+                }
+
+                for(i = 0; i < count; i++)
+                {
+                    if(!equal_value(field, pa.data + i * field->data_size,
+                                    pb.data + i * field->data_size))
+                    {
+                        return(false);
+                    }
+                }
+
+                break;
+        }
+
+        field_next(&pb);
+    } while(field_next(&pa));
+
+    return(true);
+}
+
+/* === Random streams ====================================================== */
+
+typedef struct
+{
+    uint8_t *buf;
+    size_t len;
+    size_t max;
+} Writer;
+
+static void put_byte(Writer *w, uint8_t byte)
+{
+    if(w->len < w->max)
+    {
+        w->buf[w->len++] = byte;
+    }
+}
+
+static void put_varint(Writer *w, uint64_t value)
+{
+    while(value >= 0x80)
+    {
+        put_byte(w, (uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+
+    put_byte(w, (uint8_t)value);
+}
+
+static void put_random_varint(Writer *w)
+{
+    unsigned int i;
+
+    if(chance(3))
+    {
+        /* Overlong: more continuation bytes than any varint may have */
+        for(i = 0; i < 11; i++)
+        {
+            put_byte(w, 0x80 | (uint8_t)rnd());
+        }
+
+        put_byte(w, 0x01);
+    }
+    else
+    {
+        put_varint(w, rnd_value());
+    }
+}
+
+static void put_random_bytes(Writer *w, size_t len)
+{
+    while(len--)
+    {
+        put_byte(w, (uint8_t)rnd());
+    }
+}
+
+/* Length prefix near the limit of a string/bytes field */
+static size_t random_length(const pb_field_t *field)
+{
+    size_t limit = 8;
+
+    if(field && PB_LTYPE(field->type) == PB_LTYPE_BYTES)
+    {
+        limit = bytes_max(field);
+    }
+    else if(field && PB_LTYPE(field->type) == PB_LTYPE_STRING)
+    {
+        limit = field->data_size - 1;
+    }
+
+    if(chance(40) && limit > 0)
+    {
+        return(limit - 1 + rnd_below(3));
+    }
+
+    return(rnd_below(limit + 2));
+}
+
+static void gen_message(Writer *w, const pb_field_t *fields, unsigned int depth);
+
+/* Writes a length delimited payload, sometimes with a lying length prefix */
+static void put_delimited(Writer *w, const pb_field_t *field, unsigned int depth)
+{
+    uint8_t payload[STREAM_SIZE / 4];
+    Writer sub = { payload, 0, sizeof(payload) };
+    unsigned int i, n;
+
+    if(field && PB_LTYPE(field->type) == PB_LTYPE_SUBMESSAGE && depth < MAX_DEPTH)
+    {
+        gen_message(&sub, (const pb_field_t *)field->ptr, depth + 1);
+    }
+    else if(field && PB_LTYPE(field->type) <= PB_LTYPE_LAST_PACKABLE)
+    {
+        /* Packed array */
+        n = rnd_below(field->array_size + 3);
+
+        for(i = 0; i < n; i++)
+        {
+            switch(PB_LTYPE(field->type))
+            {
+                case PB_LTYPE_FIXED32:
+                    put_random_bytes(&sub, 4);
+                    break;
+
+                case PB_LTYPE_FIXED64:
+                    put_random_bytes(&sub, 8);
+                    break;
+
+                default:
+                    put_random_varint(&sub);
+                    break;
+            }
+        }
+
+        if(chance(10))
+        {
+            put_byte(&sub, 0x80);
+        }
+    }
+    else
+    {
+        put_random_bytes(&sub, random_length(field));
+    }
+
+    if(chance(3))
+    {
+        /* Length beyond 32 bits */
+        put_varint(w, ((uint64_t)1 << 32) + sub.len);
+    }
+    else if(chance(3))
+    {
+        put_varint(w, sub.len + 1 + rnd_below(16));
+    }
+    else
+    {
+        put_varint(w, sub.len);
+    }
+
+    for(i = 0; i < sub.len; i++)
+    {
+        put_byte(w, payload[i]);
+    }
+}
+
+static uint8_t natural_wire_type(const pb_field_t *field)
+{
+    switch(PB_LTYPE(field->type))
+    {
+        case PB_LTYPE_VARINT:
+        case PB_LTYPE_UVARINT:
+        case PB_LTYPE_SVARINT:
+            return(PB_WT_VARINT);
+
+        case PB_LTYPE_FIXED32:
+            return(PB_WT_32BIT);
+
+        case PB_LTYPE_FIXED64:
+            return(PB_WT_64BIT);
+
+        default:
+            return(PB_WT_STRING);
+    }
+}
+
+/*
+ * gen_message() - Writes a random stream of fields for a message: mostly its
+ * own tags with their natural wire type, plus mismatched wire types, unknown
+ * tags, invalid wire types and the occasional zero tag
+ */
+static void gen_message(Writer *w, const pb_field_t *fields, unsigned int depth)
+{
+    static const uint8_t wire_types[] = { PB_WT_VARINT, PB_WT_64BIT, PB_WT_STRING, PB_WT_32BIT };
+    static const uint8_t invalid_wire_types[] = { 3, 4, 6, 7 };
+    unsigned int nfields = 0, n, i;
+    const pb_field_t *field;
+    uint32_t tag;
+    uint8_t wire_type;
+
+    for(field = fields; field->tag != 0; field++)
+    {
+        nfields++;
+    }
+
+    n = rnd_below(depth == 0 ? 24 : 8);
+
+    for(i = 0; i < n; i++)
+    {
+        if(nfields > 0 && chance(80))
+        {
+            field = &fields[rnd_below(nfields)];
+            tag = field->tag;
+            wire_type = chance(75) ? natural_wire_type(field) : wire_types[rnd_below(4)];
+        }
+        else
+        {
+            do
+            {
+                tag = chance(50) ? 1 + rnd_below(40) : 1 + rnd_below(0x1fffffff);
+            } while(find_field(fields, tag) != NULL);
+
+            field = NULL;
+            wire_type = wire_types[rnd_below(4)];
+        }
+
+        if(chance(2))
+        {
+            wire_type = invalid_wire_types[rnd_below(4)];
+        }
+
+        if(chance(1))
+        {
+            put_byte(w, 0);
+        }
+
+        put_varint(w, ((uint64_t)tag << 3) | wire_type);
+
+        switch(wire_type)
+        {
+            case PB_WT_VARINT:
+                put_random_varint(w);
+                break;
+
+            case PB_WT_64BIT:
+                put_random_bytes(w, 8);
+                break;
+
+            case PB_WT_32BIT:
+                put_random_bytes(w, 4);
+                break;
+
+            case PB_WT_STRING:
+                put_delimited(w, field, depth);
+                break;
+        }
+    }
+}
+
+/* === Comparisons ========================================================= */
+
+static void report(const TestMessage *msg, const char *what, const uint8_t *buf, size_t len)
+{
+    size_t i;
+
+    failures++;
+    printf("FAIL %s: %s (%u bytes)\n", msg->name, what, (unsigned int)len);
+
+    for(i = 0; i < len && i < 256; i++)
+    {
+        printf("%02x%s", buf[i], (i % 32 == 31) ? "\n" : "");
+    }
+
+    printf("\n");
+}
+
+/*
+ * check_decode() - Decodes the same input with both codecs and compares
+ *
+ * INPUT
+ *     msg - message under test
+ *     codec - specialized codec
+ *     buf - encoded input
+ *     len - input length
+ * OUTPUT
+ *     true if both decoders accepted the input
+ */
+static bool check_decode(const TestMessage *msg, const pb_fast_codec_t *codec,
+                         const uint8_t *buf, size_t len)
+{
+    uint8_t *slow = malloc(msg->size);
+    uint8_t *fast = malloc(msg->size);
+    pb_istream_t slow_stream = pb_istream_from_buffer((uint8_t *)buf, len);
+    pb_istream_t fast_stream = pb_istream_from_buffer((uint8_t *)buf, len);
+    uint8_t garbage = (uint8_t)rnd();
+    bool slow_ok, fast_ok;
+
+    memset(slow, garbage, msg->size);
+    memset(fast, garbage, msg->size);
+
+    slow_ok = pb_decode(&slow_stream, msg->fields, slow);
+    fast_ok = codec->decode(&fast_stream, fast);
+
+    if(slow_ok != fast_ok)
+    {
+        report(msg, slow_ok ? "fast decode failed" : "fast decode accepted invalid input",
+               buf, len);
+    }
+    else if(slow_ok && (slow_stream.bytes_left != fast_stream.bytes_left ||
+                        !equal_message(msg->fields, slow, fast)))
+    {
+        report(msg, "decoded structs differ", buf, len);
+    }
+
+    free(slow);
+    free(fast);
+    return(slow_ok && fast_ok);
+}
+
+/*
+ * check_encode() - Encodes a random struct with both codecs, compares the
+ * bytes and feeds the encoding and mutations of it to check_decode()
+ *
+ * INPUT
+ *     msg - message under test
+ *     codec - specialized codec
+ * OUTPUT
+ *     none
+ */
+static void check_encode(const TestMessage *msg, const pb_fast_codec_t *codec)
+{
+    uint8_t *src = malloc(msg->size);
+    pb_ostream_t slow_stream = pb_ostream_from_buffer(output_slow, sizeof(output_slow));
+    pb_ostream_t fast_stream = pb_ostream_from_buffer(output_fast, sizeof(output_fast));
+    bool slow_ok, fast_ok;
+    size_t len, i;
+
+    memset(src, 0, msg->size);
+    fill_message(msg->fields, src, 0);
+
+    slow_ok = pb_encode(&slow_stream, msg->fields, src);
+    fast_ok = codec->encode(&fast_stream, src);
+
+    if(slow_ok != fast_ok)
+    {
+        report(msg, slow_ok ? "fast encode failed" : "fast encode accepted invalid struct",
+               output_slow, slow_stream.bytes_written);
+    }
+    else if(slow_ok && (slow_stream.bytes_written != fast_stream.bytes_written ||
+                        memcmp(output_slow, output_fast, slow_stream.bytes_written) != 0))
+    {
+        report(msg, "encoded bytes differ", output_slow, slow_stream.bytes_written);
+    }
+
+    len = slow_stream.bytes_written;
+
+    if(slow_ok && fast_ok && len > 0)
+    {
+        /* Both must run out of space the same way */
+        slow_stream = pb_ostream_from_buffer(output_slow, len - 1);
+        fast_stream = pb_ostream_from_buffer(output_fast, len - 1);
+
+        if(pb_encode(&slow_stream, msg->fields, src) || codec->encode(&fast_stream, src))
+        {
+            report(msg, "encode into short buffer succeeded", output_slow, len);
+        }
+    }
+
+    if(slow_ok && fast_ok)
+    {
+        memcpy(input, output_slow, len);
+        check_decode(msg, codec, input, len);
+
+        /* Truncation */
+        check_decode(msg, codec, input, rnd_below(len + 1));
+
+        /* Bit flips */
+        if(len > 0)
+        {
+            for(i = 1 + rnd_below(3); i > 0; i--)
+            {
+                input[rnd_below(len)] ^= (uint8_t)(1 << rnd_below(8));
+            }
+
+            check_decode(msg, codec, input, len);
+        }
+    }
+
+    free(src);
+}
+
+/* === Functions =========================================================== */
+
+int main(void)
+{
+    const pb_fast_codec_t *codec;
+    unsigned int m, i;
+    Writer w;
+
+    for(m = 0; m < sizeof(test_messages) / sizeof(test_messages[0]); m++)
+    {
+        const TestMessage *msg = &test_messages[m];
+
+        codec = pb_fast_codec(msg->fields);
+
+        if(codec == NULL)
+        {
+            printf("FAIL %s: no specialized codec\n", msg->name);
+            failures++;
+            continue;
+        }
+
+        for(i = 0; i < ITERATIONS; i++)
+        {
+            check_encode(msg, codec);
+
+            w.buf = input;
+            w.len = 0;
+            w.max = sizeof(input);
+            gen_message(&w, msg->fields, 0);
+            check_decode(msg, codec, input, w.len);
+        }
+    }
+
+    if(failures)
+    {
+        printf("nanopb_fast_test: %u failures\n", failures);
+        return(1);
+    }
+
+    printf("nanopb_fast_test: OK\n");
+    return(0);
+}
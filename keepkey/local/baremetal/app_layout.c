@@ -610,8 +610,9 @@ void layout_address(const char *address, QRSize qr_size)
 {
     static unsigned char bitdata[QR_MAX_BITDATA];
     Canvas *canvas = layout_get_canvas();
+    DrawableParams sp;
 
-    int a, i, j, side, y_pos = QR_DISPLAY_Y;
+    int side, y_pos = QR_DISPLAY_Y;
 
     if(qr_size == QR_SMALL)
     {
@@ -630,21 +631,10 @@ void layout_address(const char *address, QRSize qr_size)
         draw_box_simple(canvas, 0xFF, QR_DISPLAY_X, y_pos,
                         (side + 2) * QR_DISPLAY_SCALE, (side + 2) * QR_DISPLAY_SCALE);
 
-        /* Fill in QR */
-        for(i = 0; i < side; i++)
-        {
-            for(j = 0; j < side; j++)
-            {
-                a = j * side + i;
-
-                if(bitdata[a / 8] & (1 << (7 - a % 8)))
-                {
-                    draw_box_simple(canvas, 0x00,
-                                    QR_DISPLAY_SCALE + (i + QR_DISPLAY_X) * QR_DISPLAY_SCALE,
-                                    QR_DISPLAY_SCALE + (j + y_pos) * QR_DISPLAY_SCALE,
-                                    QR_DISPLAY_SCALE, QR_DISPLAY_SCALE);
-                }
-            }
-        }
+        /* Fill in QR, one span per run of dark modules */
+        sp.x = QR_DISPLAY_SCALE + QR_DISPLAY_X * QR_DISPLAY_SCALE;
+        sp.y = QR_DISPLAY_SCALE + y_pos * QR_DISPLAY_SCALE;
+        sp.color = 0x00;
+        draw_bitmap_mono_scaled(canvas, &sp, bitdata, side, side, QR_DISPLAY_SCALE);
     }
 }
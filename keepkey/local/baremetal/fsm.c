@@ -66,81 +66,81 @@ static uint8_t msg_resp[MAX_FRAME_SIZE] __attribute__((aligned(4)));
 static const MessagesMap_t MessagesMap[] =
 {
     /* Normal Messages */
-    MSG_IN(MessageType_MessageType_Initialize,          Initialize_fields, (void (*)(void *))fsm_msgInitialize)
-    MSG_IN(MessageType_MessageType_GetFeatures,         GetFeatures_fields, (void (*)(void *))fsm_msgGetFeatures)
-    MSG_IN(MessageType_MessageType_Ping,                Ping_fields, (void (*)(void *))fsm_msgPing)
-    MSG_IN(MessageType_MessageType_ChangePin,           ChangePin_fields, (void (*)(void *))fsm_msgChangePin)
-    MSG_IN(MessageType_MessageType_WipeDevice,          WipeDevice_fields, (void (*)(void *))fsm_msgWipeDevice)
-    MSG_IN(MessageType_MessageType_FirmwareErase,       FirmwareErase_fields, (void (*)(void *))fsm_msgFirmwareErase)
-    MSG_IN(MessageType_MessageType_FirmwareUpload,      FirmwareUpload_fields, (void (*)(void *))fsm_msgFirmwareUpload)
-    MSG_IN(MessageType_MessageType_GetEntropy,          GetEntropy_fields, (void (*)(void *))fsm_msgGetEntropy)
-    MSG_IN(MessageType_MessageType_GetPublicKey,        GetPublicKey_fields, (void (*)(void *))fsm_msgGetPublicKey)
-    MSG_IN(MessageType_MessageType_LoadDevice,          LoadDevice_fields, (void (*)(void *))fsm_msgLoadDevice)
-    MSG_IN(MessageType_MessageType_ResetDevice,         ResetDevice_fields, (void (*)(void *))fsm_msgResetDevice)
-    MSG_IN(MessageType_MessageType_SignTx,              SignTx_fields, (void (*)(void *))fsm_msgSignTx)
-    MSG_IN(MessageType_MessageType_PinMatrixAck,        PinMatrixAck_fields,        NO_PROCESS_FUNC)
-    MSG_IN(MessageType_MessageType_Cancel,              Cancel_fields, (void (*)(void *))fsm_msgCancel)
-    MSG_IN(MessageType_MessageType_TxAck,               TxAck_fields, (void (*)(void *))fsm_msgTxAck)
-    MSG_IN(MessageType_MessageType_CipherKeyValue,      CipherKeyValue_fields, (void (*)(void *))fsm_msgCipherKeyValue)
-    MSG_IN(MessageType_MessageType_ClearSession,        ClearSession_fields, (void (*)(void *))fsm_msgClearSession)
-    MSG_IN(MessageType_MessageType_ApplySettings,       ApplySettings_fields, (void (*)(void *))fsm_msgApplySettings)
-    MSG_IN(MessageType_MessageType_ButtonAck,           ButtonAck_fields,           NO_PROCESS_FUNC)
-    MSG_IN(MessageType_MessageType_GetAddress,          GetAddress_fields, (void (*)(void *))fsm_msgGetAddress)
-    MSG_IN(MessageType_MessageType_EntropyAck,          EntropyAck_fields, (void (*)(void *))fsm_msgEntropyAck)
-    MSG_IN(MessageType_MessageType_SignMessage,         SignMessage_fields, (void (*)(void *))fsm_msgSignMessage)
-    MSG_IN(MessageType_MessageType_SignIdentity,        SignIdentity_fields, (void (*)(void *))fsm_msgSignIdentity)
-    MSG_IN(MessageType_MessageType_VerifyMessage,       VerifyMessage_fields, (void (*)(void *))fsm_msgVerifyMessage)
+    MSG_IN(MessageType_MessageType_Initialize,          Initialize, (void (*)(void *))fsm_msgInitialize)
+    MSG_IN(MessageType_MessageType_GetFeatures,         GetFeatures, (void (*)(void *))fsm_msgGetFeatures)
+    MSG_IN(MessageType_MessageType_Ping,                Ping, (void (*)(void *))fsm_msgPing)
+    MSG_IN(MessageType_MessageType_ChangePin,           ChangePin, (void (*)(void *))fsm_msgChangePin)
+    MSG_IN(MessageType_MessageType_WipeDevice,          WipeDevice, (void (*)(void *))fsm_msgWipeDevice)
+    MSG_IN(MessageType_MessageType_FirmwareErase,       FirmwareErase, (void (*)(void *))fsm_msgFirmwareErase)
+    MSG_IN(MessageType_MessageType_FirmwareUpload,      FirmwareUpload, (void (*)(void *))fsm_msgFirmwareUpload)
+    MSG_IN(MessageType_MessageType_GetEntropy,          GetEntropy, (void (*)(void *))fsm_msgGetEntropy)
+    MSG_IN(MessageType_MessageType_GetPublicKey,        GetPublicKey, (void (*)(void *))fsm_msgGetPublicKey)
+    MSG_IN(MessageType_MessageType_LoadDevice,          LoadDevice, (void (*)(void *))fsm_msgLoadDevice)
+    MSG_IN(MessageType_MessageType_ResetDevice,         ResetDevice, (void (*)(void *))fsm_msgResetDevice)
+    MSG_IN(MessageType_MessageType_SignTx,              SignTx, (void (*)(void *))fsm_msgSignTx)
+    MSG_IN(MessageType_MessageType_PinMatrixAck,        PinMatrixAck,               NO_PROCESS_FUNC)
+    MSG_IN(MessageType_MessageType_Cancel,              Cancel, (void (*)(void *))fsm_msgCancel)
+    MSG_IN(MessageType_MessageType_TxAck,               TxAck, (void (*)(void *))fsm_msgTxAck)
+    MSG_IN(MessageType_MessageType_CipherKeyValue,      CipherKeyValue, (void (*)(void *))fsm_msgCipherKeyValue)
+    MSG_IN(MessageType_MessageType_ClearSession,        ClearSession, (void (*)(void *))fsm_msgClearSession)
+    MSG_IN(MessageType_MessageType_ApplySettings,       ApplySettings, (void (*)(void *))fsm_msgApplySettings)
+    MSG_IN(MessageType_MessageType_ButtonAck,           ButtonAck,                  NO_PROCESS_FUNC)
+    MSG_IN(MessageType_MessageType_GetAddress,          GetAddress, (void (*)(void *))fsm_msgGetAddress)
+    MSG_IN(MessageType_MessageType_EntropyAck,          EntropyAck, (void (*)(void *))fsm_msgEntropyAck)
+    MSG_IN(MessageType_MessageType_SignMessage,         SignMessage, (void (*)(void *))fsm_msgSignMessage)
+    MSG_IN(MessageType_MessageType_SignIdentity,        SignIdentity, (void (*)(void *))fsm_msgSignIdentity)
+    MSG_IN(MessageType_MessageType_VerifyMessage,       VerifyMessage, (void (*)(void *))fsm_msgVerifyMessage)
 /* ECIES disabled
-    MSG_IN(MessageType_MessageType_EncryptMessage,      EncryptMessage_fields, (void (*)(void *))fsm_msgEncryptMessage)
-    MSG_IN(MessageType_MessageType_DecryptMessage,      DecryptMessage_fields, (void (*)(void *))fsm_msgDecryptMessage)
+    MSG_IN(MessageType_MessageType_EncryptMessage,      EncryptMessage, (void (*)(void *))fsm_msgEncryptMessage)
+    MSG_IN(MessageType_MessageType_DecryptMessage,      DecryptMessage, (void (*)(void *))fsm_msgDecryptMessage)
 */
-    MSG_IN(MessageType_MessageType_PassphraseAck,       PassphraseAck_fields,       NO_PROCESS_FUNC)
-    MSG_IN(MessageType_MessageType_EstimateTxSize,      EstimateTxSize_fields, (void (*)(void *))fsm_msgEstimateTxSize)
-    MSG_IN(MessageType_MessageType_RecoveryDevice,      RecoveryDevice_fields, (void (*)(void *))fsm_msgRecoveryDevice)
-    MSG_IN(MessageType_MessageType_WordAck,             WordAck_fields, (void (*)(void *))fsm_msgWordAck)
-    MSG_IN(MessageType_MessageType_CharacterAck,        CharacterAck_fields, (void (*)(void *))fsm_msgCharacterAck)
-    MSG_IN(MessageType_MessageType_ApplyPolicies,       ApplyPolicies_fields, (void (*)(void *))fsm_msgApplyPolicies)
-    MSG_IN(MessageType_MessageType_EthereumGetAddress,	EthereumGetAddress_fields, (void (*)(void *))fsm_msgEthereumGetAddress)
-    MSG_IN(MessageType_MessageType_EthereumSignTx,      EthereumSignTx_fields, (void (*)(void *))fsm_msgEthereumSignTx)
-    MSG_IN(MessageType_MessageType_EthereumTxAck,       EthereumTxAck_fields, (void (*)(void *))fsm_msgEthereumTxAck)
+    MSG_IN(MessageType_MessageType_PassphraseAck,       PassphraseAck,              NO_PROCESS_FUNC)
+    MSG_IN(MessageType_MessageType_EstimateTxSize,      EstimateTxSize, (void (*)(void *))fsm_msgEstimateTxSize)
+    MSG_IN(MessageType_MessageType_RecoveryDevice,      RecoveryDevice, (void (*)(void *))fsm_msgRecoveryDevice)
+    MSG_IN(MessageType_MessageType_WordAck,             WordAck, (void (*)(void *))fsm_msgWordAck)
+    MSG_IN(MessageType_MessageType_CharacterAck,        CharacterAck, (void (*)(void *))fsm_msgCharacterAck)
+    MSG_IN(MessageType_MessageType_ApplyPolicies,       ApplyPolicies, (void (*)(void *))fsm_msgApplyPolicies)
+    MSG_IN(MessageType_MessageType_EthereumGetAddress,	EthereumGetAddress, (void (*)(void *))fsm_msgEthereumGetAddress)
+    MSG_IN(MessageType_MessageType_EthereumSignTx,      EthereumSignTx, (void (*)(void *))fsm_msgEthereumSignTx)
+    MSG_IN(MessageType_MessageType_EthereumTxAck,       EthereumTxAck, (void (*)(void *))fsm_msgEthereumTxAck)
 
     /* Normal Raw Messages */
-    RAW_IN(MessageType_MessageType_RawTxAck,            RawTxAck_fields,            (void (*)(void *))fsm_msgRawTxAck)
+    RAW_IN(MessageType_MessageType_RawTxAck,            RawTxAck,                   (void (*)(void *))fsm_msgRawTxAck)
 
     /* Normal Out Messages */
-    MSG_OUT(MessageType_MessageType_Success,            Success_fields,             NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_Failure,            Failure_fields,             NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_Entropy,            Entropy_fields,             NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_PublicKey,          PublicKey_fields,           NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_Features,           Features_fields,            NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_PinMatrixRequest,   PinMatrixRequest_fields,    NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_TxRequest,          TxRequest_fields,           NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_CipheredKeyValue,   CipheredKeyValue_fields,    NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_ButtonRequest,      ButtonRequest_fields,       NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_Address,            Address_fields,             NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_EntropyRequest,     EntropyRequest_fields,      NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_MessageSignature,   MessageSignature_fields,    NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_SignedIdentity,     SignedIdentity_fields,      NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Success,            Success,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Failure,            Failure,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Entropy,            Entropy,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_PublicKey,          PublicKey,                  NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Features,           Features,                   NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_PinMatrixRequest,   PinMatrixRequest,           NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_TxRequest,          TxRequest,                  NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_CipheredKeyValue,   CipheredKeyValue,           NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_ButtonRequest,      ButtonRequest,              NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Address,            Address,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_EntropyRequest,     EntropyRequest,             NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_MessageSignature,   MessageSignature,           NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_SignedIdentity,     SignedIdentity,             NO_PROCESS_FUNC)
 /* ECIES disabled
-    MSG_OUT(MessageType_MessageType_EncryptedMessage,   EncryptedMessage_fields,    NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_DecryptedMessage,   DecryptedMessage_fields,    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_EncryptedMessage,   EncryptedMessage,           NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_DecryptedMessage,   DecryptedMessage,           NO_PROCESS_FUNC)
 */
-    MSG_OUT(MessageType_MessageType_PassphraseRequest,  PassphraseRequest_fields,   NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_TxSize,             TxSize_fields,              NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_WordRequest,        WordRequest_fields,         NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_CharacterRequest,   CharacterRequest_fields,    NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_EthereumAddress,    EthereumAddress_fields,     NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_EthereumTxRequest,  EthereumTxRequest_fields,   NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_PassphraseRequest,  PassphraseRequest,          NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_TxSize,             TxSize,                     NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_WordRequest,        WordRequest,                NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_CharacterRequest,   CharacterRequest,           NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_EthereumAddress,    EthereumAddress,            NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_EthereumTxRequest,  EthereumTxRequest,          NO_PROCESS_FUNC)
 
 #if DEBUG_LINK
     /* Debug Messages */
-    DEBUG_IN(MessageType_MessageType_DebugLinkDecision, DebugLinkDecision_fields,   NO_PROCESS_FUNC)
-    DEBUG_IN(MessageType_MessageType_DebugLinkGetState, DebugLinkGetState_fields, (void (*)(void *))fsm_msgDebugLinkGetState)
-    DEBUG_IN(MessageType_MessageType_DebugLinkStop,     DebugLinkStop_fields, (void (*)(void *))fsm_msgDebugLinkStop)
+    DEBUG_IN(MessageType_MessageType_DebugLinkDecision, DebugLinkDecision,          NO_PROCESS_FUNC)
+    DEBUG_IN(MessageType_MessageType_DebugLinkGetState, DebugLinkGetState, (void (*)(void *))fsm_msgDebugLinkGetState)
+    DEBUG_IN(MessageType_MessageType_DebugLinkStop,     DebugLinkStop, (void (*)(void *))fsm_msgDebugLinkStop)
 
     /* Debug Out Messages */
-    DEBUG_OUT(MessageType_MessageType_DebugLinkState, DebugLinkState_fields,        NO_PROCESS_FUNC)
-    DEBUG_OUT(MessageType_MessageType_DebugLinkLog, DebugLinkLog_fields,            NO_PROCESS_FUNC)
+    DEBUG_OUT(MessageType_MessageType_DebugLinkState, DebugLinkState,               NO_PROCESS_FUNC)
+    DEBUG_OUT(MessageType_MessageType_DebugLinkLog, DebugLinkLog,                   NO_PROCESS_FUNC)
 #endif
 };
 
@@ -764,6 +764,7 @@ void fsm_msgRawTxAck(RawMessage *msg, uint32_t frame_length)
 {
     static RawMessageState msg_state = RAW_MESSAGE_NOT_STARTED;
     static uint32_t msg_offset = 0, skip = 0;
+    bool last_chunk;
 
     /* Start raw transaction */
     if(msg_state == RAW_MESSAGE_NOT_STARTED)
@@ -776,11 +777,12 @@ void fsm_msgRawTxAck(RawMessage *msg, uint32_t frame_length)
     if(msg_state == RAW_MESSAGE_STARTED)
     {
         msg_offset += msg->length;
+        last_chunk = msg_offset >= frame_length - skip;
 
-        parse_raw_txack(msg->buffer, msg->length);
+        parse_raw_txack(msg->buffer, msg->length, last_chunk);
 
         /* Finish raw transaction */
-        if(msg_offset >= frame_length - skip)
+        if(last_chunk)
         {
             msg_offset = 0;
             skip = 0;
@@ -49,7 +49,7 @@ const char *const application_version = APP_VERSIONS;
 /* === Private Functions =================================================== */
 
 /*
- * exec() - Main loop
+ * exec() - Main loop work, run on every wakeup
  *
  * INPUT
  *     none
@@ -106,6 +106,9 @@ int main(void)
     /* Init storage */
     storage_init();
 
+    /* Measure bootloader and firmware in the background */
+    memory_hash_init();
+
     /* Init protcol buffer message map and usb msg callback */
     fsm_init();
 
@@ -121,11 +124,32 @@ int main(void)
 
     reset_idle_time();
 
+    uint32_t idle_mark = get_clock_ms();
+
     while(1)
     {
-        delay_ms_with_callback(ONE_SEC, &exec, 1);
-        increment_idle_time(ONE_SEC);
-        toggle_screensaver();
+        exec();
+
+        if(get_clock_ms() - idle_mark >= ONE_SEC)
+        {
+            idle_mark += ONE_SEC;
+            increment_idle_time(ONE_SEC);
+            toggle_screensaver();
+        }
+
+        /*
+         * Sleep until the USB, button, display or 1 ms timer interrupt.  With
+         * interrupts masked, one arriving after the check still ends the WFI.
+         * The timer tick keeps running, so sleep lasts at most 1 ms at a time.
+         */
+        cm_disable_interrupts();
+
+        if(!usb_event_pending())
+        {
+            wait_for_interrupt();
+        }
+
+        cm_enable_interrupts();
     }
 
     return(0);
@@ -30,6 +30,17 @@
 
 #include "qr_encode.h"
 #include "qr_consts.h"
+#include "qr_templates.h"
+
+/* === Defines ============================================================= */
+
+// Modules are bit-packed, one 64-bit word per row, and function patterns
+// come from the templates of versions 1 - 9
+#if QR_MAX_VERSION != QR_VERSION_S
+#error "QR_MAX_VERSION must be QR_VERSION_S for 64-bit module rows and templates"
+#endif
+
+#define QR_LINE_MASK(n)   ((n) >= 64 ? ~(uint64_t)0 : (((uint64_t)1 << (n)) - 1))
 
 /* === Variables =========================================================== */
 
@@ -40,7 +51,8 @@ int m_ncDataCodeWordBit, m_ncAllCodeWord, nEncodeVersion;
 int m_ncDataBlock;
 int m_nSymbleSize;
 int m_nBlockLength[QR_MAX_DATACODEWORD];
-uint8_t m_byModuleData[QR_MAX_MODULESIZE][QR_MAX_MODULESIZE]; // [x][y]
+const uint64_t* m_lpqwFunctionRow;           // [y], bit x set for a function module
+uint64_t m_qwModuleRow[QR_MAX_MODULESIZE];   // [y], bit x set for a dark module (before masking)
 uint8_t m_byAllCodeWord[QR_MAX_ALLCODEWORD];
 uint8_t m_byBlockMode[QR_MAX_DATACODEWORD];
 uint8_t m_byDataCodeWord[QR_MAX_DATACODEWORD];
@@ -511,116 +523,17 @@ void GetRSCodeWord(uint8_t* lpbyRSWork, int ncDataCodeWord, int ncRSCodeWord)
 	}
 }
 
-void SetFinderPattern(int x, int y)
-{
-	static const uint8_t byPattern[] = {	0x7f,	// 1111111b
-											0x41,	// 1000001b
-											0x5d,	// 1011101b
-											0x5d,	// 1011101b
-											0x5d,	// 1011101b
-											0x41,	// 1000001b
-											0x7f};	// 1111111b
-	int i, j;
-
-	for (i = 0; i < 7; i++) {
-		for (j = 0; j < 7; j++) {
-			m_byModuleData[x + j][y + i] = (byPattern[i] & (1 << (6 - j))) ? '\x30' : '\x20';
-		}
-	}
-}
-
-void SetVersionPattern(void)
-{
-	int i, j;
-
-	if (m_nVersion <= 6) {
-		return;
-	}
-
-	int nVerData = m_nVersion << 12;
-
-	// Calculated bit remainder
-
-	for (i = 0; i < 6; i++) {
-		if (nVerData & (1 << (17 - i))) {
-			nVerData ^= (0x1f25 << (5 - i));
-		}
-	}
-
-	nVerData += m_nVersion << 12;
-
-	for (i = 0; i < 6; i++) {
-		for (j = 0; j < 3; j++) {
-			m_byModuleData[m_nSymbleSize - 11 + j][i] = m_byModuleData[i][m_nSymbleSize - 11 + j] =
-			(nVerData & (1 << (i * 3 + j))) ? '\x30' : '\x20';
-		}
-	}
-}
-
-void SetAlignmentPattern(int x, int y)
+int IsFunctionModule(int x, int y)
 {
-	static const uint8_t byPattern[] = {	0x1f,	// 11111b
-											0x11,	// 10001b
-											0x15,	// 10101b
-											0x11,	// 10001b
-											0x1f};	// 11111b
-	int i, j;
-
-	if (m_byModuleData[x][y] & 0x20) {
-		return; 		// Excluded due to overlap with the functional module
-	}
-
-	x -= 2; y -= 2; 	// Convert the coordinates to the upper left corner
-
-	for (i = 0; i < 5; i++) {
-		for (j = 0; j < 5; j++) {
-			m_byModuleData[x + j][y + i] = (byPattern[i] & (1 << (4 - j))) ? '\x30' : '\x20';
-		}
-	}
+	return (int)((m_lpqwFunctionRow[y] >> x) & 1);
 }
 
-void SetFunctionModule(void)
+void SetModuleBit(int x, int y, int bDark)
 {
-	int i, j;
-
-	// Position detection pattern
-	SetFinderPattern(0, 0);
-	SetFinderPattern(m_nSymbleSize - 7, 0);
-	SetFinderPattern(0, m_nSymbleSize - 7);
-
-	// Separator pattern position detection
-	for (i = 0; i < 8; i++) {
-		m_byModuleData[i][7] = m_byModuleData[7][i] = '\x20';
-		m_byModuleData[m_nSymbleSize - 8][i] = m_byModuleData[m_nSymbleSize - 8 + i][7] = '\x20';
-		m_byModuleData[i][m_nSymbleSize - 8] = m_byModuleData[7][m_nSymbleSize - 8 + i] = '\x20';
-	}
-
-	// Registration as part of a functional module position description format information
-	for (i = 0; i < 9; i++) {
-		m_byModuleData[i][8] = m_byModuleData[8][i] = '\x20';
-	}
-
-	for (i = 0; i < 8; i++) {
-		m_byModuleData[m_nSymbleSize - 8 + i][8] = m_byModuleData[8][m_nSymbleSize - 8 + i] = '\x20';
-	}
-
-	// Version information pattern
-	SetVersionPattern();
-
-	// Pattern alignment
-	for (i = 0; i < QR_VersonInfo[m_nVersion].ncAlignPoint; i++) {
-		SetAlignmentPattern(QR_VersonInfo[m_nVersion].nAlignPoint[i], 6);
-		SetAlignmentPattern(6, QR_VersonInfo[m_nVersion].nAlignPoint[i]);
-
-		for (j = 0; j < QR_VersonInfo[m_nVersion].ncAlignPoint; j++) {
-			SetAlignmentPattern(QR_VersonInfo[m_nVersion].nAlignPoint[i], QR_VersonInfo[m_nVersion].nAlignPoint[j]);
-		}
-	}
-
-	// Timing pattern
-	for (i = 8; i <= m_nSymbleSize - 9; i++) {
-		m_byModuleData[i][6] = (i % 2) == 0 ? '\x30' : '\x20';
-		m_byModuleData[6][i] = (i % 2) == 0 ? '\x30' : '\x20';
+	if (bDark) {
+		m_qwModuleRow[y] |= (uint64_t)1 << x;
+	} else {
+		m_qwModuleRow[y] &= ~((uint64_t)1 << x);
 	}
 }
 
@@ -654,54 +567,58 @@ void SetCodeWordPattern(void)
 						}
 					}
 				}
-			} while (m_byModuleData[x][y] & 0x20); // Exclude a functional module
-
-			m_byModuleData[x][y] = (m_byAllCodeWord[i] & (1 << (7 - j))) ? '\x02' : '\x00';
+			} while (IsFunctionModule(x, y)); // Exclude a functional module
 
+			if (m_byAllCodeWord[i] & (1 << (7 - j))) {
+				m_qwModuleRow[y] |= (uint64_t)1 << x;
+			}
 		}
 	}
 }
 
-void SetMaskingPattern(int nPatternNo)
+int GetMaskBit(int nPatternNo, int i, int j)
 {
-	int i, j;
+	switch (nPatternNo) {
+		case 0:
+			return ((i + j) % 2 == 0);
+		case 1:
+			return (i % 2 == 0);
+		case 2:
+			return (j % 3 == 0);
+		case 3:
+			return ((i + j) % 3 == 0);
+		case 4:
+			return (((i / 2) + (j / 3)) % 2 == 0);
+		case 5:
+			return (((i * j) % 2) + ((i * j) % 3) == 0);
+		case 6:
+			return ((((i * j) % 2) + ((i * j) % 3)) % 2 == 0);
+		default: // case 7:
+			return ((((i * j) % 3) + ((i + j) % 2)) % 2 == 0);
+	}
+}
 
-	for (i = 0; i < m_nSymbleSize; i++) {
-		for (j = 0; j < m_nSymbleSize; j++) {
-			if (! (m_byModuleData[j][i] & 0x20)) { // Exclude a functional module
-				int bMask;
-
-				switch (nPatternNo) {
-					case 0:
-						bMask = ((i + j) % 2 == 0);
-						break;
-					case 1:
-						bMask = (i % 2 == 0);
-						break;
-					case 2:
-						bMask = (j % 3 == 0);
-						break;
-					case 3:
-						bMask = ((i + j) % 3 == 0);
-						break;
-					case 4:
-						bMask = (((i / 2) + (j / 3)) % 2 == 0);
-						break;
-					case 5:
-						bMask = (((i * j) % 2) + ((i * j) % 3) == 0);
-						break;
-					case 6:
-						bMask = ((((i * j) % 2) + ((i * j) % 3)) % 2 == 0);
-						break;
-					default: // case 7:
-						bMask = ((((i * j) % 3) + ((i + j) % 2)) % 2 == 0);
-						break;
-				}
+// Masked row i. Every mask repeats every 6 columns, so one period is
+// evaluated and replicated across the row.
+uint64_t GetMaskedRow(int nPatternNo, int i)
+{
+	uint64_t qwPeriod = 0;
+	uint64_t qwMask = 0;
+	int j;
 
-				m_byModuleData[j][i] = (uint8_t)((m_byModuleData[j][i] & 0xfe) | (((m_byModuleData[j][i] & 0x02) > 1) ^ bMask));
-			}
+	for (j = 0; j < 6; j++) {
+		if (GetMaskBit(nPatternNo, i, j)) {
+			qwPeriod |= (uint64_t)1 << j;
 		}
 	}
+
+	for (j = 0; j < m_nSymbleSize; j += 6) {
+		qwMask |= qwPeriod << j;
+	}
+
+	qwMask &= ~m_lpqwFunctionRow[i] & QR_LINE_MASK(m_nSymbleSize); // Exclude a functional module
+
+	return m_qwModuleRow[i] ^ qwMask;
 }
 
 void SetFormatInfoPattern(int nPatternNo)
@@ -735,144 +652,99 @@ void SetFormatInfoPattern(int nPatternNo)
 	nFormatData ^= 0x5412; // 101010000010010b
 	// Position detection patterns located around the upper left
 	for (i = 0; i <= 5; i++) {
-		m_byModuleData[8][i] = (nFormatData & (1 << i)) ? '\x30' : '\x20';
+		SetModuleBit(8, i, nFormatData & (1 << i));
 	}
-	m_byModuleData[8][7] = (nFormatData & (1 << 6)) ? '\x30' : '\x20';
-	m_byModuleData[8][8] = (nFormatData & (1 << 7)) ? '\x30' : '\x20';
-	m_byModuleData[7][8] = (nFormatData & (1 << 8)) ? '\x30' : '\x20';
+	SetModuleBit(8, 7, nFormatData & (1 << 6));
+	SetModuleBit(8, 8, nFormatData & (1 << 7));
+	SetModuleBit(7, 8, nFormatData & (1 << 8));
 	for (i = 9; i <= 14; i++) {
-		m_byModuleData[14 - i][8] = (nFormatData & (1 << i)) ? '\x30' : '\x20';
+		SetModuleBit(14 - i, 8, nFormatData & (1 << i));
 	}
 	// Position detection patterns located under the upper right corner
 	for (i = 0; i <= 7; i++) {
-		m_byModuleData[m_nSymbleSize - 1 - i][8] = (nFormatData & (1 << i)) ? '\x30' : '\x20';
+		SetModuleBit(m_nSymbleSize - 1 - i, 8, nFormatData & (1 << i));
 	}
 	// Right lower left position detection patterns located
-	m_byModuleData[8][m_nSymbleSize - 8] = '\x30'; 	// Module fixed dark
+	SetModuleBit(8, m_nSymbleSize - 8, 1); 	// Module fixed dark
 	for (i = 8; i <= 14; i++) {
-		m_byModuleData[8][m_nSymbleSize - 15 + i] = (nFormatData & (1 << i)) ? '\x30' : '\x20';
+		SetModuleBit(8, m_nSymbleSize - 15 + i, nFormatData & (1 << i));
 	}
 }
 
-int CountPenalty(void)
+// Transpose a 64 x 64 bit matrix in place, bit x of row y to bit y of row x
+void TransposeModules(uint64_t *lpqwRows)
 {
-	int nPenalty = 0;
-	int i, j, k;
-
-	// Column of the same color adjacent module
-	for (i = 0; i < m_nSymbleSize; i++) {
-		for (j = 0; j < m_nSymbleSize - 4; j++) {
-			int nCount = 1;
-
-			for (k = j + 1; k < m_nSymbleSize; k++) {
-				if (((m_byModuleData[i][j] & 0x11) == 0) == ((m_byModuleData[i][k] & 0x11) == 0)) {
-					nCount++;
-				} else {
-					break;
-				}
-			}
+	uint64_t qwMask = 0x00000000ffffffffULL;
+	int i, j;
 
-			if (nCount >= 5) {
-				nPenalty += 3 + (nCount - 5);
-			}
+	for (j = 32; j != 0; j >>= 1, qwMask ^= qwMask << j) {
+		for (i = 0; i < 64; i = ((i | j) + 1) & ~j) {
+			uint64_t t = ((lpqwRows[i] >> j) ^ lpqwRows[i | j]) & qwMask;
 
-			j = k - 1;
+			lpqwRows[i] ^= t << j;
+			lpqwRows[i | j] ^= t;
 		}
 	}
+}
 
-	// Adjacent module line of the same color
-	for (i = 0; i < m_nSymbleSize; i++) {
-		for (j = 0; j < m_nSymbleSize - 4; j++) {
-			int nCount = 1;
+// Penalty of a single row or column, dark modules set, evaluated a word at a time
+int CountLinePenalty(uint64_t qwLine)
+{
+	int n = m_nSymbleSize;
+	int nPenalty = 0;
 
-			for (k = j + 1; k < m_nSymbleSize; k++) {
-				if (((m_byModuleData[j][i] & 0x11) == 0) == ((m_byModuleData[k][i] & 0x11) == 0)) {
-					nCount++;
-				} else {
-					break;
-				}
-			}
+	// Adjacent modules of the same color: 3 + (run - 5) for each run of 5 or more,
+	// i.e. one per window of five same-colored modules plus 2 per run
+	uint64_t qwSame = ~(qwLine ^ (qwLine >> 1)) & QR_LINE_MASK(n - 1);
+	uint64_t qwRun5 = qwSame & (qwSame >> 1) & (qwSame >> 2) & (qwSame >> 3);
 
-			if (nCount >= 5) {
-				nPenalty += 3 + (nCount - 5);
-			}
+	nPenalty += __builtin_popcountll(qwRun5) + 2 * __builtin_popcountll(qwRun5 & ~(qwRun5 << 1));
 
-			j = k - 1;
-		}
-	}
+	// Pattern (dark: light: dark: light: dark) ratio 1:1:3:1:1 with light on
+	// either side, where modules outside the symbol count as light
+	uint64_t qwFinder = ~(qwLine << 1) & qwLine & ~(qwLine >> 1) & (qwLine >> 2) &
+						(qwLine >> 3) & (qwLine >> 4) & ~(qwLine >> 5) & (qwLine >> 6) &
+						~(qwLine >> 7) & QR_LINE_MASK(n - 6);
 
-	// Modules of the same color block (2 ~ 2)
-	for (i = 0; i < m_nSymbleSize - 1; i++) {
-		for (j = 0; j < m_nSymbleSize - 1; j++) {
-			if ((((m_byModuleData[i][j] & 0x11) == 0) == ((m_byModuleData[i + 1][j]		& 0x11) == 0)) &&
-				(((m_byModuleData[i][j] & 0x11) == 0) == ((m_byModuleData[i]	[j + 1] & 0x11) == 0)) &&
-				(((m_byModuleData[i][j] & 0x11) == 0) == ((m_byModuleData[i + 1][j + 1] & 0x11) == 0))) {
-				nPenalty += 3;
-			}
-		}
-	}
+	// Clear pattern of four or more before or after
+	qwFinder &= ~((qwLine << 2) | (qwLine << 3) | (qwLine << 4)) |
+				~((qwLine >> 8) | (qwLine >> 9) | (qwLine >> 10));
+
+	nPenalty += 40 * __builtin_popcountll(qwFinder);
+
+	return nPenalty;
+}
+
+int CountPenalty(int nPatternNo)
+{
+	static uint64_t qwRows[64], qwColumns[64];
+	int nPenalty = 0;
+	int nCount = 0;
+	int i;
+
+	memset(qwRows, 0, sizeof(qwRows));
 
-	// Pattern (dark dark: light: dark: light) ratio 1:1:3:1:1 in the same column
 	for (i = 0; i < m_nSymbleSize; i++) {
-		for (j = 0; j < m_nSymbleSize - 6; j++) {
-			if (((j == 0) ||				 (! (m_byModuleData[i][j - 1] & 0x11))) &&
-											 (   m_byModuleData[i][j    ] & 0x11) &&
-											 (! (m_byModuleData[i][j + 1] & 0x11)) &&
-											 (   m_byModuleData[i][j + 2] & 0x11) &&
-											 (   m_byModuleData[i][j + 3] & 0x11) &&
-											 (   m_byModuleData[i][j + 4] & 0x11) &&
-											 (! (m_byModuleData[i][j + 5] & 0x11)) &&
-											 (   m_byModuleData[i][j + 6] & 0x11) &&
-				((j == m_nSymbleSize - 7) || (! (m_byModuleData[i][j + 7] & 0x11)))) {
-
-				// Clear pattern of four or more before or after
-				if (((j < 2 || ! (m_byModuleData[i][j - 2] & 0x11)) &&
-					 (j < 3 || ! (m_byModuleData[i][j - 3] & 0x11)) &&
-					 (j < 4 || ! (m_byModuleData[i][j - 4] & 0x11))) ||
-					((j >= m_nSymbleSize - 8 || ! (m_byModuleData[i][j + 8] & 0x11)) &&
-					 (j >= m_nSymbleSize - 9 || ! (m_byModuleData[i][j + 9] & 0x11)) &&
-					 (j >= m_nSymbleSize - 10 || ! (m_byModuleData[i][j + 10] & 0x11)))) {
-					nPenalty += 40;
-				}
-			}
-		}
+		qwRows[i] = GetMaskedRow(nPatternNo, i);
 	}
 
-	// Pattern (dark dark: light: dark: light) in the same line ratio 1:1:3:1:1
+	memcpy(qwColumns, qwRows, sizeof(qwColumns));
+	TransposeModules(qwColumns);
+
 	for (i = 0; i < m_nSymbleSize; i++) {
-		for (j = 0; j < m_nSymbleSize - 6; j++) {
-			if (((j == 0) ||				 (! (m_byModuleData[j - 1][i] & 0x11))) &&
-											 (   m_byModuleData[j   ] [i] & 0x11) &&
-											 (! (m_byModuleData[j + 1][i] & 0x11)) &&
-											 (   m_byModuleData[j + 2][i] & 0x11) &&
-											 (   m_byModuleData[j + 3][i] & 0x11) &&
-											 (   m_byModuleData[j + 4][i] & 0x11) &&
-											 (! (m_byModuleData[j + 5][i] & 0x11)) &&
-											 (   m_byModuleData[j + 6][i] & 0x11) &&
-				((j == m_nSymbleSize - 7) || (! (m_byModuleData[j + 7][i] & 0x11)))) {
-
-				// Clear pattern of four or more before or after
-				if (((j < 2 || ! (m_byModuleData[j - 2][i] & 0x11)) &&
-					 (j < 3 || ! (m_byModuleData[j - 3][i] & 0x11)) &&
-					 (j < 4 || ! (m_byModuleData[j - 4][i] & 0x11))) ||
-					((j >= m_nSymbleSize - 8 || ! (m_byModuleData[j + 8][i] & 0x11)) &&
-					 (j >= m_nSymbleSize - 9 || ! (m_byModuleData[j + 9][i] & 0x11)) &&
-					 (j >= m_nSymbleSize - 10 || ! (m_byModuleData[j + 10][i] & 0x11)))) {
-					nPenalty += 40;
-				}
-			}
-		}
+		nPenalty += CountLinePenalty(qwRows[i]) + CountLinePenalty(qwColumns[i]);
+
+		// The proportion of light modules
+		nCount += m_nSymbleSize - __builtin_popcountll(qwRows[i]);
 	}
 
-	// The proportion of modules for the entire dark
-	int nCount = 0;
+	// Modules of the same color block (2 ~ 2)
+	for (i = 0; i < m_nSymbleSize - 1; i++) {
+		uint64_t qwVertical = qwRows[i] ^ qwRows[i + 1];
+		uint64_t qwHorizontal = qwRows[i] ^ (qwRows[i] >> 1);
 
-	for (i = 0; i < m_nSymbleSize; i++) {
-		for (j = 0; j < m_nSymbleSize; j++) {
-			if (! (m_byModuleData[i][j] & 0x11)) {
-				nCount++;
-			}
-		}
+		nPenalty += 3 * __builtin_popcountll(~(qwVertical | (qwVertical >> 1) | qwHorizontal) &
+											 QR_LINE_MASK(m_nSymbleSize - 1));
 	}
 
 	nPenalty += (abs(50 - ((nCount * 100) / (m_nSymbleSize * m_nSymbleSize))) / 5) * 10;
@@ -882,12 +754,11 @@ int CountPenalty(void)
 
 void FormatModule(void)
 {
-	int i, j;
-
-	memset(m_byModuleData, 0, sizeof(m_byModuleData));
+	int i;
 
 	// Function module placement
-	SetFunctionModule();
+	m_lpqwFunctionRow = QR_Template[m_nVersion].lpqwFunctionRow;
+	memcpy(m_qwModuleRow, QR_Template[m_nVersion].lpqwModuleRow, m_nSymbleSize * sizeof(uint64_t));
 
 	// Data placement
 	SetCodeWordPattern();
@@ -897,16 +768,14 @@ void FormatModule(void)
 		// Select the best pattern masking
 		m_nMaskingNo = 0;
 
-		SetMaskingPattern(m_nMaskingNo); 		// Masking
 		SetFormatInfoPattern(m_nMaskingNo); 	// Placement pattern format information
 
-		int nMinPenalty = CountPenalty();
+		int nMinPenalty = CountPenalty(m_nMaskingNo);
 
 		for (i = 1; i <= 7; i++) {
-			SetMaskingPattern(i); 			// Masking
 			SetFormatInfoPattern(i); 		// Placement pattern format information
 
-			int nPenalty = CountPenalty();
+			int nPenalty = CountPenalty(i);
 
 			if (nPenalty < nMinPenalty) {
 				nMinPenalty = nPenalty;
@@ -915,29 +784,11 @@ void FormatModule(void)
 		}
 	}
 
-	SetMaskingPattern(m_nMaskingNo); 	// Masking
 	SetFormatInfoPattern(m_nMaskingNo); // Placement pattern format information
 
-	// The module pattern converted to a Boolean value
-
+	// Masking
 	for (i = 0; i < m_nSymbleSize; i++) {
-		for (j = 0; j < m_nSymbleSize; j++) {
-			m_byModuleData[i][j] = (uint8_t)((m_byModuleData[i][j] & 0x11) != 0);
-		}
-	}
-}
-
-void putBitToPos(uint32_t pos, int bw, uint8_t *bits)
-{
-	if (bw == 0) return;
-	uint32_t tmp;
-	uint32_t bitpos[8] = {128, 64, 32, 16, 8, 4, 2, 1};
-	if (pos % 8 == 0) {
-		tmp = (pos / 8) - 1;
-		bits[tmp] = bits[tmp] ^ bitpos[7];
-	} else {
-		tmp = pos / 8;
-		bits[tmp] = bits[tmp] ^ bitpos[pos % 8 - 1];
+		m_qwModuleRow[i] = GetMaskedRow(m_nMaskingNo, i);
 	}
 }
 
@@ -1079,12 +930,12 @@ int qr_encode(int level, int version, const char *source, size_t source_len, uin
 	// Module placement
 	FormatModule();
 
-	for (i = 0; i < m_nSymbleSize; i++) {
-		for (j = 0; j < m_nSymbleSize; j++) {
-			if (!m_byModuleData[i][j]) {
-				putBitToPos((j * m_nSymbleSize) + i + 1, 0, result);
-			} else {
-				putBitToPos((j * m_nSymbleSize) + i + 1, 1, result);
+	for (j = 0; j < m_nSymbleSize; j++) {
+		uint64_t qwRow = m_qwModuleRow[j];
+
+		for (i = j * m_nSymbleSize; qwRow != 0; i++, qwRow >>= 1) {
+			if (qwRow & 1) {
+				result[i / 8] |= (uint8_t)(0x80 >> (i % 8));
 			}
 		}
 	}
@@ -55,6 +55,15 @@ static uint64_t to_spend, spending, change_spend;
 static bool multisig_fp_set, multisig_fp_mismatch;
 static uint8_t multisig_fp[32];
 
+/* The request for the next item can be sent before the current TxAck has been
+ * processed, so that the host round trip overlaps with hashing/derivation here.
+ * The host's answer waits in the USB receive queue until this TxAck returns.
+ * If processing then fails, the answer to the prefetched request is still on
+ * its way and is dropped instead of being reported as an unexpected message.
+ */
+static bool ack_prefetched = false;
+static bool drop_prefetched_ack = false;
+
 /* === Variables =========================================================== */
 
 enum {
@@ -435,6 +444,8 @@ void signing_init(uint32_t _inputs_count, uint32_t _outputs_count, const CoinTyp
 	memset(&resp, 0, sizeof(TxRequest));
 
 	signing = true;
+	ack_prefetched = false;
+	drop_prefetched_ack = false;
 
 	multisig_fp_set = false;
 	multisig_fp_mismatch = false;
@@ -452,7 +463,7 @@ void signing_init(uint32_t _inputs_count, uint32_t _outputs_count, const CoinTyp
     set_exchange_error(NO_EXCHANGE_ERROR);
 }
 
-void parse_raw_txack(uint8_t *msg, uint32_t msg_size)
+void parse_raw_txack(uint8_t *msg, uint32_t msg_size, bool last_chunk)
 {
 	static int32_t state_pos = 0;
 	static uint8_t *ptr;
@@ -461,6 +472,21 @@ void parse_raw_txack(uint8_t *msg, uint32_t msg_size)
 	static uint32_t seen, script_len;
 	static uint64_t current_output_val;
 
+	/* A raw ack arrives in several chunks; only act once its last one is in */
+	if (!signing) {
+		if (last_chunk) {
+			if (drop_prefetched_ack) {
+				drop_prefetched_ack = false;
+			} else {
+				fsm_sendFailure(FailureType_Failure_UnexpectedMessage, "Not in Signing mode");
+				go_home();
+			}
+		}
+		return;
+	}
+
+	ack_prefetched = false;
+
 	for(uint32_t i = 0; i < msg_size; ++i) {
 
 		state_pos--;
@@ -619,17 +645,26 @@ void parse_raw_txack(uint8_t *msg, uint32_t msg_size)
 void signing_txack(TransactionType *tx)
 {
 	int co;
+	uint32_t cur;
 
 	if (!signing) {
+		if (drop_prefetched_ack) {
+			drop_prefetched_ack = false;
+			return;
+		}
 		fsm_sendFailure(FailureType_Failure_UnexpectedMessage, "Not in Signing mode");
 		go_home();
 		return;
 	}
 
 	memset(&resp, 0, sizeof(TxRequest));
+	ack_prefetched = false;
 
 	switch (signing_stage) {
 		case STAGE_REQUEST_1_INPUT:
+			memcpy(&input, tx->inputs, sizeof(TxInputType));
+			send_req_2_prev_meta();
+			ack_prefetched = true;
 			/* compute multisig fingerprint */
 			/* (if all input share the same fingerprint, outputs having the same fingerprint will be considered as change outputs) */
 			if (tx->inputs[0].script_type == InputScriptType_SPENDMULTISIG) {
@@ -657,8 +692,6 @@ void signing_txack(TransactionType *tx)
 				multisig_fp_mismatch = true;
 			}
 			sha256_Update(&tc, (const uint8_t *)tx->inputs, sizeof(TxInputType));
-			memcpy(&input, tx->inputs, sizeof(TxInputType));
-			send_req_2_prev_meta();
 			return;
 		case STAGE_REQUEST_2_PREV_META:
 			tx_init(&tp, tx->inputs_cnt, tx->outputs_cnt, tx->version, tx->lock_time, tx->extra_data_len, false);
@@ -671,11 +704,6 @@ void signing_txack(TransactionType *tx)
 			}
 			return;
 		case STAGE_REQUEST_2_PREV_INPUT:
-			if (!tx_serialize_input_hash(&tp, tx->inputs)) {
-				fsm_sendFailure(FailureType_Failure_Other, "Failed to serialize input");
-				signing_abort();
-				return;
-			}
 			if (idx2 < tp.inputs_len - 1) {
 				idx2++;
 				send_req_2_prev_input();
@@ -683,13 +711,14 @@ void signing_txack(TransactionType *tx)
 				idx2 = 0;
 				send_req_2_prev_output();
 			}
-			return;
-		case STAGE_REQUEST_2_PREV_OUTPUT:
-			if (!tx_serialize_output_hash(&tp, tx->bin_outputs)) {
-				fsm_sendFailure(FailureType_Failure_Other, "Failed to serialize output");
+			ack_prefetched = true;
+			if (!tx_serialize_input_hash(&tp, tx->inputs)) {
+				fsm_sendFailure(FailureType_Failure_Other, "Failed to serialize input");
 				signing_abort();
 				return;
 			}
+			return;
+		case STAGE_REQUEST_2_PREV_OUTPUT:
 			if (idx2 == input.prev_index) {
 				to_spend += tx->bin_outputs[0].amount;
 			}
@@ -697,11 +726,17 @@ void signing_txack(TransactionType *tx)
 				/* Check prevtx of next input */
 				idx2++;
 				send_req_2_prev_output();
-			} else { // last output
-				if (tp.extra_data_len > 0) { // has extra data
-					send_req_2_prev_extradata(0, MIN(1024, tp.extra_data_len));
-					return;
-				}
+				ack_prefetched = true;
+			} else if (tp.extra_data_len > 0) { // last output, has extra data
+				send_req_2_prev_extradata(0, MIN(1024, tp.extra_data_len));
+				ack_prefetched = true;
+			}
+			if (!tx_serialize_output_hash(&tp, tx->bin_outputs)) {
+				fsm_sendFailure(FailureType_Failure_Other, "Failed to serialize output");
+				signing_abort();
+				return;
+			}
+			if (!ack_prefetched) { // last output
 				tx_hash_final(&tp, hash, true);
 				if (memcmp(hash, input.prev_hash.bytes, 32) != 0) {
 					fsm_sendFailure(FailureType_Failure_Other, "Encountered invalid prevhash");
@@ -718,14 +753,17 @@ void signing_txack(TransactionType *tx)
 			}
 			return;
 		case STAGE_REQUEST_2_PREV_EXTRADATA:
+			cur = tp.extra_data_received + tx->extra_data.size;
+			if (cur < tp.extra_data_len) { // still some data remanining
+				send_req_2_prev_extradata(cur, MIN(1024, tp.extra_data_len - cur));
+				ack_prefetched = true;
+			}
 			if (!tx_serialize_extra_data_hash(&tp, tx->extra_data.bytes, tx->extra_data.size)) {
 				fsm_sendFailure(FailureType_Failure_Other, "Failed to serialize extra data");
 				signing_abort();
 				return;
 			}
-			if (tp.extra_data_received < tp.extra_data_len) { // still some data remanining
-				send_req_2_prev_extradata(tp.extra_data_received, MIN(1024, tp.extra_data_len - tp.extra_data_received));
-			} else {
+			if (!ack_prefetched) {
 				tx_hash_final(&tp, hash, true);
 				if (memcmp(hash, input.prev_hash.bytes, 32) != 0) {
 					fsm_sendFailure(FailureType_Failure_Other, "Encountered invalid prevhash");
@@ -846,7 +884,18 @@ void signing_txack(TransactionType *tx)
 			return;
 		}
 		case STAGE_REQUEST_4_INPUT:
-			if (idx2 == 0) {
+			/* Key derivation for the signed input is the slowest step, so
+			 * the next input/output is requested before doing it */
+			cur = idx2;
+			if (idx2 < inputs_count - 1) {
+				idx2++;
+				send_req_4_input();
+			} else {
+				idx2 = 0;
+				send_req_4_output();
+			}
+			ack_prefetched = true;
+			if (cur == 0) {
 				tx_init(&ti, inputs_count, outputs_count, version, lock_time, 0, true);
 				sha256_Init(&tc);
 				sha256_Update(&tc, (const uint8_t *)&inputs_count, sizeof(inputs_count));
@@ -857,7 +906,7 @@ void signing_txack(TransactionType *tx)
 				memset(pubkey, 0, 33);
 			}
 			sha256_Update(&tc, (const uint8_t *)tx->inputs, sizeof(TxInputType));
-			if (idx2 == idx1) {
+			if (cur == idx1) {
 				memcpy(&input, tx->inputs, sizeof(TxInputType));
 				memcpy(&node, root, sizeof(HDNode));
 				if(hdnode_private_ckd_cached(&node, tx->inputs[0].address_n, tx->inputs[0].address_n_count, NULL) == 0) {
@@ -892,15 +941,15 @@ void signing_txack(TransactionType *tx)
 				signing_abort();
 				return;
 			}
-			if (idx2 < inputs_count - 1) {
+			return;
+		case STAGE_REQUEST_4_OUTPUT:
+			/* The last output's request carries the signature, so only
+			 * earlier outputs can be prefetched */
+			if (idx2 < outputs_count - 1) {
 				idx2++;
-				send_req_4_input();
-			} else {
-				idx2 = 0;
 				send_req_4_output();
+				ack_prefetched = true;
 			}
-			return;
-		case STAGE_REQUEST_4_OUTPUT:
 			co = run_policy_compile_output(coin, root, (void *)tx->outputs, (void *)&bin_output, false);
 			if (co <= TXOUT_COMPILE_ERROR) {
 			    send_fsm_co_error_message(co);
@@ -913,10 +962,7 @@ void signing_txack(TransactionType *tx)
 				signing_abort();
 				return;
 			}
-			if (idx2 < outputs_count - 1) {
-				idx2++;
-				send_req_4_output();
-			} else {
+			if (!ack_prefetched) {
 				sha256_Final(&tc, hash);
 				if (memcmp(hash, hash_check, 32) != 0) {
 					fsm_sendFailure(FailureType_Failure_Other, "Transaction has changed during signing");
@@ -998,6 +1044,8 @@ void signing_txack(TransactionType *tx)
 void signing_abort(void)
 {
 	if (signing) {
+		drop_prefetched_ack = ack_prefetched;
+		ack_prefetched = false;
 		go_home();
 		signing = false;
 	}
@@ -21,6 +21,7 @@
 
 #include <string.h>
 #include <stdint.h>
+#include <stddef.h>
 
 #include <libopencm3/stm32/flash.h>
 
@@ -54,10 +55,28 @@ static char sessionPassphrase[51];
 
 static Allocation storage_location = FLASH_INVALID;
 
+/* Config as stored in flash (image plus replayed log) and offset of the first
+ * free word of the log in the active sector.  A log_end outside the log forces
+ * the next commit to compact into a fresh sector. */
+static ConfigFlash committed_config;
+static uint32_t log_end = 0;
+
+/* Blocks of shadow memory that differ from committed config, one bit each */
+static uint32_t dirty_blocks[(sizeof(ConfigFlash) + 32 * STORAGE_DIRTY_BLOCK - 1) /
+                            (32 * STORAGE_DIRTY_BLOCK)];
+
+/* Current word of the PIN failure area and its value.  Failures counted there
+ * come on top of pin_failed_attempts in the config. */
+static uint32_t pin_fail_word = STORAGE_PIN_FAIL_END;
+static uint32_t pin_fail_value = STORAGE_LOG_ERASED;
+
 /* === Variables =========================================================== */
 
 /* Shadow memory for configuration data in storage partition */
 _Static_assert(sizeof(ConfigFlash) <= FLASH_STORAGE_LEN, "ConfigFlash struct is too large for storage partition");
+_Static_assert(sizeof(ConfigFlash) <= 0xFFFF, "ConfigFlash offsets do not fit storage log header");
+_Static_assert(STORAGE_LOG_START + 2 * STORAGE_LOG_RECORD_MAX <= STORAGE_LOG_END,
+               "No room for storage log after ConfigFlash");
 static ConfigFlash shadow_config;
 
 /* === Private Functions =================================================== */
@@ -114,6 +133,7 @@ static bool storage_from_flash(ConfigFlash *stor_config)
 
         case 2:
         case 3:
+        case 4:
             memcpy(&shadow_config, stor_config, sizeof(shadow_config));
 
             /* We have to do this for users with bootloaders <= v1.0.2. This
@@ -176,6 +196,405 @@ static void wear_leveling_shift(void)
     }
 }
 
+/*
+ * storage_log_record_ok() - Checks a log record header and crc
+ *
+ * INPUT
+ *     - record: pointer to record in flash
+ *     - pos: offset of record in sector
+ *     - size: set to size of record in bytes when header is sane
+ * OUTPUT
+ *     true/false whether record is intact
+ */
+static bool storage_log_record_ok(const uint32_t *record, uint32_t pos, uint32_t *size)
+{
+    uint32_t offset = record[0] >> 16;
+    uint32_t len = record[0] & STORAGE_LOG_LEN_MASK;
+    uint32_t words = (len + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    *size = 0;
+
+    if(len == 0 || offset + len > sizeof(ConfigFlash) ||
+            pos + (words + 2) * sizeof(uint32_t) > STORAGE_LOG_END)
+    {
+        return(false);
+    }
+
+    *size = (words + 2) * sizeof(uint32_t);
+    return(calc_crc32((uint32_t *)record, words + 1) == record[words + 1]);
+}
+
+/*
+ * storage_log_replay() - Loads config image from a storage sector and applies
+ * every complete commit found in its log
+ *
+ * INPUT
+ *     - sector: start of active storage sector
+ * OUTPUT
+ *     none
+ */
+static void storage_log_replay(const uint8_t *sector)
+{
+    uint32_t pos = STORAGE_LOG_START, commit_start = pos, p, size;
+    const uint32_t *record;
+    bool commit_ok = true;
+
+    memcpy(&committed_config, sector, sizeof(committed_config));
+
+    while(pos + 2 * sizeof(uint32_t) <= STORAGE_LOG_END)
+    {
+        record = (const uint32_t *)(sector + pos);
+
+        if(record[0] == STORAGE_LOG_ERASED)
+        {
+            break;
+        }
+
+        if(!storage_log_record_ok(record, pos, &size))
+        {
+            commit_ok = false;
+
+            if(size == 0)
+            {
+                /* Header is damaged so the rest of the log can't be walked */
+                break;
+            }
+        }
+
+        pos += size;
+
+        if(record[0] & STORAGE_LOG_LAST)
+        {
+            /* Apply a commit only when all of its records made it to flash */
+            for(p = commit_start; commit_ok && p < pos; p += size)
+            {
+                record = (const uint32_t *)(sector + p);
+                storage_log_record_ok(record, p, &size);
+                memcpy((uint8_t *)&committed_config + (record[0] >> 16), &record[1],
+                       record[0] & STORAGE_LOG_LEN_MASK);
+            }
+
+            commit_start = pos;
+            commit_ok = true;
+        }
+    }
+
+    /* Don't append behind a damaged or interrupted commit, compact instead */
+    log_end = (commit_start == pos && commit_ok) ? pos : STORAGE_LOG_END;
+}
+
+/*
+ * storage_mark_dirty() - Compares shadow memory against committed config
+ * block by block
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether any block differs
+ */
+static bool storage_mark_dirty(void)
+{
+    const uint8_t *shadow = (const uint8_t *)&shadow_config;
+    const uint8_t *committed = (const uint8_t *)&committed_config;
+    uint32_t block, offset, len;
+    bool dirty = false;
+
+    memset(dirty_blocks, 0, sizeof(dirty_blocks));
+
+    for(block = 0; block * STORAGE_DIRTY_BLOCK < sizeof(ConfigFlash); block++)
+    {
+        offset = block * STORAGE_DIRTY_BLOCK;
+        len = sizeof(ConfigFlash) - offset;
+
+        if(len > STORAGE_DIRTY_BLOCK)
+        {
+            len = STORAGE_DIRTY_BLOCK;
+        }
+
+        if(memcmp(shadow + offset, committed + offset, len) != 0)
+        {
+            dirty_blocks[block / 32] |= 1u << (block % 32);
+            dirty = true;
+        }
+    }
+
+    return(dirty);
+}
+
+/*
+ * storage_log_next_range() - Finds next range of shadow memory that differs
+ * from what is committed to flash
+ *
+ * INPUT
+ *     - from: offset to start searching at
+ *     - start: set to word aligned start of range
+ *     - len: set to length of range
+ * OUTPUT
+ *     true/false whether a changed range was found
+ */
+static bool storage_log_next_range(uint32_t from, uint32_t *start, uint32_t *len)
+{
+    const uint8_t *shadow = (const uint8_t *)&shadow_config;
+    const uint8_t *committed = (const uint8_t *)&committed_config;
+    uint32_t i, end;
+
+    for(i = from; i < sizeof(ConfigFlash) && shadow[i] == committed[i]; i++)
+    {
+        /* Skip to the end of blocks without changes */
+        if(!(dirty_blocks[i / STORAGE_DIRTY_BLOCK / 32] &
+                (1u << (i / STORAGE_DIRTY_BLOCK % 32))))
+        {
+            i |= STORAGE_DIRTY_BLOCK - 1;
+        }
+    }
+
+    if(i >= sizeof(ConfigFlash))
+    {
+        return(false);
+    }
+
+    *start = i & ~(sizeof(uint32_t) - 1);
+    end = i + 1;
+
+    for(i = end; i < sizeof(ConfigFlash) && i - *start < STORAGE_LOG_RECORD_MAX; i++)
+    {
+        if(shadow[i] != committed[i])
+        {
+            end = i + 1;
+        }
+        else if(i - end >= STORAGE_LOG_MERGE_GAP)
+        {
+            break;
+        }
+    }
+
+    *len = end - *start;
+    return(true);
+}
+
+/*
+ * storage_log_secret_overwritten() - Checks whether a commit replaces secret data
+ * that would otherwise stay readable in the sector image or log
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether secret data is being overwritten
+ */
+static bool storage_log_secret_overwritten(void)
+{
+    static const struct
+    {
+        size_t offset;
+        size_t len;
+    } secrets[] =
+    {
+        { offsetof(ConfigFlash, storage.node), sizeof(((ConfigFlash *)NULL)->storage.node) },
+        { offsetof(ConfigFlash, storage.mnemonic), sizeof(((ConfigFlash *)NULL)->storage.mnemonic) },
+        { offsetof(ConfigFlash, storage.pin), sizeof(((ConfigFlash *)NULL)->storage.pin) },
+        { offsetof(ConfigFlash, cache.root_seed_cache), sizeof(((ConfigFlash *)NULL)->cache.root_seed_cache) }
+    };
+    const uint8_t *shadow = (const uint8_t *)&shadow_config;
+    const uint8_t *committed = (const uint8_t *)&committed_config;
+    uint32_t i, j;
+
+    for(i = 0; i < sizeof(secrets) / sizeof(secrets[0]); i++)
+    {
+        if(memcmp(shadow + secrets[i].offset, committed + secrets[i].offset,
+                  secrets[i].len) == 0)
+        {
+            continue;
+        }
+
+        for(j = 0; j < secrets[i].len; j++)
+        {
+            if(committed[secrets[i].offset + j] != 0)
+            {
+                return(true);
+            }
+        }
+    }
+
+    return(false);
+}
+
+/*
+ * storage_log_append() - Appends changes between shadow memory and flash to
+ * the log of the active storage sector
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether changes were committed.  False means the sector has
+ *     to be compacted.
+ */
+static bool storage_log_append(void)
+{
+    uint32_t record[STORAGE_LOG_RECORD_MAX / sizeof(uint32_t) + 2];
+    uint32_t start, len, words, next, needed = 0, pos = log_end;
+    const uint8_t *sector = (const uint8_t *)flash_write_helper(storage_location);
+    bool ret_stat = true;
+
+    if(log_end < STORAGE_LOG_START || log_end > STORAGE_LOG_END)
+    {
+        return(false);
+    }
+
+    /* Old secrets must be erased, which only compaction does */
+    if(storage_log_secret_overwritten())
+    {
+        return(false);
+    }
+
+    /* Size the whole commit first so it never straddles a compaction */
+    for(next = 0; storage_log_next_range(next, &start, &len); next = start + len)
+    {
+        needed += ((len + sizeof(uint32_t) - 1) / sizeof(uint32_t) + 2) * sizeof(uint32_t);
+    }
+
+    if(needed == 0)
+    {
+        return(true);
+    }
+
+    if(pos + needed > STORAGE_LOG_END)
+    {
+        return(false);
+    }
+
+    flash_unlock();
+
+    for(next = 0; storage_log_next_range(next, &start, &len); next = start + len)
+    {
+        words = (len + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+        record[0] = (start << 16) | len;
+
+        if(pos + (words + 2) * sizeof(uint32_t) == log_end + needed)
+        {
+            record[0] |= STORAGE_LOG_LAST;
+        }
+
+        memset(&record[1], 0xFF, words * sizeof(uint32_t));
+        memcpy(&record[1], (uint8_t *)&shadow_config + start, len);
+        record[words + 1] = calc_crc32(record, words + 1);
+
+        if(!flash_write_word(storage_location, pos, (words + 2) * sizeof(uint32_t),
+                             (uint8_t *)record) ||
+                memcmp(sector + pos, record, (words + 2) * sizeof(uint32_t)) != 0)
+        {
+            ret_stat = false;
+            break;
+        }
+
+        pos += (words + 2) * sizeof(uint32_t);
+    }
+
+    flash_lock();
+
+    if(ret_stat)
+    {
+        memcpy(&committed_config, &shadow_config, sizeof(committed_config));
+        log_end = pos;
+    }
+
+    return(ret_stat);
+}
+
+/*
+ * storage_pin_fail_scan() - Finds current word of the PIN failure area
+ *
+ * INPUT
+ *     - sector: start of active storage sector
+ * OUTPUT
+ *     none
+ */
+static void storage_pin_fail_scan(const uint8_t *sector)
+{
+    const uint32_t *word;
+
+    for(pin_fail_word = STORAGE_PIN_FAIL_START; pin_fail_word < STORAGE_PIN_FAIL_END;
+            pin_fail_word += sizeof(uint32_t))
+    {
+        word = (const uint32_t *)(sector + pin_fail_word);
+
+        /* Retired words are all zero */
+        if(*word != 0)
+        {
+            pin_fail_value = *word;
+            return;
+        }
+    }
+
+    pin_fail_value = STORAGE_LOG_ERASED;
+}
+
+/*
+ * storage_pin_fail_count() - Number of PIN failures in current word of the
+ * PIN failure area
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     number of cleared bits
+ */
+static uint32_t storage_pin_fail_count(void)
+{
+    if(pin_fail_word >= STORAGE_PIN_FAIL_END)
+    {
+        return(0);
+    }
+
+    return(32 - __builtin_popcount(pin_fail_value));
+}
+
+/*
+ * storage_pin_fail_program() - Clears bits of current word of the PIN failure
+ * area without erasing
+ *
+ * INPUT
+ *     - value: new word value, may only clear bits
+ * OUTPUT
+ *     true/false whether word was programmed
+ */
+static bool storage_pin_fail_program(uint32_t value)
+{
+    const uint32_t *word = (const uint32_t *)(flash_write_helper(storage_location) +
+                           pin_fail_word);
+    bool ret_stat;
+
+    if(pin_fail_word >= STORAGE_PIN_FAIL_END)
+    {
+        return(false);
+    }
+
+    flash_unlock();
+    ret_stat = flash_write_word(storage_location, pin_fail_word, sizeof(uint32_t),
+                                (uint8_t *)&value) && *word == value;
+    flash_lock();
+
+    if(ret_stat)
+    {
+        pin_fail_value = value;
+    }
+    else
+    {
+        /* Word is in an unknown state, keep its count in the config and stop
+         * using the area until the next compaction */
+        if(storage_pin_fail_count())
+        {
+            shadow_config.storage.has_pin_failed_attempts = true;
+            shadow_config.storage.pin_failed_attempts += storage_pin_fail_count();
+        }
+
+        pin_fail_word = STORAGE_PIN_FAIL_END;
+        pin_fail_value = STORAGE_LOG_ERASED;
+        log_end = 0;
+    }
+
+    return(ret_stat);
+}
+
 /*
  * storage_set_root_seed_cache() - Sets root session seed  in storage
  *
@@ -277,6 +696,11 @@ void storage_init(void)
     if(memcmp((void *)stor_config->meta.magic , STORAGE_MAGIC_STR,
               STORAGE_MAGIC_LEN) == 0)
     {
+        /* Bring in changes appended since the sector was last compacted */
+        storage_log_replay((const uint8_t *)stor_config);
+        storage_pin_fail_scan((const uint8_t *)stor_config);
+        stor_config = &committed_config;
+
         /* Clear out stor_config before finding end config node */
         memcpy(shadow_config.meta.uuid, (void *)&stor_config->meta.uuid,
                sizeof(shadow_config.meta.uuid));
@@ -291,9 +715,12 @@ void storage_init(void)
             }
         }
 
-        /* New app with storage version changed!  update the storage space */
+        /* New app with storage version changed!  update the storage space.
+         * Compact rather than append so the base image is rewritten at the
+         * new version too. */
         if(stor_config->storage.version != STORAGE_VERSION)
         {
+            log_end = 0;
             storage_commit();
         }
     }
@@ -338,6 +765,14 @@ void storage_reset(void)
 
     storage_reset_policies();
 
+    /* Drop failures counted in flash, which takes a compaction */
+    if(storage_pin_fail_count())
+    {
+        pin_fail_word = STORAGE_PIN_FAIL_END;
+        pin_fail_value = STORAGE_LOG_ERASED;
+        log_end = 0;
+    }
+
     shadow_config.storage.version = STORAGE_VERSION;
     session_clear(true); // clear PIN as well
 }
@@ -365,31 +800,28 @@ void session_clear(bool clear_pin)
 }
 
 /*
- * storage_commit() - Write content of configuration in shadow memory to
- * storage partion in flash
+ * storage_compact() - Write content of configuration in shadow memory to the
+ * next storage sector, leaving an empty log behind it
  *
  * INPUT
  *     none
  * OUTPUT
  *     none
  */
-void storage_commit(void)
+static void storage_compact(void)
 {
-    uint32_t shadow_ram_crc32, shadow_flash_crc32, retries;
+    uint32_t retries;
 
-    memcpy((void *)&shadow_config, STORAGE_MAGIC_STR, STORAGE_MAGIC_LEN);
+    /* PIN failure area is erased with the sector, keep its count in the config */
+    if(storage_pin_fail_count())
+    {
+        shadow_config.storage.has_pin_failed_attempts = true;
+        shadow_config.storage.pin_failed_attempts += storage_pin_fail_count();
+        pin_fail_value = STORAGE_LOG_ERASED;
+    }
 
     for(retries = 0; retries < STORAGE_RETRIES; retries++)
     {
-        /* Capture CRC for verification at restore */
-        shadow_ram_crc32 = calc_crc32((uint32_t *)&shadow_config,
-                                      sizeof(shadow_config) / sizeof(uint32_t));
-
-        if(shadow_ram_crc32 == 0)
-        {
-            continue; /* Retry */
-        }
-
         /* Make sure flash is in good state before proceeding */
         if(!flash_chk_status())
         {
@@ -427,12 +859,10 @@ void storage_commit(void)
             continue; /* Retry */
         }
 
-        /* Flash write completed successfully.  Verify CRC */
-        shadow_flash_crc32 = calc_crc32((uint32_t *)flash_write_helper(
-                                            storage_location),
-                                        sizeof(shadow_config) / sizeof(uint32_t));
-
-        if(shadow_flash_crc32 == shadow_ram_crc32)
+        /* Flash write completed successfully.  Compare it against shadow
+         * memory directly instead of checksumming both copies */
+        if(memcmp((void *)flash_write_helper(storage_location), &shadow_config,
+                  sizeof(shadow_config)) == 0)
         {
             /* Commit successful, break to exit */
             break;
@@ -450,6 +880,36 @@ void storage_commit(void)
         layout_warning_static("Error Detected.  Reboot Device!");
         system_halt();
     }
+
+    memcpy(&committed_config, &shadow_config, sizeof(committed_config));
+    log_end = STORAGE_LOG_START;
+    pin_fail_word = STORAGE_PIN_FAIL_START;
+    pin_fail_value = STORAGE_LOG_ERASED;
+}
+
+/*
+ * storage_commit() - Write content of configuration in shadow memory to
+ * storage partion in flash
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void storage_commit(void)
+{
+    memcpy((void *)&shadow_config, STORAGE_MAGIC_STR, STORAGE_MAGIC_LEN);
+
+    /* Nothing to write when flash already holds the shadow */
+    if(!storage_mark_dirty() && log_end >= STORAGE_LOG_START && log_end <= STORAGE_LOG_END)
+    {
+        return;
+    }
+
+    if(!storage_log_append())
+    {
+        storage_compact();
+    }
 }
 
 /*
@@ -685,6 +1145,14 @@ bool session_is_pin_cached(void)
  */
 void storage_reset_pin_fails(void)
 {
+    /* Retire current word of the PIN failure area.  If that fails its count
+     * has been moved to the config and the commit below compacts. */
+    if(storage_pin_fail_count() && storage_pin_fail_program(0))
+    {
+        pin_fail_word += sizeof(uint32_t);
+        pin_fail_value = STORAGE_LOG_ERASED;
+    }
+
     /* Only write to flash if there's a change in status */
     if(shadow_config.storage.has_pin_failed_attempts == true)
     {
@@ -705,6 +1173,14 @@ void storage_reset_pin_fails(void)
  */
 void storage_increase_pin_fails(void)
 {
+    /* Clear one more bit, as long as that doesn't make the word look retired */
+    if((pin_fail_value & (pin_fail_value - 1)) != 0 &&
+            storage_pin_fail_program(pin_fail_value & (pin_fail_value - 1)))
+    {
+        return;
+    }
+
+    /* Area is used up, move the count to the config and start a fresh sector */
     if(!shadow_config.storage.has_pin_failed_attempts)
     {
         shadow_config.storage.has_pin_failed_attempts = true;
@@ -715,6 +1191,7 @@ void storage_increase_pin_fails(void)
         shadow_config.storage.pin_failed_attempts++;
     }
 
+    log_end = 0;
     storage_commit();
 }
 
@@ -728,8 +1205,8 @@ void storage_increase_pin_fails(void)
  */
 uint32_t storage_get_pin_fails(void)
 {
-    return shadow_config.storage.has_pin_failed_attempts ?
-           shadow_config.storage.pin_failed_attempts : 0;
+    return (shadow_config.storage.has_pin_failed_attempts ?
+            shadow_config.storage.pin_failed_attempts : 0) + storage_pin_fail_count();
 }
 
 /*
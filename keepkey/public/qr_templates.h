@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2010 Psytec Inc.
+ * Copyright (c) 2012 Alexey Mednyy <swexru@gmail.com>
+ * Copyright (c) 2012-2014 Pavol Rusnak <stick@gk2.sk>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* === Typedefs ============================================================ */
+
+typedef struct
+{
+	const uint64_t* lpqwFunctionRow;	// [y], bit x set for a function module
+	const uint64_t* lpqwModuleRow;		// [y], bit x set for a dark function module
+} QR_TEMPLATE;
+
+/* === Variables =========================================================== */
+
+// Function patterns of versions 1 - 9: position detection, separator, timing,
+// alignment and version information patterns, with the format information
+// area reserved (light). Generated from the former SetFunctionModule().
+
+static const uint64_t qwTemplateFunction1[] = {
+	0x00000000001fe1ffULL, 0x00000000001fe1ffULL, 0x00000000001fe1ffULL, 0x00000000001fe1ffULL,
+	0x00000000001fe1ffULL, 0x00000000001fe1ffULL, 0x00000000001fffffULL, 0x00000000001fe1ffULL,
+	0x00000000001fe1ffULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x00000000000001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL,
+	0x00000000000001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL,
+	0x00000000000001ffULL
+};
+
+static const uint64_t qwTemplateModule1[] = {
+	0x00000000001fc07fULL, 0x0000000000104041ULL, 0x000000000017405dULL, 0x000000000017405dULL,
+	0x000000000017405dULL, 0x0000000000104041ULL, 0x00000000001fd57fULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x000000000000007fULL, 0x0000000000000041ULL,
+	0x000000000000005dULL, 0x000000000000005dULL, 0x000000000000005dULL, 0x0000000000000041ULL,
+	0x000000000000007fULL
+};
+
+static const uint64_t qwTemplateFunction2[] = {
+	0x0000000001fe01ffULL, 0x0000000001fe01ffULL, 0x0000000001fe01ffULL, 0x0000000001fe01ffULL,
+	0x0000000001fe01ffULL, 0x0000000001fe01ffULL, 0x0000000001ffffffULL, 0x0000000001fe01ffULL,
+	0x0000000001fe01ffULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x00000000001f0040ULL, 0x00000000001f01ffULL, 0x00000000001f01ffULL, 0x00000000001f01ffULL,
+	0x00000000001f01ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL,
+	0x00000000000001ffULL
+};
+
+static const uint64_t qwTemplateModule2[] = {
+	0x0000000001fc007fULL, 0x0000000001040041ULL, 0x000000000174005dULL, 0x000000000174005dULL,
+	0x000000000174005dULL, 0x0000000001040041ULL, 0x0000000001fd557fULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x00000000001f0040ULL, 0x0000000000110000ULL, 0x000000000015007fULL, 0x0000000000110041ULL,
+	0x00000000001f005dULL, 0x000000000000005dULL, 0x000000000000005dULL, 0x0000000000000041ULL,
+	0x000000000000007fULL
+};
+
+static const uint64_t qwTemplateFunction3[] = {
+	0x000000001fe001ffULL, 0x000000001fe001ffULL, 0x000000001fe001ffULL, 0x000000001fe001ffULL,
+	0x000000001fe001ffULL, 0x000000001fe001ffULL, 0x000000001fffffffULL, 0x000000001fe001ffULL,
+	0x000000001fe001ffULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000001f00040ULL, 0x0000000001f001ffULL, 0x0000000001f001ffULL, 0x0000000001f001ffULL,
+	0x0000000001f001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL,
+	0x00000000000001ffULL
+};
+
+static const uint64_t qwTemplateModule3[] = {
+	0x000000001fc0007fULL, 0x0000000010400041ULL, 0x000000001740005dULL, 0x000000001740005dULL,
+	0x000000001740005dULL, 0x0000000010400041ULL, 0x000000001fd5557fULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000001f00040ULL, 0x0000000001100000ULL, 0x000000000150007fULL, 0x0000000001100041ULL,
+	0x0000000001f0005dULL, 0x000000000000005dULL, 0x000000000000005dULL, 0x0000000000000041ULL,
+	0x000000000000007fULL
+};
+
+static const uint64_t qwTemplateFunction4[] = {
+	0x00000001fe0001ffULL, 0x00000001fe0001ffULL, 0x00000001fe0001ffULL, 0x00000001fe0001ffULL,
+	0x00000001fe0001ffULL, 0x00000001fe0001ffULL, 0x00000001ffffffffULL, 0x00000001fe0001ffULL,
+	0x00000001fe0001ffULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x000000001f000040ULL, 0x000000001f0001ffULL, 0x000000001f0001ffULL, 0x000000001f0001ffULL,
+	0x000000001f0001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL,
+	0x00000000000001ffULL
+};
+
+static const uint64_t qwTemplateModule4[] = {
+	0x00000001fc00007fULL, 0x0000000104000041ULL, 0x000000017400005dULL, 0x000000017400005dULL,
+	0x000000017400005dULL, 0x0000000104000041ULL, 0x00000001fd55557fULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x000000001f000040ULL, 0x0000000011000000ULL, 0x000000001500007fULL, 0x0000000011000041ULL,
+	0x000000001f00005dULL, 0x000000000000005dULL, 0x000000000000005dULL, 0x0000000000000041ULL,
+	0x000000000000007fULL
+};
+
+static const uint64_t qwTemplateFunction5[] = {
+	0x0000001fe00001ffULL, 0x0000001fe00001ffULL, 0x0000001fe00001ffULL, 0x0000001fe00001ffULL,
+	0x0000001fe00001ffULL, 0x0000001fe00001ffULL, 0x0000001fffffffffULL, 0x0000001fe00001ffULL,
+	0x0000001fe00001ffULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x00000001f0000040ULL, 0x00000001f00001ffULL, 0x00000001f00001ffULL, 0x00000001f00001ffULL,
+	0x00000001f00001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL,
+	0x00000000000001ffULL
+};
+
+static const uint64_t qwTemplateModule5[] = {
+	0x0000001fc000007fULL, 0x0000001040000041ULL, 0x000000174000005dULL, 0x000000174000005dULL,
+	0x000000174000005dULL, 0x0000001040000041ULL, 0x0000001fd555557fULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x00000001f0000040ULL, 0x0000000110000000ULL, 0x000000015000007fULL, 0x0000000110000041ULL,
+	0x00000001f000005dULL, 0x000000000000005dULL, 0x000000000000005dULL, 0x0000000000000041ULL,
+	0x000000000000007fULL
+};
+
+static const uint64_t qwTemplateFunction6[] = {
+	0x000001fe000001ffULL, 0x000001fe000001ffULL, 0x000001fe000001ffULL, 0x000001fe000001ffULL,
+	0x000001fe000001ffULL, 0x000001fe000001ffULL, 0x000001ffffffffffULL, 0x000001fe000001ffULL,
+	0x000001fe000001ffULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000001f00000040ULL, 0x0000001f000001ffULL, 0x0000001f000001ffULL, 0x0000001f000001ffULL,
+	0x0000001f000001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL,
+	0x00000000000001ffULL
+};
+
+static const uint64_t qwTemplateModule6[] = {
+	0x000001fc0000007fULL, 0x0000010400000041ULL, 0x000001740000005dULL, 0x000001740000005dULL,
+	0x000001740000005dULL, 0x0000010400000041ULL, 0x000001fd5555557fULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000001f00000040ULL, 0x0000001100000000ULL, 0x000000150000007fULL, 0x0000001100000041ULL,
+	0x0000001f0000005dULL, 0x000000000000005dULL, 0x000000000000005dULL, 0x0000000000000041ULL,
+	0x000000000000007fULL
+};
+
+static const uint64_t qwTemplateFunction7[] = {
+	0x00001ffc000001ffULL, 0x00001ffc000001ffULL, 0x00001ffc000001ffULL, 0x00001ffc000001ffULL,
+	0x00001ffc01f001ffULL, 0x00001ffc01f001ffULL, 0x00001fffffffffffULL, 0x00001fe001f001ffULL,
+	0x00001fe001f001ffULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x000001f001f001f0ULL, 0x000001f001f001f0ULL, 0x000001f001f001f0ULL, 0x000001f001f001f0ULL,
+	0x000001f001f001f0ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x000000000000007fULL, 0x000000000000007fULL,
+	0x000001f001f0007fULL, 0x000001f001f001ffULL, 0x000001f001f001ffULL, 0x000001f001f001ffULL,
+	0x000001f001f001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL,
+	0x00000000000001ffULL
+};
+
+static const uint64_t qwTemplateModule7[] = {
+	0x00001fd00000007fULL, 0x0000104800000041ULL, 0x000017480000005dULL, 0x000017580000005dULL,
+	0x0000175c01f0005dULL, 0x0000104001100041ULL, 0x00001fd55555557fULL, 0x0000000001100000ULL,
+	0x0000000001f00040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x000001f001f001f0ULL, 0x0000011001100110ULL, 0x0000015001500150ULL, 0x0000011001100110ULL,
+	0x000001f001f001f0ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000050ULL, 0x000000000000001eULL,
+	0x000001f001f00059ULL, 0x0000011001100000ULL, 0x000001500150007fULL, 0x0000011001100041ULL,
+	0x000001f001f0005dULL, 0x000000000000005dULL, 0x000000000000005dULL, 0x0000000000000041ULL,
+	0x000000000000007fULL
+};
+
+static const uint64_t qwTemplateFunction8[] = {
+	0x0001ffc0000001ffULL, 0x0001ffc0000001ffULL, 0x0001ffc0000001ffULL, 0x0001ffc0000001ffULL,
+	0x0001ffc007c001ffULL, 0x0001ffc007c001ffULL, 0x0001ffffffffffffULL, 0x0001fe0007c001ffULL,
+	0x0001fe0007c001ffULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x00001f0007c001f0ULL, 0x00001f0007c001f0ULL,
+	0x00001f0007c001f0ULL, 0x00001f0007c001f0ULL, 0x00001f0007c001f0ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x000000000000007fULL, 0x000000000000007fULL,
+	0x00001f0007c0007fULL, 0x00001f0007c001ffULL, 0x00001f0007c001ffULL, 0x00001f0007c001ffULL,
+	0x00001f0007c001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL,
+	0x00000000000001ffULL
+};
+
+static const uint64_t qwTemplateModule8[] = {
+	0x0001fd000000007fULL, 0x000105c000000041ULL, 0x000175800000005dULL, 0x000174800000005dULL,
+	0x0001740007c0005dULL, 0x0001044004400041ULL, 0x0001fd555555557fULL, 0x0000000004400000ULL,
+	0x0000000007c00040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x00001f0007c001f0ULL, 0x0000110004400110ULL,
+	0x0000150005400150ULL, 0x0000110004400110ULL, 0x00001f0007c001f0ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000062ULL, 0x000000000000000eULL,
+	0x00001f0007c00047ULL, 0x0000110004400000ULL, 0x000015000540007fULL, 0x0000110004400041ULL,
+	0x00001f0007c0005dULL, 0x000000000000005dULL, 0x000000000000005dULL, 0x0000000000000041ULL,
+	0x000000000000007fULL
+};
+
+static const uint64_t qwTemplateFunction9[] = {
+	0x001ffc00000001ffULL, 0x001ffc00000001ffULL, 0x001ffc00000001ffULL, 0x001ffc00000001ffULL,
+	0x001ffc001f0001ffULL, 0x001ffc001f0001ffULL, 0x001fffffffffffffULL, 0x001fe0001f0001ffULL,
+	0x001fe0001f0001ffULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0001f0001f0001f0ULL, 0x0001f0001f0001f0ULL, 0x0001f0001f0001f0ULL, 0x0001f0001f0001f0ULL,
+	0x0001f0001f0001f0ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000000040ULL,
+	0x0000000000000040ULL, 0x0000000000000040ULL, 0x000000000000007fULL, 0x000000000000007fULL,
+	0x0001f0001f00007fULL, 0x0001f0001f0001ffULL, 0x0001f0001f0001ffULL, 0x0001f0001f0001ffULL,
+	0x0001f0001f0001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL, 0x00000000000001ffULL,
+	0x00000000000001ffULL
+};
+
+static const uint64_t qwTemplateModule9[] = {
+	0x001fc4000000007fULL, 0x00104c0000000041ULL, 0x001748000000005dULL, 0x001754000000005dULL,
+	0x001744001f00005dULL, 0x0010440011000041ULL, 0x001fd5555555557fULL, 0x0000000011000000ULL,
+	0x000000001f000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0001f0001f0001f0ULL, 0x0001100011000110ULL, 0x0001500015000150ULL, 0x0001100011000110ULL,
+	0x0001f0001f0001f0ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+	0x0000000000000040ULL, 0x0000000000000000ULL, 0x000000000000007bULL, 0x0000000000000006ULL,
+	0x0001f0001f000048ULL, 0x0001100011000000ULL, 0x000150001500007fULL, 0x0001100011000041ULL,
+	0x0001f0001f00005dULL, 0x000000000000005dULL, 0x000000000000005dULL, 0x0000000000000041ULL,
+	0x000000000000007fULL
+};
+
+static const QR_TEMPLATE QR_Template[] = {
+	{NULL, NULL},
+	{qwTemplateFunction1, qwTemplateModule1},
+	{qwTemplateFunction2, qwTemplateModule2},
+	{qwTemplateFunction3, qwTemplateModule3},
+	{qwTemplateFunction4, qwTemplateModule4},
+	{qwTemplateFunction5, qwTemplateModule5},
+	{qwTemplateFunction6, qwTemplateModule6},
+	{qwTemplateFunction7, qwTemplateModule7},
+	{qwTemplateFunction8, qwTemplateModule8},
+	{qwTemplateFunction9, qwTemplateModule9}
+};
@@ -40,7 +40,7 @@
 
 void signing_init(uint32_t _inputs_count, uint32_t _outputs_count, const CoinType *_coin, const HDNode *_root, uint32_t _version, uint32_t _lock_time);
 void signing_abort(void);
-void parse_raw_txack(uint8_t *msg, uint32_t msg_size);
+void parse_raw_txack(uint8_t *msg, uint32_t msg_size, bool last_chunk);
 void signing_txack(TransactionType *tx);
 void send_fsm_co_error_message(int co_error);
 
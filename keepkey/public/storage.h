@@ -30,9 +30,36 @@
 
 /* === Defines ============================================================= */
 
-#define STORAGE_VERSION 3
+#define STORAGE_VERSION 4
 #define STORAGE_RETRIES 3
 
+/* Commits are appended as records after the config image in the active
+ * storage sector, until the sector is full and has to be compacted.
+ *
+ * Record layout (32-bit words):
+ *     header: offset in ConfigFlash (bits 31-16), last record of commit flag
+ *             (bit 15) and data length in bytes (bits 14-0)
+ *     data:   new bytes for that range, padded to a word with 0xFF
+ *     crc:    crc32 of header and data words
+ */
+#define STORAGE_LOG_START       ((sizeof(ConfigFlash) + sizeof(uint32_t) - 1) & \
+                                 ~(sizeof(uint32_t) - 1))
+#define STORAGE_LOG_LAST        0x8000
+#define STORAGE_LOG_LEN_MASK    0x7FFF
+#define STORAGE_LOG_RECORD_MAX  256     /* data bytes per record */
+#define STORAGE_LOG_MERGE_GAP   8       /* unchanged bytes merged into a record */
+#define STORAGE_LOG_ERASED      0xFFFFFFFF
+#define STORAGE_LOG_END         STORAGE_PIN_FAIL_START
+#define STORAGE_DIRTY_BLOCK     64      /* bytes compared per block on commit */
+
+/* PIN failures are counted by clearing one more bit of the current word in
+ * an erased area at the end of the storage sector.  A correct PIN retires the
+ * word by clearing it completely.  The area is only renewed on compaction. */
+#define STORAGE_PIN_FAIL_WORDS  32
+#define STORAGE_PIN_FAIL_START  (STOR_FLASH_SECT_LEN - \
+                                 STORAGE_PIN_FAIL_WORDS * sizeof(uint32_t))
+#define STORAGE_PIN_FAIL_END    STOR_FLASH_SECT_LEN
+
 /* === Functions =========================================================== */
 
 void storage_init(void);
@@ -20,14 +20,164 @@
 /* === Includes ============================================================ */
 
 #include <stddef.h>
+#include <string.h>
 
 #include "draw.h"
 #include "keepkey_display.h"
 #include "font.h"
 #include "resources.h"
+#include "text_layout.h"
+
+/* === Private Functions =================================================== */
+
+/*
+ * draw_pixel() - Set one 4-bpp pixel in a canvas row
+ *
+ * INPUT
+ *     - row: first byte of the canvas row
+ *     - x: pixel column
+ *     - color: 8-bit color, the high nibble is used
+ * OUTPUT
+ *     none
+ */
+static inline void draw_pixel(uint8_t *row, int x, uint8_t color)
+{
+    uint8_t *byte = &row[ x >> 1 ];
+
+    if(x & 1)
+    {
+        *byte = (*byte & 0xF0) | (color >> 4);
+    }
+    else
+    {
+        *byte = (*byte & 0x0F) | (color & 0xF0);
+    }
+}
+
+/*
+ * draw_span() - Fill a run of 4-bpp pixels in a canvas row, a byte at a time
+ * where the run covers both pixels of a byte
+ *
+ * INPUT
+ *     - row: first byte of the canvas row
+ *     - x: first pixel column
+ *     - width: number of pixels
+ *     - color: 8-bit color, the high nibble is used
+ * OUTPUT
+ *     none
+ */
+static void draw_span(uint8_t *row, int x, int width, uint8_t color)
+{
+    if(width <= 0)
+    {
+        return;
+    }
+
+    if(x & 1)
+    {
+        draw_pixel(row, x, color);
+        x++;
+        width--;
+    }
+
+    if(width >= 2)
+    {
+        memset(&row[ x >> 1 ], (color & 0xF0) | (color >> 4), width >> 1);
+        x += width & ~1;
+    }
+
+    if(width & 1)
+    {
+        draw_pixel(row, x, color);
+    }
+}
+
+/*
+ * draw_glyph_row() - Blit one 1-bpp glyph row, a canvas byte (two pixels)
+ * at a time
+ *
+ * INPUT
+ *     - row: first byte of the canvas row
+ *     - x: pixel column of the glyph's left edge
+ *     - bits: glyph row, leftmost pixel in bit 31
+ *     - width: glyph width in pixels
+ *     - color: 8-bit color, the high nibble is used
+ * OUTPUT
+ *     none
+ */
+static void draw_glyph_row(uint8_t *row, int x, uint32_t bits, int width, uint8_t color)
+{
+    uint8_t fill = (color & 0xF0) | (color >> 4);
+    uint8_t *byte;
+
+    /* Align to a canvas byte by prepending a blank pixel */
+    if(x & 1)
+    {
+        bits >>= 1;
+        x--;
+        width++;
+    }
+
+    byte = &row[ x >> 1 ];
+
+    for(; (width > 0) && (bits != 0); width -= 2, bits <<= 2, byte++)
+    {
+        uint8_t mask = ((bits & 0x80000000) ? 0xF0 : 0x00) |
+                       ((bits & 0x40000000) ? 0x0F : 0x00);
+
+        if(mask != 0)
+        {
+            *byte = (*byte & ~mask) | (fill & mask);
+        }
+    }
+}
 
 /* === Functions =========================================================== */
 
+/*
+ * draw_mark_dirty() - Grow the canvas damaged region to cover a rectangle
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - x: left edge
+ *     - y: top edge
+ *     - width: width of rectangle
+ *     - height: height of rectangle
+ * OUTPUT
+ *     none
+ */
+void draw_mark_dirty(Canvas *canvas, int x, int y, int width, int height)
+{
+    int x1 = x + width;
+    int y1 = y + height;
+
+    x = (x < 0) ? 0 : x;
+    y = (y < 0) ? 0 : y;
+    x1 = (x1 > canvas->width) ? canvas->width : x1;
+    y1 = (y1 > canvas->height) ? canvas->height : y1;
+
+    if((x >= x1) || (y >= y1))
+    {
+        return;
+    }
+
+    if(!canvas->dirty)
+    {
+        canvas->dirty_x0 = x;
+        canvas->dirty_y0 = y;
+        canvas->dirty_x1 = x1;
+        canvas->dirty_y1 = y1;
+        canvas->dirty = true;
+    }
+    else
+    {
+        canvas->dirty_x0 = (x < canvas->dirty_x0) ? x : canvas->dirty_x0;
+        canvas->dirty_y0 = (y < canvas->dirty_y0) ? y : canvas->dirty_y0;
+        canvas->dirty_x1 = (x1 > canvas->dirty_x1) ? x1 : canvas->dirty_x1;
+        canvas->dirty_y1 = (y1 > canvas->dirty_y1) ? y1 : canvas->dirty_y1;
+    }
+}
+
 /*
  * draw_char_with_shift() - Draw image on display with left/top margins
  *
@@ -45,9 +195,6 @@ bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
 {
     bool ret_stat = false;
 
-    int start_index = (p->y * canvas->width) + p->x;
-    uint8_t *canvas_pixel = &canvas->buffer[ start_index ];
-
     /* Check that this was a character that we have in the font */
     if(img != NULL)
     {
@@ -56,24 +203,30 @@ bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
         if(((img->width + p->x) <= canvas->width) &&
                 ((img->height + p->y) <= canvas->height))
         {
-            const uint8_t *img_pixel = &img->data[ 0 ];
+            const uint8_t *img_row = &img->data[ 0 ];
+            int row_bytes = GLYPH_ROW_BYTES(img);
 
             int y;
 
+            display_wait_region(p->x, p->y, img->width, img->height);
+
             for(y = 0; y < img->height; y++)
             {
-                int x;
+                uint8_t *row = &canvas->buffer[ (p->y + y) * CANVAS_ROW_BYTES(canvas) ];
+                uint32_t bits = 0;
+                int i;
 
-                for(x = 0; x < img->width; x++)
+                for(i = 0; i < row_bytes; i++)
                 {
-                    *canvas_pixel = (*img_pixel == 0x00) ? p->color : *canvas_pixel;
-                    canvas_pixel++;
-                    img_pixel++;
+                    bits |= (uint32_t)img_row[ i ] << (24 - (8 * i));
                 }
 
-                canvas_pixel += (canvas->width - img->width);
+                draw_glyph_row(row, p->x, bits, img->width, p->color);
+                img_row += row_bytes;
             }
 
+            draw_mark_dirty(canvas, p->x, p->y, img->width, img->height);
+
             if(x_shift != NULL)
             {
                 *x_shift += img->width;
@@ -88,8 +241,6 @@ bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
         }
     }
 
-    canvas->dirty = true;
-
     return(ret_stat);
 }
 
@@ -109,60 +260,30 @@ bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
 void draw_string(Canvas *canvas, const Font *font, const char *str_write,
                  DrawableParams *p, int width, int line_height)
 {
-    bool have_space = true;
-    int x_offset = 0;
+    const TextLayout *layout = text_layout(font, str_write, width);
     DrawableParams char_params = *p;
+    int r;
 
-    while(*str_write && have_space)
+    for(r = 0; r < layout->run_count; r++)
     {
-        const CharacterImage *img = font_get_char(font, *str_write);
-        int word_width = img->width;
-        char *next_c = (char *)str_write + 1;
+        const TextRun *run = &layout->runs[ r ];
+        int x_offset = 0;
+        int i;
 
-        /* Allow line breaks */
-        if(*str_write == '\n')
-        {
-            char_params.y += line_height;
-            x_offset = 0;
-            str_write++;
-            continue;
-        }
+        char_params.y = p->y + (run->line * line_height);
 
-        /*
-         * Calculate the next word width while
-         * removing spacings at beginning of lines
-         */
-        if(*str_write == ' ')
+        for(i = run->start; i < run->start + run->length; i++)
         {
+            /* Draw Character, stop at the first one that does not fit */
+            char_params.x = x_offset + p->x;
 
-            while(*next_c && *next_c != ' ' && *next_c != '\n')
+            if(!draw_char_with_shift(canvas, &char_params, &x_offset, NULL,
+                                     font_get_char(font, str_write[ i ])))
             {
-                word_width += font_get_char(font, *next_c)->width;
-                next_c++;
+                return;
             }
         }
-
-        /* Determine if we need a line break */
-        if((width != 0) && (x_offset + word_width > width))
-        {
-            char_params.y += line_height;
-            x_offset = 0;
-        }
-
-        /* Remove spaces from beginning of of line */
-        if(x_offset == 0 && *str_write == ' ')
-        {
-            str_write++;
-            continue;
-        }
-
-        /* Draw Character */
-        char_params.x = x_offset + p->x;
-        have_space = draw_char_with_shift(canvas, &char_params, &x_offset, NULL, img);
-        str_write++;
     }
-
-    canvas->dirty = true;
 }
 
 /*
@@ -183,8 +304,6 @@ void draw_char(Canvas *canvas, const Font *font, char c, DrawableParams *p)
 
     /* Draw Character */
     draw_char_with_shift(canvas, p, &x_offset, NULL, img);
-
-    canvas->dirty = true;
 }
 
 /*
@@ -231,28 +350,20 @@ void draw_box(Canvas *canvas, BoxDrawableParams *p)
     int end_col = p->base.x + p->width;
     end_col = (end_col >= canvas->width) ? canvas->width - 1 : end_col;
 
-    int start_index = (start_row * canvas->width) + start_col;
-    uint8_t *canvas_pixel = &canvas->buffer[ start_index ];
-
     int height = end_row - start_row;
     int width = end_col - start_col;
 
     int y;
 
-    for(y = 0; y < height; y++)
-    {
-        int x;
+    display_wait_region(start_col, start_row, width, height);
 
-        for(x = 0; x < width; x++)
-        {
-            *canvas_pixel = p->base.color;
-            canvas_pixel++;
-        }
-
-        canvas_pixel += (canvas->width - width);
+    for(y = start_row; y < end_row; y++)
+    {
+        draw_span(&canvas->buffer[ y * CANVAS_ROW_BYTES(canvas) ], start_col, width,
+                  p->base.color);
     }
 
-    canvas->dirty = true;
+    draw_mark_dirty(canvas, start_col, start_row, width, height);
 }
 
 /*
@@ -290,23 +401,22 @@ bool draw_bitmap_mono_rle(Canvas *canvas, DrawableParams *p, const Image *img)
     int x0, y0;
     int8_t sequence = 0;
     int8_t nonsequence = 0;
-    static uint8_t image_data[KEEPKEY_DISPLAY_WIDTH * KEEPKEY_DISPLAY_HEIGHT];
-
-    int start_index = (p->y * canvas->width) + p->x;
-    uint8_t *canvas_pixel = &canvas->buffer[ start_index ];
-
-    /* Get image data */
-    img->get_image_data(image_data);
 
     /* Check that image will fit in bounds */
     if(((img->width + p->x) <= canvas->width) &&
             ((img->height + p->y) <= canvas->height))
     {
-        const uint8_t *img_pixel = &image_data[0];
+        const uint8_t *img_pixel = img->data;
+
+        display_wait_region(p->x, p->y, img->width, img->height);
 
         for(y0 = 0; y0 < img->height; y0++)
         {
-            for(x0 = 0; x0 < img->width; x0++)
+            uint8_t *row = &canvas->buffer[ (p->y + y0) * CANVAS_ROW_BYTES(canvas) ];
+
+            x0 = 0;
+
+            while(x0 < img->width)
             {
                 if((sequence == 0) && (nonsequence == 0))
                 {
@@ -317,36 +427,114 @@ bool draw_bitmap_mono_rle(Canvas *canvas, DrawableParams *p, const Image *img)
                         nonsequence = -sequence;
                         sequence = 0;
                     }
+                    else if(sequence == 0)
+                    {
+                        /* Empty run leaves one pixel untouched */
+                        x0++;
+                        continue;
+                    }
                 }
 
+                int run = img->width - x0;
+
                 if(sequence > 0)
                 {
-                    *canvas_pixel = *img_pixel;
+                    /* Repeated pixel: fill the part of the run on this row */
+                    run = (sequence < run) ? sequence : run;
+                    draw_span(row, p->x + x0, run, *img_pixel);
 
-                    sequence--;
+                    sequence -= run;
 
                     if(sequence == 0)
                     {
                         img_pixel++;
                     }
                 }
-
-                if(nonsequence > 0)
+                else
                 {
-                    *canvas_pixel = *img_pixel++;
+                    int x;
 
-                    nonsequence--;
+                    run = (nonsequence < run) ? nonsequence : run;
+
+                    for(x = 0; x < run; x++)
+                    {
+                        draw_pixel(row, p->x + x0 + x, *img_pixel++);
+                    }
+
+                    nonsequence -= run;
                 }
 
-                canvas_pixel++;
+                x0 += run;
             }
-
-            canvas_pixel += (canvas->width - img->width);
         }
 
-        canvas->dirty = true;
+        draw_mark_dirty(canvas, p->x, p->y, img->width, img->height);
         ret_stat = true;
     }
 
     return(ret_stat);
 }
+
+/*
+ * draw_bitmap_mono_scaled() - Draw the set bits of a 1-bpp bitmap, each bit
+ * as a scale x scale block
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - p: pointer to position and color of set bits
+ *     - bits: bitmap rows packed back to back, MSB first
+ *     - width: bitmap width in bits
+ *     - height: bitmap height in bits
+ *     - scale: canvas pixels per bit
+ * OUTPUT
+ *     true/false whether bitmap was drawn
+ */
+bool draw_bitmap_mono_scaled(Canvas *canvas, DrawableParams *p, const uint8_t *bits,
+                             int width, int height, int scale)
+{
+    int x0, y0, dy, start;
+    int bit = 0;
+
+    /* Check that bitmap will fit in bounds */
+    if((p->x < 0) || (p->y < 0) ||
+            ((width * scale + p->x) > canvas->width) ||
+            ((height * scale + p->y) > canvas->height))
+    {
+        return(false);
+    }
+
+    display_wait_region(p->x, p->y, width * scale, height * scale);
+
+    for(y0 = 0; y0 < height; y0++, bit += width)
+    {
+        uint8_t *row = &canvas->buffer[ (p->y + y0 * scale) * CANVAS_ROW_BYTES(canvas) ];
+
+        x0 = 0;
+
+        while(x0 < width)
+        {
+            /* Skip clear bits, then fill the run of set bits as one span per row */
+            while((x0 < width) && !(bits[ (bit + x0) >> 3 ] & (0x80 >> ((bit + x0) & 7))))
+            {
+                x0++;
+            }
+
+            start = x0;
+
+            while((x0 < width) && (bits[ (bit + x0) >> 3 ] & (0x80 >> ((bit + x0) & 7))))
+            {
+                x0++;
+            }
+
+            for(dy = 0; (x0 > start) && (dy < scale); dy++)
+            {
+                draw_span(&row[ dy * CANVAS_ROW_BYTES(canvas) ], p->x + start * scale,
+                          (x0 - start) * scale, p->color);
+            }
+        }
+    }
+
+    draw_mark_dirty(canvas, p->x, p->y, width * scale, height * scale);
+
+    return(true);
+}
@@ -37,6 +37,52 @@
 /* Stack smashing protector (SSP) canary value storage */
 uintptr_t __stack_chk_guard;
 
+/* === Private Functions =================================================== */
+
+/*
+ * crc32_hw() - Calculate crc32 on the CRC peripheral
+ *
+ * INPUT
+ *     - data: words to calculate crc32 over
+ *     - word_len: number of words
+ * OUTPUT
+ *     crc32 of data
+ */
+static uint32_t crc32_hw(uint32_t *data, int word_len)
+{
+    crc_reset();
+    return(crc_calculate_block(data, word_len));
+}
+
+/*
+ * crc32_sw() - Calculate crc32 in software, bit exact with the CRC peripheral
+ * (polynomial 0x04C11DB7, initial value 0xFFFFFFFF, words fed MSB first and no
+ * final xor)
+ *
+ * INPUT
+ *     - data: words to calculate crc32 over
+ *     - word_len: number of words
+ * OUTPUT
+ *     crc32 of data
+ */
+static uint32_t crc32_sw(uint32_t *data, int word_len)
+{
+    uint32_t crc32 = 0xFFFFFFFF;
+    int i, bit;
+
+    for(i = 0; i < word_len; i++)
+    {
+        crc32 ^= data[i];
+
+        for(bit = 0; bit < 32; bit++)
+        {
+            crc32 = (crc32 & 0x80000000) ? (crc32 << 1) ^ 0x04C11DB7 : crc32 << 1;
+        }
+    }
+
+    return(crc32);
+}
+
 /* === Functions =========================================================== */
 
 /*
@@ -49,6 +95,9 @@ uintptr_t __stack_chk_guard;
  */
 void __attribute__((noreturn)) system_halt(void)
 {
+    /* Let the last layout reach the display */
+    display_wait();
+
     cm_disable_interrupts();
 
     for(;;);  /* Loops forever */
@@ -124,15 +173,19 @@ void board_init(void)
 /* calc_crc32() - Calculate crc32 for block of memory
  *
  * INPUT
- *     none
+ *     - data: words to calculate crc32 over
+ *     - word_len: number of words
  * OUTPUT
  *     crc32 of data
  */
 uint32_t calc_crc32(uint32_t *data, int word_len)
 {
-    uint32_t crc32 = 0;
-
-    crc_reset();
-    crc32 = crc_calculate_block(data, word_len);
-    return(crc32);
+    /* The CRC peripheral is clocked by the bootloader.  Fall back to software
+     * if it isn't, rather than reading back a stale data register. */
+    if(RCC_AHB1ENR & RCC_AHB1ENR_CRCEN)
+    {
+        return(crc32_hw(data, word_len));
+    }
+
+    return(crc32_sw(data, word_len));
 }
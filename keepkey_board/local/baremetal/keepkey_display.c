@@ -21,6 +21,9 @@
 
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/gpio.h>
+#include <libopencm3/stm32/dma.h>
+#include <libopencm3/stm32/timer.h>
+#include <libopencm3/stm32/f2/nvic.h>
 
 #include "keepkey_display.h"
 #include "pin.h"
@@ -46,9 +49,25 @@ static const Pin nRESET_PIN    = { GPIOB, GPIO5 };
 
 static const Pin BACKLIGHT_PWR_PIN = { GPIOB, GPIO0 };
 
-static uint8_t canvas_buffer[ KEEPKEY_DISPLAY_HEIGHT * KEEPKEY_DISPLAY_WIDTH ];
+static uint8_t canvas_buffer[ KEEPKEY_DISPLAY_HEIGHT * KEEPKEY_DISPLAY_WIDTH / 2 ];
 static Canvas canvas;
 
+/*
+ * GRAM stream: TIM8 paces DMA2 writes of precomputed GPIOA BSRR words, three
+ * bus phases per byte.  Two chunk buffers are refilled from the canvas in
+ * dma2_stream1_isr() while the other one is on the bus.
+ */
+static uint32_t stream_words[ 2 ][ DISPLAY_STREAM_CHUNK * DISPLAY_STREAM_PHASES ];
+static uint16_t stream_len[ 2 ];
+static int stream_active;
+static volatile bool stream_busy = false;
+static int stream_x, stream_x_first, stream_x_last;
+static int stream_y, stream_y_end;
+static int stream_step;
+
+/* Canvas region being streamed, which drawing must not touch until it is done */
+static int stream_win_x0, stream_win_y0, stream_win_x1, stream_win_y1;
+
 /* === Private Functions =================================================== */
 
 /*
@@ -249,8 +268,200 @@ static void display_write_ram(uint8_t val)
     __asm__("nop");
 }
 
+/*
+ * display_set_window() - Set the GRAM window written by the next GRAM write
+ *
+ * INPUT
+ *     - x0: first pixel column, multiple of KEEPKEY_DISPLAY_COL_PIXELS
+ *     - x1: end pixel column (exclusive), multiple of KEEPKEY_DISPLAY_COL_PIXELS
+ *     - y0: first row
+ *     - y1: end row (exclusive)
+ * OUTPUT
+ *     none
+ */
+static void display_set_window(int x0, int x1, int y0, int y1)
+{
+    display_write_reg((uint8_t)0x15);
+    display_write_ram(START_COL + (x0 / KEEPKEY_DISPLAY_COL_PIXELS));
+    display_write_ram(START_COL + (x1 / KEEPKEY_DISPLAY_COL_PIXELS) - 1);
+
+    display_write_reg((uint8_t)0x75);
+    display_write_ram(START_ROW + y0);
+    display_write_ram(START_ROW + y1 - 1);
+}
+
+/*
+ * display_stream_fill() - Encode the next canvas bytes of the GRAM stream
+ * as bus phases
+ *
+ * INPUT
+ *     - words: chunk buffer to fill
+ * OUTPUT
+ *     number of words filled, 0 when the stream is exhausted
+ */
+static uint16_t display_stream_fill(uint32_t *words)
+{
+    uint16_t count = 0;
+
+    while((count < DISPLAY_STREAM_CHUNK) && (stream_y != stream_y_end))
+    {
+        uint8_t val = canvas.buffer[ (stream_y * CANVAS_ROW_BYTES(&canvas)) + stream_x ];
+
+#ifdef INVERT_DISPLAY
+        val = (uint8_t)((val << 4) | (val >> 4));
+#endif
+
+        /* Data out and nOLED_SEL low, nMEM_WE low, nMEM_WE and nOLED_SEL high */
+        *words++ = val | ((uint32_t)(uint8_t)~val << 16) | ((uint32_t)nSEL_PIN.pin << 16);
+        *words++ = (uint32_t)nWE_PIN.pin << 16;
+        *words++ = nWE_PIN.pin | nSEL_PIN.pin;
+        count++;
+
+        if(stream_x == stream_x_last)
+        {
+            stream_x = stream_x_first;
+            stream_y += stream_step;
+        }
+        else
+        {
+            stream_x += stream_step;
+        }
+    }
+
+    return(count * DISPLAY_STREAM_PHASES);
+}
+
+/*
+ * display_stream_send() - Put a filled chunk buffer on the bus
+ *
+ * INPUT
+ *     - index: chunk buffer to send
+ * OUTPUT
+ *     none
+ */
+static void display_stream_send(int index)
+{
+    stream_active = index;
+
+    dma_clear_interrupt_flags(DMA2, DMA_STREAM1, DMA_ISR_FLAGS);
+    dma_set_memory_address(DMA2, DMA_STREAM1, (uint32_t)stream_words[ index ]);
+    dma_set_number_of_data(DMA2, DMA_STREAM1, stream_len[ index ]);
+    dma_enable_stream(DMA2, DMA_STREAM1);
+}
+
+/*
+ * display_stream_init() - Set up TIM8 and DMA2 stream 1 for GRAM streaming
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+static void display_stream_init(void)
+{
+    rcc_periph_clock_enable(RCC_DMA2);
+    rcc_periph_clock_enable(RCC_TIM8);
+
+    /* TIM8 update is DMA2 stream 1 channel 7 */
+    dma_stream_reset(DMA2, DMA_STREAM1);
+    dma_channel_select(DMA2, DMA_STREAM1, DMA_SxCR_CHSEL_7);
+    dma_set_transfer_mode(DMA2, DMA_STREAM1, DMA_SxCR_DIR_MEM_TO_PERIPHERAL);
+    dma_set_priority(DMA2, DMA_STREAM1, DMA_SxCR_PL_HIGH);
+    dma_set_memory_size(DMA2, DMA_STREAM1, DMA_SxCR_MSIZE_32BIT);
+    dma_set_peripheral_size(DMA2, DMA_STREAM1, DMA_SxCR_PSIZE_32BIT);
+    dma_enable_memory_increment_mode(DMA2, DMA_STREAM1);
+    dma_set_peripheral_address(DMA2, DMA_STREAM1, (uint32_t)&GPIO_BSRR(GPIOA));
+    dma_enable_transfer_complete_interrupt(DMA2, DMA_STREAM1);
+    dma_enable_transfer_error_interrupt(DMA2, DMA_STREAM1);
+
+    /* Above the timer runnables so a runnable may wait on a refresh */
+    nvic_set_priority(NVIC_DMA2_STREAM1_IRQ, 16 * 1);
+    nvic_enable_irq(NVIC_DMA2_STREAM1_IRQ);
+
+    timer_reset(TIM8);
+    timer_set_mode(TIM8, TIM_CR1_CKD_CK_INT, TIM_CR1_CMS_EDGE, TIM_CR1_DIR_UP);
+    timer_set_prescaler(TIM8, 0);
+    timer_set_period(TIM8, DISPLAY_STREAM_PERIOD - 1);
+    timer_enable_irq(TIM8, TIM_DIER_UDE);
+    timer_enable_counter(TIM8);
+}
+
 /* === Functions =========================================================== */
 
+/*
+ * dma2_stream1_isr() - GRAM stream chunk complete.  Chunks are sent one
+ * shot at a time rather than circularly, so a late refill stalls the bus
+ * instead of replaying stale bus phases into GRAM.
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void dma2_stream1_isr(void)
+{
+    int done = stream_active;
+    bool complete = dma_get_interrupt_flag(DMA2, DMA_STREAM1, DMA_TCIF);
+
+    stream_len[ done ] = 0;
+
+    if(complete && (stream_len[ done ^ 1 ] != 0))
+    {
+        display_stream_send(done ^ 1);
+        stream_len[ done ] = display_stream_fill(stream_words[ done ]);
+        return;
+    }
+
+    dma_clear_interrupt_flags(DMA2, DMA_STREAM1, DMA_ISR_FLAGS);
+
+    if(!complete)
+    {
+        /* Transfer error stopped the stream, resend the whole screen */
+        stream_len[ done ^ 1 ] = 0;
+        canvas.dirty_x0 = 0;
+        canvas.dirty_y0 = 0;
+        canvas.dirty_x1 = canvas.width;
+        canvas.dirty_y1 = canvas.height;
+        canvas.dirty = true;
+    }
+
+    stream_busy = false;
+}
+
+/*
+ * display_wait() - Wait for an in-progress refresh to reach GRAM.  Needs
+ * interrupts enabled.
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void display_wait(void)
+{
+    while(stream_busy) {}
+}
+
+/*
+ * display_wait_region() - Wait for an in-progress refresh if it is still
+ * streaming the given canvas region.  Called before drawing into the canvas,
+ * so a refresh never sends a half drawn region.
+ *
+ * INPUT
+ *     - x: left edge
+ *     - y: top edge
+ *     - width: width of region
+ *     - height: height of region
+ * OUTPUT
+ *     none
+ */
+void display_wait_region(int x, int y, int width, int height)
+{
+    while(stream_busy &&
+            (x < stream_win_x1) && (x + width > stream_win_x0) &&
+            (y < stream_win_y1) && (y + height > stream_win_y0)) {}
+}
+
 /*
  * display_canvas_init() - Display canvas initialization
  *
@@ -284,7 +495,10 @@ Canvas *display_canvas(void)
 }
 
 /*
- * display_refresh() - Refresh display
+ * display_refresh() - Start streaming the damaged region of the canvas to
+ * the display.  Returns once the transfer is under way; a refresh already in
+ * progress is waited for first.  Drawing into the streamed region waits for
+ * the transfer in display_wait_region().
  *
  * INPUT
  *     none
@@ -298,27 +512,56 @@ void display_refresh(void)
         return;
     }
 
-    display_prepare_gram_write();
+    display_wait();
 
-    int num_writes = canvas.width * canvas.height;
+    /* GRAM is addressed in columns of KEEPKEY_DISPLAY_COL_PIXELS pixels */
+    int x0 = canvas.dirty_x0 & ~(KEEPKEY_DISPLAY_COL_PIXELS - 1);
+    int x1 = (canvas.dirty_x1 + KEEPKEY_DISPLAY_COL_PIXELS - 1) &
+             ~(KEEPKEY_DISPLAY_COL_PIXELS - 1);
+    int y0 = canvas.dirty_y0;
+    int y1 = canvas.dirty_y1;
 
-    int i;
 #ifdef INVERT_DISPLAY
 
-    for(i = num_writes; i > 0; i -= 2)
-    {
-        uint8_t v = (0xF0 & canvas.buffer[ i ]) | (canvas.buffer[ i - 1 ] >> 4);
+    /* Canvas is rotated 180 degrees, so the window is mirrored on the panel */
+    display_set_window(canvas.width - x1, canvas.width - x0,
+                       canvas.height - y1, canvas.height - y0);
+
+    stream_step = -1;
+    stream_x_first = (x1 / 2) - 1;
+    stream_x_last = x0 / 2;
+    stream_y = y1 - 1;
+    stream_y_end = y0 - 1;
 #else
 
-    for(i = 0; i < num_writes; i += 2)
-    {
-        uint8_t v = (0xF0 & canvas.buffer[ i ]) | (canvas.buffer[ i + 1 ] >> 4);
+    display_set_window(x0, x1, y0, y1);
+
+    stream_step = 1;
+    stream_x_first = x0 / 2;
+    stream_x_last = (x1 / 2) - 1;
+    stream_y = y0;
+    stream_y_end = y1;
 #endif
-        display_write_ram(v);
-    }
 
+    stream_x = stream_x_first;
+
+    stream_win_x0 = x0;
+    stream_win_y0 = y0;
+    stream_win_x1 = x1;
+    stream_win_y1 = y1;
+
+    display_prepare_gram_write();
+
+    /* Stream phases leave nDC alone, so hold it high for data */
+    SET_PIN(nDC_PIN);
 
     canvas.dirty = false;
+
+    stream_len[ 0 ] = display_stream_fill(stream_words[ 0 ]);
+    stream_len[ 1 ] = display_stream_fill(stream_words[ 1 ]);
+
+    stream_busy = true;
+    display_stream_send(0);
 }
 
 /*
@@ -331,6 +574,7 @@ void display_refresh(void)
  */
 void display_turn_on(void)
 {
+    display_wait();
     display_write_reg((uint8_t)0xAF);
 }
 
@@ -344,6 +588,7 @@ void display_turn_on(void)
  */
 void display_turn_off(void)
 {
+    display_wait();
     display_write_reg((uint8_t)0xAE);
 }
 
@@ -360,6 +605,7 @@ void display_turn_off(void)
 void display_hw_init(void)
 {
     display_configure_io();
+    display_stream_init();
 
     CLEAR_PIN(BACKLIGHT_PWR_PIN);
 
@@ -490,6 +736,7 @@ void display_set_brightness(int percentage)
 
     uint8_t reg_value = (uint8_t)v;
 
+    display_wait();
     display_write_reg((uint8_t)0xC1);
     display_write_ram(reg_value);
 }
\ No newline at end of file
@@ -135,6 +135,11 @@ bool flash_write_word(Allocation group, uint32_t offset, uint32_t len, uint8_t *
     /* Byte writes for flash start address not long-word aligned */
     if(start % sizeof(uint32_t)) {
         align_cnt = sizeof(uint32_t) - start % sizeof(uint32_t);
+
+        if(align_cnt > len) {
+            align_cnt = len;
+        }
+
         flash_program(start, data, align_cnt);
         if(flash_chk_status() == false) {
             retval = false;
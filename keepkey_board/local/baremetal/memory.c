@@ -22,7 +22,9 @@
 #include <string.h>
 #include <assert.h>
 #include <stdint.h>
+#include <stdbool.h>
 
+#include <libopencm3/cm3/cortex.h>
 #include <libopencm3/stm32/flash.h>
 
 #include <sha2.h>
@@ -30,6 +32,143 @@
 #include "keepkey_board.h"
 #include "memory.h"
 #include "keepkey_flash.h"
+#include "timer.h"
+
+/* === Private Variables =================================================== */
+
+/*
+ * Measured boot: the bootloader and firmware hashes are computed once, a slice
+ * per timer tick, by memory_hash_runnable() after memory_hash_init().  Flash
+ * contents do not change while the application runs, so the results are kept
+ * and the getters below only fall back to hashing flash themselves when asked
+ * before the measurement has finished.
+ */
+typedef enum
+{
+    MEMORY_HASH_IDLE,
+    MEMORY_HASH_BOOTLOADER,
+    MEMORY_HASH_FIRMWARE
+} MemoryHashStage;
+
+static MemoryHashStage hash_stage = MEMORY_HASH_IDLE;
+static SHA256_CTX hash_ctx;
+static uint32_t hash_offset;
+static uint32_t hash_codelen;
+
+static uint8_t bootloader_hash[SHA256_DIGEST_LENGTH];
+static volatile bool bootloader_hash_valid = false;
+
+static uint8_t firmware_hash[SHA256_DIGEST_LENGTH];
+static int firmware_hash_len;
+static volatile bool firmware_hash_valid = false;
+
+/* === Private Functions =================================================== */
+
+/*
+ * memory_firmware_hash_start() - Start a firmware hash with the magic and the
+ * meta descriptor that follows it
+ *
+ * INPUT
+ *     - ctx: hash context to initialize
+ * OUTPUT
+ *     none
+ */
+static void memory_firmware_hash_start(SHA256_CTX *ctx)
+{
+    sha256_Init(ctx);
+    sha256_Update(ctx, (const uint8_t *)META_MAGIC_STR, META_MAGIC_SIZE);
+    sha256_Update(ctx, (const uint8_t *)FLASH_META_CODELEN,
+                  FLASH_META_DESC_LEN - META_MAGIC_SIZE);
+}
+
+/*
+ * memory_hash_slice() - Hash the next slice of a flash region
+ *
+ * INPUT
+ *     - start: start of region
+ *     - len: length of region
+ * OUTPUT
+ *     true when the whole region has been hashed
+ */
+static bool memory_hash_slice(uint32_t start, uint32_t len)
+{
+    uint32_t slice = len - hash_offset;
+
+    if(slice > MEMORY_HASH_SLICE_LEN)
+    {
+        slice = MEMORY_HASH_SLICE_LEN;
+    }
+
+    sha256_Update(&hash_ctx, (const uint8_t *)(start + hash_offset), slice);
+    hash_offset += slice;
+
+    return(hash_offset == len);
+}
+
+/*
+ * memory_hash_runnable() - Timer runnable measuring the bootloader, then the
+ * firmware
+ *
+ * INPUT
+ *     - context: unused
+ * OUTPUT
+ *     none
+ */
+static void memory_hash_runnable(void *context)
+{
+    (void)context;
+
+    switch(hash_stage)
+    {
+        case MEMORY_HASH_BOOTLOADER:
+            if(memory_hash_slice(FLASH_BOOT_START, FLASH_BOOT_LEN))
+            {
+                if(!bootloader_hash_valid)
+                {
+                    sha256_Final(&hash_ctx, bootloader_hash);
+                    sha256_Raw(bootloader_hash, SHA256_DIGEST_LENGTH, bootloader_hash);
+                    bootloader_hash_valid = true;
+                }
+
+                hash_codelen = *((uint32_t *)FLASH_META_CODELEN);
+                hash_offset = 0;
+
+                if(hash_codelen <= FLASH_APP_LEN)
+                {
+                    memory_firmware_hash_start(&hash_ctx);
+                    hash_stage = MEMORY_HASH_FIRMWARE;
+                }
+                else
+                {
+                    firmware_hash_len = 0;
+                    firmware_hash_valid = true;
+                    hash_stage = MEMORY_HASH_IDLE;
+                }
+            }
+
+            break;
+
+        case MEMORY_HASH_FIRMWARE:
+            if(memory_hash_slice(FLASH_APP_START, hash_codelen))
+            {
+                sha256_Final(&hash_ctx, firmware_hash);
+                firmware_hash_len = SHA256_DIGEST_LENGTH;
+                firmware_hash_valid = true;
+                hash_stage = MEMORY_HASH_IDLE;
+            }
+
+            break;
+
+        case MEMORY_HASH_IDLE:
+        default:
+            break;
+    }
+
+    if(hash_stage == MEMORY_HASH_IDLE)
+    {
+        remove_runnable(&memory_hash_runnable);
+    }
+}
 
 /* === Functions =========================================================== */
 
@@ -55,6 +194,30 @@ void memory_protect(void)
     flash_lock_option_bytes();
 }
 
+/*
+ * memory_hash_init() - Start measuring the bootloader and firmware in the
+ * background
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void memory_hash_init(void)
+{
+    if(hash_stage != MEMORY_HASH_IDLE || firmware_hash_valid)
+    {
+        return;
+    }
+
+    sha256_Init(&hash_ctx);
+    hash_offset = 0;
+    hash_stage = MEMORY_HASH_BOOTLOADER;
+
+    post_periodic(&memory_hash_runnable, NULL, MEMORY_HASH_PERIOD,
+                  MEMORY_HASH_PERIOD);
+}
+
 /*
  * memory_bootloader_hash() - SHA256 hash of bootloader
  *
@@ -65,15 +228,26 @@ void memory_protect(void)
  */
 int memory_bootloader_hash(uint8_t *hash)
 {
-    static uint8_t cached_hash[SHA256_DIGEST_LENGTH];
+    uint8_t measured[SHA256_DIGEST_LENGTH];
 
-    if(cached_hash[0] == '\0')
+    if(!bootloader_hash_valid)
     {
-        sha256_Raw((const uint8_t *)FLASH_BOOT_START, FLASH_BOOT_LEN, cached_hash);
-        sha256_Raw(cached_hash, SHA256_DIGEST_LENGTH, cached_hash);
+        sha256_Raw((const uint8_t *)FLASH_BOOT_START, FLASH_BOOT_LEN, measured);
+        sha256_Raw(measured, SHA256_DIGEST_LENGTH, measured);
+
+        /* memory_hash_runnable() may have published while this was hashing */
+        cm_disable_interrupts();
+
+        if(!bootloader_hash_valid)
+        {
+            memcpy(bootloader_hash, measured, SHA256_DIGEST_LENGTH);
+            bootloader_hash_valid = true;
+        }
+
+        cm_enable_interrupts();
     }
 
-    memcpy(hash, cached_hash, SHA256_DIGEST_LENGTH);
+    memcpy(hash, bootloader_hash, SHA256_DIGEST_LENGTH);
 
     return SHA256_DIGEST_LENGTH;
 }
@@ -89,14 +263,20 @@ int memory_bootloader_hash(uint8_t *hash)
 int memory_firmware_hash(uint8_t *hash)
 {
     SHA256_CTX ctx;
-    uint32_t codelen = *((uint32_t *)FLASH_META_CODELEN);
+    uint32_t codelen;
+
+    /* Measured at boot by memory_hash_runnable() */
+    if(firmware_hash_valid)
+    {
+        memcpy(hash, firmware_hash, firmware_hash_len);
+        return firmware_hash_len;
+    }
+
+    codelen = *((uint32_t *)FLASH_META_CODELEN);
 
     if(codelen <= FLASH_APP_LEN)
     {
-        sha256_Init(&ctx);
-        sha256_Update(&ctx, (const uint8_t *)META_MAGIC_STR, META_MAGIC_SIZE);
-        sha256_Update(&ctx, (const uint8_t *)FLASH_META_CODELEN,
-                      FLASH_META_DESC_LEN - META_MAGIC_SIZE);
+        memory_firmware_hash_start(&ctx);
         sha256_Update(&ctx, (const uint8_t *)FLASH_APP_START, codelen);
         sha256_Final(&ctx, hash);
         return SHA256_DIGEST_LENGTH;
@@ -40,6 +40,7 @@ static msg_debug_link_get_state_t msg_debug_link_get_state;
 /* Tiny messages */
 static bool msg_tiny_flag = false;
 static uint8_t msg_tiny[MSG_TINY_BFR_SZ];
+static uint32_t msg_tiny_size = 0;
 static uint16_t msg_tiny_id = MSG_TINY_TYPE_ERROR; /* Default to error type */
 
 /* === Variables =========================================================== */
@@ -103,6 +104,29 @@ static const pb_field_t *message_fields(MessageMapType type, MessageType msg_id,
     return NULL;
 }
 
+/*
+ * encode_pb_stream() - Encode message using its generated specialized encoder when
+ * there is one, otherwise using nanopb's table-driven encoder
+ *
+ * INPUT
+ *     - os: output stream
+ *     - fields: protocol buffer
+ *     - msg: pointer to message struct
+ * OUTPUT
+ *     true/false whether message was encoded successfully
+ */
+static bool encode_pb_stream(pb_ostream_t *os, const pb_field_t *fields, const void *msg)
+{
+    const pb_fast_codec_t *codec = pb_fast_codec(fields);
+
+    if(codec != NULL)
+    {
+        return(codec->encode(os, msg));
+    }
+
+    return(pb_encode(os, fields, msg));
+}
+
 /*
  * usb_write_pb() - Add usb frame header info to message buffer and perform usb transmission
  *
@@ -129,7 +153,7 @@ static void usb_write_pb(const pb_field_t *fields, const void *msg, MessageType
     pb_ostream_t os = pb_ostream_from_buffer(framebuf.buffer,
                       sizeof(framebuf.buffer));
 
-    if(pb_encode(&os, fields, msg))
+    if(encode_pb_stream(&os, fields, msg))
     {
         framebuf.frame.header.len = __builtin_bswap32(os.bytes_written);
         (*usb_tx_handler)((uint8_t *)&framebuf, sizeof(framebuf.frame) + os.bytes_written);
@@ -151,6 +175,13 @@ static bool pb_parse(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size
                      uint8_t *buf)
 {
     pb_istream_t stream = pb_istream_from_buffer(msg, msg_size);
+    const pb_fast_codec_t *codec = pb_fast_codec(entry->fields);
+
+    if(codec != NULL)
+    {
+        return(codec->decode(&stream, buf));
+    }
+
     return(pb_decode(&stream, entry->fields, buf));
 }
 
@@ -200,11 +231,18 @@ static void dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size
  */
 static void tiny_dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size)
 {
-    bool status = pb_parse(entry, msg, msg_size, msg_tiny);
+    bool status = false;
+
+    /* Only messages whose decoded struct fits can be parsed into the tiny buffer */
+    if(entry->decode_size <= sizeof(msg_tiny))
+    {
+        status = pb_parse(entry, msg, msg_size, msg_tiny);
+    }
 
     if(status)
     {
         msg_tiny_id = entry->msg_id;
+        msg_tiny_size = entry->decode_size;
     }
     else
     {
@@ -253,12 +291,13 @@ static void usb_rx_helper(UsbMessage *msg, MessageMapType type)
     static uint8_t content_buf[MAX_FRAME_SIZE] __attribute__((aligned(4)));
     static uint32_t content_pos = 0, content_size = 0;
     static bool mid_frame = false;
+    static bool discard_frame = false;
 
     const MessagesMap_t *entry;
     TrezorFrame *frame = (TrezorFrame *)(msg->message);
     TrezorFrameFragment *frame_fragment  = (TrezorFrameFragment *)(msg->message);
 
-    bool last_segment;
+    bool first_segment, last_segment;
     uint8_t *contents;
 
     assert(msg != NULL);
@@ -281,13 +320,14 @@ static void usb_rx_helper(UsbMessage *msg, MessageMapType type)
         /* Init content pos and size */
         content_pos = msg->len - 9;
         content_size = content_pos;
-
+        first_segment = true;
     }
     else if(mid_frame)
     {
         contents = frame_fragment->contents;
         content_pos += msg->len - 1;
         content_size = msg->len - 1;
+        first_segment = false;
     }
     else
     {
@@ -300,6 +340,28 @@ static void usb_rx_helper(UsbMessage *msg, MessageMapType type)
     /* Determine callback handler and message map type */
     entry = message_map_entry(type, last_frame_header.id, IN_MSG);
 
+    /*
+     * Reject frames that cannot fit the reassembly buffer up front, and drop
+     * the rest of their fragments without buffering them.  Frames longer than
+     * the message's own encoding are fine, newer hosts may add fields that
+     * the decoder skips.
+     */
+    if(first_segment)
+    {
+        discard_frame = entry && entry->dispatch != RAW &&
+                        last_frame_header.len > sizeof(content_buf);
+
+        if(discard_frame)
+        {
+            (*msg_failure)(FailureType_Failure_SyntaxError, "Message too large");
+        }
+    }
+
+    if(discard_frame)
+    {
+        goto done_handling;
+    }
+
     if(entry && entry->dispatch == RAW)
     {
         /* Call dispatch for every segment since we are not buffering and parsing, and
@@ -308,26 +370,29 @@ static void usb_rx_helper(UsbMessage *msg, MessageMapType type)
          */
         raw_dispatch(entry, contents, content_size, last_frame_header.len);
     }
-    else if(entry)
+    else if(entry && !(first_segment && last_segment))
     {
         /* Copy content to frame buffer */
-        if(sizeof(content_buf) >= content_pos)
+        if(first_segment)
         {
-            if(content_size == content_pos)
-            {
-                memcpy(content_buf, contents, content_pos);
-            }
-            else
+            memcpy(content_buf, contents, content_pos);
+        }
+        else
+        {
+            /* Padding past the end of the frame is not copied */
+            if(content_pos > last_frame_header.len)
             {
-                memcpy(content_buf + (content_pos - (msg->len - 1)), contents,
-                       msg->len - 1);
+                content_size -= content_pos - last_frame_header.len;
             }
+
+            memcpy(content_buf + (content_pos - (msg->len - 1)), contents, content_size);
         }
     }
 
     /*
      * Only parse and message map if all segments have been buffered
-     * and this message type is parsable
+     * and this message type is parsable.  Messages that arrived in a single
+     * packet are parsed straight out of it.
      */
     if(last_segment && !entry)
     {
@@ -335,13 +400,18 @@ static void usb_rx_helper(UsbMessage *msg, MessageMapType type)
     }
     else if(last_segment && entry->dispatch != RAW)
     {
+        if(!first_segment)
+        {
+            contents = content_buf;
+        }
+
         if(msg_tiny_flag)
         {
-            tiny_dispatch(entry, content_buf, last_frame_header.len);
+            tiny_dispatch(entry, contents, last_frame_header.len);
         }
         else
         {
-            dispatch(entry, content_buf, last_frame_header.len);
+            dispatch(entry, contents, last_frame_header.len);
         }
     }
 
@@ -406,7 +476,7 @@ static MessageType tiny_msg_poll_and_buffer(bool block, uint8_t *buf)
 
     if(msg_tiny_id != MSG_TINY_TYPE_ERROR)
     {
-        memcpy(buf, msg_tiny, sizeof(msg_tiny));
+        memcpy(buf, msg_tiny, msg_tiny_size);
     }
 
     return(msg_tiny_id);
@@ -637,7 +707,7 @@ int encode_pb(const void *source_ptr, const pb_field_t *fields,  uint8_t *buffer
 {
     pb_ostream_t os = pb_ostream_from_buffer(buffer, len);
 
-    if(pb_encode(&os, fields, source_ptr))
+    if(encode_pb_stream(&os, fields, source_ptr))
     {
         return(os.bytes_written);
     }
@@ -19,63 +19,41 @@
 
 /* === Includes ============================================================ */
 
-#include <string.h>
-
 #include "resources.h"
 
 /* === Private Variables =================================================== */
 
 /* --- Confirm Icon Animation ---------------------------------------------- */
 
-static void confirm_icon_1(uint8_t *data)
+static const uint8_t confirm_icon_1_data[240] =
 {
-    const uint8_t image_data[240] =
-    {
-        0x08, 0x00, 0xfc, 0x02, 0x11, 0x1e, 0x29, 0x02, 0x2f, 0xfc, 0x29, 0x1e, 0x11, 0x02, 0x0b, 0x00, 0xfe, 0x0d, 0x22, 0x08, 0x33, 0xfe, 0x22, 0x0d, 0x09, 0x00, 0xfe, 0x11, 0x2b, 0x0a, 0x33, 0xfe, 0x2b, 0x11, 0x07, 0x00, 0xfe, 0x0d, 0x2b, 0x05, 0x33, 0x02, 0x31, 0x05, 0x33, 0xfe, 0x2b, 0x0d, 0x05, 0x00, 0xfe, 0x02, 0x22, 0x06, 0x33, 0x02, 0x15, 0x06, 0x33, 0xfe, 0x22, 0x02, 0x04, 0x00, 0xff, 0x11, 0x06, 0x33, 0xff, 0x2b, 0x02, 0x01, 0xff, 0x2b, 0x06, 0x33, 0xff, 0x11, 0x04, 0x00, 0xff, 0x1e, 0x06, 0x33, 0xff, 0x0d, 0x02, 0x00, 0xff, 0x0d, 0x06, 0x33, 0xff, 0x1e, 0x04, 0x00, 0xff, 0x29, 0x05, 0x33, 0xff, 0x1f, 0x04, 0x00, 0xff, 0x1f, 0x05, 0x33, 0xff, 0x29, 0x04, 0x00, 0xff, 0x2f, 0x04, 0x33, 0xfe, 0x2f, 0x02, 0x04, 0x00, 0xfe, 0x02, 0x2f, 0x04, 0x33, 0xff, 0x2f, 0x04, 0x00, 0xff, 0x2f, 0x04, 0x33, 0xff, 0x11, 0x06, 0x00, 0xff, 0x15, 0x04, 0x33, 0xff, 0x2f, 0x04, 0x00, 0xff, 0x29, 0x03, 0x33, 0xff, 0x26, 0x08, 0x00, 0xff, 0x26, 0x03, 0x33, 0xff, 0x29, 0x04, 0x00, 0xff, 0x1e, 0x03, 0x33, 0xff, 0x11, 0x08, 0x07, 0xff, 0x15, 0x03, 0x33, 0xff, 0x1e, 0x04, 0x00, 0xff, 0x11, 0x10, 0x33, 0xff, 0x11, 0x04, 0x00, 0xfe, 0x02, 0x22, 0x0e, 0x33, 0xfe, 0x22, 0x02, 0x05, 0x00, 0xfe, 0x0d, 0x2b, 0x0c, 0x33, 0xfe, 0x2b, 0x0d, 0x07, 0x00, 0xfe, 0x11, 0x2b, 0x0a, 0x33, 0xfe, 0x2b, 0x11, 0x09, 0x00, 0xfe, 0x0d, 0x22, 0x08, 0x33, 0xfe, 0x22, 0x0d, 0x0b, 0x00, 0xfc, 0x02, 0x11, 0x1e, 0x29, 0x02, 0x2f, 0xfc, 0x29, 0x1e, 0x11, 0x02, 0x04, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirm_icon_1_image = {(void *) &confirm_icon_1, 22, 18};
+    0x08, 0x00, 0xfc, 0x02, 0x11, 0x1e, 0x29, 0x02, 0x2f, 0xfc, 0x29, 0x1e, 0x11, 0x02, 0x0b, 0x00, 0xfe, 0x0d, 0x22, 0x08, 0x33, 0xfe, 0x22, 0x0d, 0x09, 0x00, 0xfe, 0x11, 0x2b, 0x0a, 0x33, 0xfe, 0x2b, 0x11, 0x07, 0x00, 0xfe, 0x0d, 0x2b, 0x05, 0x33, 0x02, 0x31, 0x05, 0x33, 0xfe, 0x2b, 0x0d, 0x05, 0x00, 0xfe, 0x02, 0x22, 0x06, 0x33, 0x02, 0x15, 0x06, 0x33, 0xfe, 0x22, 0x02, 0x04, 0x00, 0xff, 0x11, 0x06, 0x33, 0xff, 0x2b, 0x02, 0x01, 0xff, 0x2b, 0x06, 0x33, 0xff, 0x11, 0x04, 0x00, 0xff, 0x1e, 0x06, 0x33, 0xff, 0x0d, 0x02, 0x00, 0xff, 0x0d, 0x06, 0x33, 0xff, 0x1e, 0x04, 0x00, 0xff, 0x29, 0x05, 0x33, 0xff, 0x1f, 0x04, 0x00, 0xff, 0x1f, 0x05, 0x33, 0xff, 0x29, 0x04, 0x00, 0xff, 0x2f, 0x04, 0x33, 0xfe, 0x2f, 0x02, 0x04, 0x00, 0xfe, 0x02, 0x2f, 0x04, 0x33, 0xff, 0x2f, 0x04, 0x00, 0xff, 0x2f, 0x04, 0x33, 0xff, 0x11, 0x06, 0x00, 0xff, 0x15, 0x04, 0x33, 0xff, 0x2f, 0x04, 0x00, 0xff, 0x29, 0x03, 0x33, 0xff, 0x26, 0x08, 0x00, 0xff, 0x26, 0x03, 0x33, 0xff, 0x29, 0x04, 0x00, 0xff, 0x1e, 0x03, 0x33, 0xff, 0x11, 0x08, 0x07, 0xff, 0x15, 0x03, 0x33, 0xff, 0x1e, 0x04, 0x00, 0xff, 0x11, 0x10, 0x33, 0xff, 0x11, 0x04, 0x00, 0xfe, 0x02, 0x22, 0x0e, 0x33, 0xfe, 0x22, 0x02, 0x05, 0x00, 0xfe, 0x0d, 0x2b, 0x0c, 0x33, 0xfe, 0x2b, 0x0d, 0x07, 0x00, 0xfe, 0x11, 0x2b, 0x0a, 0x33, 0xfe, 0x2b, 0x11, 0x09, 0x00, 0xfe, 0x0d, 0x22, 0x08, 0x33, 0xfe, 0x22, 0x0d, 0x0b, 0x00, 0xfc, 0x02, 0x11, 0x1e, 0x29, 0x02, 0x2f, 0xfc, 0x29, 0x1e, 0x11, 0x02, 0x04, 0x00
+};
+static const Image confirm_icon_1_image = {confirm_icon_1_data, 22, 18};
 
-static void confirm_icon_2(uint8_t *data)
+static const uint8_t confirm_icon_2_data[240] =
 {
-    const uint8_t image_data[240] =
-    {
-        0x07, 0x00, 0xfc, 0x03, 0x22, 0x3f, 0x55, 0x02, 0x60, 0xfc, 0x55, 0x3f, 0x22, 0x03, 0x0b, 0x00, 0xfe, 0x1c, 0x44, 0x08, 0x66, 0xfe, 0x44, 0x1c, 0x09, 0x00, 0xfe, 0x22, 0x55, 0x0a, 0x66, 0xfe, 0x55, 0x22, 0x07, 0x00, 0xfe, 0x1c, 0x55, 0x05, 0x66, 0x02, 0x63, 0x05, 0x66, 0xfe, 0x55, 0x1c, 0x05, 0x00, 0xfe, 0x03, 0x44, 0x06, 0x66, 0x02, 0x37, 0x06, 0x66, 0xfe, 0x44, 0x03, 0x04, 0x00, 0xff, 0x22, 0x06, 0x66, 0xff, 0x55, 0x02, 0x03, 0xff, 0x55, 0x06, 0x66, 0xff, 0x22, 0x04, 0x00, 0xff, 0x3f, 0x06, 0x66, 0xff, 0x19, 0x02, 0x00, 0xff, 0x19, 0x06, 0x66, 0xff, 0x3f, 0x04, 0x00, 0xff, 0x55, 0x05, 0x66, 0xff, 0x3f, 0x04, 0x00, 0xff, 0x3f, 0x05, 0x66, 0xff, 0x55, 0x04, 0x00, 0xff, 0x60, 0x04, 0x66, 0xfe, 0x5a, 0x03, 0x04, 0x00, 0xfe, 0x03, 0x60, 0x04, 0x66, 0xff, 0x60, 0x04, 0x00, 0xff, 0x60, 0x04, 0x66, 0xff, 0x22, 0x06, 0x00, 0xff, 0x2b, 0x04, 0x66, 0xff, 0x60, 0x04, 0x00, 0xff, 0x55, 0x03, 0x66, 0xff, 0x4e, 0x08, 0x00, 0xff, 0x4e, 0x03, 0x66, 0xff, 0x55, 0x04, 0x00, 0xff, 0x3f, 0x03, 0x66, 0xff, 0x22, 0x08, 0x19, 0xff, 0x22, 0x03, 0x66, 0xff, 0x3f, 0x04, 0x00, 0xff, 0x22, 0x10, 0x66, 0xff, 0x22, 0x04, 0x00, 0xfe, 0x03, 0x44, 0x0e, 0x66, 0xfe, 0x44, 0x03, 0x05, 0x00, 0xfe, 0x1c, 0x55, 0x0c, 0x66, 0xfe, 0x55, 0x1c, 0x07, 0x00, 0xfe, 0x22, 0x55, 0x0a, 0x66, 0xfe, 0x55, 0x22, 0x09, 0x00, 0xfe, 0x1c, 0x44, 0x08, 0x66, 0xfe, 0x44, 0x1c, 0x0b, 0x00, 0xfc, 0x03, 0x22, 0x3f, 0x55, 0x02, 0x60, 0xfc, 0x55, 0x3f, 0x22, 0x03, 0x05, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirm_icon_2_image = {(void *) &confirm_icon_2, 22, 18};
+    0x07, 0x00, 0xfc, 0x03, 0x22, 0x3f, 0x55, 0x02, 0x60, 0xfc, 0x55, 0x3f, 0x22, 0x03, 0x0b, 0x00, 0xfe, 0x1c, 0x44, 0x08, 0x66, 0xfe, 0x44, 0x1c, 0x09, 0x00, 0xfe, 0x22, 0x55, 0x0a, 0x66, 0xfe, 0x55, 0x22, 0x07, 0x00, 0xfe, 0x1c, 0x55, 0x05, 0x66, 0x02, 0x63, 0x05, 0x66, 0xfe, 0x55, 0x1c, 0x05, 0x00, 0xfe, 0x03, 0x44, 0x06, 0x66, 0x02, 0x37, 0x06, 0x66, 0xfe, 0x44, 0x03, 0x04, 0x00, 0xff, 0x22, 0x06, 0x66, 0xff, 0x55, 0x02, 0x03, 0xff, 0x55, 0x06, 0x66, 0xff, 0x22, 0x04, 0x00, 0xff, 0x3f, 0x06, 0x66, 0xff, 0x19, 0x02, 0x00, 0xff, 0x19, 0x06, 0x66, 0xff, 0x3f, 0x04, 0x00, 0xff, 0x55, 0x05, 0x66, 0xff, 0x3f, 0x04, 0x00, 0xff, 0x3f, 0x05, 0x66, 0xff, 0x55, 0x04, 0x00, 0xff, 0x60, 0x04, 0x66, 0xfe, 0x5a, 0x03, 0x04, 0x00, 0xfe, 0x03, 0x60, 0x04, 0x66, 0xff, 0x60, 0x04, 0x00, 0xff, 0x60, 0x04, 0x66, 0xff, 0x22, 0x06, 0x00, 0xff, 0x2b, 0x04, 0x66, 0xff, 0x60, 0x04, 0x00, 0xff, 0x55, 0x03, 0x66, 0xff, 0x4e, 0x08, 0x00, 0xff, 0x4e, 0x03, 0x66, 0xff, 0x55, 0x04, 0x00, 0xff, 0x3f, 0x03, 0x66, 0xff, 0x22, 0x08, 0x19, 0xff, 0x22, 0x03, 0x66, 0xff, 0x3f, 0x04, 0x00, 0xff, 0x22, 0x10, 0x66, 0xff, 0x22, 0x04, 0x00, 0xfe, 0x03, 0x44, 0x0e, 0x66, 0xfe, 0x44, 0x03, 0x05, 0x00, 0xfe, 0x1c, 0x55, 0x0c, 0x66, 0xfe, 0x55, 0x1c, 0x07, 0x00, 0xfe, 0x22, 0x55, 0x0a, 0x66, 0xfe, 0x55, 0x22, 0x09, 0x00, 0xfe, 0x1c, 0x44, 0x08, 0x66, 0xfe, 0x44, 0x1c, 0x0b, 0x00, 0xfc, 0x03, 0x22, 0x3f, 0x55, 0x02, 0x60, 0xfc, 0x55, 0x3f, 0x22, 0x03, 0x05, 0x00
+};
+static const Image confirm_icon_2_image = {confirm_icon_2_data, 22, 18};
 
-static void confirm_icon_3(uint8_t *data)
+static const uint8_t confirm_icon_3_data[240] =
 {
-    const uint8_t image_data[240] =
-    {
-        0x06, 0x00, 0xfc, 0x06, 0x33, 0x5b, 0x80, 0x02, 0x91, 0xfc, 0x80, 0x5b, 0x33, 0x06, 0x0b, 0x00, 0xfe, 0x29, 0x62, 0x08, 0x99, 0xfe, 0x62, 0x29, 0x09, 0x00, 0xfe, 0x33, 0x80, 0x0a, 0x99, 0xfe, 0x80, 0x33, 0x07, 0x00, 0xfe, 0x29, 0x80, 0x05, 0x99, 0x02, 0x96, 0x05, 0x99, 0xfe, 0x80, 0x29, 0x05, 0x00, 0xfe, 0x06, 0x62, 0x06, 0x99, 0x02, 0x40, 0x06, 0x99, 0xfe, 0x62, 0x06, 0x04, 0x00, 0xff, 0x33, 0x06, 0x99, 0xff, 0x80, 0x02, 0x02, 0xff, 0x80, 0x06, 0x99, 0xff, 0x33, 0x04, 0x00, 0xff, 0x5b, 0x06, 0x99, 0xff, 0x26, 0x02, 0x00, 0xff, 0x26, 0x06, 0x99, 0xff, 0x5b, 0x04, 0x00, 0xff, 0x80, 0x05, 0x99, 0xff, 0x5b, 0x04, 0x00, 0xff, 0x62, 0x05, 0x99, 0xff, 0x80, 0x04, 0x00, 0xff, 0x91, 0x04, 0x99, 0xfe, 0x88, 0x06, 0x04, 0x00, 0xfe, 0x06, 0x91, 0x04, 0x99, 0xff, 0x91, 0x04, 0x00, 0xff, 0x91, 0x04, 0x99, 0xff, 0x33, 0x06, 0x00, 0xff, 0x40, 0x04, 0x99, 0xff, 0x91, 0x04, 0x00, 0xff, 0x80, 0x03, 0x99, 0xff, 0x74, 0x08, 0x00, 0xff, 0x74, 0x03, 0x99, 0xff, 0x80, 0x04, 0x00, 0xff, 0x5b, 0x03, 0x99, 0xff, 0x33, 0x08, 0x26, 0xff, 0x33, 0x03, 0x99, 0xff, 0x5b, 0x04, 0x00, 0xff, 0x33, 0x10, 0x99, 0xff, 0x33, 0x04, 0x00, 0xfe, 0x06, 0x62, 0x0e, 0x99, 0xfe, 0x62, 0x06, 0x05, 0x00, 0xfe, 0x29, 0x80, 0x0c, 0x99, 0xfe, 0x80, 0x29, 0x07, 0x00, 0xfe, 0x33, 0x80, 0x0a, 0x99, 0xfe, 0x80, 0x33, 0x09, 0x00, 0xfe, 0x29, 0x62, 0x08, 0x99, 0xfe, 0x62, 0x29, 0x0b, 0x00, 0xfc, 0x06, 0x33, 0x5b, 0x80, 0x02, 0x91, 0xfc, 0x80, 0x5b, 0x33, 0x06, 0x06, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirm_icon_3_image = {(void *) &confirm_icon_3, 22, 18};
+    0x06, 0x00, 0xfc, 0x06, 0x33, 0x5b, 0x80, 0x02, 0x91, 0xfc, 0x80, 0x5b, 0x33, 0x06, 0x0b, 0x00, 0xfe, 0x29, 0x62, 0x08, 0x99, 0xfe, 0x62, 0x29, 0x09, 0x00, 0xfe, 0x33, 0x80, 0x0a, 0x99, 0xfe, 0x80, 0x33, 0x07, 0x00, 0xfe, 0x29, 0x80, 0x05, 0x99, 0x02, 0x96, 0x05, 0x99, 0xfe, 0x80, 0x29, 0x05, 0x00, 0xfe, 0x06, 0x62, 0x06, 0x99, 0x02, 0x40, 0x06, 0x99, 0xfe, 0x62, 0x06, 0x04, 0x00, 0xff, 0x33, 0x06, 0x99, 0xff, 0x80, 0x02, 0x02, 0xff, 0x80, 0x06, 0x99, 0xff, 0x33, 0x04, 0x00, 0xff, 0x5b, 0x06, 0x99, 0xff, 0x26, 0x02, 0x00, 0xff, 0x26, 0x06, 0x99, 0xff, 0x5b, 0x04, 0x00, 0xff, 0x80, 0x05, 0x99, 0xff, 0x5b, 0x04, 0x00, 0xff, 0x62, 0x05, 0x99, 0xff, 0x80, 0x04, 0x00, 0xff, 0x91, 0x04, 0x99, 0xfe, 0x88, 0x06, 0x04, 0x00, 0xfe, 0x06, 0x91, 0x04, 0x99, 0xff, 0x91, 0x04, 0x00, 0xff, 0x91, 0x04, 0x99, 0xff, 0x33, 0x06, 0x00, 0xff, 0x40, 0x04, 0x99, 0xff, 0x91, 0x04, 0x00, 0xff, 0x80, 0x03, 0x99, 0xff, 0x74, 0x08, 0x00, 0xff, 0x74, 0x03, 0x99, 0xff, 0x80, 0x04, 0x00, 0xff, 0x5b, 0x03, 0x99, 0xff, 0x33, 0x08, 0x26, 0xff, 0x33, 0x03, 0x99, 0xff, 0x5b, 0x04, 0x00, 0xff, 0x33, 0x10, 0x99, 0xff, 0x33, 0x04, 0x00, 0xfe, 0x06, 0x62, 0x0e, 0x99, 0xfe, 0x62, 0x06, 0x05, 0x00, 0xfe, 0x29, 0x80, 0x0c, 0x99, 0xfe, 0x80, 0x29, 0x07, 0x00, 0xfe, 0x33, 0x80, 0x0a, 0x99, 0xfe, 0x80, 0x33, 0x09, 0x00, 0xfe, 0x29, 0x62, 0x08, 0x99, 0xfe, 0x62, 0x29, 0x0b, 0x00, 0xfc, 0x06, 0x33, 0x5b, 0x80, 0x02, 0x91, 0xfc, 0x80, 0x5b, 0x33, 0x06, 0x06, 0x00
+};
+static const Image confirm_icon_3_image = {confirm_icon_3_data, 22, 18};
 
-static void confirm_icon_4(uint8_t *data)
+static const uint8_t confirm_icon_4_data[240] =
 {
-    const uint8_t image_data[240] =
-    {
-        0x05, 0x00, 0xfc, 0x08, 0x44, 0x82, 0xaa, 0x02, 0xc1, 0xfc, 0xaa, 0x82, 0x44, 0x08, 0x0b, 0x00, 0xfe, 0x37, 0x82, 0x08, 0xcc, 0xfe, 0x82, 0x37, 0x09, 0x00, 0xfe, 0x44, 0xaa, 0x0a, 0xcc, 0xfe, 0xaa, 0x44, 0x07, 0x00, 0xfe, 0x37, 0xaa, 0x05, 0xcc, 0x02, 0xc8, 0x05, 0xcc, 0xfe, 0xaa, 0x37, 0x05, 0x00, 0xfe, 0x08, 0x82, 0x06, 0xcc, 0x02, 0x6f, 0x06, 0xcc, 0xfe, 0x82, 0x08, 0x04, 0x00, 0xff, 0x44, 0x06, 0xcc, 0xff, 0xaa, 0x02, 0x08, 0xff, 0xaa, 0x06, 0xcc, 0xff, 0x44, 0x04, 0x00, 0xff, 0x82, 0x06, 0xcc, 0xff, 0x32, 0x02, 0x00, 0xff, 0x32, 0x06, 0xcc, 0xff, 0x82, 0x04, 0x00, 0xff, 0xaa, 0x05, 0xcc, 0xff, 0x82, 0x04, 0x00, 0xff, 0x82, 0x05, 0xcc, 0xff, 0xaa, 0x04, 0x00, 0xff, 0xc1, 0x04, 0xcc, 0xfe, 0xb4, 0x08, 0x04, 0x00, 0xfe, 0x08, 0xc1, 0x04, 0xcc, 0xff, 0xc1, 0x04, 0x00, 0xff, 0xc1, 0x04, 0xcc, 0xff, 0x44, 0x06, 0x00, 0xff, 0x56, 0x04, 0xcc, 0xff, 0xc1, 0x04, 0x00, 0xff, 0xaa, 0x03, 0xcc, 0xff, 0x9b, 0x08, 0x00, 0xff, 0x9b, 0x03, 0xcc, 0xff, 0xaa, 0x04, 0x00, 0xff, 0x82, 0x03, 0xcc, 0xff, 0x44, 0x08, 0x32, 0xff, 0x44, 0x03, 0xcc, 0xff, 0x82, 0x04, 0x00, 0xff, 0x44, 0x10, 0xcc, 0xff, 0x44, 0x04, 0x00, 0xfe, 0x08, 0x82, 0x0e, 0xcc, 0xfe, 0x82, 0x08, 0x05, 0x00, 0xfe, 0x37, 0xaa, 0x0c, 0xcc, 0xfe, 0xaa, 0x37, 0x07, 0x00, 0xfe, 0x44, 0xaa, 0x0a, 0xcc, 0xfe, 0xaa, 0x44, 0x09, 0x00, 0xfe, 0x37, 0x82, 0x08, 0xcc, 0xfe, 0x82, 0x37, 0x0b, 0x00, 0xfc, 0x08, 0x44, 0x82, 0xaa, 0x02, 0xc1, 0xfc, 0xaa, 0x82, 0x44, 0x08, 0x07, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirm_icon_4_image = {(void *) &confirm_icon_4, 22, 18};
+    0x05, 0x00, 0xfc, 0x08, 0x44, 0x82, 0xaa, 0x02, 0xc1, 0xfc, 0xaa, 0x82, 0x44, 0x08, 0x0b, 0x00, 0xfe, 0x37, 0x82, 0x08, 0xcc, 0xfe, 0x82, 0x37, 0x09, 0x00, 0xfe, 0x44, 0xaa, 0x0a, 0xcc, 0xfe, 0xaa, 0x44, 0x07, 0x00, 0xfe, 0x37, 0xaa, 0x05, 0xcc, 0x02, 0xc8, 0x05, 0xcc, 0xfe, 0xaa, 0x37, 0x05, 0x00, 0xfe, 0x08, 0x82, 0x06, 0xcc, 0x02, 0x6f, 0x06, 0xcc, 0xfe, 0x82, 0x08, 0x04, 0x00, 0xff, 0x44, 0x06, 0xcc, 0xff, 0xaa, 0x02, 0x08, 0xff, 0xaa, 0x06, 0xcc, 0xff, 0x44, 0x04, 0x00, 0xff, 0x82, 0x06, 0xcc, 0xff, 0x32, 0x02, 0x00, 0xff, 0x32, 0x06, 0xcc, 0xff, 0x82, 0x04, 0x00, 0xff, 0xaa, 0x05, 0xcc, 0xff, 0x82, 0x04, 0x00, 0xff, 0x82, 0x05, 0xcc, 0xff, 0xaa, 0x04, 0x00, 0xff, 0xc1, 0x04, 0xcc, 0xfe, 0xb4, 0x08, 0x04, 0x00, 0xfe, 0x08, 0xc1, 0x04, 0xcc, 0xff, 0xc1, 0x04, 0x00, 0xff, 0xc1, 0x04, 0xcc, 0xff, 0x44, 0x06, 0x00, 0xff, 0x56, 0x04, 0xcc, 0xff, 0xc1, 0x04, 0x00, 0xff, 0xaa, 0x03, 0xcc, 0xff, 0x9b, 0x08, 0x00, 0xff, 0x9b, 0x03, 0xcc, 0xff, 0xaa, 0x04, 0x00, 0xff, 0x82, 0x03, 0xcc, 0xff, 0x44, 0x08, 0x32, 0xff, 0x44, 0x03, 0xcc, 0xff, 0x82, 0x04, 0x00, 0xff, 0x44, 0x10, 0xcc, 0xff, 0x44, 0x04, 0x00, 0xfe, 0x08, 0x82, 0x0e, 0xcc, 0xfe, 0x82, 0x08, 0x05, 0x00, 0xfe, 0x37, 0xaa, 0x0c, 0xcc, 0xfe, 0xaa, 0x37, 0x07, 0x00, 0xfe, 0x44, 0xaa, 0x0a, 0xcc, 0xfe, 0xaa, 0x44, 0x09, 0x00, 0xfe, 0x37, 0x82, 0x08, 0xcc, 0xfe, 0x82, 0x37, 0x0b, 0x00, 0xfc, 0x08, 0x44, 0x82, 0xaa, 0x02, 0xc1, 0xfc, 0xaa, 0x82, 0x44, 0x08, 0x07, 0x00
+};
+static const Image confirm_icon_4_image = {confirm_icon_4_data, 22, 18};
 
-static void confirm_icon_5(uint8_t *data)
+static const uint8_t confirm_icon_5_data[240] =
 {
-    const uint8_t image_data[240] =
-    {
-        0x04, 0x00, 0xfc, 0x0a, 0x55, 0xa3, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0xa3, 0x55, 0x0a, 0x0b, 0x00, 0xfe, 0x45, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x45, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x07, 0x00, 0xfe, 0x45, 0xd5, 0x05, 0xff, 0x02, 0xfa, 0x05, 0xff, 0xfe, 0xd5, 0x45, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0x02, 0x8b, 0x06, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xff, 0xd5, 0x02, 0x04, 0xff, 0xd5, 0x06, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x3f, 0x02, 0x00, 0xff, 0x3f, 0x06, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x0a, 0x04, 0x00, 0xfe, 0x0a, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x3f, 0xff, 0x55, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x45, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x45, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x45, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x45, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0xa3, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0xa3, 0x55, 0x0a, 0x08, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirm_icon_5_image = {(void *) &confirm_icon_5, 22, 18};
+    0x04, 0x00, 0xfc, 0x0a, 0x55, 0xa3, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0xa3, 0x55, 0x0a, 0x0b, 0x00, 0xfe, 0x45, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x45, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x07, 0x00, 0xfe, 0x45, 0xd5, 0x05, 0xff, 0x02, 0xfa, 0x05, 0xff, 0xfe, 0xd5, 0x45, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0x02, 0x8b, 0x06, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xff, 0xd5, 0x02, 0x04, 0xff, 0xd5, 0x06, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x3f, 0x02, 0x00, 0xff, 0x3f, 0x06, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x0a, 0x04, 0x00, 0xfe, 0x0a, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x3f, 0xff, 0x55, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x45, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x45, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x45, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x45, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0xa3, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0xa3, 0x55, 0x0a, 0x08, 0x00
+};
+static const Image confirm_icon_5_image = {confirm_icon_5_data, 22, 18};
 
 static const AnimationFrame confirm_icon_array[] =
 {
@@ -90,645 +68,389 @@ static const ImageAnimation confirm_icon = { 5, confirm_icon_array };
 
 /* --- Confirming Animation ------------------------------------------------ */
 
-static void confirming_1(uint8_t *data)
+static const uint8_t confirming_1_data[240] =
 {
-    const uint8_t image_data[240] =
-    {
-        0x32, 0x00, 0xfc, 0x0a, 0x56, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x56, 0x0a, 0x0b, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x09, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0x02, 0xfa, 0x05, 0xff, 0xfe, 0xd5, 0x49, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0x02, 0x6c, 0x06, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x56, 0x06, 0xff, 0xff, 0xd5, 0x02, 0x04, 0xff, 0xd5, 0x06, 0xff, 0xff, 0x56, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x49, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x0a, 0x04, 0x00, 0xfe, 0x0a, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x6c, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x56, 0x08, 0x22, 0xff, 0x59, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x56, 0x10, 0xff, 0xff, 0x56, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x0a, 0x56, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x56, 0x0a, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_1_image = {(void *) &confirming_1, 22, 22};
+    0x32, 0x00, 0xfc, 0x0a, 0x56, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x56, 0x0a, 0x0b, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x09, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0x02, 0xfa, 0x05, 0xff, 0xfe, 0xd5, 0x49, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0x02, 0x6c, 0x06, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x56, 0x06, 0xff, 0xff, 0xd5, 0x02, 0x04, 0xff, 0xd5, 0x06, 0xff, 0xff, 0x56, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x49, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x0a, 0x04, 0x00, 0xfe, 0x0a, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x6c, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x56, 0x08, 0x22, 0xff, 0x59, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x56, 0x10, 0xff, 0xff, 0x56, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x0a, 0x56, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x56, 0x0a, 0x32, 0x00
+};
+static const Image confirming_1_image = {confirming_1_data, 22, 22};
 
-static void confirming_2(uint8_t *data)
+static const uint8_t confirming_2_data[240] =
 {
-    const uint8_t image_data[240] =
-    {
-        0x32, 0x00, 0xfc, 0x0a, 0x56, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x56, 0x0a, 0x0b, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x09, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0x02, 0xfa, 0x05, 0xff, 0xfe, 0xd5, 0x49, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0x02, 0x6c, 0x06, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x56, 0x06, 0xff, 0xff, 0xd5, 0x02, 0x04, 0xff, 0xd5, 0x06, 0xff, 0xff, 0x56, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x49, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x0a, 0x04, 0x00, 0xfe, 0x0a, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x6c, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x56, 0x08, 0x22, 0xff, 0x59, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x56, 0x10, 0xff, 0xff, 0x56, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x0a, 0x56, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x56, 0x0a, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_2_image = {(void *) &confirming_2, 22, 22};
+    0x32, 0x00, 0xfc, 0x0a, 0x56, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x56, 0x0a, 0x0b, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x09, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0x02, 0xfa, 0x05, 0xff, 0xfe, 0xd5, 0x49, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0x02, 0x6c, 0x06, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x56, 0x06, 0xff, 0xff, 0xd5, 0x02, 0x04, 0xff, 0xd5, 0x06, 0xff, 0xff, 0x56, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x49, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x0a, 0x04, 0x00, 0xfe, 0x0a, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x6c, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x56, 0x08, 0x22, 0xff, 0x59, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x56, 0x10, 0xff, 0xff, 0x56, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x0a, 0x56, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x56, 0x0a, 0x32, 0x00
+};
+static const Image confirming_2_image = {confirming_2_data, 22, 22};
 
-static void confirming_3(uint8_t *data)
+static const uint8_t confirming_3_data[248] =
 {
-    const uint8_t image_data[248] =
-    {
-        0x32, 0x00, 0xf6, 0x05, 0x56, 0x97, 0xd5, 0xfa, 0x0f, 0xd5, 0x97, 0x56, 0x05, 0x0b, 0x00, 0xfe, 0x49, 0xa3, 0x04, 0xff, 0xff, 0x0f, 0x03, 0xff, 0xfe, 0xa3, 0x49, 0x09, 0x00, 0xfe, 0x59, 0xd5, 0x05, 0xff, 0xff, 0x0f, 0x04, 0xff, 0xfe, 0xd5, 0x59, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0xfe, 0xfa, 0x0f, 0x05, 0xff, 0xfe, 0xd5, 0x49, 0x05, 0x00, 0xfe, 0x05, 0xa3, 0x06, 0xff, 0xfe, 0x6c, 0x05, 0x06, 0xff, 0xfe, 0xa3, 0x05, 0x04, 0x00, 0xff, 0x56, 0x06, 0xff, 0xfc, 0xd5, 0x05, 0x00, 0xd5, 0x06, 0xff, 0xff, 0x56, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x49, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x12, 0x04, 0x00, 0xfe, 0x12, 0xe3, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x6c, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x56, 0x08, 0x33, 0xff, 0x59, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x56, 0x10, 0xff, 0xff, 0x56, 0x04, 0x00, 0xfe, 0x05, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x05, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x05, 0x56, 0x97, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0x97, 0x56, 0x05, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_3_image = {(void *) &confirming_3, 22, 22};
+    0x32, 0x00, 0xf6, 0x05, 0x56, 0x97, 0xd5, 0xfa, 0x0f, 0xd5, 0x97, 0x56, 0x05, 0x0b, 0x00, 0xfe, 0x49, 0xa3, 0x04, 0xff, 0xff, 0x0f, 0x03, 0xff, 0xfe, 0xa3, 0x49, 0x09, 0x00, 0xfe, 0x59, 0xd5, 0x05, 0xff, 0xff, 0x0f, 0x04, 0xff, 0xfe, 0xd5, 0x59, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0xfe, 0xfa, 0x0f, 0x05, 0xff, 0xfe, 0xd5, 0x49, 0x05, 0x00, 0xfe, 0x05, 0xa3, 0x06, 0xff, 0xfe, 0x6c, 0x05, 0x06, 0xff, 0xfe, 0xa3, 0x05, 0x04, 0x00, 0xff, 0x56, 0x06, 0xff, 0xfc, 0xd5, 0x05, 0x00, 0xd5, 0x06, 0xff, 0xff, 0x56, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x49, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x12, 0x04, 0x00, 0xfe, 0x12, 0xe3, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x6c, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x56, 0x08, 0x33, 0xff, 0x59, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x56, 0x10, 0xff, 0xff, 0x56, 0x04, 0x00, 0xfe, 0x05, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x05, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x05, 0x56, 0x97, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0x97, 0x56, 0x05, 0x32, 0x00
+};
+static const Image confirming_3_image = {confirming_3_data, 22, 22};
 
-static void confirming_4(uint8_t *data)
+static const uint8_t confirming_4_data[251] =
 {
-    const uint8_t image_data[251] =
-    {
-        0x32, 0x00, 0xfb, 0x0a, 0x55, 0x97, 0xd5, 0xf1, 0x02, 0x0e, 0xfd, 0x97, 0x55, 0x0a, 0x0b, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x02, 0x0e, 0x02, 0xff, 0xfe, 0xa3, 0x41, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x02, 0x0e, 0x03, 0xff, 0xfe, 0xd5, 0x55, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x02, 0x0e, 0x04, 0xff, 0xfe, 0xd5, 0x41, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfd, 0x6b, 0x0a, 0x0e, 0x05, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x04, 0x00, 0xd5, 0x06, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x41, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x0e, 0x04, 0x00, 0xfe, 0x0e, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x55, 0x0a, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_4_image = {(void *) &confirming_4, 22, 22};
+    0x32, 0x00, 0xfb, 0x0a, 0x55, 0x97, 0xd5, 0xf1, 0x02, 0x0e, 0xfd, 0x97, 0x55, 0x0a, 0x0b, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x02, 0x0e, 0x02, 0xff, 0xfe, 0xa3, 0x41, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x02, 0x0e, 0x03, 0xff, 0xfe, 0xd5, 0x55, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x02, 0x0e, 0x04, 0xff, 0xfe, 0xd5, 0x41, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfd, 0x6b, 0x0a, 0x0e, 0x05, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x04, 0x00, 0xd5, 0x06, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x41, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x0e, 0x04, 0x00, 0xfe, 0x0e, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x55, 0x0a, 0x32, 0x00
+};
+static const Image confirming_4_image = {confirming_4_data, 22, 22};
 
-static void confirming_5(uint8_t *data)
+static const uint8_t confirming_5_data[252] =
 {
-    const uint8_t image_data[252] =
-    {
-        0x32, 0x00, 0xfb, 0x0a, 0x57, 0x97, 0xd5, 0xfa, 0x02, 0x0e, 0xfd, 0x0a, 0x33, 0x0a, 0x0b, 0x00, 0xfe, 0x49, 0xa3, 0x04, 0xff, 0x03, 0x0e, 0xfd, 0xff, 0xa3, 0x49, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x03, 0x0e, 0x02, 0xff, 0xfe, 0xd5, 0x57, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x02, 0x0e, 0xff, 0x97, 0x03, 0xff, 0xfe, 0xd5, 0x49, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfd, 0x70, 0x0a, 0x0e, 0x05, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x05, 0x00, 0x0e, 0x06, 0xff, 0xff, 0x57, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x20, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x0e, 0x04, 0x00, 0xfe, 0x0e, 0xe3, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x57, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x57, 0x08, 0x33, 0xff, 0x57, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x57, 0x10, 0xff, 0xff, 0x57, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x57, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x0a, 0x57, 0x97, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0x97, 0x57, 0x0a, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_5_image = {(void *) &confirming_5, 22, 22};
+    0x32, 0x00, 0xfb, 0x0a, 0x57, 0x97, 0xd5, 0xfa, 0x02, 0x0e, 0xfd, 0x0a, 0x33, 0x0a, 0x0b, 0x00, 0xfe, 0x49, 0xa3, 0x04, 0xff, 0x03, 0x0e, 0xfd, 0xff, 0xa3, 0x49, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x03, 0x0e, 0x02, 0xff, 0xfe, 0xd5, 0x57, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x02, 0x0e, 0xff, 0x97, 0x03, 0xff, 0xfe, 0xd5, 0x49, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfd, 0x70, 0x0a, 0x0e, 0x05, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x05, 0x00, 0x0e, 0x06, 0xff, 0xff, 0x57, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x20, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x0e, 0x04, 0x00, 0xfe, 0x0e, 0xe3, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x57, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x57, 0x08, 0x33, 0xff, 0x57, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x57, 0x10, 0xff, 0xff, 0x57, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x57, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x0a, 0x57, 0x97, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0x97, 0x57, 0x0a, 0x32, 0x00
+};
+static const Image confirming_5_image = {confirming_5_data, 22, 22};
 
-static void confirming_6(uint8_t *data)
+static const uint8_t confirming_6_data[249] =
 {
-    const uint8_t image_data[249] =
-    {
-        0x32, 0x00, 0xfb, 0x0a, 0x55, 0x99, 0xc2, 0xf7, 0x02, 0x0e, 0xfe, 0x0a, 0x05, 0x0c, 0x00, 0xfe, 0x45, 0xa6, 0x04, 0xff, 0x04, 0x10, 0xfe, 0xa6, 0x45, 0x09, 0x00, 0xfe, 0x55, 0xe0, 0x05, 0xff, 0x04, 0x10, 0xfd, 0xff, 0xe0, 0x55, 0x07, 0x00, 0xfe, 0x45, 0xe0, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x02, 0x10, 0x03, 0xff, 0xfe, 0xe0, 0x45, 0x05, 0x00, 0xfe, 0x0a, 0xa6, 0x06, 0xff, 0xfe, 0x6b, 0x0a, 0x02, 0x10, 0x04, 0xff, 0xfe, 0xa6, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xe0, 0x05, 0x00, 0x0e, 0x06, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x3d, 0x02, 0x00, 0xff, 0x05, 0x06, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0xa6, 0x05, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xe0, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xf7, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x55, 0x08, 0x3d, 0xff, 0x55, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xa6, 0x0e, 0xff, 0xfe, 0xa6, 0x0a, 0x05, 0x00, 0xfe, 0x45, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x45, 0x07, 0x00, 0xfe, 0x55, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x55, 0x09, 0x00, 0xfe, 0x45, 0xa6, 0x08, 0xff, 0xfe, 0xa6, 0x45, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0x99, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0x99, 0x55, 0x0a, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_6_image = {(void *) &confirming_6, 22, 22};
+    0x32, 0x00, 0xfb, 0x0a, 0x55, 0x99, 0xc2, 0xf7, 0x02, 0x0e, 0xfe, 0x0a, 0x05, 0x0c, 0x00, 0xfe, 0x45, 0xa6, 0x04, 0xff, 0x04, 0x10, 0xfe, 0xa6, 0x45, 0x09, 0x00, 0xfe, 0x55, 0xe0, 0x05, 0xff, 0x04, 0x10, 0xfd, 0xff, 0xe0, 0x55, 0x07, 0x00, 0xfe, 0x45, 0xe0, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x02, 0x10, 0x03, 0xff, 0xfe, 0xe0, 0x45, 0x05, 0x00, 0xfe, 0x0a, 0xa6, 0x06, 0xff, 0xfe, 0x6b, 0x0a, 0x02, 0x10, 0x04, 0xff, 0xfe, 0xa6, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xe0, 0x05, 0x00, 0x0e, 0x06, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x3d, 0x02, 0x00, 0xff, 0x05, 0x06, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0xa6, 0x05, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xe0, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xf7, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x55, 0x08, 0x3d, 0xff, 0x55, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xa6, 0x0e, 0xff, 0xfe, 0xa6, 0x0a, 0x05, 0x00, 0xfe, 0x45, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x45, 0x07, 0x00, 0xfe, 0x55, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x55, 0x09, 0x00, 0xfe, 0x45, 0xa6, 0x08, 0xff, 0xfe, 0xa6, 0x45, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0x99, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0x99, 0x55, 0x0a, 0x32, 0x00
+};
+static const Image confirming_6_image = {confirming_6_data, 22, 22};
 
-static void confirming_7(uint8_t *data)
+static const uint8_t confirming_7_data[249] =
 {
-    const uint8_t image_data[249] =
-    {
-        0x32, 0x00, 0xf7, 0x0a, 0x55, 0x8c, 0xc2, 0xf1, 0x10, 0x0d, 0x0a, 0x05, 0x0c, 0x00, 0xfe, 0x41, 0xa4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x41, 0x09, 0x00, 0xfe, 0x55, 0xe0, 0x05, 0xff, 0x05, 0x10, 0xfe, 0xe0, 0x55, 0x07, 0x00, 0xfe, 0x41, 0xe0, 0x05, 0xff, 0xff, 0xfa, 0x04, 0x10, 0x02, 0xff, 0xfe, 0xe0, 0x41, 0x05, 0x00, 0xfe, 0x0a, 0xa4, 0x06, 0xff, 0xfe, 0x8c, 0x0a, 0x02, 0x10, 0xff, 0xa4, 0x03, 0xff, 0xfe, 0xa4, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfb, 0xe0, 0x05, 0x00, 0x0d, 0x10, 0x05, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0x8c, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x05, 0x06, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa4, 0x04, 0x00, 0xff, 0xa4, 0x05, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x5e, 0x06, 0x00, 0xff, 0x5e, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0x8c, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x5e, 0x03, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xa4, 0x0e, 0xff, 0xfe, 0xa4, 0x0a, 0x05, 0x00, 0xfe, 0x41, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa4, 0x08, 0xff, 0xfe, 0xa4, 0x41, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0x8c, 0xc2, 0x02, 0xf1, 0xfc, 0xc2, 0x8c, 0x55, 0x0a, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_7_image = {(void *) &confirming_7, 22, 22};
+    0x32, 0x00, 0xf7, 0x0a, 0x55, 0x8c, 0xc2, 0xf1, 0x10, 0x0d, 0x0a, 0x05, 0x0c, 0x00, 0xfe, 0x41, 0xa4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x41, 0x09, 0x00, 0xfe, 0x55, 0xe0, 0x05, 0xff, 0x05, 0x10, 0xfe, 0xe0, 0x55, 0x07, 0x00, 0xfe, 0x41, 0xe0, 0x05, 0xff, 0xff, 0xfa, 0x04, 0x10, 0x02, 0xff, 0xfe, 0xe0, 0x41, 0x05, 0x00, 0xfe, 0x0a, 0xa4, 0x06, 0xff, 0xfe, 0x8c, 0x0a, 0x02, 0x10, 0xff, 0xa4, 0x03, 0xff, 0xfe, 0xa4, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfb, 0xe0, 0x05, 0x00, 0x0d, 0x10, 0x05, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0x8c, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x05, 0x06, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa4, 0x04, 0x00, 0xff, 0xa4, 0x05, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x5e, 0x06, 0x00, 0xff, 0x5e, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0x8c, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x5e, 0x03, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xa4, 0x0e, 0xff, 0xfe, 0xa4, 0x0a, 0x05, 0x00, 0xfe, 0x41, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa4, 0x08, 0xff, 0xfe, 0xa4, 0x41, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0x8c, 0xc2, 0x02, 0xf1, 0xfc, 0xc2, 0x8c, 0x55, 0x0a, 0x32, 0x00
+};
+static const Image confirming_7_image = {confirming_7_data, 22, 22};
 
-static void confirming_8(uint8_t *data)
+static const uint8_t confirming_8_data[249] =
 {
-    const uint8_t image_data[249] =
-    {
-        0x32, 0x00, 0xf7, 0x09, 0x55, 0xa3, 0xc2, 0xf7, 0x0e, 0x0c, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x04, 0x09, 0x00, 0xfe, 0x59, 0xe0, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x59, 0x07, 0x00, 0xfe, 0x41, 0xe0, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x04, 0x10, 0xfd, 0xff, 0xe0, 0x41, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x09, 0x03, 0x10, 0x03, 0xff, 0xfe, 0xa3, 0x09, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfa, 0xe0, 0x09, 0x00, 0x0e, 0x10, 0x59, 0x04, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xfe, 0x04, 0x10, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xe0, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xf7, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x59, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x59, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x09, 0x05, 0x00, 0xfe, 0x41, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x41, 0x07, 0x00, 0xfe, 0x59, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x59, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x55, 0xa3, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0xa3, 0x55, 0x09, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_8_image = {(void *) &confirming_8, 22, 22};
+    0x32, 0x00, 0xf7, 0x09, 0x55, 0xa3, 0xc2, 0xf7, 0x0e, 0x0c, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x04, 0x09, 0x00, 0xfe, 0x59, 0xe0, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x59, 0x07, 0x00, 0xfe, 0x41, 0xe0, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x04, 0x10, 0xfd, 0xff, 0xe0, 0x41, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x09, 0x03, 0x10, 0x03, 0xff, 0xfe, 0xa3, 0x09, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfa, 0xe0, 0x09, 0x00, 0x0e, 0x10, 0x59, 0x04, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xfe, 0x04, 0x10, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xe0, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xf7, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x59, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x59, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x09, 0x05, 0x00, 0xfe, 0x41, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x41, 0x07, 0x00, 0xfe, 0x59, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x59, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x55, 0xa3, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0xa3, 0x55, 0x09, 0x32, 0x00
+};
+static const Image confirming_8_image = {confirming_8_data, 22, 22};
 
-static void confirming_9(uint8_t *data)
+static const uint8_t confirming_9_data[249] =
 {
-    const uint8_t image_data[249] =
-    {
-        0x32, 0x00, 0xfb, 0x0b, 0x57, 0x97, 0xc2, 0xf7, 0x02, 0x0e, 0xfe, 0x0b, 0x05, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xe0, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0e, 0x05, 0x07, 0x00, 0xfe, 0x41, 0xe0, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0xe0, 0x41, 0x05, 0x00, 0xfe, 0x0b, 0xa3, 0x06, 0xff, 0xfe, 0x6c, 0x05, 0x04, 0x10, 0x02, 0xff, 0xfe, 0xa3, 0x0b, 0x04, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xe0, 0x05, 0x00, 0x0e, 0x02, 0x10, 0x04, 0xff, 0xff, 0x57, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xfe, 0x05, 0x10, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xe0, 0x13, 0x04, 0x00, 0xfe, 0x13, 0xf7, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x6c, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x57, 0x08, 0x33, 0xff, 0x57, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x57, 0x10, 0xff, 0xff, 0x57, 0x04, 0x00, 0xfe, 0x0b, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0b, 0x05, 0x00, 0xfe, 0x41, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x41, 0x07, 0x00, 0xfe, 0x57, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x57, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x0b, 0x57, 0x97, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0x97, 0x57, 0x0b, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_9_image = {(void *) &confirming_9, 22, 22};
+    0x32, 0x00, 0xfb, 0x0b, 0x57, 0x97, 0xc2, 0xf7, 0x02, 0x0e, 0xfe, 0x0b, 0x05, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xe0, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0e, 0x05, 0x07, 0x00, 0xfe, 0x41, 0xe0, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0xe0, 0x41, 0x05, 0x00, 0xfe, 0x0b, 0xa3, 0x06, 0xff, 0xfe, 0x6c, 0x05, 0x04, 0x10, 0x02, 0xff, 0xfe, 0xa3, 0x0b, 0x04, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xe0, 0x05, 0x00, 0x0e, 0x02, 0x10, 0x04, 0xff, 0xff, 0x57, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xfe, 0x05, 0x10, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xe0, 0x13, 0x04, 0x00, 0xfe, 0x13, 0xf7, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x6c, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x57, 0x08, 0x33, 0xff, 0x57, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x57, 0x10, 0xff, 0xff, 0x57, 0x04, 0x00, 0xfe, 0x0b, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0b, 0x05, 0x00, 0xfe, 0x41, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x41, 0x07, 0x00, 0xfe, 0x57, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x57, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x0b, 0x57, 0x97, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0x97, 0x57, 0x0b, 0x32, 0x00
+};
+static const Image confirming_9_image = {confirming_9_data, 22, 22};
 
-static void confirming_10(uint8_t *data)
+static const uint8_t confirming_10_data[249] =
 {
-    const uint8_t image_data[249] =
-    {
-        0x32, 0x00, 0xfb, 0x0a, 0x55, 0x99, 0xc7, 0xee, 0x02, 0x0e, 0xfe, 0x0a, 0x05, 0x0c, 0x00, 0xfe, 0x41, 0xb1, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x05, 0x09, 0x00, 0xfe, 0x55, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0e, 0x05, 0x07, 0x00, 0xfe, 0x41, 0xdf, 0x05, 0xff, 0xfe, 0xfa, 0x0e, 0x05, 0x10, 0xfe, 0x0e, 0x22, 0x05, 0x00, 0xfe, 0x0a, 0xb1, 0x06, 0xff, 0xfe, 0x6b, 0x0a, 0x05, 0x10, 0xfd, 0xee, 0xb1, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xdf, 0x05, 0x00, 0x0e, 0x03, 0x10, 0x03, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x05, 0x02, 0x10, 0x04, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0xc7, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x0a, 0x05, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0xee, 0x04, 0xff, 0xfe, 0xee, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xee, 0x04, 0xff, 0xff, 0xee, 0x04, 0x00, 0xff, 0xee, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xee, 0x04, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xb1, 0x08, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xb1, 0x0e, 0xff, 0xfe, 0xb1, 0x0a, 0x05, 0x00, 0xfe, 0x41, 0xdf, 0x0c, 0xff, 0xfe, 0xdf, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xdf, 0x0a, 0xff, 0xfe, 0xdf, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xb1, 0x08, 0xff, 0xfe, 0xb1, 0x41, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0x99, 0xc7, 0x02, 0xee, 0xfc, 0xc7, 0x99, 0x55, 0x0a, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_10_image = {(void *) &confirming_10, 22, 22};
+    0x32, 0x00, 0xfb, 0x0a, 0x55, 0x99, 0xc7, 0xee, 0x02, 0x0e, 0xfe, 0x0a, 0x05, 0x0c, 0x00, 0xfe, 0x41, 0xb1, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x05, 0x09, 0x00, 0xfe, 0x55, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0e, 0x05, 0x07, 0x00, 0xfe, 0x41, 0xdf, 0x05, 0xff, 0xfe, 0xfa, 0x0e, 0x05, 0x10, 0xfe, 0x0e, 0x22, 0x05, 0x00, 0xfe, 0x0a, 0xb1, 0x06, 0xff, 0xfe, 0x6b, 0x0a, 0x05, 0x10, 0xfd, 0xee, 0xb1, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xdf, 0x05, 0x00, 0x0e, 0x03, 0x10, 0x03, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x05, 0x02, 0x10, 0x04, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0xc7, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x0a, 0x05, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0xee, 0x04, 0xff, 0xfe, 0xee, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xee, 0x04, 0xff, 0xff, 0xee, 0x04, 0x00, 0xff, 0xee, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xee, 0x04, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xb1, 0x08, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xb1, 0x0e, 0xff, 0xfe, 0xb1, 0x0a, 0x05, 0x00, 0xfe, 0x41, 0xdf, 0x0c, 0xff, 0xfe, 0xdf, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xdf, 0x0a, 0xff, 0xfe, 0xdf, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xb1, 0x08, 0xff, 0xfe, 0xb1, 0x41, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0x99, 0xc7, 0x02, 0xee, 0xfc, 0xc7, 0x99, 0x55, 0x0a, 0x32, 0x00
+};
+static const Image confirming_10_image = {confirming_10_data, 22, 22};
 
-static void confirming_11(uint8_t *data)
+static const uint8_t confirming_11_data[246] =
 {
-    const uint8_t image_data[246] =
-    {
-        0x32, 0x00, 0xf7, 0x09, 0x55, 0x99, 0xc7, 0xee, 0x10, 0x0d, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xb1, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x09, 0x04, 0x09, 0x00, 0xfe, 0x55, 0xe0, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x41, 0xe0, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xb1, 0x06, 0xff, 0xfe, 0x6b, 0x09, 0x06, 0x10, 0x02, 0x09, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xe0, 0x09, 0x00, 0x0d, 0x04, 0x10, 0xfd, 0xee, 0xff, 0x55, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x04, 0x03, 0x10, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0xc7, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xfe, 0x09, 0xee, 0x04, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0xee, 0x04, 0xff, 0xfe, 0xee, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xee, 0x04, 0xff, 0xff, 0xee, 0x04, 0x00, 0xff, 0xee, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xee, 0x04, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xb1, 0x08, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x09, 0xb1, 0x0e, 0xff, 0xfe, 0xb1, 0x09, 0x05, 0x00, 0xfe, 0x41, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xb1, 0x08, 0xff, 0xfe, 0xb1, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x55, 0x99, 0xc7, 0x02, 0xee, 0xfc, 0xc7, 0x99, 0x55, 0x09, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_11_image = {(void *) &confirming_11, 22, 22};
+    0x32, 0x00, 0xf7, 0x09, 0x55, 0x99, 0xc7, 0xee, 0x10, 0x0d, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xb1, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x09, 0x04, 0x09, 0x00, 0xfe, 0x55, 0xe0, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x41, 0xe0, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xb1, 0x06, 0xff, 0xfe, 0x6b, 0x09, 0x06, 0x10, 0x02, 0x09, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xe0, 0x09, 0x00, 0x0d, 0x04, 0x10, 0xfd, 0xee, 0xff, 0x55, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x04, 0x03, 0x10, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0xc7, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xfe, 0x09, 0xee, 0x04, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0xee, 0x04, 0xff, 0xfe, 0xee, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xee, 0x04, 0xff, 0xff, 0xee, 0x04, 0x00, 0xff, 0xee, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xee, 0x04, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xb1, 0x08, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x09, 0xb1, 0x0e, 0xff, 0xfe, 0xb1, 0x09, 0x05, 0x00, 0xfe, 0x41, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xb1, 0x08, 0xff, 0xfe, 0xb1, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x55, 0x99, 0xc7, 0x02, 0xee, 0xfc, 0xc7, 0x99, 0x55, 0x09, 0x32, 0x00
+};
+static const Image confirming_11_image = {confirming_11_data, 22, 22};
 
-static void confirming_12(uint8_t *data)
+static const uint8_t confirming_12_data[244] =
 {
-    const uint8_t image_data[244] =
-    {
-        0x32, 0x00, 0xf7, 0x09, 0x55, 0xa3, 0xd5, 0xfa, 0x10, 0x0d, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x09, 0x04, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x8a, 0x09, 0x06, 0x10, 0xff, 0x09, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x09, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x55, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x04, 0x04, 0x10, 0x02, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xfe, 0x09, 0x10, 0x04, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xe3, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x5e, 0x06, 0x00, 0xff, 0x5e, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x5e, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x09, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x55, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x55, 0x09, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_12_image = {(void *) &confirming_12, 22, 22};
+    0x32, 0x00, 0xf7, 0x09, 0x55, 0xa3, 0xd5, 0xfa, 0x10, 0x0d, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x09, 0x04, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x8a, 0x09, 0x06, 0x10, 0xff, 0x09, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x09, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x55, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x04, 0x04, 0x10, 0x02, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xfe, 0x09, 0x10, 0x04, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xe3, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x5e, 0x06, 0x00, 0xff, 0x5e, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x5e, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x09, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x55, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x55, 0x09, 0x32, 0x00
+};
+static const Image confirming_12_image = {confirming_12_data, 22, 22};
 
-static void confirming_13(uint8_t *data)
+static const uint8_t confirming_13_data[245] =
 {
-    const uint8_t image_data[245] =
-    {
-        0x32, 0x00, 0xf7, 0x08, 0x55, 0x97, 0xd5, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0d, 0x03, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x6b, 0x08, 0x06, 0x10, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x05, 0x10, 0xfe, 0x22, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x08, 0x02, 0x10, 0xff, 0xa3, 0x02, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0xe3, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x55, 0x97, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0x97, 0x55, 0x08, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_13_image = {(void *) &confirming_13, 22, 22};
+    0x32, 0x00, 0xf7, 0x08, 0x55, 0x97, 0xd5, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0d, 0x03, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x6b, 0x08, 0x06, 0x10, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x05, 0x10, 0xfe, 0x22, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x08, 0x02, 0x10, 0xff, 0xa3, 0x02, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0xe3, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x55, 0x97, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0x97, 0x55, 0x08, 0x32, 0x00
+};
+static const Image confirming_13_image = {confirming_13_data, 22, 22};
 
-static void confirming_14(uint8_t *data)
+static const uint8_t confirming_14_data[241] =
 {
-    const uint8_t image_data[241] =
-    {
-        0x32, 0x00, 0xf7, 0x08, 0x55, 0xa3, 0xd5, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0d, 0x03, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x8a, 0x08, 0x06, 0x10, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x08, 0x04, 0x10, 0xfe, 0x8a, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0x10, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x55, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x55, 0x08, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_14_image = {(void *) &confirming_14, 22, 22};
+    0x32, 0x00, 0xf7, 0x08, 0x55, 0xa3, 0xd5, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0d, 0x03, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x8a, 0x08, 0x06, 0x10, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x08, 0x04, 0x10, 0xfe, 0x8a, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0x10, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x55, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x55, 0x08, 0x32, 0x00
+};
+static const Image confirming_14_image = {confirming_14_data, 22, 22};
 
-static void confirming_15(uint8_t *data)
+static const uint8_t confirming_15_data[240] =
 {
-    const uint8_t image_data[240] =
-    {
-        0x32, 0x00, 0xf7, 0x08, 0x55, 0xa3, 0xd5, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x45, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0d, 0x03, 0x09, 0x00, 0xfe, 0x59, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x45, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x7a, 0x08, 0x06, 0x10, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x45, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0x03, 0x10, 0xfd, 0xa3, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x59, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x27, 0xff, 0x59, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x45, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x45, 0x07, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x09, 0x00, 0xfe, 0x45, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x45, 0x0b, 0x00, 0xfc, 0x08, 0x55, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x55, 0x08, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_15_image = {(void *) &confirming_15, 22, 22};
+    0x32, 0x00, 0xf7, 0x08, 0x55, 0xa3, 0xd5, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x45, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0d, 0x03, 0x09, 0x00, 0xfe, 0x59, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x45, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x7a, 0x08, 0x06, 0x10, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x45, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0x03, 0x10, 0xfd, 0xa3, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x59, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x27, 0xff, 0x59, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x45, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x45, 0x07, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x09, 0x00, 0xfe, 0x45, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x45, 0x0b, 0x00, 0xfc, 0x08, 0x55, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x55, 0x08, 0x32, 0x00
+};
+static const Image confirming_15_image = {confirming_15_data, 22, 22};
 
-static void confirming_16(uint8_t *data)
+static const uint8_t confirming_16_data[236] =
 {
-    const uint8_t image_data[236] =
-    {
-        0x32, 0x00, 0xf7, 0x0a, 0x57, 0xa3, 0xd5, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x49, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x03, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0x06, 0x10, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x57, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x08, 0x22, 0xff, 0x57, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x57, 0x10, 0xff, 0xff, 0x57, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x57, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x0a, 0x57, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x57, 0x0a, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_16_image = {(void *) &confirming_16, 22, 22};
+    0x32, 0x00, 0xf7, 0x0a, 0x57, 0xa3, 0xd5, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x49, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x03, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0x06, 0x10, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x57, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x08, 0x22, 0xff, 0x57, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x57, 0x10, 0xff, 0xff, 0x57, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x57, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x0a, 0x57, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x57, 0x0a, 0x32, 0x00
+};
+static const Image confirming_16_image = {confirming_16_data, 22, 22};
 
-static void confirming_17(uint8_t *data)
+static const uint8_t confirming_17_data[234] =
 {
-    const uint8_t image_data[234] =
-    {
-        0x32, 0x00, 0xf7, 0x08, 0x55, 0x99, 0xc7, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xb1, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0d, 0x03, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xb1, 0x06, 0xff, 0xfe, 0x6b, 0x08, 0x06, 0x10, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc7, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0x06, 0x10, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x08, 0x05, 0x10, 0x04, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xb1, 0x08, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x08, 0xb1, 0x0e, 0xff, 0xfe, 0xb1, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xb1, 0x08, 0xff, 0xfe, 0xb1, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x55, 0x99, 0xc7, 0x02, 0xfa, 0xfc, 0xc7, 0x99, 0x55, 0x08, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_17_image = {(void *) &confirming_17, 22, 22};
+    0x32, 0x00, 0xf7, 0x08, 0x55, 0x99, 0xc7, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xb1, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0d, 0x03, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xb1, 0x06, 0xff, 0xfe, 0x6b, 0x08, 0x06, 0x10, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc7, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0x06, 0x10, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x08, 0x05, 0x10, 0x04, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xb1, 0x08, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x08, 0xb1, 0x0e, 0xff, 0xfe, 0xb1, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xb1, 0x08, 0xff, 0xfe, 0xb1, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x55, 0x99, 0xc7, 0x02, 0xfa, 0xfc, 0xc7, 0x99, 0x55, 0x08, 0x32, 0x00
+};
+static const Image confirming_17_image = {confirming_17_data, 22, 22};
 
-static void confirming_18(uint8_t *data)
+static const uint8_t confirming_18_data[241] =
 {
-    const uint8_t image_data[241] =
-    {
-        0x32, 0x00, 0xf7, 0x08, 0x4e, 0xa3, 0xd5, 0xfa, 0x0e, 0x0c, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x03, 0x09, 0x00, 0xfe, 0x4e, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x08, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xfe, 0xfa, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0c, 0x05, 0x00, 0xff, 0x4e, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x4e, 0x06, 0x00, 0xff, 0x08, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xfb, 0xc2, 0xff, 0xa3, 0x41, 0x0e, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x4e, 0x08, 0x41, 0xff, 0x4e, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x4e, 0x10, 0xff, 0xff, 0x4e, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x4e, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x4e, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x4e, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x4e, 0x08, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_18_image = {(void *) &confirming_18, 22, 22};
+    0x32, 0x00, 0xf7, 0x08, 0x4e, 0xa3, 0xd5, 0xfa, 0x0e, 0x0c, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x03, 0x09, 0x00, 0xfe, 0x4e, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x08, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xfe, 0xfa, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0c, 0x05, 0x00, 0xff, 0x4e, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x4e, 0x06, 0x00, 0xff, 0x08, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xfb, 0xc2, 0xff, 0xa3, 0x41, 0x0e, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x4e, 0x08, 0x41, 0xff, 0x4e, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x4e, 0x10, 0xff, 0xff, 0x4e, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x4e, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x4e, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x4e, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x4e, 0x08, 0x32, 0x00
+};
+static const Image confirming_18_image = {confirming_18_data, 22, 22};
 
-static void confirming_19(uint8_t *data)
+static const uint8_t confirming_19_data[242] =
 {
-    const uint8_t image_data[242] =
-    {
-        0x32, 0x00, 0xf7, 0x08, 0x57, 0xa3, 0xc2, 0xf7, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x41, 0xdf, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x7a, 0x08, 0x06, 0x10, 0xff, 0x0c, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xdf, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0x22, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x08, 0x41, 0xff, 0x57, 0x02, 0xff, 0xfe, 0xc2, 0x22, 0x04, 0x00, 0xff, 0x57, 0x10, 0xff, 0xff, 0x57, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xdf, 0x0c, 0xff, 0xfe, 0xdf, 0x41, 0x07, 0x00, 0xfe, 0x57, 0xdf, 0x0a, 0xff, 0xfe, 0xdf, 0x57, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x57, 0xa3, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0xa3, 0x57, 0x08, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_19_image = {(void *) &confirming_19, 22, 22};
+    0x32, 0x00, 0xf7, 0x08, 0x57, 0xa3, 0xc2, 0xf7, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x41, 0xdf, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x7a, 0x08, 0x06, 0x10, 0xff, 0x0c, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xdf, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0x22, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x08, 0x41, 0xff, 0x57, 0x02, 0xff, 0xfe, 0xc2, 0x22, 0x04, 0x00, 0xff, 0x57, 0x10, 0xff, 0xff, 0x57, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xdf, 0x0c, 0xff, 0xfe, 0xdf, 0x41, 0x07, 0x00, 0xfe, 0x57, 0xdf, 0x0a, 0xff, 0xfe, 0xdf, 0x57, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x57, 0xa3, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0xa3, 0x57, 0x08, 0x32, 0x00
+};
+static const Image confirming_19_image = {confirming_19_data, 22, 22};
 
-static void confirming_20(uint8_t *data)
+static const uint8_t confirming_20_data[243] =
 {
-    const uint8_t image_data[243] =
-    {
-        0x32, 0x00, 0xf7, 0x09, 0x57, 0xa3, 0xd5, 0xfa, 0x0e, 0x0c, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xfe, 0xfa, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x7a, 0x09, 0x06, 0x10, 0xff, 0x0c, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x09, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x04, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xbc, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x08, 0x41, 0xfe, 0x57, 0xa3, 0x02, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x57, 0x0f, 0xff, 0xfe, 0xfa, 0x22, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x09, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x57, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x57, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x57, 0x09, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_20_image = {(void *) &confirming_20, 22, 22};
+    0x32, 0x00, 0xf7, 0x09, 0x57, 0xa3, 0xd5, 0xfa, 0x0e, 0x0c, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xfe, 0xfa, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x7a, 0x09, 0x06, 0x10, 0xff, 0x0c, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x09, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x04, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xbc, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x08, 0x41, 0xfe, 0x57, 0xa3, 0x02, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x57, 0x0f, 0xff, 0xfe, 0xfa, 0x22, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x09, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x57, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x57, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x57, 0x09, 0x32, 0x00
+};
+static const Image confirming_20_image = {confirming_20_data, 22, 22};
 
-static void confirming_21(uint8_t *data)
+static const uint8_t confirming_21_data[242] =
 {
-    const uint8_t image_data[242] =
-    {
-        0x32, 0x00, 0xf7, 0x0a, 0x51, 0xa3, 0xd5, 0xea, 0x0e, 0x0c, 0x0a, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x03, 0x09, 0x00, 0xfe, 0x51, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x03, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x51, 0x06, 0xff, 0xfc, 0xd5, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x51, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x51, 0x08, 0x41, 0xff, 0x22, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x51, 0x0e, 0xff, 0xfd, 0x51, 0x10, 0x03, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x03, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x51, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x51, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x0a, 0x51, 0xa3, 0xd5, 0x02, 0xea, 0xfc, 0xd5, 0xa3, 0x51, 0x0a, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_21_image = {(void *) &confirming_21, 22, 22};
+    0x32, 0x00, 0xf7, 0x0a, 0x51, 0xa3, 0xd5, 0xea, 0x0e, 0x0c, 0x0a, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x03, 0x09, 0x00, 0xfe, 0x51, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x03, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x51, 0x06, 0xff, 0xfc, 0xd5, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x51, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x51, 0x08, 0x41, 0xff, 0x22, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x51, 0x0e, 0xff, 0xfd, 0x51, 0x10, 0x03, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x03, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x51, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x51, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x0a, 0x51, 0xa3, 0xd5, 0x02, 0xea, 0xfc, 0xd5, 0xa3, 0x51, 0x0a, 0x32, 0x00
+};
+static const Image confirming_21_image = {confirming_21_data, 22, 22};
 
-static void confirming_22(uint8_t *data)
+static const uint8_t confirming_22_data[245] =
 {
-    const uint8_t image_data[245] =
-    {
-        0x32, 0x00, 0xfb, 0x0b, 0x55, 0xa3, 0xc2, 0xf7, 0x02, 0x0e, 0xfe, 0x07, 0x03, 0x0c, 0x00, 0xfe, 0x45, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x03, 0x09, 0x00, 0xfe, 0x55, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0e, 0x07, 0x07, 0x00, 0xfe, 0x45, 0xdf, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0x0e, 0x03, 0x05, 0x00, 0xfe, 0x0b, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xdf, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x3f, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x07, 0x3f, 0xfe, 0x22, 0x07, 0x03, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x55, 0x0d, 0xff, 0x03, 0x10, 0xff, 0x03, 0x04, 0x00, 0xfe, 0x0b, 0xa3, 0x0d, 0xff, 0xfe, 0x78, 0x0b, 0x06, 0x00, 0xfe, 0x45, 0xdf, 0x0c, 0xff, 0xfe, 0xdf, 0x3f, 0x07, 0x00, 0xfe, 0x55, 0xdf, 0x0a, 0xff, 0xfe, 0xdf, 0x55, 0x09, 0x00, 0xfe, 0x45, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x45, 0x0b, 0x00, 0xfc, 0x0b, 0x55, 0xa3, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0xa3, 0x55, 0x0b, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_22_image = {(void *) &confirming_22, 22, 22};
+    0x32, 0x00, 0xfb, 0x0b, 0x55, 0xa3, 0xc2, 0xf7, 0x02, 0x0e, 0xfe, 0x07, 0x03, 0x0c, 0x00, 0xfe, 0x45, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x03, 0x09, 0x00, 0xfe, 0x55, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0e, 0x07, 0x07, 0x00, 0xfe, 0x45, 0xdf, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0x0e, 0x03, 0x05, 0x00, 0xfe, 0x0b, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xdf, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x3f, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x07, 0x3f, 0xfe, 0x22, 0x07, 0x03, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x55, 0x0d, 0xff, 0x03, 0x10, 0xff, 0x03, 0x04, 0x00, 0xfe, 0x0b, 0xa3, 0x0d, 0xff, 0xfe, 0x78, 0x0b, 0x06, 0x00, 0xfe, 0x45, 0xdf, 0x0c, 0xff, 0xfe, 0xdf, 0x3f, 0x07, 0x00, 0xfe, 0x55, 0xdf, 0x0a, 0xff, 0xfe, 0xdf, 0x55, 0x09, 0x00, 0xfe, 0x45, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x45, 0x0b, 0x00, 0xfc, 0x0b, 0x55, 0xa3, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0xa3, 0x55, 0x0b, 0x32, 0x00
+};
+static const Image confirming_22_image = {confirming_22_data, 22, 22};
 
-static void confirming_23(uint8_t *data)
+static const uint8_t confirming_23_data[238] =
 {
-    const uint8_t image_data[238] =
-    {
-        0x32, 0x00, 0xf7, 0x09, 0x57, 0xa3, 0xc2, 0xf7, 0x10, 0x0d, 0x09, 0x06, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x02, 0x09, 0x00, 0xfe, 0x57, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x41, 0xdf, 0x05, 0xff, 0xff, 0xf7, 0x06, 0x10, 0xfe, 0x0d, 0x02, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x09, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xdf, 0x06, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x06, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x02, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0x06, 0x10, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x06, 0x05, 0x10, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x07, 0x41, 0xfe, 0x02, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x57, 0x0c, 0xff, 0x04, 0x10, 0xff, 0x06, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0c, 0xff, 0xfd, 0x41, 0x10, 0x0b, 0x06, 0x00, 0xfe, 0x41, 0xdf, 0x0c, 0xff, 0xfe, 0x78, 0x02, 0x07, 0x00, 0xfe, 0x57, 0xdf, 0x0a, 0xff, 0xfe, 0xdf, 0x57, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x57, 0xa3, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0xa3, 0x57, 0x09, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_23_image = {(void *) &confirming_23, 22, 22};
+    0x32, 0x00, 0xf7, 0x09, 0x57, 0xa3, 0xc2, 0xf7, 0x10, 0x0d, 0x09, 0x06, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x02, 0x09, 0x00, 0xfe, 0x57, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x41, 0xdf, 0x05, 0xff, 0xff, 0xf7, 0x06, 0x10, 0xfe, 0x0d, 0x02, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x09, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xdf, 0x06, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x06, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x02, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0x06, 0x10, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x06, 0x05, 0x10, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x07, 0x41, 0xfe, 0x02, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x57, 0x0c, 0xff, 0x04, 0x10, 0xff, 0x06, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0c, 0xff, 0xfd, 0x41, 0x10, 0x0b, 0x06, 0x00, 0xfe, 0x41, 0xdf, 0x0c, 0xff, 0xfe, 0x78, 0x02, 0x07, 0x00, 0xfe, 0x57, 0xdf, 0x0a, 0xff, 0xfe, 0xdf, 0x57, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x57, 0xa3, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0xa3, 0x57, 0x09, 0x32, 0x00
+};
+static const Image confirming_23_image = {confirming_23_data, 22, 22};
 
-static void confirming_24(uint8_t *data)
+static const uint8_t confirming_24_data[250] =
 {
-    const uint8_t image_data[250] =
-    {
-        0x32, 0x00, 0xf7, 0x09, 0x4e, 0xa3, 0xc6, 0xea, 0x0e, 0x0d, 0x09, 0x06, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x02, 0x09, 0x00, 0xfe, 0x4e, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x41, 0xc6, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x02, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x09, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x4e, 0x06, 0xff, 0xfc, 0xc6, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x06, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x02, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x4e, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xc6, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x4e, 0x06, 0x41, 0xfd, 0x0e, 0x02, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x4e, 0x0b, 0xff, 0xff, 0x41, 0x04, 0x10, 0xff, 0x06, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0b, 0xff, 0xff, 0x41, 0x02, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x41, 0xc6, 0x0b, 0xff, 0xfd, 0x4e, 0x0d, 0x02, 0x07, 0x00, 0xfe, 0x4e, 0xc6, 0x0a, 0xff, 0xfe, 0xc6, 0x10, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x4e, 0xa3, 0xc6, 0x02, 0xea, 0xfc, 0xc6, 0xa3, 0x4e, 0x09, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_24_image = {(void *) &confirming_24, 22, 22};
+    0x32, 0x00, 0xf7, 0x09, 0x4e, 0xa3, 0xc6, 0xea, 0x0e, 0x0d, 0x09, 0x06, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x02, 0x09, 0x00, 0xfe, 0x4e, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x41, 0xc6, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x02, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x09, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x4e, 0x06, 0xff, 0xfc, 0xc6, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x06, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x02, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x4e, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xc6, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x4e, 0x06, 0x41, 0xfd, 0x0e, 0x02, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x4e, 0x0b, 0xff, 0xff, 0x41, 0x04, 0x10, 0xff, 0x06, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0b, 0xff, 0xff, 0x41, 0x02, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x41, 0xc6, 0x0b, 0xff, 0xfd, 0x4e, 0x0d, 0x02, 0x07, 0x00, 0xfe, 0x4e, 0xc6, 0x0a, 0xff, 0xfe, 0xc6, 0x10, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x4e, 0xa3, 0xc6, 0x02, 0xea, 0xfc, 0xc6, 0xa3, 0x4e, 0x09, 0x32, 0x00
+};
+static const Image confirming_24_image = {confirming_24_data, 22, 22};
 
-static void confirming_25(uint8_t *data)
+static const uint8_t confirming_25_data[249] =
 {
-    const uint8_t image_data[249] =
-    {
-        0x32, 0x00, 0xf7, 0x0b, 0x55, 0xa3, 0xc6, 0xea, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x4c, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x05, 0x09, 0x00, 0xfe, 0x55, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x4c, 0xc6, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x05, 0x00, 0xfe, 0x0b, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xc6, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x4c, 0x02, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xc6, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x06, 0x2a, 0x02, 0x02, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x55, 0x0b, 0xff, 0x05, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0b, 0xa3, 0x0a, 0xff, 0xff, 0xc6, 0x03, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x4c, 0xc6, 0x0a, 0xff, 0xfc, 0x55, 0x10, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x55, 0xc6, 0x0a, 0xff, 0xfe, 0x10, 0x05, 0x09, 0x00, 0xfe, 0x4c, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x4c, 0x0b, 0x00, 0xfc, 0x0b, 0x55, 0xa3, 0xc6, 0x02, 0xea, 0xfc, 0xc6, 0xa3, 0x55, 0x0b, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_25_image = {(void *) &confirming_25, 22, 22};
+    0x32, 0x00, 0xf7, 0x0b, 0x55, 0xa3, 0xc6, 0xea, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x4c, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x05, 0x09, 0x00, 0xfe, 0x55, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x4c, 0xc6, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x05, 0x00, 0xfe, 0x0b, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xc6, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x4c, 0x02, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xc6, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x06, 0x2a, 0x02, 0x02, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x55, 0x0b, 0xff, 0x05, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0b, 0xa3, 0x0a, 0xff, 0xff, 0xc6, 0x03, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x4c, 0xc6, 0x0a, 0xff, 0xfc, 0x55, 0x10, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x55, 0xc6, 0x0a, 0xff, 0xfe, 0x10, 0x05, 0x09, 0x00, 0xfe, 0x4c, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x4c, 0x0b, 0x00, 0xfc, 0x0b, 0x55, 0xa3, 0xc6, 0x02, 0xea, 0xfc, 0xc6, 0xa3, 0x55, 0x0b, 0x32, 0x00
+};
+static const Image confirming_25_image = {confirming_25_data, 22, 22};
 
-static void confirming_26(uint8_t *data)
+static const uint8_t confirming_26_data[252] =
 {
-    const uint8_t image_data[252] =
-    {
-        0x32, 0x00, 0xf7, 0x0b, 0x57, 0xb4, 0xd5, 0xea, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x49, 0xb4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x05, 0x00, 0xfe, 0x0b, 0xb4, 0x06, 0xff, 0xfe, 0x79, 0x08, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xb4, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xb4, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xb4, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xb4, 0x03, 0xff, 0xff, 0x57, 0x06, 0x22, 0x02, 0x02, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x57, 0x0a, 0xff, 0xff, 0x22, 0x05, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0b, 0xb4, 0x0a, 0xff, 0x04, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x49, 0xd5, 0x09, 0xff, 0xff, 0xb4, 0x02, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x09, 0xff, 0xfd, 0x22, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x49, 0xb4, 0x08, 0xff, 0xfe, 0xb4, 0x05, 0x0b, 0x00, 0xfc, 0x0b, 0x57, 0xb4, 0xd5, 0x02, 0xea, 0xfc, 0xd5, 0xb4, 0x57, 0x0b, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_26_image = {(void *) &confirming_26, 22, 22};
+    0x32, 0x00, 0xf7, 0x0b, 0x57, 0xb4, 0xd5, 0xea, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x49, 0xb4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x05, 0x00, 0xfe, 0x0b, 0xb4, 0x06, 0xff, 0xfe, 0x79, 0x08, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xb4, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xb4, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xb4, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xb4, 0x03, 0xff, 0xff, 0x57, 0x06, 0x22, 0x02, 0x02, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x57, 0x0a, 0xff, 0xff, 0x22, 0x05, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0b, 0xb4, 0x0a, 0xff, 0x04, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x49, 0xd5, 0x09, 0xff, 0xff, 0xb4, 0x02, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x09, 0xff, 0xfd, 0x22, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x49, 0xb4, 0x08, 0xff, 0xfe, 0xb4, 0x05, 0x0b, 0x00, 0xfc, 0x0b, 0x57, 0xb4, 0xd5, 0x02, 0xea, 0xfc, 0xd5, 0xb4, 0x57, 0x0b, 0x32, 0x00
+};
+static const Image confirming_26_image = {confirming_26_data, 22, 22};
 
-static void confirming_27(uint8_t *data)
+static const uint8_t confirming_27_data[254] =
 {
-    const uint8_t image_data[254] =
-    {
-        0x32, 0x00, 0xf7, 0x0b, 0x57, 0xb4, 0xd5, 0xea, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x4d, 0xb4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x4d, 0xd5, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x05, 0x00, 0xfe, 0x0b, 0xb4, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xb4, 0x06, 0xff, 0xff, 0x4d, 0x02, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xb4, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xb4, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xb4, 0x03, 0xff, 0xff, 0x57, 0x05, 0x27, 0xff, 0x10, 0x02, 0x02, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x57, 0x0a, 0xff, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0b, 0xb4, 0x09, 0xff, 0xff, 0x4d, 0x04, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x4d, 0xd5, 0x09, 0xff, 0x03, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x08, 0xff, 0xfc, 0x4d, 0x10, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x4d, 0xb4, 0x07, 0xff, 0xfd, 0xea, 0x0b, 0x05, 0x0b, 0x00, 0xfc, 0x0b, 0x57, 0xb4, 0xd5, 0x02, 0xea, 0xfc, 0xd5, 0xb4, 0x57, 0x02, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_27_image = {(void *) &confirming_27, 22, 22};
+    0x32, 0x00, 0xf7, 0x0b, 0x57, 0xb4, 0xd5, 0xea, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x4d, 0xb4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x4d, 0xd5, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x05, 0x00, 0xfe, 0x0b, 0xb4, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xb4, 0x06, 0xff, 0xff, 0x4d, 0x02, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xb4, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xb4, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xb4, 0x03, 0xff, 0xff, 0x57, 0x05, 0x27, 0xff, 0x10, 0x02, 0x02, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x57, 0x0a, 0xff, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0b, 0xb4, 0x09, 0xff, 0xff, 0x4d, 0x04, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x4d, 0xd5, 0x09, 0xff, 0x03, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x08, 0xff, 0xfc, 0x4d, 0x10, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x4d, 0xb4, 0x07, 0xff, 0xfd, 0xea, 0x0b, 0x05, 0x0b, 0x00, 0xfc, 0x0b, 0x57, 0xb4, 0xd5, 0x02, 0xea, 0xfc, 0xd5, 0xb4, 0x57, 0x02, 0x32, 0x00
+};
+static const Image confirming_27_image = {confirming_27_data, 22, 22};
 
-static void confirming_28(uint8_t *data)
+static const uint8_t confirming_28_data[254] =
 {
-    const uint8_t image_data[254] =
-    {
-        0x32, 0x00, 0xf7, 0x0b, 0x57, 0xb4, 0xe3, 0xfa, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x57, 0xb4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xe3, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x57, 0xe3, 0x05, 0xff, 0xfe, 0xfa, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0b, 0xb4, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xe3, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xb4, 0x06, 0xff, 0xff, 0x2b, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xe3, 0x05, 0xff, 0xff, 0xb4, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xe3, 0x03, 0xff, 0xff, 0xb4, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xb4, 0x03, 0xff, 0xff, 0x57, 0x05, 0x2b, 0x03, 0x02, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x57, 0x09, 0xff, 0xff, 0xb4, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0b, 0xb4, 0x09, 0xff, 0x05, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x57, 0xe3, 0x08, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xe3, 0x07, 0xff, 0xff, 0xb4, 0x02, 0x10, 0xfe, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xb4, 0x07, 0xff, 0xfd, 0x10, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x0b, 0x57, 0xb4, 0xe3, 0x02, 0xfa, 0xfd, 0xe3, 0xb4, 0x10, 0x33, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_28_image = {(void *) &confirming_28, 22, 22};
+    0x32, 0x00, 0xf7, 0x0b, 0x57, 0xb4, 0xe3, 0xfa, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x57, 0xb4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xe3, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x57, 0xe3, 0x05, 0xff, 0xfe, 0xfa, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0b, 0xb4, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xe3, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xb4, 0x06, 0xff, 0xff, 0x2b, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xe3, 0x05, 0xff, 0xff, 0xb4, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xe3, 0x03, 0xff, 0xff, 0xb4, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xb4, 0x03, 0xff, 0xff, 0x57, 0x05, 0x2b, 0x03, 0x02, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x57, 0x09, 0xff, 0xff, 0xb4, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0b, 0xb4, 0x09, 0xff, 0x05, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x57, 0xe3, 0x08, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xe3, 0x07, 0xff, 0xff, 0xb4, 0x02, 0x10, 0xfe, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xb4, 0x07, 0xff, 0xfd, 0x10, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x0b, 0x57, 0xb4, 0xe3, 0x02, 0xfa, 0xfd, 0xe3, 0xb4, 0x10, 0x33, 0x00
+};
+static const Image confirming_28_image = {confirming_28_data, 22, 22};
 
-static void confirming_29(uint8_t *data)
+static const uint8_t confirming_29_data[255] =
 {
-    const uint8_t image_data[255] =
-    {
-        0x32, 0x00, 0xf7, 0x0a, 0x4d, 0x99, 0xbc, 0xf7, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x4d, 0xbc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x4d, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x4d, 0xdf, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xbc, 0x06, 0xff, 0xfe, 0x6b, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x4d, 0x06, 0xff, 0xfc, 0xdf, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x4d, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xbc, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x4d, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xbc, 0x03, 0xff, 0xff, 0xbc, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x4d, 0x05, 0x27, 0x03, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x4d, 0x09, 0xff, 0x07, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xbc, 0x08, 0xff, 0xff, 0x4d, 0x05, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x4d, 0xdf, 0x07, 0xff, 0xff, 0xdf, 0x04, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x4d, 0xdf, 0x07, 0xff, 0x03, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x4d, 0xbc, 0x06, 0xff, 0x02, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x0a, 0x4d, 0x99, 0xbc, 0x02, 0xf7, 0xfd, 0xbc, 0x27, 0x04, 0x33, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_29_image = {(void *) &confirming_29, 22, 22};
+    0x32, 0x00, 0xf7, 0x0a, 0x4d, 0x99, 0xbc, 0xf7, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x4d, 0xbc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x4d, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x4d, 0xdf, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xbc, 0x06, 0xff, 0xfe, 0x6b, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x4d, 0x06, 0xff, 0xfc, 0xdf, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x4d, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xbc, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x4d, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xbc, 0x03, 0xff, 0xff, 0xbc, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x4d, 0x05, 0x27, 0x03, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x4d, 0x09, 0xff, 0x07, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xbc, 0x08, 0xff, 0xff, 0x4d, 0x05, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x4d, 0xdf, 0x07, 0xff, 0xff, 0xdf, 0x04, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x4d, 0xdf, 0x07, 0xff, 0x03, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x4d, 0xbc, 0x06, 0xff, 0x02, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x0a, 0x4d, 0x99, 0xbc, 0x02, 0xf7, 0xfd, 0xbc, 0x27, 0x04, 0x33, 0x00
+};
+static const Image confirming_29_image = {confirming_29_data, 22, 22};
 
-static void confirming_30(uint8_t *data)
+static const uint8_t confirming_30_data[261] =
 {
-    const uint8_t image_data[261] =
-    {
-        0x32, 0x00, 0xf7, 0x0a, 0x57, 0xa3, 0xc6, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x41, 0xc6, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xc6, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xc6, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x04, 0x41, 0xff, 0x22, 0x03, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x08, 0xff, 0xff, 0xa3, 0x07, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x07, 0xff, 0xff, 0xa3, 0x06, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x41, 0xc6, 0x06, 0xff, 0xff, 0xa3, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0xff, 0xa3, 0x03, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xf7, 0x0a, 0x57, 0xa3, 0xc6, 0xea, 0xa3, 0x0c, 0x0a, 0x04, 0x33, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_30_image = {(void *) &confirming_30, 22, 22};
+    0x32, 0x00, 0xf7, 0x0a, 0x57, 0xa3, 0xc6, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x41, 0xc6, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xc6, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xc6, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x04, 0x41, 0xff, 0x22, 0x03, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x08, 0xff, 0xff, 0xa3, 0x07, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x07, 0xff, 0xff, 0xa3, 0x06, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x41, 0xc6, 0x06, 0xff, 0xff, 0xa3, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0xff, 0xa3, 0x03, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xf7, 0x0a, 0x57, 0xa3, 0xc6, 0xea, 0xa3, 0x0c, 0x0a, 0x04, 0x33, 0x00
+};
+static const Image confirming_30_image = {confirming_30_data, 22, 22};
 
-static void confirming_31(uint8_t *data)
+static const uint8_t confirming_31_data[252] =
 {
-    const uint8_t image_data[252] =
-    {
-        0x32, 0x00, 0xf7, 0x0a, 0x57, 0xa3, 0xc6, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x49, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x49, 0xc6, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xc6, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xc6, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x04, 0x22, 0x04, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x08, 0xff, 0x08, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x07, 0xff, 0x07, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x49, 0xc6, 0x06, 0xff, 0x06, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x03, 0xff, 0xff, 0xea, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfd, 0x0a, 0x57, 0xa3, 0x02, 0xc6, 0xfc, 0x0e, 0x0c, 0x0a, 0x04, 0x33, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_31_image = {(void *) &confirming_31, 22, 22};
+    0x32, 0x00, 0xf7, 0x0a, 0x57, 0xa3, 0xc6, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x49, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x49, 0xc6, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xc6, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xc6, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x04, 0x22, 0x04, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x08, 0xff, 0x08, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x07, 0xff, 0x07, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x49, 0xc6, 0x06, 0xff, 0x06, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x03, 0xff, 0xff, 0xea, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfd, 0x0a, 0x57, 0xa3, 0x02, 0xc6, 0xfc, 0x0e, 0x0c, 0x0a, 0x04, 0x33, 0x00
+};
+static const Image confirming_31_image = {confirming_31_data, 22, 22};
 
-static void confirming_32(uint8_t *data)
+static const uint8_t confirming_32_data[256] =
 {
-    const uint8_t image_data[256] =
-    {
-        0x32, 0x00, 0xf7, 0x0a, 0x55, 0xa9, 0xd1, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x3c, 0xa9, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x55, 0xd1, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x3c, 0xd1, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa9, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd1, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa9, 0x06, 0xff, 0xff, 0x3c, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xd1, 0x05, 0xff, 0xff, 0xa9, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd1, 0x03, 0xff, 0xff, 0xa9, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa9, 0x03, 0xff, 0xff, 0x55, 0x04, 0x3c, 0x04, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x08, 0xff, 0x08, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa9, 0x06, 0xff, 0xff, 0xea, 0x07, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x3c, 0xd1, 0x05, 0xff, 0xff, 0x78, 0x06, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x55, 0xd1, 0x04, 0xff, 0xff, 0x19, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x3c, 0xa9, 0x03, 0xff, 0x05, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfe, 0x0a, 0x55, 0x02, 0xa9, 0x02, 0x0e, 0xfd, 0x0c, 0x0a, 0x04, 0x33, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_32_image = {(void *) &confirming_32, 22, 22};
+    0x32, 0x00, 0xf7, 0x0a, 0x55, 0xa9, 0xd1, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x3c, 0xa9, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x55, 0xd1, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x3c, 0xd1, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa9, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd1, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa9, 0x06, 0xff, 0xff, 0x3c, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xd1, 0x05, 0xff, 0xff, 0xa9, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd1, 0x03, 0xff, 0xff, 0xa9, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa9, 0x03, 0xff, 0xff, 0x55, 0x04, 0x3c, 0x04, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x08, 0xff, 0x08, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa9, 0x06, 0xff, 0xff, 0xea, 0x07, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x3c, 0xd1, 0x05, 0xff, 0xff, 0x78, 0x06, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x55, 0xd1, 0x04, 0xff, 0xff, 0x19, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x3c, 0xa9, 0x03, 0xff, 0x05, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfe, 0x0a, 0x55, 0x02, 0xa9, 0x02, 0x0e, 0xfd, 0x0c, 0x0a, 0x04, 0x33, 0x00
+};
+static const Image confirming_32_image = {confirming_32_data, 22, 22};
 
-static void confirming_33(uint8_t *data)
+static const uint8_t confirming_33_data[257] =
 {
-    const uint8_t image_data[257] =
-    {
-        0x32, 0x00, 0xf7, 0x0a, 0x57, 0xb4, 0xdf, 0xf7, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x49, 0xb4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x49, 0xdf, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xb4, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xdf, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xb4, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xdf, 0x05, 0xff, 0xff, 0xb4, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xdf, 0x03, 0xff, 0xff, 0xb4, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xb4, 0x03, 0xff, 0xff, 0x57, 0x04, 0x22, 0x04, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x07, 0xff, 0xff, 0xb4, 0x08, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xb4, 0x06, 0xff, 0x08, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x49, 0xdf, 0x05, 0xff, 0x07, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xdf, 0x03, 0xff, 0xff, 0xb4, 0x06, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x49, 0xb4, 0x02, 0xff, 0xff, 0x22, 0x05, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x0a, 0x57, 0x78, 0x0c, 0x02, 0x0e, 0xfd, 0x0c, 0x0a, 0x04, 0x33, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_33_image = {(void *) &confirming_33, 22, 22};
+    0x32, 0x00, 0xf7, 0x0a, 0x57, 0xb4, 0xdf, 0xf7, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x49, 0xb4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x49, 0xdf, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xb4, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xdf, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xb4, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xdf, 0x05, 0xff, 0xff, 0xb4, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xdf, 0x03, 0xff, 0xff, 0xb4, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xb4, 0x03, 0xff, 0xff, 0x57, 0x04, 0x22, 0x04, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x07, 0xff, 0xff, 0xb4, 0x08, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xb4, 0x06, 0xff, 0x08, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x49, 0xdf, 0x05, 0xff, 0x07, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xdf, 0x03, 0xff, 0xff, 0xb4, 0x06, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x49, 0xb4, 0x02, 0xff, 0xff, 0x22, 0x05, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x0a, 0x57, 0x78, 0x0c, 0x02, 0x0e, 0xfd, 0x0c, 0x0a, 0x04, 0x33, 0x00
+};
+static const Image confirming_33_image = {confirming_33_data, 22, 22};
 
-static void confirming_34(uint8_t *data)
+static const uint8_t confirming_34_data[256] =
 {
-    const uint8_t image_data[256] =
-    {
-        0x32, 0x00, 0xf7, 0x0a, 0x56, 0xa9, 0xd1, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x47, 0xa9, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x56, 0xd1, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x47, 0xd1, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa9, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x56, 0x06, 0xff, 0xfc, 0xd1, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa9, 0x06, 0xff, 0xff, 0x47, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xd1, 0x05, 0xff, 0xff, 0xa9, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x56, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd1, 0x03, 0xff, 0xff, 0xa9, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa9, 0x03, 0xff, 0xff, 0x56, 0x04, 0x22, 0x04, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x56, 0x07, 0xff, 0x09, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa9, 0x05, 0xff, 0xff, 0xea, 0x08, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x47, 0xd1, 0x04, 0xff, 0xff, 0x22, 0x07, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x56, 0xd1, 0x02, 0xff, 0xff, 0xea, 0x07, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfc, 0x47, 0xa9, 0xff, 0x56, 0x06, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x0a, 0x56, 0x0a, 0x0c, 0x02, 0x0e, 0xfd, 0x0c, 0x0a, 0x04, 0x33, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_34_image = {(void *) &confirming_34, 22, 22};
+    0x32, 0x00, 0xf7, 0x0a, 0x56, 0xa9, 0xd1, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x47, 0xa9, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x56, 0xd1, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x47, 0xd1, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa9, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x56, 0x06, 0xff, 0xfc, 0xd1, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa9, 0x06, 0xff, 0xff, 0x47, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xd1, 0x05, 0xff, 0xff, 0xa9, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x56, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd1, 0x03, 0xff, 0xff, 0xa9, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa9, 0x03, 0xff, 0xff, 0x56, 0x04, 0x22, 0x04, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x56, 0x07, 0xff, 0x09, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa9, 0x05, 0xff, 0xff, 0xea, 0x08, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x47, 0xd1, 0x04, 0xff, 0xff, 0x22, 0x07, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x56, 0xd1, 0x02, 0xff, 0xff, 0xea, 0x07, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfc, 0x47, 0xa9, 0xff, 0x56, 0x06, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x0a, 0x56, 0x0a, 0x0c, 0x02, 0x0e, 0xfd, 0x0c, 0x0a, 0x04, 0x33, 0x00
+};
+static const Image confirming_34_image = {confirming_34_data, 22, 22};
 
-static void confirming_35(uint8_t *data)
+static const uint8_t confirming_35_data[251] =
 {
-    const uint8_t image_data[251] =
-    {
-        0x32, 0x00, 0xf7, 0x0a, 0x57, 0xa9, 0xd1, 0xea, 0x0e, 0x0c, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x33, 0xa9, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xd1, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x33, 0xd1, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa9, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd1, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa9, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xd1, 0x05, 0xff, 0xff, 0xa9, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd1, 0x03, 0xff, 0xff, 0xa9, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa9, 0x03, 0xff, 0xff, 0x57, 0x03, 0x33, 0x05, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x57, 0x07, 0xff, 0x09, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa9, 0x05, 0xff, 0x09, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x33, 0xd1, 0x03, 0xff, 0xff, 0xa9, 0x08, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xd1, 0x02, 0xff, 0x08, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfd, 0x33, 0xa9, 0x78, 0x07, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x07, 0x04, 0x09, 0x0c, 0x02, 0x0e, 0xfd, 0x0c, 0x09, 0x04, 0x33, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_35_image = {(void *) &confirming_35, 22, 22};
+    0x32, 0x00, 0xf7, 0x0a, 0x57, 0xa9, 0xd1, 0xea, 0x0e, 0x0c, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x33, 0xa9, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xd1, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x33, 0xd1, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa9, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd1, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa9, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xd1, 0x05, 0xff, 0xff, 0xa9, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd1, 0x03, 0xff, 0xff, 0xa9, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa9, 0x03, 0xff, 0xff, 0x57, 0x03, 0x33, 0x05, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x57, 0x07, 0xff, 0x09, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa9, 0x05, 0xff, 0x09, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x33, 0xd1, 0x03, 0xff, 0xff, 0xa9, 0x08, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xd1, 0x02, 0xff, 0x08, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfd, 0x33, 0xa9, 0x78, 0x07, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x07, 0x04, 0x09, 0x0c, 0x02, 0x0e, 0xfd, 0x0c, 0x09, 0x04, 0x33, 0x00
+};
+static const Image confirming_35_image = {confirming_35_data, 22, 22};
 
-static void confirming_36(uint8_t *data)
+static const uint8_t confirming_36_data[256] =
 {
-    const uint8_t image_data[256] =
-    {
-        0x32, 0x00, 0xf6, 0x0a, 0x57, 0xa8, 0xd1, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x01, 0x0b, 0x00, 0xfe, 0x57, 0xa8, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xd1, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x57, 0xd1, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa8, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd1, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa8, 0x06, 0xff, 0xff, 0x2b, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xd1, 0x05, 0xff, 0xff, 0xa8, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd1, 0x03, 0xff, 0xff, 0xa8, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa8, 0x03, 0xff, 0xff, 0x57, 0x03, 0x2b, 0x05, 0x03, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x06, 0xff, 0x0a, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa8, 0x04, 0xff, 0xff, 0xa8, 0x09, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfe, 0x57, 0xd1, 0x02, 0xff, 0xff, 0xea, 0x09, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfd, 0x57, 0xd1, 0xff, 0x09, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x57, 0x2b, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x04, 0x0a, 0x0c, 0x02, 0x0e, 0xfc, 0x0c, 0x0a, 0x04, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_36_image = {(void *) &confirming_36, 22, 22};
+    0x32, 0x00, 0xf6, 0x0a, 0x57, 0xa8, 0xd1, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x01, 0x0b, 0x00, 0xfe, 0x57, 0xa8, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xd1, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x57, 0xd1, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa8, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd1, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa8, 0x06, 0xff, 0xff, 0x2b, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xd1, 0x05, 0xff, 0xff, 0xa8, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd1, 0x03, 0xff, 0xff, 0xa8, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa8, 0x03, 0xff, 0xff, 0x57, 0x03, 0x2b, 0x05, 0x03, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x06, 0xff, 0x0a, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa8, 0x04, 0xff, 0xff, 0xa8, 0x09, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfe, 0x57, 0xd1, 0x02, 0xff, 0xff, 0xea, 0x09, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfd, 0x57, 0xd1, 0xff, 0x09, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x57, 0x2b, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x04, 0x0a, 0x0c, 0x02, 0x0e, 0xfc, 0x0c, 0x0a, 0x04, 0x01, 0x32, 0x00
+};
+static const Image confirming_36_image = {confirming_36_data, 22, 22};
 
-static void confirming_37(uint8_t *data)
+static const uint8_t confirming_37_data[255] =
 {
-    const uint8_t image_data[255] =
-    {
-        0x32, 0x00, 0xf6, 0x0a, 0x55, 0xa3, 0xc7, 0xf3, 0x0e, 0x0c, 0x0a, 0x04, 0x01, 0x0b, 0x00, 0xfe, 0x55, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x55, 0xc7, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x55, 0xc7, 0x05, 0xff, 0xfe, 0xf3, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xc7, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x2b, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xc7, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf3, 0x04, 0xff, 0xfe, 0xf3, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf3, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc7, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x03, 0x2b, 0x05, 0x03, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xf3, 0x0a, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x03, 0xff, 0xff, 0xf3, 0x0a, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfc, 0x55, 0xc7, 0xff, 0xf3, 0x0a, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x55, 0xc7, 0x0a, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0x02, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x04, 0x0a, 0x0c, 0x02, 0x0e, 0xfc, 0x0c, 0x0a, 0x04, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_37_image = {(void *) &confirming_37, 22, 22};
+    0x32, 0x00, 0xf6, 0x0a, 0x55, 0xa3, 0xc7, 0xf3, 0x0e, 0x0c, 0x0a, 0x04, 0x01, 0x0b, 0x00, 0xfe, 0x55, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x55, 0xc7, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x55, 0xc7, 0x05, 0xff, 0xfe, 0xf3, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xc7, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x2b, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xc7, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf3, 0x04, 0xff, 0xfe, 0xf3, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf3, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc7, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x03, 0x2b, 0x05, 0x03, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xf3, 0x0a, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x03, 0xff, 0xff, 0xf3, 0x0a, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfc, 0x55, 0xc7, 0xff, 0xf3, 0x0a, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x55, 0xc7, 0x0a, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0x02, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x04, 0x0a, 0x0c, 0x02, 0x0e, 0xfc, 0x0c, 0x0a, 0x04, 0x01, 0x32, 0x00
+};
+static const Image confirming_37_image = {confirming_37_data, 22, 22};
 
-static void confirming_38(uint8_t *data)
+static const uint8_t confirming_38_data[249] =
 {
-    const uint8_t image_data[249] =
-    {
-        0x32, 0x00, 0xff, 0x0a, 0x02, 0x78, 0xf9, 0xc0, 0xea, 0x0e, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x33, 0xc0, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x78, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x33, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xc0, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x78, 0x06, 0xff, 0xfc, 0xea, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x78, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x78, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x78, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x78, 0x03, 0xff, 0x03, 0x33, 0x06, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x78, 0x05, 0xff, 0x0b, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0a, 0xc0, 0x03, 0xff, 0x0b, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfd, 0x33, 0xea, 0xc0, 0x0b, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x33, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_38_image = {(void *) &confirming_38, 22, 22};
+    0x32, 0x00, 0xff, 0x0a, 0x02, 0x78, 0xf9, 0xc0, 0xea, 0x0e, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x33, 0xc0, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x78, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x33, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xc0, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x78, 0x06, 0xff, 0xfc, 0xea, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x78, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x78, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x78, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x78, 0x03, 0xff, 0x03, 0x33, 0x06, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x78, 0x05, 0xff, 0x0b, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0a, 0xc0, 0x03, 0xff, 0x0b, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfd, 0x33, 0xea, 0xc0, 0x0b, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x33, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_38_image = {confirming_38_data, 22, 22};
 
-static void confirming_39(uint8_t *data)
+static const uint8_t confirming_39_data[252] =
 {
-    const uint8_t image_data[252] =
-    {
-        0x32, 0x00, 0xfe, 0x0a, 0x76, 0x02, 0xb5, 0xfa, 0xe9, 0x0e, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x33, 0xb5, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x76, 0xe9, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x33, 0xe9, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xb5, 0x06, 0xff, 0xfe, 0x76, 0x08, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x76, 0x06, 0xff, 0xfc, 0xe9, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xb5, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xb5, 0x05, 0xff, 0xff, 0xb5, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xe9, 0x04, 0xff, 0xfe, 0xe9, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xe9, 0x04, 0xff, 0xff, 0x76, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xb5, 0x03, 0xff, 0xff, 0xb5, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xb5, 0x03, 0xff, 0xff, 0x76, 0x02, 0x33, 0x06, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x76, 0x04, 0xff, 0xff, 0x33, 0x0b, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfc, 0x0a, 0xb5, 0xff, 0xe9, 0x0c, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfe, 0x33, 0x76, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_39_image = {(void *) &confirming_39, 22, 22};
+    0x32, 0x00, 0xfe, 0x0a, 0x76, 0x02, 0xb5, 0xfa, 0xe9, 0x0e, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x33, 0xb5, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x76, 0xe9, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x33, 0xe9, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xb5, 0x06, 0xff, 0xfe, 0x76, 0x08, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x76, 0x06, 0xff, 0xfc, 0xe9, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xb5, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xb5, 0x05, 0xff, 0xff, 0xb5, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xe9, 0x04, 0xff, 0xfe, 0xe9, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xe9, 0x04, 0xff, 0xff, 0x76, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xb5, 0x03, 0xff, 0xff, 0xb5, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xb5, 0x03, 0xff, 0xff, 0x76, 0x02, 0x33, 0x06, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x76, 0x04, 0xff, 0xff, 0x33, 0x0b, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfc, 0x0a, 0xb5, 0xff, 0xe9, 0x0c, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfe, 0x33, 0x76, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_39_image = {confirming_39_data, 22, 22};
 
-static void confirming_40(uint8_t *data)
+static const uint8_t confirming_40_data[248] =
 {
-    const uint8_t image_data[248] =
-    {
-        0x32, 0x00, 0xf6, 0x0a, 0x34, 0x79, 0xbc, 0xea, 0x0e, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xbc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x79, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xbc, 0x06, 0xff, 0xfe, 0x79, 0x08, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xea, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x79, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xbc, 0x05, 0xff, 0xff, 0xbc, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x79, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xbc, 0x03, 0xff, 0xff, 0xbc, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x79, 0x03, 0xff, 0x02, 0x34, 0x07, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x34, 0x02, 0xff, 0xff, 0xea, 0x0d, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfd, 0x0a, 0xbc, 0x79, 0x0d, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_40_image = {(void *) &confirming_40, 22, 22};
+    0x32, 0x00, 0xf6, 0x0a, 0x34, 0x79, 0xbc, 0xea, 0x0e, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xbc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x79, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xbc, 0x06, 0xff, 0xfe, 0x79, 0x08, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xea, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x79, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xbc, 0x05, 0xff, 0xff, 0xbc, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x79, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xbc, 0x03, 0xff, 0xff, 0xbc, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x79, 0x03, 0xff, 0x02, 0x34, 0x07, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x34, 0x02, 0xff, 0xff, 0xea, 0x0d, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfd, 0x0a, 0xbc, 0x79, 0x0d, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_40_image = {confirming_40_data, 22, 22};
 
-static void confirming_41(uint8_t *data)
+static const uint8_t confirming_41_data[245] =
 {
-    const uint8_t image_data[245] =
-    {
-        0x32, 0x00, 0xf6, 0x0a, 0x34, 0x7a, 0xc0, 0xea, 0x0e, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xc0, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x7a, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xc0, 0x06, 0xff, 0xfe, 0x7a, 0x08, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xea, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x7a, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x7a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x7a, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x7a, 0x03, 0xff, 0xff, 0x34, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xfd, 0x34, 0xea, 0x7a, 0x0e, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x03, 0x0a, 0x0e, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_41_image = {(void *) &confirming_41, 22, 22};
+    0x32, 0x00, 0xf6, 0x0a, 0x34, 0x7a, 0xc0, 0xea, 0x0e, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xc0, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x7a, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xc0, 0x06, 0xff, 0xfe, 0x7a, 0x08, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xea, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x7a, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x7a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x7a, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x7a, 0x03, 0xff, 0xff, 0x34, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xfd, 0x34, 0xea, 0x7a, 0x0e, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x03, 0x0a, 0x0e, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_41_image = {confirming_41_data, 22, 22};
 
-static void confirming_42(uint8_t *data)
+static const uint8_t confirming_42_data[243] =
 {
-    const uint8_t image_data[243] =
-    {
-        0x32, 0x00, 0xf6, 0x09, 0x34, 0x81, 0xc0, 0xea, 0x0e, 0x0d, 0x09, 0x04, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xc0, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x34, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x34, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xc0, 0x06, 0xff, 0xfe, 0x81, 0x09, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xea, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0x81, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x81, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x34, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xfb, 0x81, 0xff, 0xc0, 0x34, 0x04, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x10, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x04, 0x09, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x09, 0x04, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_42_image = {(void *) &confirming_42, 22, 22};
+    0x32, 0x00, 0xf6, 0x09, 0x34, 0x81, 0xc0, 0xea, 0x0e, 0x0d, 0x09, 0x04, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xc0, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x34, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x34, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xc0, 0x06, 0xff, 0xfe, 0x81, 0x09, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xea, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0x81, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x81, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x34, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xfb, 0x81, 0xff, 0xc0, 0x34, 0x04, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x10, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x04, 0x09, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x09, 0x04, 0x01, 0x32, 0x00
+};
+static const Image confirming_42_image = {confirming_42_data, 22, 22};
 
-static void confirming_43(uint8_t *data)
+static const uint8_t confirming_43_data[244] =
 {
-    const uint8_t image_data[244] =
-    {
-        0x32, 0x00, 0xf6, 0x09, 0x34, 0x82, 0xca, 0xf3, 0x0e, 0x0c, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xca, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x34, 0xca, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xca, 0x05, 0xff, 0xfe, 0xf3, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xca, 0x06, 0xff, 0xfe, 0x82, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xca, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x82, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xca, 0x05, 0xff, 0xff, 0x82, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf3, 0x04, 0xff, 0xfe, 0xf3, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf3, 0x04, 0xff, 0xff, 0x34, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xfb, 0xca, 0xff, 0xf3, 0xca, 0x34, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0x0e, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0c, 0x0c, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0c, 0x0a, 0x10, 0xfe, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0c, 0x02, 0x0e, 0xfc, 0x0c, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_43_image = {(void *) &confirming_43, 22, 22};
+    0x32, 0x00, 0xf6, 0x09, 0x34, 0x82, 0xca, 0xf3, 0x0e, 0x0c, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xca, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x34, 0xca, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xca, 0x05, 0xff, 0xfe, 0xf3, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xca, 0x06, 0xff, 0xfe, 0x82, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xca, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x82, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xca, 0x05, 0xff, 0xff, 0x82, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf3, 0x04, 0xff, 0xfe, 0xf3, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf3, 0x04, 0xff, 0xff, 0x34, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xfb, 0xca, 0xff, 0xf3, 0xca, 0x34, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0x0e, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0c, 0x0c, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0c, 0x0a, 0x10, 0xfe, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0c, 0x02, 0x0e, 0xfc, 0x0c, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_43_image = {confirming_43_data, 22, 22};
 
-static void confirming_44(uint8_t *data)
+static const uint8_t confirming_44_data[241] =
 {
-    const uint8_t image_data[241] =
-    {
-        0x32, 0x00, 0xf6, 0x09, 0x34, 0x7a, 0xc0, 0xea, 0x0e, 0x0c, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xc0, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x7a, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xc0, 0x06, 0xff, 0xfe, 0x7a, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xea, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x7a, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x7a, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x7a, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0x04, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0c, 0x0c, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0c, 0x0a, 0x10, 0xfe, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0c, 0x02, 0x0e, 0xfc, 0x0c, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_44_image = {(void *) &confirming_44, 22, 22};
+    0x32, 0x00, 0xf6, 0x09, 0x34, 0x7a, 0xc0, 0xea, 0x0e, 0x0c, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xc0, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x7a, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xc0, 0x06, 0xff, 0xfe, 0x7a, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xea, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x7a, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x7a, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x7a, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0x04, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0c, 0x0c, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0c, 0x0a, 0x10, 0xfe, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0c, 0x02, 0x0e, 0xfc, 0x0c, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_44_image = {confirming_44_data, 22, 22};
 
-static void confirming_45(uint8_t *data)
+static const uint8_t confirming_45_data[239] =
 {
-    const uint8_t image_data[239] =
-    {
-        0x32, 0x00, 0xff, 0x09, 0x02, 0x6e, 0xf9, 0xcc, 0xff, 0x0e, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x27, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x6e, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x27, 0xcc, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x6e, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x6e, 0x06, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x6e, 0x06, 0xff, 0xff, 0x27, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xcc, 0x05, 0xff, 0xff, 0x6e, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0x06, 0xff, 0xff, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0x05, 0x27, 0xff, 0x0b, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_45_image = {(void *) &confirming_45, 22, 22};
+    0x32, 0x00, 0xff, 0x09, 0x02, 0x6e, 0xf9, 0xcc, 0xff, 0x0e, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x27, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x6e, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x27, 0xcc, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x6e, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x6e, 0x06, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x6e, 0x06, 0xff, 0xff, 0x27, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xcc, 0x05, 0xff, 0xff, 0x6e, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0x06, 0xff, 0xff, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0x05, 0x27, 0xff, 0x0b, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_45_image = {confirming_45_data, 22, 22};
 
-static void confirming_46(uint8_t *data)
+static const uint8_t confirming_46_data[246] =
 {
-    const uint8_t image_data[246] =
-    {
-        0x32, 0x00, 0xff, 0x09, 0x02, 0x76, 0xf9, 0xcc, 0xff, 0x0e, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x30, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x76, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x30, 0xcc, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x76, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x76, 0x06, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x76, 0x06, 0xff, 0xff, 0x30, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xcc, 0x05, 0xff, 0xff, 0x76, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0x02, 0x30, 0xfe, 0x76, 0xcc, 0x02, 0xff, 0xff, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_46_image = {(void *) &confirming_46, 22, 22};
+    0x32, 0x00, 0xff, 0x09, 0x02, 0x76, 0xf9, 0xcc, 0xff, 0x0e, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x30, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x76, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x30, 0xcc, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x76, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x76, 0x06, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x76, 0x06, 0xff, 0xff, 0x30, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xcc, 0x05, 0xff, 0xff, 0x76, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0x02, 0x30, 0xfe, 0x76, 0xcc, 0x02, 0xff, 0xff, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_46_image = {confirming_46_data, 22, 22};
 
-static void confirming_47(uint8_t *data)
+static const uint8_t confirming_47_data[245] =
 {
-    const uint8_t image_data[245] =
-    {
-        0x32, 0x00, 0xff, 0x09, 0x02, 0x78, 0xf9, 0xcc, 0xff, 0x0e, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x78, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xcc, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x78, 0x06, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x78, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xfe, 0x10, 0x78, 0x04, 0xff, 0xff, 0x78, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xfe, 0x78, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_47_image = {(void *) &confirming_47, 22, 22};
+    0x32, 0x00, 0xff, 0x09, 0x02, 0x78, 0xf9, 0xcc, 0xff, 0x0e, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x78, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xcc, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x78, 0x06, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x78, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xfe, 0x10, 0x78, 0x04, 0xff, 0xff, 0x78, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xfe, 0x78, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_47_image = {confirming_47_data, 22, 22};
 
-static void confirming_48(uint8_t *data)
+static const uint8_t confirming_48_data[247] =
 {
-    const uint8_t image_data[247] =
-    {
-        0x32, 0x00, 0xfe, 0x09, 0x59, 0x02, 0xcc, 0xfa, 0xff, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x59, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x59, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x59, 0xcc, 0x06, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x59, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x59, 0x06, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0f, 0x59, 0x05, 0xff, 0xff, 0x59, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xfd, 0xcc, 0xff, 0xcc, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_48_image = {(void *) &confirming_48, 22, 22};
+    0x32, 0x00, 0xfe, 0x09, 0x59, 0x02, 0xcc, 0xfa, 0xff, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x59, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x59, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x59, 0xcc, 0x06, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x59, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x59, 0x06, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0f, 0x59, 0x05, 0xff, 0xff, 0x59, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xfd, 0xcc, 0xff, 0xcc, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_48_image = {confirming_48_data, 22, 22};
 
-static void confirming_49(uint8_t *data)
+static const uint8_t confirming_49_data[250] =
 {
-    const uint8_t image_data[250] =
-    {
-        0x32, 0x00, 0xff, 0x09, 0x02, 0x6a, 0xf9, 0xcc, 0xff, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x6a, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x6a, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x6a, 0xcc, 0x06, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x6a, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xfe, 0x05, 0x6a, 0x05, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x02, 0x10, 0xff, 0x6a, 0x03, 0xff, 0xff, 0x10, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x04, 0x10, 0xfe, 0x6a, 0xcc, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_49_image = {(void *) &confirming_49, 22, 22};
+    0x32, 0x00, 0xff, 0x09, 0x02, 0x6a, 0xf9, 0xcc, 0xff, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x6a, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x6a, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x6a, 0xcc, 0x06, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x6a, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xfe, 0x05, 0x6a, 0x05, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x02, 0x10, 0xff, 0x6a, 0x03, 0xff, 0xff, 0x10, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x04, 0x10, 0xfe, 0x6a, 0xcc, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_49_image = {confirming_49_data, 22, 22};
 
-static void confirming_50(uint8_t *data)
+static const uint8_t confirming_50_data[250] =
 {
-    const uint8_t image_data[250] =
-    {
-        0x32, 0x00, 0xfe, 0x0a, 0x4e, 0x02, 0xca, 0xfa, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x4e, 0xca, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x4e, 0xca, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x4e, 0xca, 0x06, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x4e, 0x06, 0xff, 0xfe, 0x4e, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x02, 0x10, 0xff, 0xca, 0x03, 0xff, 0xfc, 0xca, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x04, 0x10, 0x02, 0xff, 0xff, 0x4e, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x4e, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_50_image = {(void *) &confirming_50, 22, 22};
+    0x32, 0x00, 0xfe, 0x0a, 0x4e, 0x02, 0xca, 0xfa, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x4e, 0xca, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x4e, 0xca, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x4e, 0xca, 0x06, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x4e, 0x06, 0xff, 0xfe, 0x4e, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x02, 0x10, 0xff, 0xca, 0x03, 0xff, 0xfc, 0xca, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x04, 0x10, 0x02, 0xff, 0xff, 0x4e, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x4e, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_50_image = {confirming_50_data, 22, 22};
 
-static void confirming_51(uint8_t *data)
+static const uint8_t confirming_51_data[251] =
 {
-    const uint8_t image_data[251] =
-    {
-        0x32, 0x00, 0xfe, 0x0a, 0x54, 0x02, 0xd4, 0xfa, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x54, 0xd4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x54, 0xd4, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x05, 0xd4, 0x06, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfc, 0x01, 0x0b, 0x10, 0xd4, 0x04, 0xff, 0xfe, 0x54, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x03, 0x10, 0xff, 0x54, 0x02, 0xff, 0xfc, 0xd4, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xfe, 0xff, 0x54, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_51_image = {(void *) &confirming_51, 22, 22};
+    0x32, 0x00, 0xfe, 0x0a, 0x54, 0x02, 0xd4, 0xfa, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x54, 0xd4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x54, 0xd4, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x05, 0xd4, 0x06, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfc, 0x01, 0x0b, 0x10, 0xd4, 0x04, 0xff, 0xfe, 0x54, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x03, 0x10, 0xff, 0x54, 0x02, 0xff, 0xfc, 0xd4, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xfe, 0xff, 0x54, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_51_image = {confirming_51_data, 22, 22};
 
-static void confirming_52(uint8_t *data)
+static const uint8_t confirming_52_data[251] =
 {
-    const uint8_t image_data[251] =
-    {
-        0x32, 0x00, 0xfe, 0x0a, 0x53, 0x02, 0xba, 0xfa, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x53, 0xba, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x10, 0xba, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfd, 0x04, 0x0d, 0x53, 0x05, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x02, 0x10, 0xff, 0x53, 0x03, 0xff, 0xfe, 0x53, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x04, 0x10, 0xfa, 0x53, 0xff, 0xba, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0x02, 0x53, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_52_image = {(void *) &confirming_52, 22, 22};
+    0x32, 0x00, 0xfe, 0x0a, 0x53, 0x02, 0xba, 0xfa, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x53, 0xba, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x10, 0xba, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfd, 0x04, 0x0d, 0x53, 0x05, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x02, 0x10, 0xff, 0x53, 0x03, 0xff, 0xfe, 0x53, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x04, 0x10, 0xfa, 0x53, 0xff, 0xba, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0x02, 0x53, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_52_image = {confirming_52_data, 22, 22};
 
-static void confirming_53(uint8_t *data)
+static const uint8_t confirming_53_data[251] =
 {
-    const uint8_t image_data[251] =
-    {
-        0x32, 0x00, 0xfe, 0x0a, 0x52, 0x02, 0xc8, 0xfa, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x52, 0xc8, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x10, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfc, 0x04, 0x0d, 0x10, 0x52, 0x04, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x03, 0x10, 0xff, 0xc8, 0x02, 0xff, 0xfe, 0x52, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x05, 0x10, 0xfb, 0xff, 0xc8, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x06, 0x10, 0xff, 0x52, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_53_image = {(void *) &confirming_53, 22, 22};
+    0x32, 0x00, 0xfe, 0x0a, 0x52, 0x02, 0xc8, 0xfa, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x52, 0xc8, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x10, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfc, 0x04, 0x0d, 0x10, 0x52, 0x04, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x03, 0x10, 0xff, 0xc8, 0x02, 0xff, 0xfe, 0x52, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x05, 0x10, 0xfb, 0xff, 0xc8, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x06, 0x10, 0xff, 0x52, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_53_image = {confirming_53_data, 22, 22};
 
-static void confirming_54(uint8_t *data)
+static const uint8_t confirming_54_data[249] =
 {
-    const uint8_t image_data[249] =
-    {
-        0x32, 0x00, 0xff, 0x0a, 0x02, 0x6d, 0xf9, 0xe2, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x6d, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfd, 0x06, 0x0d, 0x10, 0x04, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x02, 0x10, 0xff, 0x6d, 0x03, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x04, 0x10, 0x02, 0xff, 0xfe, 0x6d, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xfc, 0xe2, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x07, 0x10, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_54_image = {(void *) &confirming_54, 22, 22};
+    0x32, 0x00, 0xff, 0x0a, 0x02, 0x6d, 0xf9, 0xe2, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x6d, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfd, 0x06, 0x0d, 0x10, 0x04, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x02, 0x10, 0xff, 0x6d, 0x03, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x04, 0x10, 0x02, 0xff, 0xfe, 0x6d, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xfc, 0xe2, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x07, 0x10, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_54_image = {confirming_54_data, 22, 22};
 
-static void confirming_55(uint8_t *data)
+static const uint8_t confirming_55_data[251] =
 {
-    const uint8_t image_data[251] =
-    {
-        0x32, 0x00, 0xfe, 0x01, 0x10, 0x02, 0xa3, 0xfa, 0xf7, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfd, 0x04, 0x0b, 0xa3, 0x03, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x02, 0x10, 0x03, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x03, 0x10, 0xfc, 0xa3, 0xff, 0xf7, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x05, 0x10, 0xfd, 0xff, 0xa3, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xfc, 0xa3, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_55_image = {(void *) &confirming_55, 22, 22};
+    0x32, 0x00, 0xfe, 0x01, 0x10, 0x02, 0xa3, 0xfa, 0xf7, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfd, 0x04, 0x0b, 0xa3, 0x03, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x02, 0x10, 0x03, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x03, 0x10, 0xfc, 0xa3, 0xff, 0xf7, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x05, 0x10, 0xfd, 0xff, 0xa3, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xfc, 0xa3, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_55_image = {confirming_55_data, 22, 22};
 
-static void confirming_56(uint8_t *data)
+static const uint8_t confirming_56_data[250] =
 {
-    const uint8_t image_data[250] =
-    {
-        0x32, 0x00, 0xfd, 0x01, 0x05, 0x89, 0x02, 0xfb, 0xfb, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfc, 0x04, 0x0b, 0x10, 0x89, 0x02, 0xfb, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x03, 0x10, 0x02, 0xfb, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x04, 0x10, 0x02, 0xfb, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0xfe, 0x89, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xfc, 0x0d, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_56_image = {(void *) &confirming_56, 22, 22};
+    0x32, 0x00, 0xfd, 0x01, 0x05, 0x89, 0x02, 0xfb, 0xfb, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfc, 0x04, 0x0b, 0x10, 0x89, 0x02, 0xfb, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x03, 0x10, 0x02, 0xfb, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x04, 0x10, 0x02, 0xfb, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0xfe, 0x89, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xfc, 0x0d, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_56_image = {confirming_56_data, 22, 22};
 
-static void confirming_57(uint8_t *data)
+static const uint8_t confirming_57_data[250] =
 {
-    const uint8_t image_data[250] =
-    {
-        0x32, 0x00, 0xfd, 0x01, 0x05, 0x09, 0x02, 0xf8, 0xfb, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x02, 0x10, 0xfe, 0x6a, 0xf8, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x04, 0x10, 0xff, 0xf8, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x05, 0x10, 0xfe, 0xf8, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0xfe, 0x6a, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xfc, 0x0d, 0x04, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_57_image = {(void *) &confirming_57, 22, 22};
+    0x32, 0x00, 0xfd, 0x01, 0x05, 0x09, 0x02, 0xf8, 0xfb, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x02, 0x10, 0xfe, 0x6a, 0xf8, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x04, 0x10, 0xff, 0xf8, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x05, 0x10, 0xfe, 0xf8, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0xfe, 0x6a, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xfc, 0x0d, 0x04, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_57_image = {confirming_57_data, 22, 22};
 
-static void confirming_58(uint8_t *data)
+static const uint8_t confirming_58_data[247] =
 {
-    const uint8_t image_data[247] =
-    {
-        0x32, 0x00, 0xf6, 0x01, 0x05, 0x09, 0x0d, 0x86, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x03, 0x10, 0xff, 0x86, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x04, 0x10, 0xff, 0x86, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x06, 0x10, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0x02, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x0d, 0x02, 0x00, 0xff, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_58_image = {(void *) &confirming_58, 22, 22};
+    0x32, 0x00, 0xf6, 0x01, 0x05, 0x09, 0x0d, 0x86, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x03, 0x10, 0xff, 0x86, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x04, 0x10, 0xff, 0x86, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x06, 0x10, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0x02, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x0d, 0x02, 0x00, 0xff, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_58_image = {confirming_58_data, 22, 22};
 
-static void confirming_59(uint8_t *data)
+static const uint8_t confirming_59_data[240] =
 {
-    const uint8_t image_data[240] =
-    {
-        0x32, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x05, 0x10, 0x02, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0x02, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x0d, 0x02, 0x00, 0xff, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_59_image = {(void *) &confirming_59, 22, 22};
+    0x32, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x05, 0x10, 0x02, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0x02, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x0d, 0x02, 0x00, 0xff, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_59_image = {confirming_59_data, 22, 22};
 
-static void confirming_60(uint8_t *data)
+static const uint8_t confirming_60_data[236] =
 {
-    const uint8_t image_data[236] =
-    {
-        0x32, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0x02, 0x0c, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x0f, 0x02, 0x08, 0xff, 0x0f, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x0a, 0x02, 0x08, 0xff, 0x0a, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x08, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x09, 0x04, 0x08, 0xfe, 0x09, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x0b, 0x06, 0x08, 0xff, 0x0b, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0e, 0x08, 0x08, 0xff, 0x0e, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x0a, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_60_image = {(void *) &confirming_60, 22, 22};
+    0x32, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0x02, 0x0c, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x0f, 0x02, 0x08, 0xff, 0x0f, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x0a, 0x02, 0x08, 0xff, 0x0a, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x08, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x09, 0x04, 0x08, 0xfe, 0x09, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x0b, 0x06, 0x08, 0xff, 0x0b, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0e, 0x08, 0x08, 0xff, 0x0e, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x0a, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_60_image = {confirming_60_data, 22, 22};
 
-static void confirming_61(uint8_t *data)
+static const uint8_t confirming_61_data[174] =
 {
-    const uint8_t image_data[174] =
-    {
-        0x32, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x10, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x10, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x10, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x10, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x10, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x10, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_61_image = {(void *) &confirming_61, 22, 22};
+    0x32, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x10, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x10, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x10, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x10, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x10, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x10, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_61_image = {confirming_61_data, 22, 22};
 
-static void confirming_62(uint8_t *data)
+static const uint8_t confirming_62_data[277] =
 {
-    const uint8_t image_data[277] =
-    {
-        0x32, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x09, 0x10, 0xfb, 0x23, 0x44, 0x10, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x09, 0x10, 0xfd, 0x23, 0x5c, 0x44, 0x02, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x09, 0x10, 0xfc, 0x23, 0x5c, 0x60, 0x44, 0x03, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x07, 0x08, 0x10, 0xfe, 0x17, 0x54, 0x02, 0x60, 0xff, 0x44, 0x03, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x0d, 0x08, 0x10, 0xff, 0x44, 0x03, 0x60, 0xff, 0x54, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x03, 0x10, 0xfe, 0x17, 0x23, 0x02, 0x10, 0xff, 0x31, 0x03, 0x60, 0xff, 0x31, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x02, 0x10, 0xff, 0x23, 0x02, 0x54, 0x02, 0x10, 0xff, 0x54, 0x02, 0x60, 0xff, 0x31, 0x05, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xfd, 0x0d, 0x10, 0x44, 0x03, 0x60, 0x02, 0x31, 0x02, 0x60, 0xff, 0x31, 0x06, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x07, 0x02, 0x10, 0xfd, 0x31, 0x5c, 0x60, 0x02, 0x54, 0xfe, 0x60, 0x44, 0x07, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x05, 0x03, 0x10, 0xfe, 0x23, 0x5c, 0x02, 0x60, 0xff, 0x54, 0x08, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x03, 0x10, 0xff, 0x23, 0x02, 0x5c, 0xff, 0x17, 0x07, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x03, 0x10, 0xfe, 0x23, 0x31, 0x07, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_62_image = {(void *) &confirming_62, 22, 22};
+    0x32, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x09, 0x10, 0xfb, 0x23, 0x44, 0x10, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x09, 0x10, 0xfd, 0x23, 0x5c, 0x44, 0x02, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x09, 0x10, 0xfc, 0x23, 0x5c, 0x60, 0x44, 0x03, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x07, 0x08, 0x10, 0xfe, 0x17, 0x54, 0x02, 0x60, 0xff, 0x44, 0x03, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x0d, 0x08, 0x10, 0xff, 0x44, 0x03, 0x60, 0xff, 0x54, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x03, 0x10, 0xfe, 0x17, 0x23, 0x02, 0x10, 0xff, 0x31, 0x03, 0x60, 0xff, 0x31, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x02, 0x10, 0xff, 0x23, 0x02, 0x54, 0x02, 0x10, 0xff, 0x54, 0x02, 0x60, 0xff, 0x31, 0x05, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xfd, 0x0d, 0x10, 0x44, 0x03, 0x60, 0x02, 0x31, 0x02, 0x60, 0xff, 0x31, 0x06, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x07, 0x02, 0x10, 0xfd, 0x31, 0x5c, 0x60, 0x02, 0x54, 0xfe, 0x60, 0x44, 0x07, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x05, 0x03, 0x10, 0xfe, 0x23, 0x5c, 0x02, 0x60, 0xff, 0x54, 0x08, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x03, 0x10, 0xff, 0x23, 0x02, 0x5c, 0xff, 0x17, 0x07, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x03, 0x10, 0xfe, 0x23, 0x31, 0x07, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_62_image = {confirming_62_data, 22, 22};
 
-static void confirming_63(uint8_t *data)
+static const uint8_t confirming_63_data[277] =
 {
-    const uint8_t image_data[277] =
-    {
-        0x32, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x09, 0x10, 0xfb, 0x36, 0x78, 0x10, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x09, 0x10, 0xfd, 0x36, 0xa5, 0x78, 0x02, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x09, 0x10, 0xfc, 0x36, 0xa5, 0xaf, 0x78, 0x03, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x07, 0x08, 0x10, 0xfe, 0x1d, 0xa5, 0x02, 0xaf, 0xff, 0x78, 0x03, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x0d, 0x08, 0x10, 0xff, 0x78, 0x03, 0xaf, 0xff, 0x97, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x03, 0x10, 0xfe, 0x1d, 0x36, 0x02, 0x10, 0xff, 0x52, 0x03, 0xaf, 0xff, 0x52, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x02, 0x10, 0xff, 0x36, 0x02, 0x97, 0x02, 0x10, 0xff, 0x97, 0x02, 0xaf, 0xff, 0x52, 0x05, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xfd, 0x0d, 0x10, 0x78, 0x03, 0xaf, 0x02, 0x52, 0x02, 0xaf, 0xff, 0x52, 0x06, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x07, 0x02, 0x10, 0xff, 0x52, 0x02, 0xaf, 0x02, 0x97, 0xfe, 0xaf, 0x78, 0x07, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x05, 0x03, 0x10, 0xfe, 0x36, 0xa5, 0x02, 0xaf, 0xff, 0x97, 0x08, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x03, 0x10, 0xff, 0x36, 0x02, 0xa5, 0xff, 0x1d, 0x07, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x03, 0x10, 0xfe, 0x36, 0x52, 0x07, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_63_image = {(void *) &confirming_63, 22, 22};
+    0x32, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x09, 0x10, 0xfb, 0x36, 0x78, 0x10, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x09, 0x10, 0xfd, 0x36, 0xa5, 0x78, 0x02, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x09, 0x10, 0xfc, 0x36, 0xa5, 0xaf, 0x78, 0x03, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x07, 0x08, 0x10, 0xfe, 0x1d, 0xa5, 0x02, 0xaf, 0xff, 0x78, 0x03, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x0d, 0x08, 0x10, 0xff, 0x78, 0x03, 0xaf, 0xff, 0x97, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x03, 0x10, 0xfe, 0x1d, 0x36, 0x02, 0x10, 0xff, 0x52, 0x03, 0xaf, 0xff, 0x52, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x02, 0x10, 0xff, 0x36, 0x02, 0x97, 0x02, 0x10, 0xff, 0x97, 0x02, 0xaf, 0xff, 0x52, 0x05, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xfd, 0x0d, 0x10, 0x78, 0x03, 0xaf, 0x02, 0x52, 0x02, 0xaf, 0xff, 0x52, 0x06, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x07, 0x02, 0x10, 0xff, 0x52, 0x02, 0xaf, 0x02, 0x97, 0xfe, 0xaf, 0x78, 0x07, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x05, 0x03, 0x10, 0xfe, 0x36, 0xa5, 0x02, 0xaf, 0xff, 0x97, 0x08, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x03, 0x10, 0xff, 0x36, 0x02, 0xa5, 0xff, 0x1d, 0x07, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x03, 0x10, 0xfe, 0x36, 0x52, 0x07, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_63_image = {confirming_63_data, 22, 22};
 
-static void confirming_64(uint8_t *data)
+static const uint8_t confirming_64_data[277] =
 {
-    const uint8_t image_data[277] =
-    {
-        0x32, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x09, 0x10, 0xfb, 0x4a, 0xac, 0x10, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x09, 0x10, 0xfd, 0x4a, 0xf0, 0xac, 0x02, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x09, 0x10, 0xfc, 0x4a, 0xf0, 0xff, 0xac, 0x03, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x07, 0x08, 0x10, 0xfe, 0x24, 0xf0, 0x02, 0xff, 0xff, 0xac, 0x03, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x0d, 0x08, 0x10, 0xff, 0xac, 0x03, 0xff, 0xff, 0xdb, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x03, 0x10, 0xfe, 0x24, 0x4a, 0x02, 0x10, 0xff, 0x73, 0x03, 0xff, 0xff, 0x73, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x02, 0x10, 0xff, 0x4a, 0x02, 0xdb, 0x02, 0x10, 0xff, 0xdb, 0x02, 0xff, 0xff, 0x73, 0x05, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xfd, 0x0d, 0x10, 0xac, 0x03, 0xff, 0x02, 0x73, 0x02, 0xff, 0xff, 0x73, 0x06, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x07, 0x02, 0x10, 0xff, 0x73, 0x02, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0xac, 0x07, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x05, 0x03, 0x10, 0xfe, 0x4a, 0xf0, 0x02, 0xff, 0xff, 0xdb, 0x08, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x03, 0x10, 0xff, 0x4a, 0x02, 0xf0, 0xff, 0x24, 0x07, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x03, 0x10, 0xfe, 0x4a, 0x73, 0x07, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x32, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image confirming_64_image = {(void *) &confirming_64, 22, 22};
+    0x32, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x09, 0x10, 0xfb, 0x4a, 0xac, 0x10, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x09, 0x10, 0xfd, 0x4a, 0xf0, 0xac, 0x02, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x09, 0x10, 0xfc, 0x4a, 0xf0, 0xff, 0xac, 0x03, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x07, 0x08, 0x10, 0xfe, 0x24, 0xf0, 0x02, 0xff, 0xff, 0xac, 0x03, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x0d, 0x08, 0x10, 0xff, 0xac, 0x03, 0xff, 0xff, 0xdb, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x03, 0x10, 0xfe, 0x24, 0x4a, 0x02, 0x10, 0xff, 0x73, 0x03, 0xff, 0xff, 0x73, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x02, 0x10, 0xff, 0x4a, 0x02, 0xdb, 0x02, 0x10, 0xff, 0xdb, 0x02, 0xff, 0xff, 0x73, 0x05, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xfd, 0x0d, 0x10, 0xac, 0x03, 0xff, 0x02, 0x73, 0x02, 0xff, 0xff, 0x73, 0x06, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x07, 0x02, 0x10, 0xff, 0x73, 0x02, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0xac, 0x07, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x05, 0x03, 0x10, 0xfe, 0x4a, 0xf0, 0x02, 0xff, 0xff, 0xdb, 0x08, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x03, 0x10, 0xff, 0x4a, 0x02, 0xf0, 0xff, 0x24, 0x07, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x03, 0x10, 0xfe, 0x4a, 0x73, 0x07, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x32, 0x00
+};
+static const Image confirming_64_image = {confirming_64_data, 22, 22};
 
 static const AnimationFrame confirming_array[] =
 {
@@ -802,665 +524,401 @@ static const ImageAnimation confirming = { 64, confirming_array };
 
 /* --- Loading Animation --------------------------------------------------- */
 
-static void loading_1(uint8_t *data)
+static const uint8_t loading_1_data[134] =
 {
-    const uint8_t image_data[134] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_1_image = {(void *) &loading_1, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x5d, 0x00
+};
+static const Image loading_1_image = {loading_1_data, 92, 8};
 
-static void loading_2(uint8_t *data)
+static const uint8_t loading_2_data[152] =
 {
-    const uint8_t image_data[152] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_2_image = {(void *) &loading_2, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x5d, 0x00
+};
+static const Image loading_2_image = {loading_2_data, 92, 8};
 
-static void loading_3(uint8_t *data)
+static const uint8_t loading_3_data[158] =
 {
-    const uint8_t image_data[158] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_3_image = {(void *) &loading_3, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x5d, 0x00
+};
+static const Image loading_3_image = {loading_3_data, 92, 8};
 
-static void loading_4(uint8_t *data)
+static const uint8_t loading_4_data[158] =
 {
-    const uint8_t image_data[158] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_4_image = {(void *) &loading_4, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x5d, 0x00
+};
+static const Image loading_4_image = {loading_4_data, 92, 8};
 
-static void loading_5(uint8_t *data)
+static const uint8_t loading_5_data[176] =
 {
-    const uint8_t image_data[176] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_5_image = {(void *) &loading_5, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x5d, 0x00
+};
+static const Image loading_5_image = {loading_5_data, 92, 8};
 
-static void loading_6(uint8_t *data)
+static const uint8_t loading_6_data[182] =
 {
-    const uint8_t image_data[182] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_6_image = {(void *) &loading_6, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x5d, 0x00
+};
+static const Image loading_6_image = {loading_6_data, 92, 8};
 
-static void loading_7(uint8_t *data)
+static const uint8_t loading_7_data[182] =
 {
-    const uint8_t image_data[182] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_7_image = {(void *) &loading_7, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x5d, 0x00
+};
+static const Image loading_7_image = {loading_7_data, 92, 8};
 
-static void loading_8(uint8_t *data)
+static const uint8_t loading_8_data[200] =
 {
-    const uint8_t image_data[200] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_8_image = {(void *) &loading_8, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x5d, 0x00
+};
+static const Image loading_8_image = {loading_8_data, 92, 8};
 
-static void loading_9(uint8_t *data)
+static const uint8_t loading_9_data[206] =
 {
-    const uint8_t image_data[206] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_9_image = {(void *) &loading_9, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x5d, 0x00
+};
+static const Image loading_9_image = {loading_9_data, 92, 8};
 
-static void loading_10(uint8_t *data)
+static const uint8_t loading_10_data[206] =
 {
-    const uint8_t image_data[206] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_10_image = {(void *) &loading_10, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x5d, 0x00
+};
+static const Image loading_10_image = {loading_10_data, 92, 8};
 
-static void loading_11(uint8_t *data)
+static const uint8_t loading_11_data[200] =
 {
-    const uint8_t image_data[200] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_11_image = {(void *) &loading_11, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x5d, 0x00
+};
+static const Image loading_11_image = {loading_11_data, 92, 8};
 
-static void loading_12(uint8_t *data)
+static const uint8_t loading_12_data[230] =
 {
-    const uint8_t image_data[230] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_12_image = {(void *) &loading_12, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x5d, 0x00
+};
+static const Image loading_12_image = {loading_12_data, 92, 8};
 
-static void loading_13(uint8_t *data)
+static const uint8_t loading_13_data[230] =
 {
-    const uint8_t image_data[230] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_13_image = {(void *) &loading_13, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x5d, 0x00
+};
+static const Image loading_13_image = {loading_13_data, 92, 8};
 
-static void loading_14(uint8_t *data)
+static const uint8_t loading_14_data[230] =
 {
-    const uint8_t image_data[230] =
-    {
-        0x5d, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_14_image = {(void *) &loading_14, 92, 8};
+    0x5d, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x5d, 0x00
+};
+static const Image loading_14_image = {loading_14_data, 92, 8};
 
-static void loading_15(uint8_t *data)
+static const uint8_t loading_15_data[260] =
 {
-    const uint8_t image_data[260] =
-    {
-        0x5d, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_15_image = {(void *) &loading_15, 92, 8};
+    0x5d, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x5d, 0x00
+};
+static const Image loading_15_image = {loading_15_data, 92, 8};
 
-static void loading_16(uint8_t *data)
+static const uint8_t loading_16_data[266] =
 {
-    const uint8_t image_data[266] =
-    {
-        0x5d, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_16_image = {(void *) &loading_16, 92, 8};
+    0x5d, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x5d, 0x00
+};
+static const Image loading_16_image = {loading_16_data, 92, 8};
 
-static void loading_17(uint8_t *data)
+static const uint8_t loading_17_data[242] =
 {
-    const uint8_t image_data[242] =
-    {
-        0x5d, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_17_image = {(void *) &loading_17, 92, 8};
+    0x5d, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x5d, 0x00
+};
+static const Image loading_17_image = {loading_17_data, 92, 8};
 
-static void loading_18(uint8_t *data)
+static const uint8_t loading_18_data[266] =
 {
-    const uint8_t image_data[266] =
-    {
-        0x5d, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_18_image = {(void *) &loading_18, 92, 8};
+    0x5d, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x5d, 0x00
+};
+static const Image loading_18_image = {loading_18_data, 92, 8};
 
-static void loading_19(uint8_t *data)
+static const uint8_t loading_19_data[260] =
 {
-    const uint8_t image_data[260] =
-    {
-        0x5d, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_19_image = {(void *) &loading_19, 92, 8};
+    0x5d, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x5d, 0x00
+};
+static const Image loading_19_image = {loading_19_data, 92, 8};
 
-static void loading_20(uint8_t *data)
+static const uint8_t loading_20_data[230] =
 {
-    const uint8_t image_data[230] =
-    {
-        0x5d, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_20_image = {(void *) &loading_20, 92, 8};
+    0x5d, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x5d, 0x00
+};
+static const Image loading_20_image = {loading_20_data, 92, 8};
 
-static void loading_21(uint8_t *data)
+static const uint8_t loading_21_data[230] =
 {
-    const uint8_t image_data[230] =
-    {
-        0x5d, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_21_image = {(void *) &loading_21, 92, 8};
+    0x5d, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_21_image = {loading_21_data, 92, 8};
 
-static void loading_22(uint8_t *data)
+static const uint8_t loading_22_data[230] =
 {
-    const uint8_t image_data[230] =
-    {
-        0x5d, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_22_image = {(void *) &loading_22, 92, 8};
+    0x5d, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_22_image = {loading_22_data, 92, 8};
 
-static void loading_23(uint8_t *data)
+static const uint8_t loading_23_data[200] =
 {
-    const uint8_t image_data[200] =
-    {
-        0x5d, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_23_image = {(void *) &loading_23, 92, 8};
+    0x5d, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_23_image = {loading_23_data, 92, 8};
 
-static void loading_24(uint8_t *data)
+static const uint8_t loading_24_data[206] =
 {
-    const uint8_t image_data[206] =
-    {
-        0x5d, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_24_image = {(void *) &loading_24, 92, 8};
+    0x5d, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_24_image = {loading_24_data, 92, 8};
 
-static void loading_25(uint8_t *data)
+static const uint8_t loading_25_data[206] =
 {
-    const uint8_t image_data[206] =
-    {
-        0x5d, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_25_image = {(void *) &loading_25, 92, 8};
+    0x5d, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_25_image = {loading_25_data, 92, 8};
 
-static void loading_26(uint8_t *data)
+static const uint8_t loading_26_data[200] =
 {
-    const uint8_t image_data[200] =
-    {
-        0x5d, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_26_image = {(void *) &loading_26, 92, 8};
+    0x5d, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_26_image = {loading_26_data, 92, 8};
 
-static void loading_27(uint8_t *data)
+static const uint8_t loading_27_data[182] =
 {
-    const uint8_t image_data[182] =
-    {
-        0x5d, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_27_image = {(void *) &loading_27, 92, 8};
+    0x5d, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_27_image = {loading_27_data, 92, 8};
 
-static void loading_28(uint8_t *data)
+static const uint8_t loading_28_data[182] =
 {
-    const uint8_t image_data[182] =
-    {
-        0x5d, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_28_image = {(void *) &loading_28, 92, 8};
+    0x5d, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_28_image = {loading_28_data, 92, 8};
 
-static void loading_29(uint8_t *data)
+static const uint8_t loading_29_data[176] =
 {
-    const uint8_t image_data[176] =
-    {
-        0x5d, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_29_image = {(void *) &loading_29, 92, 8};
+    0x5d, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_29_image = {loading_29_data, 92, 8};
 
-static void loading_30(uint8_t *data)
+static const uint8_t loading_30_data[158] =
 {
-    const uint8_t image_data[158] =
-    {
-        0x5d, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_30_image = {(void *) &loading_30, 92, 8};
+    0x5d, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_30_image = {loading_30_data, 92, 8};
 
-static void loading_31(uint8_t *data)
+static const uint8_t loading_31_data[158] =
 {
-    const uint8_t image_data[158] =
-    {
-        0x5d, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_31_image = {(void *) &loading_31, 92, 8};
+    0x5d, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_31_image = {loading_31_data, 92, 8};
 
-static void loading_32(uint8_t *data)
+static const uint8_t loading_32_data[152] =
 {
-    const uint8_t image_data[152] =
-    {
-        0x5d, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_32_image = {(void *) &loading_32, 92, 8};
+    0x5d, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_32_image = {loading_32_data, 92, 8};
 
-static void loading_33(uint8_t *data)
+static const uint8_t loading_33_data[134] =
 {
-    const uint8_t image_data[134] =
-    {
-        0x5d, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_33_image = {(void *) &loading_33, 92, 8};
+    0x5d, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_33_image = {loading_33_data, 92, 8};
 
-static void loading_34(uint8_t *data)
+static const uint8_t loading_34_data[134] =
 {
-    const uint8_t image_data[134] =
-    {
-        0x5d, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_34_image = {(void *) &loading_34, 92, 8};
+    0x5d, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_34_image = {loading_34_data, 92, 8};
 
-static void loading_35(uint8_t *data)
+static const uint8_t loading_35_data[134] =
 {
-    const uint8_t image_data[134] =
-    {
-        0x5d, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_35_image = {(void *) &loading_35, 92, 8};
+    0x5d, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_35_image = {loading_35_data, 92, 8};
 
-static void loading_36(uint8_t *data)
+static const uint8_t loading_36_data[152] =
 {
-    const uint8_t image_data[152] =
-    {
-        0x5d, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_36_image = {(void *) &loading_36, 92, 8};
+    0x5d, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_36_image = {loading_36_data, 92, 8};
 
-static void loading_37(uint8_t *data)
+static const uint8_t loading_37_data[158] =
 {
-    const uint8_t image_data[158] =
-    {
-        0x5d, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_37_image = {(void *) &loading_37, 92, 8};
+    0x5d, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_37_image = {loading_37_data, 92, 8};
 
-static void loading_38(uint8_t *data)
+static const uint8_t loading_38_data[158] =
 {
-    const uint8_t image_data[158] =
-    {
-        0x5d, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_38_image = {(void *) &loading_38, 92, 8};
+    0x5d, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_38_image = {loading_38_data, 92, 8};
 
-static void loading_39(uint8_t *data)
+static const uint8_t loading_39_data[176] =
 {
-    const uint8_t image_data[176] =
-    {
-        0x5d, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_39_image = {(void *) &loading_39, 92, 8};
+    0x5d, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_39_image = {loading_39_data, 92, 8};
 
-static void loading_40(uint8_t *data)
+static const uint8_t loading_40_data[182] =
 {
-    const uint8_t image_data[182] =
-    {
-        0x5d, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_40_image = {(void *) &loading_40, 92, 8};
+    0x5d, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_40_image = {loading_40_data, 92, 8};
 
-static void loading_41(uint8_t *data)
+static const uint8_t loading_41_data[182] =
 {
-    const uint8_t image_data[182] =
-    {
-        0x5d, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_41_image = {(void *) &loading_41, 92, 8};
+    0x5d, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_41_image = {loading_41_data, 92, 8};
 
-static void loading_42(uint8_t *data)
+static const uint8_t loading_42_data[200] =
 {
-    const uint8_t image_data[200] =
-    {
-        0x5d, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_42_image = {(void *) &loading_42, 92, 8};
+    0x5d, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_42_image = {loading_42_data, 92, 8};
 
-static void loading_43(uint8_t *data)
+static const uint8_t loading_43_data[206] =
 {
-    const uint8_t image_data[206] =
-    {
-        0x5d, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_43_image = {(void *) &loading_43, 92, 8};
+    0x5d, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_43_image = {loading_43_data, 92, 8};
 
-static void loading_44(uint8_t *data)
+static const uint8_t loading_44_data[206] =
 {
-    const uint8_t image_data[206] =
-    {
-        0x5d, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_44_image = {(void *) &loading_44, 92, 8};
+    0x5d, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_44_image = {loading_44_data, 92, 8};
 
-static void loading_45(uint8_t *data)
+static const uint8_t loading_45_data[200] =
 {
-    const uint8_t image_data[200] =
-    {
-        0x5d, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_45_image = {(void *) &loading_45, 92, 8};
+    0x5d, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_45_image = {loading_45_data, 92, 8};
 
-static void loading_46(uint8_t *data)
+static const uint8_t loading_46_data[230] =
 {
-    const uint8_t image_data[230] =
-    {
-        0x5d, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_46_image = {(void *) &loading_46, 92, 8};
+    0x5d, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_46_image = {loading_46_data, 92, 8};
 
-static void loading_47(uint8_t *data)
+static const uint8_t loading_47_data[230] =
 {
-    const uint8_t image_data[230] =
-    {
-        0x5d, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_47_image = {(void *) &loading_47, 92, 8};
+    0x5d, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x5d, 0x00
+};
+static const Image loading_47_image = {loading_47_data, 92, 8};
 
-static void loading_48(uint8_t *data)
+static const uint8_t loading_48_data[230] =
 {
-    const uint8_t image_data[230] =
-    {
-        0x5d, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_48_image = {(void *) &loading_48, 92, 8};
+    0x5d, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x5d, 0x00
+};
+static const Image loading_48_image = {loading_48_data, 92, 8};
 
-static void loading_49(uint8_t *data)
+static const uint8_t loading_49_data[260] =
 {
-    const uint8_t image_data[260] =
-    {
-        0x5d, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_49_image = {(void *) &loading_49, 92, 8};
+    0x5d, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x5d, 0x00
+};
+static const Image loading_49_image = {loading_49_data, 92, 8};
 
-static void loading_50(uint8_t *data)
+static const uint8_t loading_50_data[266] =
 {
-    const uint8_t image_data[266] =
-    {
-        0x5d, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_50_image = {(void *) &loading_50, 92, 8};
+    0x5d, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x5d, 0x00
+};
+static const Image loading_50_image = {loading_50_data, 92, 8};
 
-static void loading_51(uint8_t *data)
+static const uint8_t loading_51_data[242] =
 {
-    const uint8_t image_data[242] =
-    {
-        0x5d, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_51_image = {(void *) &loading_51, 92, 8};
+    0x5d, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x5d, 0x00
+};
+static const Image loading_51_image = {loading_51_data, 92, 8};
 
-static void loading_52(uint8_t *data)
+static const uint8_t loading_52_data[266] =
 {
-    const uint8_t image_data[266] =
-    {
-        0x5d, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_52_image = {(void *) &loading_52, 92, 8};
+    0x5d, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x5d, 0x00
+};
+static const Image loading_52_image = {loading_52_data, 92, 8};
 
-static void loading_53(uint8_t *data)
+static const uint8_t loading_53_data[260] =
 {
-    const uint8_t image_data[260] =
-    {
-        0x5d, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_53_image = {(void *) &loading_53, 92, 8};
+    0x5d, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x5d, 0x00
+};
+static const Image loading_53_image = {loading_53_data, 92, 8};
 
-static void loading_54(uint8_t *data)
+static const uint8_t loading_54_data[230] =
 {
-    const uint8_t image_data[230] =
-    {
-        0x5d, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_54_image = {(void *) &loading_54, 92, 8};
+    0x5d, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x5d, 0x00
+};
+static const Image loading_54_image = {loading_54_data, 92, 8};
 
-static void loading_55(uint8_t *data)
+static const uint8_t loading_55_data[230] =
 {
-    const uint8_t image_data[230] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_55_image = {(void *) &loading_55, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x5d, 0x00
+};
+static const Image loading_55_image = {loading_55_data, 92, 8};
 
-static void loading_56(uint8_t *data)
+static const uint8_t loading_56_data[230] =
 {
-    const uint8_t image_data[230] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_56_image = {(void *) &loading_56, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x5d, 0x00
+};
+static const Image loading_56_image = {loading_56_data, 92, 8};
 
-static void loading_57(uint8_t *data)
+static const uint8_t loading_57_data[200] =
 {
-    const uint8_t image_data[200] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_57_image = {(void *) &loading_57, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x5d, 0x00
+};
+static const Image loading_57_image = {loading_57_data, 92, 8};
 
-static void loading_58(uint8_t *data)
+static const uint8_t loading_58_data[206] =
 {
-    const uint8_t image_data[206] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_58_image = {(void *) &loading_58, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x5d, 0x00
+};
+static const Image loading_58_image = {loading_58_data, 92, 8};
 
-static void loading_59(uint8_t *data)
+static const uint8_t loading_59_data[206] =
 {
-    const uint8_t image_data[206] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_59_image = {(void *) &loading_59, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x5d, 0x00
+};
+static const Image loading_59_image = {loading_59_data, 92, 8};
 
-static void loading_60(uint8_t *data)
+static const uint8_t loading_60_data[200] =
 {
-    const uint8_t image_data[200] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_60_image = {(void *) &loading_60, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x5d, 0x00
+};
+static const Image loading_60_image = {loading_60_data, 92, 8};
 
-static void loading_61(uint8_t *data)
+static const uint8_t loading_61_data[182] =
 {
-    const uint8_t image_data[182] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_61_image = {(void *) &loading_61, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x5d, 0x00
+};
+static const Image loading_61_image = {loading_61_data, 92, 8};
 
-static void loading_62(uint8_t *data)
+static const uint8_t loading_62_data[182] =
 {
-    const uint8_t image_data[182] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_62_image = {(void *) &loading_62, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x5d, 0x00
+};
+static const Image loading_62_image = {loading_62_data, 92, 8};
 
-static void loading_63(uint8_t *data)
+static const uint8_t loading_63_data[176] =
 {
-    const uint8_t image_data[176] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_63_image = {(void *) &loading_63, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x5d, 0x00
+};
+static const Image loading_63_image = {loading_63_data, 92, 8};
 
-static void loading_64(uint8_t *data)
+static const uint8_t loading_64_data[158] =
 {
-    const uint8_t image_data[158] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_64_image = {(void *) &loading_64, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x5d, 0x00
+};
+static const Image loading_64_image = {loading_64_data, 92, 8};
 
-static void loading_65(uint8_t *data)
+static const uint8_t loading_65_data[158] =
 {
-    const uint8_t image_data[158] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_65_image = {(void *) &loading_65, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x5d, 0x00
+};
+static const Image loading_65_image = {loading_65_data, 92, 8};
 
-static void loading_66(uint8_t *data)
+static const uint8_t loading_66_data[152] =
 {
-    const uint8_t image_data[152] =
-    {
-        0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x5d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image loading_66_image = {(void *) &loading_66, 92, 8};
+    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x5d, 0x00
+};
+static const Image loading_66_image = {loading_66_data, 92, 8};
 
 static const AnimationFrame loading_array[] =
 {
@@ -1536,85 +994,53 @@ static const ImageAnimation loading = { 66, loading_array };
 
 /* --- Warning Animation --------------------------------------------------- */
 
-static void warning_1(uint8_t *data)
+static const uint8_t warning_1_data[446] =
 {
-    const uint8_t image_data[446] =
-    {
-        0x11, 0x00, 0xf9, 0x17, 0x8c, 0xd2, 0xe5, 0xd2, 0x8c, 0x17, 0x21, 0x00, 0xfe, 0x2e, 0xd2, 0x05, 0xe5, 0xfe, 0xd2, 0x2e, 0x1f, 0x00, 0xfe, 0x22, 0xd2, 0x07, 0xe5, 0xfe, 0xd2, 0x22, 0x1e, 0x00, 0xff, 0xb8, 0x09, 0xe5, 0xff, 0xb8, 0x1d, 0x00, 0xff, 0x58, 0x0b, 0xe5, 0xff, 0x58, 0x1b, 0x00, 0xfe, 0x0b, 0xd2, 0x0b, 0xe5, 0xfe, 0xd2, 0x0b, 0x1a, 0x00, 0xff, 0x72, 0x0d, 0xe5, 0xff, 0x72, 0x19, 0x00, 0xff, 0x22, 0x0f, 0xe5, 0xff, 0x22, 0x18, 0x00, 0xff, 0xa1, 0x0f, 0xe5, 0xff, 0xa1, 0x17, 0x00, 0xff, 0x3a, 0x11, 0xe5, 0xff, 0x3a, 0x16, 0x00, 0xff, 0xb8, 0x07, 0xe5, 0xfc, 0x8c, 0x3a, 0x58, 0xd2, 0x06, 0xe5, 0xff, 0xb8, 0x15, 0x00, 0xff, 0x58, 0x07, 0xe5, 0xff, 0x72, 0x03, 0x00, 0xfe, 0x17, 0xd2, 0x06, 0xe5, 0xff, 0x58, 0x13, 0x00, 0xfe, 0x17, 0xd2, 0x07, 0xe5, 0xff, 0x17, 0x04, 0x00, 0xff, 0xa1, 0x06, 0xe5, 0xfe, 0xd2, 0x17, 0x12, 0x00, 0xff, 0x8c, 0x08, 0xe5, 0xff, 0x17, 0x04, 0x00, 0xff, 0x8c, 0x07, 0xe5, 0xff, 0x8c, 0x11, 0x00, 0xff, 0x2e, 0x09, 0xe5, 0xff, 0x2e, 0x04, 0x00, 0xff, 0xa1, 0x08, 0xe5, 0xff, 0x2e, 0x10, 0x00, 0xff, 0xa1, 0x09, 0xe5, 0xff, 0x3a, 0x04, 0x00, 0xff, 0xb8, 0x08, 0xe5, 0xff, 0xa1, 0x0f, 0x00, 0xff, 0x46, 0x0a, 0xe5, 0xff, 0x46, 0x04, 0x00, 0xff, 0xd2, 0x09, 0xe5, 0xff, 0x46, 0x0d, 0x00, 0xfe, 0x0b, 0xd2, 0x0a, 0xe5, 0xff, 0x58, 0x04, 0x00, 0xff, 0xd2, 0x09, 0xe5, 0xfe, 0xd2, 0x0b, 0x0c, 0x00, 0xff, 0x72, 0x0b, 0xe5, 0xff, 0x58, 0x04, 0x00, 0x0b, 0xe5, 0xff, 0x72, 0x0b, 0x00, 0xff, 0x17, 0x0c, 0xe5, 0xff, 0x72, 0x03, 0x00, 0xff, 0x0b, 0x0c, 0xe5, 0xff, 0x17, 0x0a, 0x00, 0xff, 0x8c, 0x0c, 0xe5, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x22, 0x0c, 0xe5, 0xff, 0x8c, 0x09, 0x00, 0xff, 0x2e, 0x0d, 0xe5, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x2e, 0x0d, 0xe5, 0xff, 0x2e, 0x08, 0x00, 0xff, 0xb8, 0x0d, 0xe5, 0xff, 0xb8, 0x03, 0x00, 0xff, 0x46, 0x0d, 0xe5, 0xff, 0xb8, 0x07, 0x00, 0xff, 0x58, 0x0f, 0xe5, 0xfc, 0x46, 0x00, 0x0b, 0xb8, 0x0e, 0xe5, 0xff, 0x58, 0x05, 0x00, 0xfe, 0x0b, 0xd2, 0x10, 0xe5, 0xfe, 0xb8, 0xd2, 0x0f, 0xe5, 0xfe, 0xd2, 0x0b, 0x04, 0x00, 0xff, 0x8c, 0x23, 0xe5, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x22, 0x10, 0xe5, 0xfb, 0xd2, 0x58, 0x00, 0x22, 0xa1, 0x10, 0xe5, 0xff, 0x22, 0x02, 0x00, 0xff, 0xa1, 0x10, 0xe5, 0xff, 0x58, 0x03, 0x00, 0xfe, 0x0b, 0xd2, 0x0f, 0xe5, 0xfd, 0xa1, 0x00, 0x2e, 0x11, 0xe5, 0xff, 0x22, 0x04, 0x00, 0xff, 0xa1, 0x10, 0xe5, 0xfe, 0x2e, 0x8c, 0x11, 0xe5, 0xff, 0x58, 0x04, 0x00, 0xff, 0xd2, 0x10, 0xe5, 0xfe, 0x8c, 0xd2, 0x11, 0xe5, 0xfb, 0xd2, 0x2e, 0x00, 0x0b, 0x8c, 0x11, 0xe5, 0xff, 0xd2, 0x14, 0xe5, 0xff, 0xd2, 0x3d, 0xe5, 0xff, 0xa1, 0x27, 0xe5, 0xfe, 0xa1, 0x2e, 0x27, 0xe5, 0xfd, 0x2e, 0x00, 0x58, 0x25, 0xe5, 0xff, 0x58, 0x03, 0x00, 0xfd, 0x17, 0x72, 0xb8, 0x1f, 0xe5, 0xfd, 0xb8, 0x72, 0x17, 0x02, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image warning_1_image = {(void *) &warning_1, 41, 37};
+    0x11, 0x00, 0xf9, 0x17, 0x8c, 0xd2, 0xe5, 0xd2, 0x8c, 0x17, 0x21, 0x00, 0xfe, 0x2e, 0xd2, 0x05, 0xe5, 0xfe, 0xd2, 0x2e, 0x1f, 0x00, 0xfe, 0x22, 0xd2, 0x07, 0xe5, 0xfe, 0xd2, 0x22, 0x1e, 0x00, 0xff, 0xb8, 0x09, 0xe5, 0xff, 0xb8, 0x1d, 0x00, 0xff, 0x58, 0x0b, 0xe5, 0xff, 0x58, 0x1b, 0x00, 0xfe, 0x0b, 0xd2, 0x0b, 0xe5, 0xfe, 0xd2, 0x0b, 0x1a, 0x00, 0xff, 0x72, 0x0d, 0xe5, 0xff, 0x72, 0x19, 0x00, 0xff, 0x22, 0x0f, 0xe5, 0xff, 0x22, 0x18, 0x00, 0xff, 0xa1, 0x0f, 0xe5, 0xff, 0xa1, 0x17, 0x00, 0xff, 0x3a, 0x11, 0xe5, 0xff, 0x3a, 0x16, 0x00, 0xff, 0xb8, 0x07, 0xe5, 0xfc, 0x8c, 0x3a, 0x58, 0xd2, 0x06, 0xe5, 0xff, 0xb8, 0x15, 0x00, 0xff, 0x58, 0x07, 0xe5, 0xff, 0x72, 0x03, 0x00, 0xfe, 0x17, 0xd2, 0x06, 0xe5, 0xff, 0x58, 0x13, 0x00, 0xfe, 0x17, 0xd2, 0x07, 0xe5, 0xff, 0x17, 0x04, 0x00, 0xff, 0xa1, 0x06, 0xe5, 0xfe, 0xd2, 0x17, 0x12, 0x00, 0xff, 0x8c, 0x08, 0xe5, 0xff, 0x17, 0x04, 0x00, 0xff, 0x8c, 0x07, 0xe5, 0xff, 0x8c, 0x11, 0x00, 0xff, 0x2e, 0x09, 0xe5, 0xff, 0x2e, 0x04, 0x00, 0xff, 0xa1, 0x08, 0xe5, 0xff, 0x2e, 0x10, 0x00, 0xff, 0xa1, 0x09, 0xe5, 0xff, 0x3a, 0x04, 0x00, 0xff, 0xb8, 0x08, 0xe5, 0xff, 0xa1, 0x0f, 0x00, 0xff, 0x46, 0x0a, 0xe5, 0xff, 0x46, 0x04, 0x00, 0xff, 0xd2, 0x09, 0xe5, 0xff, 0x46, 0x0d, 0x00, 0xfe, 0x0b, 0xd2, 0x0a, 0xe5, 0xff, 0x58, 0x04, 0x00, 0xff, 0xd2, 0x09, 0xe5, 0xfe, 0xd2, 0x0b, 0x0c, 0x00, 0xff, 0x72, 0x0b, 0xe5, 0xff, 0x58, 0x04, 0x00, 0x0b, 0xe5, 0xff, 0x72, 0x0b, 0x00, 0xff, 0x17, 0x0c, 0xe5, 0xff, 0x72, 0x03, 0x00, 0xff, 0x0b, 0x0c, 0xe5, 0xff, 0x17, 0x0a, 0x00, 0xff, 0x8c, 0x0c, 0xe5, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x22, 0x0c, 0xe5, 0xff, 0x8c, 0x09, 0x00, 0xff, 0x2e, 0x0d, 0xe5, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x2e, 0x0d, 0xe5, 0xff, 0x2e, 0x08, 0x00, 0xff, 0xb8, 0x0d, 0xe5, 0xff, 0xb8, 0x03, 0x00, 0xff, 0x46, 0x0d, 0xe5, 0xff, 0xb8, 0x07, 0x00, 0xff, 0x58, 0x0f, 0xe5, 0xfc, 0x46, 0x00, 0x0b, 0xb8, 0x0e, 0xe5, 0xff, 0x58, 0x05, 0x00, 0xfe, 0x0b, 0xd2, 0x10, 0xe5, 0xfe, 0xb8, 0xd2, 0x0f, 0xe5, 0xfe, 0xd2, 0x0b, 0x04, 0x00, 0xff, 0x8c, 0x23, 0xe5, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x22, 0x10, 0xe5, 0xfb, 0xd2, 0x58, 0x00, 0x22, 0xa1, 0x10, 0xe5, 0xff, 0x22, 0x02, 0x00, 0xff, 0xa1, 0x10, 0xe5, 0xff, 0x58, 0x03, 0x00, 0xfe, 0x0b, 0xd2, 0x0f, 0xe5, 0xfd, 0xa1, 0x00, 0x2e, 0x11, 0xe5, 0xff, 0x22, 0x04, 0x00, 0xff, 0xa1, 0x10, 0xe5, 0xfe, 0x2e, 0x8c, 0x11, 0xe5, 0xff, 0x58, 0x04, 0x00, 0xff, 0xd2, 0x10, 0xe5, 0xfe, 0x8c, 0xd2, 0x11, 0xe5, 0xfb, 0xd2, 0x2e, 0x00, 0x0b, 0x8c, 0x11, 0xe5, 0xff, 0xd2, 0x14, 0xe5, 0xff, 0xd2, 0x3d, 0xe5, 0xff, 0xa1, 0x27, 0xe5, 0xfe, 0xa1, 0x2e, 0x27, 0xe5, 0xfd, 0x2e, 0x00, 0x58, 0x25, 0xe5, 0xff, 0x58, 0x03, 0x00, 0xfd, 0x17, 0x72, 0xb8, 0x1f, 0xe5, 0xfd, 0xb8, 0x72, 0x17, 0x02, 0x00
+};
+static const Image warning_1_image = {warning_1_data, 41, 37};
 
-static void warning_2(uint8_t *data)
+static const uint8_t warning_2_data[455] =
 {
-    const uint8_t image_data[455] =
-    {
-        0x11, 0x00, 0xf9, 0x0b, 0x5c, 0x95, 0xa1, 0x95, 0x5c, 0x0b, 0x21, 0x00, 0xfe, 0x22, 0x95, 0x05, 0xa1, 0xfe, 0x95, 0x22, 0x1f, 0x00, 0xfe, 0x17, 0x95, 0x07, 0xa1, 0xfe, 0x95, 0x17, 0x1e, 0x00, 0xff, 0x84, 0x09, 0xa1, 0xff, 0x84, 0x1d, 0x00, 0xff, 0x3a, 0x0b, 0xa1, 0xff, 0x3a, 0x1b, 0x00, 0xfe, 0x0b, 0x95, 0x0b, 0xa1, 0xfe, 0x95, 0x0b, 0x1a, 0x00, 0xff, 0x53, 0x0d, 0xa1, 0xff, 0x53, 0x19, 0x00, 0xff, 0x17, 0x0f, 0xa1, 0xff, 0x17, 0x18, 0x00, 0xff, 0x72, 0x0f, 0xa1, 0xff, 0x72, 0x17, 0x00, 0xff, 0x2e, 0x11, 0xa1, 0xff, 0x2e, 0x16, 0x00, 0xff, 0x84, 0x07, 0xa1, 0xfc, 0x5c, 0x2e, 0x3a, 0x95, 0x06, 0xa1, 0xff, 0x84, 0x15, 0x00, 0xff, 0x46, 0x07, 0xa1, 0xff, 0x53, 0x03, 0x00, 0xfe, 0x17, 0x95, 0x06, 0xa1, 0xff, 0x46, 0x13, 0x00, 0xfe, 0x0b, 0x95, 0x07, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x06, 0xa1, 0xfe, 0x95, 0x0b, 0x12, 0x00, 0xff, 0x5c, 0x08, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x07, 0xa1, 0xff, 0x5c, 0x11, 0x00, 0xff, 0x22, 0x09, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x08, 0xa1, 0xff, 0x22, 0x10, 0x00, 0xff, 0x72, 0x09, 0xa1, 0xff, 0x22, 0x04, 0x00, 0xff, 0x84, 0x08, 0xa1, 0xff, 0x72, 0x0f, 0x00, 0xff, 0x3a, 0x0a, 0xa1, 0xff, 0x2e, 0x04, 0x00, 0xff, 0x84, 0x09, 0xa1, 0xff, 0x3a, 0x0d, 0x00, 0xfe, 0x0b, 0x84, 0x0a, 0xa1, 0xff, 0x3a, 0x04, 0x00, 0xff, 0x95, 0x09, 0xa1, 0xfe, 0x84, 0x0b, 0x0c, 0x00, 0xff, 0x53, 0x0b, 0xa1, 0xff, 0x46, 0x04, 0x00, 0x0b, 0xa1, 0xff, 0x53, 0x0b, 0x00, 0xfe, 0x17, 0x95, 0x0b, 0xa1, 0xff, 0x53, 0x03, 0x00, 0xff, 0x0b, 0x0b, 0xa1, 0xfe, 0x95, 0x17, 0x0a, 0x00, 0xff, 0x72, 0x0c, 0xa1, 0xff, 0x5c, 0x03, 0x00, 0xff, 0x17, 0x0c, 0xa1, 0xff, 0x72, 0x09, 0x00, 0xff, 0x22, 0x0d, 0xa1, 0xff, 0x72, 0x03, 0x00, 0xff, 0x22, 0x0d, 0xa1, 0xff, 0x22, 0x08, 0x00, 0xff, 0x84, 0x0d, 0xa1, 0xff, 0x72, 0x03, 0x00, 0xff, 0x2e, 0x0d, 0xa1, 0xff, 0x84, 0x07, 0x00, 0xff, 0x3a, 0x0f, 0xa1, 0xfc, 0x2e, 0x00, 0x0b, 0x84, 0x0e, 0xa1, 0xff, 0x3a, 0x05, 0x00, 0xfe, 0x0b, 0x95, 0x10, 0xa1, 0xfe, 0x84, 0x95, 0x0f, 0xa1, 0xfe, 0x95, 0x0b, 0x04, 0x00, 0xff, 0x5c, 0x23, 0xa1, 0xff, 0x5c, 0x03, 0x00, 0xff, 0x17, 0x10, 0xa1, 0xfb, 0x95, 0x3a, 0x00, 0x17, 0x72, 0x10, 0xa1, 0xff, 0x17, 0x02, 0x00, 0xff, 0x72, 0x10, 0xa1, 0xff, 0x46, 0x03, 0x00, 0xfe, 0x0b, 0x95, 0x0f, 0xa1, 0xfd, 0x72, 0x00, 0x22, 0x11, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x10, 0xa1, 0xfe, 0x22, 0x5c, 0x11, 0xa1, 0xff, 0x3a, 0x04, 0x00, 0xff, 0x95, 0x10, 0xa1, 0xfe, 0x5c, 0x95, 0x11, 0xa1, 0xfb, 0x95, 0x22, 0x00, 0x0b, 0x5c, 0x11, 0xa1, 0xff, 0x95, 0x14, 0xa1, 0xff, 0x95, 0x14, 0xa1, 0xff, 0x95, 0x27, 0xa1, 0xfe, 0x95, 0x72, 0x27, 0xa1, 0xfe, 0x72, 0x22, 0x27, 0xa1, 0xfc, 0x22, 0x00, 0x3a, 0x95, 0x23, 0xa1, 0xfe, 0x95, 0x3a, 0x03, 0x00, 0xfd, 0x17, 0x53, 0x84, 0x1f, 0xa1, 0xfd, 0x84, 0x53, 0x17, 0x02, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image warning_2_image = {(void *) &warning_2, 41, 37};
+    0x11, 0x00, 0xf9, 0x0b, 0x5c, 0x95, 0xa1, 0x95, 0x5c, 0x0b, 0x21, 0x00, 0xfe, 0x22, 0x95, 0x05, 0xa1, 0xfe, 0x95, 0x22, 0x1f, 0x00, 0xfe, 0x17, 0x95, 0x07, 0xa1, 0xfe, 0x95, 0x17, 0x1e, 0x00, 0xff, 0x84, 0x09, 0xa1, 0xff, 0x84, 0x1d, 0x00, 0xff, 0x3a, 0x0b, 0xa1, 0xff, 0x3a, 0x1b, 0x00, 0xfe, 0x0b, 0x95, 0x0b, 0xa1, 0xfe, 0x95, 0x0b, 0x1a, 0x00, 0xff, 0x53, 0x0d, 0xa1, 0xff, 0x53, 0x19, 0x00, 0xff, 0x17, 0x0f, 0xa1, 0xff, 0x17, 0x18, 0x00, 0xff, 0x72, 0x0f, 0xa1, 0xff, 0x72, 0x17, 0x00, 0xff, 0x2e, 0x11, 0xa1, 0xff, 0x2e, 0x16, 0x00, 0xff, 0x84, 0x07, 0xa1, 0xfc, 0x5c, 0x2e, 0x3a, 0x95, 0x06, 0xa1, 0xff, 0x84, 0x15, 0x00, 0xff, 0x46, 0x07, 0xa1, 0xff, 0x53, 0x03, 0x00, 0xfe, 0x17, 0x95, 0x06, 0xa1, 0xff, 0x46, 0x13, 0x00, 0xfe, 0x0b, 0x95, 0x07, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x06, 0xa1, 0xfe, 0x95, 0x0b, 0x12, 0x00, 0xff, 0x5c, 0x08, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x07, 0xa1, 0xff, 0x5c, 0x11, 0x00, 0xff, 0x22, 0x09, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x08, 0xa1, 0xff, 0x22, 0x10, 0x00, 0xff, 0x72, 0x09, 0xa1, 0xff, 0x22, 0x04, 0x00, 0xff, 0x84, 0x08, 0xa1, 0xff, 0x72, 0x0f, 0x00, 0xff, 0x3a, 0x0a, 0xa1, 0xff, 0x2e, 0x04, 0x00, 0xff, 0x84, 0x09, 0xa1, 0xff, 0x3a, 0x0d, 0x00, 0xfe, 0x0b, 0x84, 0x0a, 0xa1, 0xff, 0x3a, 0x04, 0x00, 0xff, 0x95, 0x09, 0xa1, 0xfe, 0x84, 0x0b, 0x0c, 0x00, 0xff, 0x53, 0x0b, 0xa1, 0xff, 0x46, 0x04, 0x00, 0x0b, 0xa1, 0xff, 0x53, 0x0b, 0x00, 0xfe, 0x17, 0x95, 0x0b, 0xa1, 0xff, 0x53, 0x03, 0x00, 0xff, 0x0b, 0x0b, 0xa1, 0xfe, 0x95, 0x17, 0x0a, 0x00, 0xff, 0x72, 0x0c, 0xa1, 0xff, 0x5c, 0x03, 0x00, 0xff, 0x17, 0x0c, 0xa1, 0xff, 0x72, 0x09, 0x00, 0xff, 0x22, 0x0d, 0xa1, 0xff, 0x72, 0x03, 0x00, 0xff, 0x22, 0x0d, 0xa1, 0xff, 0x22, 0x08, 0x00, 0xff, 0x84, 0x0d, 0xa1, 0xff, 0x72, 0x03, 0x00, 0xff, 0x2e, 0x0d, 0xa1, 0xff, 0x84, 0x07, 0x00, 0xff, 0x3a, 0x0f, 0xa1, 0xfc, 0x2e, 0x00, 0x0b, 0x84, 0x0e, 0xa1, 0xff, 0x3a, 0x05, 0x00, 0xfe, 0x0b, 0x95, 0x10, 0xa1, 0xfe, 0x84, 0x95, 0x0f, 0xa1, 0xfe, 0x95, 0x0b, 0x04, 0x00, 0xff, 0x5c, 0x23, 0xa1, 0xff, 0x5c, 0x03, 0x00, 0xff, 0x17, 0x10, 0xa1, 0xfb, 0x95, 0x3a, 0x00, 0x17, 0x72, 0x10, 0xa1, 0xff, 0x17, 0x02, 0x00, 0xff, 0x72, 0x10, 0xa1, 0xff, 0x46, 0x03, 0x00, 0xfe, 0x0b, 0x95, 0x0f, 0xa1, 0xfd, 0x72, 0x00, 0x22, 0x11, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x10, 0xa1, 0xfe, 0x22, 0x5c, 0x11, 0xa1, 0xff, 0x3a, 0x04, 0x00, 0xff, 0x95, 0x10, 0xa1, 0xfe, 0x5c, 0x95, 0x11, 0xa1, 0xfb, 0x95, 0x22, 0x00, 0x0b, 0x5c, 0x11, 0xa1, 0xff, 0x95, 0x14, 0xa1, 0xff, 0x95, 0x14, 0xa1, 0xff, 0x95, 0x27, 0xa1, 0xfe, 0x95, 0x72, 0x27, 0xa1, 0xfe, 0x72, 0x22, 0x27, 0xa1, 0xfc, 0x22, 0x00, 0x3a, 0x95, 0x23, 0xa1, 0xfe, 0x95, 0x3a, 0x03, 0x00, 0xfd, 0x17, 0x53, 0x84, 0x1f, 0xa1, 0xfd, 0x84, 0x53, 0x17, 0x02, 0x00
+};
+static const Image warning_2_image = {warning_2_data, 41, 37};
 
-static void warning_3(uint8_t *data)
+static const uint8_t warning_3_data[437] =
 {
-    const uint8_t image_data[437] =
-    {
-        0x11, 0x00, 0xf9, 0x0b, 0x3a, 0x53, 0x5c, 0x53, 0x3a, 0x0b, 0x21, 0x00, 0xfe, 0x17, 0x53, 0x05, 0x5c, 0xfe, 0x53, 0x17, 0x1f, 0x00, 0xfe, 0x0b, 0x53, 0x07, 0x5c, 0xfe, 0x53, 0x0b, 0x1e, 0x00, 0xff, 0x46, 0x09, 0x5c, 0xff, 0x46, 0x1d, 0x00, 0xff, 0x22, 0x0b, 0x5c, 0xff, 0x22, 0x1c, 0x00, 0xff, 0x53, 0x0b, 0x5c, 0xff, 0x53, 0x1b, 0x00, 0xff, 0x2e, 0x0d, 0x5c, 0xff, 0x2e, 0x19, 0x00, 0xff, 0x0b, 0x0f, 0x5c, 0xff, 0x0b, 0x18, 0x00, 0xff, 0x3a, 0x0f, 0x5c, 0xff, 0x3a, 0x17, 0x00, 0xff, 0x17, 0x11, 0x5c, 0xff, 0x17, 0x16, 0x00, 0xff, 0x46, 0x07, 0x5c, 0xfc, 0x3a, 0x17, 0x22, 0x53, 0x06, 0x5c, 0xff, 0x46, 0x15, 0x00, 0xff, 0x22, 0x07, 0x5c, 0xff, 0x2e, 0x03, 0x00, 0xff, 0x0b, 0x07, 0x5c, 0xff, 0x22, 0x13, 0x00, 0xfe, 0x0b, 0x53, 0x07, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x3a, 0x06, 0x5c, 0xfe, 0x53, 0x0b, 0x12, 0x00, 0xff, 0x3a, 0x08, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x3a, 0x07, 0x5c, 0xff, 0x3a, 0x11, 0x00, 0xff, 0x0b, 0x09, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x46, 0x08, 0x5c, 0xff, 0x0b, 0x10, 0x00, 0xff, 0x46, 0x09, 0x5c, 0xff, 0x17, 0x04, 0x00, 0xff, 0x46, 0x08, 0x5c, 0xff, 0x46, 0x0f, 0x00, 0xff, 0x22, 0x0a, 0x5c, 0xff, 0x17, 0x04, 0x00, 0xff, 0x53, 0x09, 0x5c, 0xff, 0x22, 0x0e, 0x00, 0xff, 0x53, 0x0a, 0x5c, 0xff, 0x22, 0x04, 0x00, 0xff, 0x53, 0x09, 0x5c, 0xff, 0x53, 0x0d, 0x00, 0xff, 0x2e, 0x0b, 0x5c, 0xff, 0x2e, 0x04, 0x00, 0x0b, 0x5c, 0xff, 0x2e, 0x0b, 0x00, 0xff, 0x0b, 0x0c, 0x5c, 0xff, 0x2e, 0x04, 0x00, 0x0c, 0x5c, 0xff, 0x0b, 0x0a, 0x00, 0xff, 0x3a, 0x0c, 0x5c, 0xff, 0x3a, 0x03, 0x00, 0xff, 0x0b, 0x0c, 0x5c, 0xff, 0x3a, 0x09, 0x00, 0xff, 0x17, 0x0d, 0x5c, 0xff, 0x3a, 0x03, 0x00, 0xff, 0x17, 0x0d, 0x5c, 0xff, 0x17, 0x08, 0x00, 0xff, 0x46, 0x0d, 0x5c, 0xff, 0x46, 0x03, 0x00, 0xff, 0x17, 0x0d, 0x5c, 0xff, 0x46, 0x07, 0x00, 0xff, 0x22, 0x0f, 0x5c, 0xff, 0x17, 0x02, 0x00, 0xff, 0x46, 0x0e, 0x5c, 0xff, 0x22, 0x06, 0x00, 0xff, 0x53, 0x10, 0x5c, 0x02, 0x53, 0x0f, 0x5c, 0xff, 0x53, 0x05, 0x00, 0xff, 0x2e, 0x23, 0x5c, 0xff, 0x2e, 0x03, 0x00, 0xff, 0x0b, 0x10, 0x5c, 0xfb, 0x53, 0x22, 0x00, 0x0b, 0x46, 0x10, 0x5c, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x46, 0x10, 0x5c, 0xff, 0x22, 0x04, 0x00, 0xff, 0x53, 0x0f, 0x5c, 0xfd, 0x46, 0x00, 0x17, 0x11, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x46, 0x10, 0x5c, 0xfe, 0x17, 0x3a, 0x11, 0x5c, 0xff, 0x22, 0x04, 0x00, 0xff, 0x53, 0x10, 0x5c, 0xfe, 0x3a, 0x53, 0x11, 0x5c, 0xfe, 0x53, 0x17, 0x02, 0x00, 0xff, 0x3a, 0x11, 0x5c, 0xff, 0x53, 0x14, 0x5c, 0xff, 0x53, 0x3d, 0x5c, 0xff, 0x46, 0x27, 0x5c, 0xfe, 0x46, 0x17, 0x27, 0x5c, 0xfd, 0x17, 0x00, 0x22, 0x25, 0x5c, 0xff, 0x22, 0x03, 0x00, 0xfd, 0x0b, 0x2e, 0x46, 0x1f, 0x5c, 0xfd, 0x46, 0x2e, 0x0b, 0x02, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image warning_3_image = {(void *) &warning_3, 41, 37};
+    0x11, 0x00, 0xf9, 0x0b, 0x3a, 0x53, 0x5c, 0x53, 0x3a, 0x0b, 0x21, 0x00, 0xfe, 0x17, 0x53, 0x05, 0x5c, 0xfe, 0x53, 0x17, 0x1f, 0x00, 0xfe, 0x0b, 0x53, 0x07, 0x5c, 0xfe, 0x53, 0x0b, 0x1e, 0x00, 0xff, 0x46, 0x09, 0x5c, 0xff, 0x46, 0x1d, 0x00, 0xff, 0x22, 0x0b, 0x5c, 0xff, 0x22, 0x1c, 0x00, 0xff, 0x53, 0x0b, 0x5c, 0xff, 0x53, 0x1b, 0x00, 0xff, 0x2e, 0x0d, 0x5c, 0xff, 0x2e, 0x19, 0x00, 0xff, 0x0b, 0x0f, 0x5c, 0xff, 0x0b, 0x18, 0x00, 0xff, 0x3a, 0x0f, 0x5c, 0xff, 0x3a, 0x17, 0x00, 0xff, 0x17, 0x11, 0x5c, 0xff, 0x17, 0x16, 0x00, 0xff, 0x46, 0x07, 0x5c, 0xfc, 0x3a, 0x17, 0x22, 0x53, 0x06, 0x5c, 0xff, 0x46, 0x15, 0x00, 0xff, 0x22, 0x07, 0x5c, 0xff, 0x2e, 0x03, 0x00, 0xff, 0x0b, 0x07, 0x5c, 0xff, 0x22, 0x13, 0x00, 0xfe, 0x0b, 0x53, 0x07, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x3a, 0x06, 0x5c, 0xfe, 0x53, 0x0b, 0x12, 0x00, 0xff, 0x3a, 0x08, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x3a, 0x07, 0x5c, 0xff, 0x3a, 0x11, 0x00, 0xff, 0x0b, 0x09, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x46, 0x08, 0x5c, 0xff, 0x0b, 0x10, 0x00, 0xff, 0x46, 0x09, 0x5c, 0xff, 0x17, 0x04, 0x00, 0xff, 0x46, 0x08, 0x5c, 0xff, 0x46, 0x0f, 0x00, 0xff, 0x22, 0x0a, 0x5c, 0xff, 0x17, 0x04, 0x00, 0xff, 0x53, 0x09, 0x5c, 0xff, 0x22, 0x0e, 0x00, 0xff, 0x53, 0x0a, 0x5c, 0xff, 0x22, 0x04, 0x00, 0xff, 0x53, 0x09, 0x5c, 0xff, 0x53, 0x0d, 0x00, 0xff, 0x2e, 0x0b, 0x5c, 0xff, 0x2e, 0x04, 0x00, 0x0b, 0x5c, 0xff, 0x2e, 0x0b, 0x00, 0xff, 0x0b, 0x0c, 0x5c, 0xff, 0x2e, 0x04, 0x00, 0x0c, 0x5c, 0xff, 0x0b, 0x0a, 0x00, 0xff, 0x3a, 0x0c, 0x5c, 0xff, 0x3a, 0x03, 0x00, 0xff, 0x0b, 0x0c, 0x5c, 0xff, 0x3a, 0x09, 0x00, 0xff, 0x17, 0x0d, 0x5c, 0xff, 0x3a, 0x03, 0x00, 0xff, 0x17, 0x0d, 0x5c, 0xff, 0x17, 0x08, 0x00, 0xff, 0x46, 0x0d, 0x5c, 0xff, 0x46, 0x03, 0x00, 0xff, 0x17, 0x0d, 0x5c, 0xff, 0x46, 0x07, 0x00, 0xff, 0x22, 0x0f, 0x5c, 0xff, 0x17, 0x02, 0x00, 0xff, 0x46, 0x0e, 0x5c, 0xff, 0x22, 0x06, 0x00, 0xff, 0x53, 0x10, 0x5c, 0x02, 0x53, 0x0f, 0x5c, 0xff, 0x53, 0x05, 0x00, 0xff, 0x2e, 0x23, 0x5c, 0xff, 0x2e, 0x03, 0x00, 0xff, 0x0b, 0x10, 0x5c, 0xfb, 0x53, 0x22, 0x00, 0x0b, 0x46, 0x10, 0x5c, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x46, 0x10, 0x5c, 0xff, 0x22, 0x04, 0x00, 0xff, 0x53, 0x0f, 0x5c, 0xfd, 0x46, 0x00, 0x17, 0x11, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x46, 0x10, 0x5c, 0xfe, 0x17, 0x3a, 0x11, 0x5c, 0xff, 0x22, 0x04, 0x00, 0xff, 0x53, 0x10, 0x5c, 0xfe, 0x3a, 0x53, 0x11, 0x5c, 0xfe, 0x53, 0x17, 0x02, 0x00, 0xff, 0x3a, 0x11, 0x5c, 0xff, 0x53, 0x14, 0x5c, 0xff, 0x53, 0x3d, 0x5c, 0xff, 0x46, 0x27, 0x5c, 0xfe, 0x46, 0x17, 0x27, 0x5c, 0xfd, 0x17, 0x00, 0x22, 0x25, 0x5c, 0xff, 0x22, 0x03, 0x00, 0xfd, 0x0b, 0x2e, 0x46, 0x1f, 0x5c, 0xfd, 0x46, 0x2e, 0x0b, 0x02, 0x00
+};
+static const Image warning_3_image = {warning_3_data, 41, 37};
 
-static void warning_4(uint8_t *data)
+static const uint8_t warning_4_data[383] =
 {
-    const uint8_t image_data[383] =
-    {
-        0x12, 0x00, 0xff, 0x17, 0x03, 0x2e, 0xff, 0x17, 0x22, 0x00, 0xff, 0x0b, 0x07, 0x2e, 0xff, 0x0b, 0x1f, 0x00, 0xff, 0x0b, 0x09, 0x2e, 0xff, 0x0b, 0x1e, 0x00, 0xff, 0x22, 0x09, 0x2e, 0xff, 0x22, 0x1d, 0x00, 0xff, 0x17, 0x0b, 0x2e, 0xff, 0x17, 0x1c, 0x00, 0x0d, 0x2e, 0x1b, 0x00, 0xff, 0x17, 0x0d, 0x2e, 0xff, 0x17, 0x19, 0x00, 0xff, 0x0b, 0x0f, 0x2e, 0xff, 0x0b, 0x18, 0x00, 0xff, 0x22, 0x0f, 0x2e, 0xff, 0x22, 0x17, 0x00, 0xff, 0x0b, 0x11, 0x2e, 0xff, 0x0b, 0x16, 0x00, 0xff, 0x22, 0x07, 0x2e, 0xfd, 0x17, 0x0b, 0x17, 0x07, 0x2e, 0xff, 0x22, 0x15, 0x00, 0xff, 0x17, 0x07, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x07, 0x2e, 0xff, 0x17, 0x14, 0x00, 0x08, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x07, 0x2e, 0x13, 0x00, 0xff, 0x17, 0x08, 0x2e, 0x05, 0x00, 0xff, 0x22, 0x07, 0x2e, 0xff, 0x17, 0x11, 0x00, 0xff, 0x0b, 0x09, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x08, 0x2e, 0xff, 0x0b, 0x10, 0x00, 0xff, 0x22, 0x09, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x08, 0x2e, 0xff, 0x22, 0x0f, 0x00, 0xff, 0x0b, 0x0a, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0x0a, 0x2e, 0xff, 0x0b, 0x0e, 0x00, 0x0b, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x0b, 0x2e, 0x0d, 0x00, 0xff, 0x17, 0x0b, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x0b, 0x2e, 0xff, 0x17, 0x0c, 0x00, 0x0c, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x0c, 0x2e, 0x0b, 0x00, 0xff, 0x22, 0x0c, 0x2e, 0xff, 0x17, 0x03, 0x00, 0xff, 0x0b, 0x0c, 0x2e, 0xff, 0x22, 0x09, 0x00, 0xff, 0x0b, 0x0d, 0x2e, 0xff, 0x22, 0x03, 0x00, 0xff, 0x0b, 0x0d, 0x2e, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x22, 0x0d, 0x2e, 0xff, 0x22, 0x03, 0x00, 0xff, 0x0b, 0x0d, 0x2e, 0xff, 0x22, 0x07, 0x00, 0xff, 0x17, 0x0f, 0x2e, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x22, 0x0e, 0x2e, 0xff, 0x17, 0x06, 0x00, 0x11, 0x2e, 0xff, 0x22, 0x11, 0x2e, 0x05, 0x00, 0xff, 0x17, 0x23, 0x2e, 0xff, 0x17, 0x03, 0x00, 0xff, 0x0b, 0x11, 0x2e, 0xfc, 0x0b, 0x00, 0x0b, 0x22, 0x10, 0x2e, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x22, 0x10, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x10, 0x2e, 0xfd, 0x22, 0x00, 0x0b, 0x11, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x10, 0x2e, 0xfe, 0x0b, 0x22, 0x11, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0x11, 0x2e, 0xff, 0x22, 0x13, 0x2e, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x22, 0x64, 0x2e, 0xff, 0x22, 0x27, 0x2e, 0xfe, 0x22, 0x0b, 0x27, 0x2e, 0xfd, 0x0b, 0x00, 0x0b, 0x25, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xfe, 0x17, 0x22, 0x1f, 0x2e, 0xfe, 0x22, 0x17, 0x03, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image warning_4_image = {(void *) &warning_4, 41, 37};
+    0x12, 0x00, 0xff, 0x17, 0x03, 0x2e, 0xff, 0x17, 0x22, 0x00, 0xff, 0x0b, 0x07, 0x2e, 0xff, 0x0b, 0x1f, 0x00, 0xff, 0x0b, 0x09, 0x2e, 0xff, 0x0b, 0x1e, 0x00, 0xff, 0x22, 0x09, 0x2e, 0xff, 0x22, 0x1d, 0x00, 0xff, 0x17, 0x0b, 0x2e, 0xff, 0x17, 0x1c, 0x00, 0x0d, 0x2e, 0x1b, 0x00, 0xff, 0x17, 0x0d, 0x2e, 0xff, 0x17, 0x19, 0x00, 0xff, 0x0b, 0x0f, 0x2e, 0xff, 0x0b, 0x18, 0x00, 0xff, 0x22, 0x0f, 0x2e, 0xff, 0x22, 0x17, 0x00, 0xff, 0x0b, 0x11, 0x2e, 0xff, 0x0b, 0x16, 0x00, 0xff, 0x22, 0x07, 0x2e, 0xfd, 0x17, 0x0b, 0x17, 0x07, 0x2e, 0xff, 0x22, 0x15, 0x00, 0xff, 0x17, 0x07, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x07, 0x2e, 0xff, 0x17, 0x14, 0x00, 0x08, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x07, 0x2e, 0x13, 0x00, 0xff, 0x17, 0x08, 0x2e, 0x05, 0x00, 0xff, 0x22, 0x07, 0x2e, 0xff, 0x17, 0x11, 0x00, 0xff, 0x0b, 0x09, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x08, 0x2e, 0xff, 0x0b, 0x10, 0x00, 0xff, 0x22, 0x09, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x08, 0x2e, 0xff, 0x22, 0x0f, 0x00, 0xff, 0x0b, 0x0a, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0x0a, 0x2e, 0xff, 0x0b, 0x0e, 0x00, 0x0b, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x0b, 0x2e, 0x0d, 0x00, 0xff, 0x17, 0x0b, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x0b, 0x2e, 0xff, 0x17, 0x0c, 0x00, 0x0c, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x0c, 0x2e, 0x0b, 0x00, 0xff, 0x22, 0x0c, 0x2e, 0xff, 0x17, 0x03, 0x00, 0xff, 0x0b, 0x0c, 0x2e, 0xff, 0x22, 0x09, 0x00, 0xff, 0x0b, 0x0d, 0x2e, 0xff, 0x22, 0x03, 0x00, 0xff, 0x0b, 0x0d, 0x2e, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x22, 0x0d, 0x2e, 0xff, 0x22, 0x03, 0x00, 0xff, 0x0b, 0x0d, 0x2e, 0xff, 0x22, 0x07, 0x00, 0xff, 0x17, 0x0f, 0x2e, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x22, 0x0e, 0x2e, 0xff, 0x17, 0x06, 0x00, 0x11, 0x2e, 0xff, 0x22, 0x11, 0x2e, 0x05, 0x00, 0xff, 0x17, 0x23, 0x2e, 0xff, 0x17, 0x03, 0x00, 0xff, 0x0b, 0x11, 0x2e, 0xfc, 0x0b, 0x00, 0x0b, 0x22, 0x10, 0x2e, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x22, 0x10, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x10, 0x2e, 0xfd, 0x22, 0x00, 0x0b, 0x11, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x10, 0x2e, 0xfe, 0x0b, 0x22, 0x11, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0x11, 0x2e, 0xff, 0x22, 0x13, 0x2e, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x22, 0x64, 0x2e, 0xff, 0x22, 0x27, 0x2e, 0xfe, 0x22, 0x0b, 0x27, 0x2e, 0xfd, 0x0b, 0x00, 0x0b, 0x25, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xfe, 0x17, 0x22, 0x1f, 0x2e, 0xfe, 0x22, 0x17, 0x03, 0x00
+};
+static const Image warning_4_image = {warning_4_data, 41, 37};
 
-static void warning_5(uint8_t *data)
+static const uint8_t warning_5_data[305] =
 {
-    const uint8_t image_data[305] =
-    {
-        0x12, 0x00, 0xff, 0x0b, 0x03, 0x17, 0xff, 0x0b, 0x23, 0x00, 0x07, 0x17, 0x21, 0x00, 0x09, 0x17, 0x1f, 0x00, 0x0b, 0x17, 0x1d, 0x00, 0xff, 0x0b, 0x0b, 0x17, 0xff, 0x0b, 0x1c, 0x00, 0x0d, 0x17, 0x1b, 0x00, 0xff, 0x0b, 0x0d, 0x17, 0xff, 0x0b, 0x1a, 0x00, 0x0f, 0x17, 0x19, 0x00, 0xff, 0x0b, 0x0f, 0x17, 0xff, 0x0b, 0x17, 0x00, 0xff, 0x0b, 0x11, 0x17, 0xff, 0x0b, 0x16, 0x00, 0x08, 0x17, 0x03, 0x0b, 0x08, 0x17, 0x15, 0x00, 0xff, 0x0b, 0x07, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x07, 0x17, 0xff, 0x0b, 0x14, 0x00, 0x08, 0x17, 0x05, 0x00, 0xff, 0x0b, 0x07, 0x17, 0x13, 0x00, 0xff, 0x0b, 0x08, 0x17, 0x05, 0x00, 0xff, 0x0b, 0x07, 0x17, 0xff, 0x0b, 0x12, 0x00, 0x09, 0x17, 0x05, 0x00, 0x09, 0x17, 0x11, 0x00, 0x0a, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0a, 0x17, 0x0f, 0x00, 0xff, 0x0b, 0x0a, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0a, 0x17, 0xff, 0x0b, 0x0e, 0x00, 0x0b, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0b, 0x17, 0x0d, 0x00, 0xff, 0x0b, 0x0b, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0b, 0x17, 0xff, 0x0b, 0x0c, 0x00, 0x0c, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0c, 0x17, 0x0b, 0x00, 0xff, 0x0b, 0x0c, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0c, 0x17, 0xff, 0x0b, 0x0a, 0x00, 0x0d, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0d, 0x17, 0x09, 0x00, 0x0f, 0x17, 0x03, 0x00, 0xff, 0x0b, 0x0e, 0x17, 0x07, 0x00, 0xff, 0x0b, 0x0f, 0x17, 0xff, 0x0b, 0x02, 0x00, 0x0f, 0x17, 0xff, 0x0b, 0x06, 0x00, 0x23, 0x17, 0x05, 0x00, 0xff, 0x0b, 0x23, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x11, 0x17, 0xff, 0x0b, 0x02, 0x00, 0x11, 0x17, 0x03, 0x00, 0x11, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x11, 0x17, 0x02, 0x00, 0x11, 0x17, 0x05, 0x00, 0x11, 0x17, 0xfe, 0x00, 0x0b, 0x11, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x11, 0x17, 0xff, 0x0b, 0x13, 0x17, 0x03, 0x00, 0xff, 0x0b, 0x7f, 0x17, 0x0e, 0x17, 0xff, 0x00, 0x27, 0x17, 0x02, 0x00, 0xff, 0x0b, 0x25, 0x17, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x0b, 0x21, 0x17, 0xff, 0x0b, 0x03, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image warning_5_image = {(void *) &warning_5, 41, 37};
+    0x12, 0x00, 0xff, 0x0b, 0x03, 0x17, 0xff, 0x0b, 0x23, 0x00, 0x07, 0x17, 0x21, 0x00, 0x09, 0x17, 0x1f, 0x00, 0x0b, 0x17, 0x1d, 0x00, 0xff, 0x0b, 0x0b, 0x17, 0xff, 0x0b, 0x1c, 0x00, 0x0d, 0x17, 0x1b, 0x00, 0xff, 0x0b, 0x0d, 0x17, 0xff, 0x0b, 0x1a, 0x00, 0x0f, 0x17, 0x19, 0x00, 0xff, 0x0b, 0x0f, 0x17, 0xff, 0x0b, 0x17, 0x00, 0xff, 0x0b, 0x11, 0x17, 0xff, 0x0b, 0x16, 0x00, 0x08, 0x17, 0x03, 0x0b, 0x08, 0x17, 0x15, 0x00, 0xff, 0x0b, 0x07, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x07, 0x17, 0xff, 0x0b, 0x14, 0x00, 0x08, 0x17, 0x05, 0x00, 0xff, 0x0b, 0x07, 0x17, 0x13, 0x00, 0xff, 0x0b, 0x08, 0x17, 0x05, 0x00, 0xff, 0x0b, 0x07, 0x17, 0xff, 0x0b, 0x12, 0x00, 0x09, 0x17, 0x05, 0x00, 0x09, 0x17, 0x11, 0x00, 0x0a, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0a, 0x17, 0x0f, 0x00, 0xff, 0x0b, 0x0a, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0a, 0x17, 0xff, 0x0b, 0x0e, 0x00, 0x0b, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0b, 0x17, 0x0d, 0x00, 0xff, 0x0b, 0x0b, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0b, 0x17, 0xff, 0x0b, 0x0c, 0x00, 0x0c, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0c, 0x17, 0x0b, 0x00, 0xff, 0x0b, 0x0c, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0c, 0x17, 0xff, 0x0b, 0x0a, 0x00, 0x0d, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x0d, 0x17, 0x09, 0x00, 0x0f, 0x17, 0x03, 0x00, 0xff, 0x0b, 0x0e, 0x17, 0x07, 0x00, 0xff, 0x0b, 0x0f, 0x17, 0xff, 0x0b, 0x02, 0x00, 0x0f, 0x17, 0xff, 0x0b, 0x06, 0x00, 0x23, 0x17, 0x05, 0x00, 0xff, 0x0b, 0x23, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x11, 0x17, 0xff, 0x0b, 0x02, 0x00, 0x11, 0x17, 0x03, 0x00, 0x11, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x11, 0x17, 0x02, 0x00, 0x11, 0x17, 0x05, 0x00, 0x11, 0x17, 0xfe, 0x00, 0x0b, 0x11, 0x17, 0xff, 0x0b, 0x04, 0x00, 0x11, 0x17, 0xff, 0x0b, 0x13, 0x17, 0x03, 0x00, 0xff, 0x0b, 0x7f, 0x17, 0x0e, 0x17, 0xff, 0x00, 0x27, 0x17, 0x02, 0x00, 0xff, 0x0b, 0x25, 0x17, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x0b, 0x21, 0x17, 0xff, 0x0b, 0x03, 0x00
+};
+static const Image warning_5_image = {warning_5_data, 41, 37};
 
-static void warning_6(uint8_t *data)
+static const uint8_t warning_6_data[383] =
 {
-    const uint8_t image_data[383] =
-    {
-        0x12, 0x00, 0xff, 0x17, 0x03, 0x2e, 0xff, 0x17, 0x22, 0x00, 0xff, 0x0b, 0x07, 0x2e, 0xff, 0x0b, 0x1f, 0x00, 0xff, 0x0b, 0x09, 0x2e, 0xff, 0x0b, 0x1e, 0x00, 0xff, 0x22, 0x09, 0x2e, 0xff, 0x22, 0x1d, 0x00, 0xff, 0x17, 0x0b, 0x2e, 0xff, 0x17, 0x1c, 0x00, 0x0d, 0x2e, 0x1b, 0x00, 0xff, 0x17, 0x0d, 0x2e, 0xff, 0x17, 0x19, 0x00, 0xff, 0x0b, 0x0f, 0x2e, 0xff, 0x0b, 0x18, 0x00, 0xff, 0x22, 0x0f, 0x2e, 0xff, 0x22, 0x17, 0x00, 0xff, 0x0b, 0x11, 0x2e, 0xff, 0x0b, 0x16, 0x00, 0xff, 0x22, 0x07, 0x2e, 0xfd, 0x17, 0x0b, 0x17, 0x07, 0x2e, 0xff, 0x22, 0x15, 0x00, 0xff, 0x17, 0x07, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x07, 0x2e, 0xff, 0x17, 0x14, 0x00, 0x08, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x07, 0x2e, 0x13, 0x00, 0xff, 0x17, 0x08, 0x2e, 0x05, 0x00, 0xff, 0x22, 0x07, 0x2e, 0xff, 0x17, 0x11, 0x00, 0xff, 0x0b, 0x09, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x08, 0x2e, 0xff, 0x0b, 0x10, 0x00, 0xff, 0x22, 0x09, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x08, 0x2e, 0xff, 0x22, 0x0f, 0x00, 0xff, 0x0b, 0x0a, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0x0a, 0x2e, 0xff, 0x0b, 0x0e, 0x00, 0x0b, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x0b, 0x2e, 0x0d, 0x00, 0xff, 0x17, 0x0b, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x0b, 0x2e, 0xff, 0x17, 0x0c, 0x00, 0x0c, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x0c, 0x2e, 0x0b, 0x00, 0xff, 0x22, 0x0c, 0x2e, 0xff, 0x17, 0x03, 0x00, 0xff, 0x0b, 0x0c, 0x2e, 0xff, 0x22, 0x09, 0x00, 0xff, 0x0b, 0x0d, 0x2e, 0xff, 0x22, 0x03, 0x00, 0xff, 0x0b, 0x0d, 0x2e, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x22, 0x0d, 0x2e, 0xff, 0x22, 0x03, 0x00, 0xff, 0x0b, 0x0d, 0x2e, 0xff, 0x22, 0x07, 0x00, 0xff, 0x17, 0x0f, 0x2e, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x22, 0x0e, 0x2e, 0xff, 0x17, 0x06, 0x00, 0x11, 0x2e, 0xff, 0x22, 0x11, 0x2e, 0x05, 0x00, 0xff, 0x17, 0x23, 0x2e, 0xff, 0x17, 0x03, 0x00, 0xff, 0x0b, 0x11, 0x2e, 0xfc, 0x0b, 0x00, 0x0b, 0x22, 0x10, 0x2e, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x22, 0x10, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x10, 0x2e, 0xfd, 0x22, 0x00, 0x0b, 0x11, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x10, 0x2e, 0xfe, 0x0b, 0x22, 0x11, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0x11, 0x2e, 0xff, 0x22, 0x13, 0x2e, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x22, 0x64, 0x2e, 0xff, 0x22, 0x27, 0x2e, 0xfe, 0x22, 0x0b, 0x27, 0x2e, 0xfd, 0x0b, 0x00, 0x0b, 0x25, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xfe, 0x17, 0x22, 0x1f, 0x2e, 0xfe, 0x22, 0x17, 0x03, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image warning_6_image = {(void *) &warning_6, 41, 37};
+    0x12, 0x00, 0xff, 0x17, 0x03, 0x2e, 0xff, 0x17, 0x22, 0x00, 0xff, 0x0b, 0x07, 0x2e, 0xff, 0x0b, 0x1f, 0x00, 0xff, 0x0b, 0x09, 0x2e, 0xff, 0x0b, 0x1e, 0x00, 0xff, 0x22, 0x09, 0x2e, 0xff, 0x22, 0x1d, 0x00, 0xff, 0x17, 0x0b, 0x2e, 0xff, 0x17, 0x1c, 0x00, 0x0d, 0x2e, 0x1b, 0x00, 0xff, 0x17, 0x0d, 0x2e, 0xff, 0x17, 0x19, 0x00, 0xff, 0x0b, 0x0f, 0x2e, 0xff, 0x0b, 0x18, 0x00, 0xff, 0x22, 0x0f, 0x2e, 0xff, 0x22, 0x17, 0x00, 0xff, 0x0b, 0x11, 0x2e, 0xff, 0x0b, 0x16, 0x00, 0xff, 0x22, 0x07, 0x2e, 0xfd, 0x17, 0x0b, 0x17, 0x07, 0x2e, 0xff, 0x22, 0x15, 0x00, 0xff, 0x17, 0x07, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x07, 0x2e, 0xff, 0x17, 0x14, 0x00, 0x08, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x07, 0x2e, 0x13, 0x00, 0xff, 0x17, 0x08, 0x2e, 0x05, 0x00, 0xff, 0x22, 0x07, 0x2e, 0xff, 0x17, 0x11, 0x00, 0xff, 0x0b, 0x09, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x08, 0x2e, 0xff, 0x0b, 0x10, 0x00, 0xff, 0x22, 0x09, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x08, 0x2e, 0xff, 0x22, 0x0f, 0x00, 0xff, 0x0b, 0x0a, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0x0a, 0x2e, 0xff, 0x0b, 0x0e, 0x00, 0x0b, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x0b, 0x2e, 0x0d, 0x00, 0xff, 0x17, 0x0b, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x0b, 0x2e, 0xff, 0x17, 0x0c, 0x00, 0x0c, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x0c, 0x2e, 0x0b, 0x00, 0xff, 0x22, 0x0c, 0x2e, 0xff, 0x17, 0x03, 0x00, 0xff, 0x0b, 0x0c, 0x2e, 0xff, 0x22, 0x09, 0x00, 0xff, 0x0b, 0x0d, 0x2e, 0xff, 0x22, 0x03, 0x00, 0xff, 0x0b, 0x0d, 0x2e, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x22, 0x0d, 0x2e, 0xff, 0x22, 0x03, 0x00, 0xff, 0x0b, 0x0d, 0x2e, 0xff, 0x22, 0x07, 0x00, 0xff, 0x17, 0x0f, 0x2e, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x22, 0x0e, 0x2e, 0xff, 0x17, 0x06, 0x00, 0x11, 0x2e, 0xff, 0x22, 0x11, 0x2e, 0x05, 0x00, 0xff, 0x17, 0x23, 0x2e, 0xff, 0x17, 0x03, 0x00, 0xff, 0x0b, 0x11, 0x2e, 0xfc, 0x0b, 0x00, 0x0b, 0x22, 0x10, 0x2e, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x22, 0x10, 0x2e, 0xff, 0x17, 0x04, 0x00, 0x10, 0x2e, 0xfd, 0x22, 0x00, 0x0b, 0x11, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x22, 0x10, 0x2e, 0xfe, 0x0b, 0x22, 0x11, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0x11, 0x2e, 0xff, 0x22, 0x13, 0x2e, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x22, 0x64, 0x2e, 0xff, 0x22, 0x27, 0x2e, 0xfe, 0x22, 0x0b, 0x27, 0x2e, 0xfd, 0x0b, 0x00, 0x0b, 0x25, 0x2e, 0xff, 0x0b, 0x04, 0x00, 0xfe, 0x17, 0x22, 0x1f, 0x2e, 0xfe, 0x22, 0x17, 0x03, 0x00
+};
+static const Image warning_6_image = {warning_6_data, 41, 37};
 
-static void warning_7(uint8_t *data)
+static const uint8_t warning_7_data[437] =
 {
-    const uint8_t image_data[437] =
-    {
-        0x11, 0x00, 0xf9, 0x0b, 0x3a, 0x53, 0x5c, 0x53, 0x3a, 0x0b, 0x21, 0x00, 0xfe, 0x17, 0x53, 0x05, 0x5c, 0xfe, 0x53, 0x17, 0x1f, 0x00, 0xfe, 0x0b, 0x53, 0x07, 0x5c, 0xfe, 0x53, 0x0b, 0x1e, 0x00, 0xff, 0x46, 0x09, 0x5c, 0xff, 0x46, 0x1d, 0x00, 0xff, 0x22, 0x0b, 0x5c, 0xff, 0x22, 0x1c, 0x00, 0xff, 0x53, 0x0b, 0x5c, 0xff, 0x53, 0x1b, 0x00, 0xff, 0x2e, 0x0d, 0x5c, 0xff, 0x2e, 0x19, 0x00, 0xff, 0x0b, 0x0f, 0x5c, 0xff, 0x0b, 0x18, 0x00, 0xff, 0x3a, 0x0f, 0x5c, 0xff, 0x3a, 0x17, 0x00, 0xff, 0x17, 0x11, 0x5c, 0xff, 0x17, 0x16, 0x00, 0xff, 0x46, 0x07, 0x5c, 0xfc, 0x3a, 0x17, 0x22, 0x53, 0x06, 0x5c, 0xff, 0x46, 0x15, 0x00, 0xff, 0x22, 0x07, 0x5c, 0xff, 0x2e, 0x03, 0x00, 0xff, 0x0b, 0x07, 0x5c, 0xff, 0x22, 0x13, 0x00, 0xfe, 0x0b, 0x53, 0x07, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x3a, 0x06, 0x5c, 0xfe, 0x53, 0x0b, 0x12, 0x00, 0xff, 0x3a, 0x08, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x3a, 0x07, 0x5c, 0xff, 0x3a, 0x11, 0x00, 0xff, 0x0b, 0x09, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x46, 0x08, 0x5c, 0xff, 0x0b, 0x10, 0x00, 0xff, 0x46, 0x09, 0x5c, 0xff, 0x17, 0x04, 0x00, 0xff, 0x46, 0x08, 0x5c, 0xff, 0x46, 0x0f, 0x00, 0xff, 0x22, 0x0a, 0x5c, 0xff, 0x17, 0x04, 0x00, 0xff, 0x53, 0x09, 0x5c, 0xff, 0x22, 0x0e, 0x00, 0xff, 0x53, 0x0a, 0x5c, 0xff, 0x22, 0x04, 0x00, 0xff, 0x53, 0x09, 0x5c, 0xff, 0x53, 0x0d, 0x00, 0xff, 0x2e, 0x0b, 0x5c, 0xff, 0x2e, 0x04, 0x00, 0x0b, 0x5c, 0xff, 0x2e, 0x0b, 0x00, 0xff, 0x0b, 0x0c, 0x5c, 0xff, 0x2e, 0x04, 0x00, 0x0c, 0x5c, 0xff, 0x0b, 0x0a, 0x00, 0xff, 0x3a, 0x0c, 0x5c, 0xff, 0x3a, 0x03, 0x00, 0xff, 0x0b, 0x0c, 0x5c, 0xff, 0x3a, 0x09, 0x00, 0xff, 0x17, 0x0d, 0x5c, 0xff, 0x3a, 0x03, 0x00, 0xff, 0x17, 0x0d, 0x5c, 0xff, 0x17, 0x08, 0x00, 0xff, 0x46, 0x0d, 0x5c, 0xff, 0x46, 0x03, 0x00, 0xff, 0x17, 0x0d, 0x5c, 0xff, 0x46, 0x07, 0x00, 0xff, 0x22, 0x0f, 0x5c, 0xff, 0x17, 0x02, 0x00, 0xff, 0x46, 0x0e, 0x5c, 0xff, 0x22, 0x06, 0x00, 0xff, 0x53, 0x10, 0x5c, 0x02, 0x53, 0x0f, 0x5c, 0xff, 0x53, 0x05, 0x00, 0xff, 0x2e, 0x23, 0x5c, 0xff, 0x2e, 0x03, 0x00, 0xff, 0x0b, 0x10, 0x5c, 0xfb, 0x53, 0x22, 0x00, 0x0b, 0x46, 0x10, 0x5c, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x46, 0x10, 0x5c, 0xff, 0x22, 0x04, 0x00, 0xff, 0x53, 0x0f, 0x5c, 0xfd, 0x46, 0x00, 0x17, 0x11, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x46, 0x10, 0x5c, 0xfe, 0x17, 0x3a, 0x11, 0x5c, 0xff, 0x22, 0x04, 0x00, 0xff, 0x53, 0x10, 0x5c, 0xfe, 0x3a, 0x53, 0x11, 0x5c, 0xfe, 0x53, 0x17, 0x02, 0x00, 0xff, 0x3a, 0x11, 0x5c, 0xff, 0x53, 0x14, 0x5c, 0xff, 0x53, 0x3d, 0x5c, 0xff, 0x46, 0x27, 0x5c, 0xfe, 0x46, 0x17, 0x27, 0x5c, 0xfd, 0x17, 0x00, 0x22, 0x25, 0x5c, 0xff, 0x22, 0x03, 0x00, 0xfd, 0x0b, 0x2e, 0x46, 0x1f, 0x5c, 0xfd, 0x46, 0x2e, 0x0b, 0x02, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image warning_7_image = {(void *) &warning_7, 41, 37};
+    0x11, 0x00, 0xf9, 0x0b, 0x3a, 0x53, 0x5c, 0x53, 0x3a, 0x0b, 0x21, 0x00, 0xfe, 0x17, 0x53, 0x05, 0x5c, 0xfe, 0x53, 0x17, 0x1f, 0x00, 0xfe, 0x0b, 0x53, 0x07, 0x5c, 0xfe, 0x53, 0x0b, 0x1e, 0x00, 0xff, 0x46, 0x09, 0x5c, 0xff, 0x46, 0x1d, 0x00, 0xff, 0x22, 0x0b, 0x5c, 0xff, 0x22, 0x1c, 0x00, 0xff, 0x53, 0x0b, 0x5c, 0xff, 0x53, 0x1b, 0x00, 0xff, 0x2e, 0x0d, 0x5c, 0xff, 0x2e, 0x19, 0x00, 0xff, 0x0b, 0x0f, 0x5c, 0xff, 0x0b, 0x18, 0x00, 0xff, 0x3a, 0x0f, 0x5c, 0xff, 0x3a, 0x17, 0x00, 0xff, 0x17, 0x11, 0x5c, 0xff, 0x17, 0x16, 0x00, 0xff, 0x46, 0x07, 0x5c, 0xfc, 0x3a, 0x17, 0x22, 0x53, 0x06, 0x5c, 0xff, 0x46, 0x15, 0x00, 0xff, 0x22, 0x07, 0x5c, 0xff, 0x2e, 0x03, 0x00, 0xff, 0x0b, 0x07, 0x5c, 0xff, 0x22, 0x13, 0x00, 0xfe, 0x0b, 0x53, 0x07, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x3a, 0x06, 0x5c, 0xfe, 0x53, 0x0b, 0x12, 0x00, 0xff, 0x3a, 0x08, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x3a, 0x07, 0x5c, 0xff, 0x3a, 0x11, 0x00, 0xff, 0x0b, 0x09, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x46, 0x08, 0x5c, 0xff, 0x0b, 0x10, 0x00, 0xff, 0x46, 0x09, 0x5c, 0xff, 0x17, 0x04, 0x00, 0xff, 0x46, 0x08, 0x5c, 0xff, 0x46, 0x0f, 0x00, 0xff, 0x22, 0x0a, 0x5c, 0xff, 0x17, 0x04, 0x00, 0xff, 0x53, 0x09, 0x5c, 0xff, 0x22, 0x0e, 0x00, 0xff, 0x53, 0x0a, 0x5c, 0xff, 0x22, 0x04, 0x00, 0xff, 0x53, 0x09, 0x5c, 0xff, 0x53, 0x0d, 0x00, 0xff, 0x2e, 0x0b, 0x5c, 0xff, 0x2e, 0x04, 0x00, 0x0b, 0x5c, 0xff, 0x2e, 0x0b, 0x00, 0xff, 0x0b, 0x0c, 0x5c, 0xff, 0x2e, 0x04, 0x00, 0x0c, 0x5c, 0xff, 0x0b, 0x0a, 0x00, 0xff, 0x3a, 0x0c, 0x5c, 0xff, 0x3a, 0x03, 0x00, 0xff, 0x0b, 0x0c, 0x5c, 0xff, 0x3a, 0x09, 0x00, 0xff, 0x17, 0x0d, 0x5c, 0xff, 0x3a, 0x03, 0x00, 0xff, 0x17, 0x0d, 0x5c, 0xff, 0x17, 0x08, 0x00, 0xff, 0x46, 0x0d, 0x5c, 0xff, 0x46, 0x03, 0x00, 0xff, 0x17, 0x0d, 0x5c, 0xff, 0x46, 0x07, 0x00, 0xff, 0x22, 0x0f, 0x5c, 0xff, 0x17, 0x02, 0x00, 0xff, 0x46, 0x0e, 0x5c, 0xff, 0x22, 0x06, 0x00, 0xff, 0x53, 0x10, 0x5c, 0x02, 0x53, 0x0f, 0x5c, 0xff, 0x53, 0x05, 0x00, 0xff, 0x2e, 0x23, 0x5c, 0xff, 0x2e, 0x03, 0x00, 0xff, 0x0b, 0x10, 0x5c, 0xfb, 0x53, 0x22, 0x00, 0x0b, 0x46, 0x10, 0x5c, 0xff, 0x0b, 0x02, 0x00, 0xff, 0x46, 0x10, 0x5c, 0xff, 0x22, 0x04, 0x00, 0xff, 0x53, 0x0f, 0x5c, 0xfd, 0x46, 0x00, 0x17, 0x11, 0x5c, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x46, 0x10, 0x5c, 0xfe, 0x17, 0x3a, 0x11, 0x5c, 0xff, 0x22, 0x04, 0x00, 0xff, 0x53, 0x10, 0x5c, 0xfe, 0x3a, 0x53, 0x11, 0x5c, 0xfe, 0x53, 0x17, 0x02, 0x00, 0xff, 0x3a, 0x11, 0x5c, 0xff, 0x53, 0x14, 0x5c, 0xff, 0x53, 0x3d, 0x5c, 0xff, 0x46, 0x27, 0x5c, 0xfe, 0x46, 0x17, 0x27, 0x5c, 0xfd, 0x17, 0x00, 0x22, 0x25, 0x5c, 0xff, 0x22, 0x03, 0x00, 0xfd, 0x0b, 0x2e, 0x46, 0x1f, 0x5c, 0xfd, 0x46, 0x2e, 0x0b, 0x02, 0x00
+};
+static const Image warning_7_image = {warning_7_data, 41, 37};
 
-static void warning_8(uint8_t *data)
+static const uint8_t warning_8_data[455] =
 {
-    const uint8_t image_data[455] =
-    {
-        0x11, 0x00, 0xf9, 0x0b, 0x5c, 0x95, 0xa1, 0x95, 0x5c, 0x0b, 0x21, 0x00, 0xfe, 0x22, 0x95, 0x05, 0xa1, 0xfe, 0x95, 0x22, 0x1f, 0x00, 0xfe, 0x17, 0x95, 0x07, 0xa1, 0xfe, 0x95, 0x17, 0x1e, 0x00, 0xff, 0x84, 0x09, 0xa1, 0xff, 0x84, 0x1d, 0x00, 0xff, 0x3a, 0x0b, 0xa1, 0xff, 0x3a, 0x1b, 0x00, 0xfe, 0x0b, 0x95, 0x0b, 0xa1, 0xfe, 0x95, 0x0b, 0x1a, 0x00, 0xff, 0x53, 0x0d, 0xa1, 0xff, 0x53, 0x19, 0x00, 0xff, 0x17, 0x0f, 0xa1, 0xff, 0x17, 0x18, 0x00, 0xff, 0x72, 0x0f, 0xa1, 0xff, 0x72, 0x17, 0x00, 0xff, 0x2e, 0x11, 0xa1, 0xff, 0x2e, 0x16, 0x00, 0xff, 0x84, 0x07, 0xa1, 0xfc, 0x5c, 0x2e, 0x3a, 0x95, 0x06, 0xa1, 0xff, 0x84, 0x15, 0x00, 0xff, 0x46, 0x07, 0xa1, 0xff, 0x53, 0x03, 0x00, 0xfe, 0x17, 0x95, 0x06, 0xa1, 0xff, 0x46, 0x13, 0x00, 0xfe, 0x0b, 0x95, 0x07, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x06, 0xa1, 0xfe, 0x95, 0x0b, 0x12, 0x00, 0xff, 0x5c, 0x08, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x07, 0xa1, 0xff, 0x5c, 0x11, 0x00, 0xff, 0x22, 0x09, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x08, 0xa1, 0xff, 0x22, 0x10, 0x00, 0xff, 0x72, 0x09, 0xa1, 0xff, 0x22, 0x04, 0x00, 0xff, 0x84, 0x08, 0xa1, 0xff, 0x72, 0x0f, 0x00, 0xff, 0x3a, 0x0a, 0xa1, 0xff, 0x2e, 0x04, 0x00, 0xff, 0x84, 0x09, 0xa1, 0xff, 0x3a, 0x0d, 0x00, 0xfe, 0x0b, 0x84, 0x0a, 0xa1, 0xff, 0x3a, 0x04, 0x00, 0xff, 0x95, 0x09, 0xa1, 0xfe, 0x84, 0x0b, 0x0c, 0x00, 0xff, 0x53, 0x0b, 0xa1, 0xff, 0x46, 0x04, 0x00, 0x0b, 0xa1, 0xff, 0x53, 0x0b, 0x00, 0xfe, 0x17, 0x95, 0x0b, 0xa1, 0xff, 0x53, 0x03, 0x00, 0xff, 0x0b, 0x0b, 0xa1, 0xfe, 0x95, 0x17, 0x0a, 0x00, 0xff, 0x72, 0x0c, 0xa1, 0xff, 0x5c, 0x03, 0x00, 0xff, 0x17, 0x0c, 0xa1, 0xff, 0x72, 0x09, 0x00, 0xff, 0x22, 0x0d, 0xa1, 0xff, 0x72, 0x03, 0x00, 0xff, 0x22, 0x0d, 0xa1, 0xff, 0x22, 0x08, 0x00, 0xff, 0x84, 0x0d, 0xa1, 0xff, 0x72, 0x03, 0x00, 0xff, 0x2e, 0x0d, 0xa1, 0xff, 0x84, 0x07, 0x00, 0xff, 0x3a, 0x0f, 0xa1, 0xfc, 0x2e, 0x00, 0x0b, 0x84, 0x0e, 0xa1, 0xff, 0x3a, 0x05, 0x00, 0xfe, 0x0b, 0x95, 0x10, 0xa1, 0xfe, 0x84, 0x95, 0x0f, 0xa1, 0xfe, 0x95, 0x0b, 0x04, 0x00, 0xff, 0x5c, 0x23, 0xa1, 0xff, 0x5c, 0x03, 0x00, 0xff, 0x17, 0x10, 0xa1, 0xfb, 0x95, 0x3a, 0x00, 0x17, 0x72, 0x10, 0xa1, 0xff, 0x17, 0x02, 0x00, 0xff, 0x72, 0x10, 0xa1, 0xff, 0x46, 0x03, 0x00, 0xfe, 0x0b, 0x95, 0x0f, 0xa1, 0xfd, 0x72, 0x00, 0x22, 0x11, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x10, 0xa1, 0xfe, 0x22, 0x5c, 0x11, 0xa1, 0xff, 0x3a, 0x04, 0x00, 0xff, 0x95, 0x10, 0xa1, 0xfe, 0x5c, 0x95, 0x11, 0xa1, 0xfb, 0x95, 0x22, 0x00, 0x0b, 0x5c, 0x11, 0xa1, 0xff, 0x95, 0x14, 0xa1, 0xff, 0x95, 0x14, 0xa1, 0xff, 0x95, 0x27, 0xa1, 0xfe, 0x95, 0x72, 0x27, 0xa1, 0xfe, 0x72, 0x22, 0x27, 0xa1, 0xfc, 0x22, 0x00, 0x3a, 0x95, 0x23, 0xa1, 0xfe, 0x95, 0x3a, 0x03, 0x00, 0xfd, 0x17, 0x53, 0x84, 0x1f, 0xa1, 0xfd, 0x84, 0x53, 0x17, 0x02, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image warning_8_image = {(void *) &warning_8, 41, 37};
+    0x11, 0x00, 0xf9, 0x0b, 0x5c, 0x95, 0xa1, 0x95, 0x5c, 0x0b, 0x21, 0x00, 0xfe, 0x22, 0x95, 0x05, 0xa1, 0xfe, 0x95, 0x22, 0x1f, 0x00, 0xfe, 0x17, 0x95, 0x07, 0xa1, 0xfe, 0x95, 0x17, 0x1e, 0x00, 0xff, 0x84, 0x09, 0xa1, 0xff, 0x84, 0x1d, 0x00, 0xff, 0x3a, 0x0b, 0xa1, 0xff, 0x3a, 0x1b, 0x00, 0xfe, 0x0b, 0x95, 0x0b, 0xa1, 0xfe, 0x95, 0x0b, 0x1a, 0x00, 0xff, 0x53, 0x0d, 0xa1, 0xff, 0x53, 0x19, 0x00, 0xff, 0x17, 0x0f, 0xa1, 0xff, 0x17, 0x18, 0x00, 0xff, 0x72, 0x0f, 0xa1, 0xff, 0x72, 0x17, 0x00, 0xff, 0x2e, 0x11, 0xa1, 0xff, 0x2e, 0x16, 0x00, 0xff, 0x84, 0x07, 0xa1, 0xfc, 0x5c, 0x2e, 0x3a, 0x95, 0x06, 0xa1, 0xff, 0x84, 0x15, 0x00, 0xff, 0x46, 0x07, 0xa1, 0xff, 0x53, 0x03, 0x00, 0xfe, 0x17, 0x95, 0x06, 0xa1, 0xff, 0x46, 0x13, 0x00, 0xfe, 0x0b, 0x95, 0x07, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x06, 0xa1, 0xfe, 0x95, 0x0b, 0x12, 0x00, 0xff, 0x5c, 0x08, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x07, 0xa1, 0xff, 0x5c, 0x11, 0x00, 0xff, 0x22, 0x09, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x08, 0xa1, 0xff, 0x22, 0x10, 0x00, 0xff, 0x72, 0x09, 0xa1, 0xff, 0x22, 0x04, 0x00, 0xff, 0x84, 0x08, 0xa1, 0xff, 0x72, 0x0f, 0x00, 0xff, 0x3a, 0x0a, 0xa1, 0xff, 0x2e, 0x04, 0x00, 0xff, 0x84, 0x09, 0xa1, 0xff, 0x3a, 0x0d, 0x00, 0xfe, 0x0b, 0x84, 0x0a, 0xa1, 0xff, 0x3a, 0x04, 0x00, 0xff, 0x95, 0x09, 0xa1, 0xfe, 0x84, 0x0b, 0x0c, 0x00, 0xff, 0x53, 0x0b, 0xa1, 0xff, 0x46, 0x04, 0x00, 0x0b, 0xa1, 0xff, 0x53, 0x0b, 0x00, 0xfe, 0x17, 0x95, 0x0b, 0xa1, 0xff, 0x53, 0x03, 0x00, 0xff, 0x0b, 0x0b, 0xa1, 0xfe, 0x95, 0x17, 0x0a, 0x00, 0xff, 0x72, 0x0c, 0xa1, 0xff, 0x5c, 0x03, 0x00, 0xff, 0x17, 0x0c, 0xa1, 0xff, 0x72, 0x09, 0x00, 0xff, 0x22, 0x0d, 0xa1, 0xff, 0x72, 0x03, 0x00, 0xff, 0x22, 0x0d, 0xa1, 0xff, 0x22, 0x08, 0x00, 0xff, 0x84, 0x0d, 0xa1, 0xff, 0x72, 0x03, 0x00, 0xff, 0x2e, 0x0d, 0xa1, 0xff, 0x84, 0x07, 0x00, 0xff, 0x3a, 0x0f, 0xa1, 0xfc, 0x2e, 0x00, 0x0b, 0x84, 0x0e, 0xa1, 0xff, 0x3a, 0x05, 0x00, 0xfe, 0x0b, 0x95, 0x10, 0xa1, 0xfe, 0x84, 0x95, 0x0f, 0xa1, 0xfe, 0x95, 0x0b, 0x04, 0x00, 0xff, 0x5c, 0x23, 0xa1, 0xff, 0x5c, 0x03, 0x00, 0xff, 0x17, 0x10, 0xa1, 0xfb, 0x95, 0x3a, 0x00, 0x17, 0x72, 0x10, 0xa1, 0xff, 0x17, 0x02, 0x00, 0xff, 0x72, 0x10, 0xa1, 0xff, 0x46, 0x03, 0x00, 0xfe, 0x0b, 0x95, 0x0f, 0xa1, 0xfd, 0x72, 0x00, 0x22, 0x11, 0xa1, 0xff, 0x17, 0x04, 0x00, 0xff, 0x72, 0x10, 0xa1, 0xfe, 0x22, 0x5c, 0x11, 0xa1, 0xff, 0x3a, 0x04, 0x00, 0xff, 0x95, 0x10, 0xa1, 0xfe, 0x5c, 0x95, 0x11, 0xa1, 0xfb, 0x95, 0x22, 0x00, 0x0b, 0x5c, 0x11, 0xa1, 0xff, 0x95, 0x14, 0xa1, 0xff, 0x95, 0x14, 0xa1, 0xff, 0x95, 0x27, 0xa1, 0xfe, 0x95, 0x72, 0x27, 0xa1, 0xfe, 0x72, 0x22, 0x27, 0xa1, 0xfc, 0x22, 0x00, 0x3a, 0x95, 0x23, 0xa1, 0xfe, 0x95, 0x3a, 0x03, 0x00, 0xfd, 0x17, 0x53, 0x84, 0x1f, 0xa1, 0xfd, 0x84, 0x53, 0x17, 0x02, 0x00
+};
+static const Image warning_8_image = {warning_8_data, 41, 37};
 
 static const AnimationFrame warning_array[] =
 {
@@ -1634,165 +1060,101 @@ static const ImageAnimation warning = { 8, warning_array };
 //============================= LOGO ANIMATION ================================
 
 
-static void logo_1(uint8_t *data)
+static const uint8_t logo_1_data[44] =
 {
-    const uint8_t image_data[44] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x4d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_1_image = {(void *) &logo_1, 56, 49};
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x4d, 0x00
+};
+static const Image logo_1_image = {logo_1_data, 56, 49};
 
-static void logo_2(uint8_t *data)
+static const uint8_t logo_2_data[1019] =
 {
-    const uint8_t image_data[1019] =
-    {
-        0x7f, 0x00, 0x61, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x04, 0x34, 0x00, 0x04, 0x11, 0x34, 0x00, 0x04, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0x05, 0x00, 0xff, 0x0a, 0x05, 0x11, 0xff, 0x0a, 0x07, 0x00, 0xff, 0x0a, 0x05, 0x11, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xfd, 0x04, 0x00, 0x0a, 0x03, 0x11, 0x02, 0x0a, 0x03, 0x00, 0x03, 0x11, 0x04, 0x00, 0xff, 0x04, 0x04, 0x11, 0x04, 0x00, 0x08, 0x11, 0xff, 0x0a, 0x05, 0x00, 0x08, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x03, 0x11, 0xff, 0x0a, 0x08, 0x11, 0xfe, 0x04, 0x00, 0x03, 0x11, 0x04, 0x00, 0x05, 0x11, 0x03, 0x00, 0x04, 0x11, 0x03, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x04, 0x11, 0x03, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x0c, 0x11, 0xfe, 0x0a, 0x00, 0x03, 0x11, 0x02, 0x00, 0xfe, 0x04, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x04, 0x03, 0x00, 0xff, 0x04, 0x03, 0x11, 0x02, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x04, 0x03, 0x00, 0xff, 0x04, 0x03, 0x11, 0x03, 0x00, 0x03, 0x11, 0xfe, 0x0a, 0x04, 0x02, 0x00, 0xff, 0x04, 0x04, 0x11, 0xff, 0x00, 0x03, 0x11, 0x02, 0x00, 0xff, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xfd, 0x0a, 0x00, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x00, 0x08, 0x11, 0xff, 0x0a, 0x05, 0x00, 0x03, 0x11, 0xff, 0x04, 0x05, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xfe, 0x0a, 0x00, 0x03, 0x11, 0xff, 0x04, 0x05, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x00, 0x07, 0x11, 0xff, 0x0a, 0x06, 0x00, 0x0c, 0x11, 0xfe, 0x0a, 0x00, 0x0c, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0xff, 0x00, 0x07, 0x11, 0xff, 0x0a, 0x06, 0x00, 0x0c, 0x11, 0xfe, 0x0a, 0x00, 0x0c, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0xff, 0x00, 0x03, 0x11, 0xfe, 0x00, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x05, 0x00, 0x03, 0x11, 0x0b, 0x00, 0x03, 0x11, 0x0c, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x00, 0x03, 0x11, 0x02, 0x00, 0xff, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x11, 0x0b, 0x00, 0xff, 0x0a, 0x02, 0x11, 0x0c, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x00, 0x03, 0x11, 0x03, 0x00, 0xff, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x05, 0x00, 0xfe, 0x04, 0x0a, 0x03, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x05, 0x00, 0xfe, 0x04, 0x0a, 0x04, 0x00, 0x03, 0x11, 0xfe, 0x0a, 0x04, 0x02, 0x00, 0xff, 0x04, 0x04, 0x11, 0xff, 0x00, 0x03, 0x11, 0x04, 0x00, 0x05, 0x11, 0x03, 0x00, 0x04, 0x11, 0x03, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x04, 0x11, 0x03, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x0b, 0x11, 0xfe, 0x0a, 0x00, 0x03, 0x11, 0x04, 0x00, 0xff, 0x04, 0x04, 0x11, 0x03, 0x00, 0xff, 0x04, 0x09, 0x11, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x09, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x0b, 0x11, 0x02, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0x04, 0x00, 0xfe, 0x04, 0x0a, 0x04, 0x11, 0x02, 0x0a, 0xff, 0x04, 0x05, 0x00, 0xfe, 0x04, 0x0a, 0x04, 0x11, 0x02, 0x0a, 0xff, 0x04, 0x04, 0x00, 0x03, 0x11, 0xfe, 0x00, 0x0a, 0x03, 0x11, 0x02, 0x0a, 0x03, 0x00, 0x03, 0x11, 0x28, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x28, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x28, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x28, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0x05, 0x00, 0xff, 0x0a, 0x05, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x05, 0x11, 0x04, 0x00, 0x05, 0x11, 0x02, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x04, 0x00, 0xff, 0x04, 0x04, 0x11, 0x04, 0x00, 0x08, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x05, 0x11, 0x04, 0x00, 0x05, 0x11, 0x02, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x04, 0x00, 0x05, 0x11, 0x03, 0x00, 0x04, 0x11, 0x03, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x02, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x02, 0x00, 0xfe, 0x04, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x04, 0x03, 0x00, 0xff, 0x04, 0x03, 0x11, 0x03, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x03, 0x11, 0x02, 0x00, 0xff, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x08, 0x11, 0xff, 0x0a, 0x05, 0x00, 0x03, 0x11, 0xff, 0x04, 0x05, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x07, 0x11, 0xff, 0x0a, 0x06, 0x00, 0x0c, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x07, 0x11, 0xff, 0x0a, 0x06, 0x00, 0x0c, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x03, 0x11, 0xfe, 0x00, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x05, 0x00, 0x03, 0x11, 0x0c, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x03, 0x11, 0x02, 0x00, 0xff, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x11, 0x0c, 0x00, 0x03, 0x11, 0xff, 0x04, 0x05, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x03, 0x11, 0x03, 0x00, 0xff, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x05, 0x00, 0xfe, 0x04, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x03, 0x11, 0x0f, 0x00, 0x03, 0x11, 0x04, 0x00, 0x05, 0x11, 0x03, 0x00, 0x04, 0x11, 0x03, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x0a, 0x03, 0x11, 0x03, 0x0a, 0x05, 0x11, 0x0f, 0x00, 0x03, 0x11, 0x04, 0x00, 0xff, 0x04, 0x04, 0x11, 0x03, 0x00, 0xff, 0x04, 0x09, 0x11, 0xff, 0x0a, 0x04, 0x00, 0x07, 0x11, 0xff, 0x0a, 0x03, 0x11, 0x0f, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0x04, 0x00, 0xfe, 0x04, 0x0a, 0x04, 0x11, 0x02, 0x0a, 0xff, 0x04, 0x06, 0x00, 0xff, 0x0a, 0x03, 0x11, 0x02, 0x0a, 0xff, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x34, 0x00, 0x04, 0x11, 0x34, 0x00, 0x04, 0x11, 0x0e, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_2_image = {(void *) &logo_2, 56, 49};
+    0x7f, 0x00, 0x61, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x04, 0x34, 0x00, 0x04, 0x11, 0x34, 0x00, 0x04, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0x05, 0x00, 0xff, 0x0a, 0x05, 0x11, 0xff, 0x0a, 0x07, 0x00, 0xff, 0x0a, 0x05, 0x11, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xfd, 0x04, 0x00, 0x0a, 0x03, 0x11, 0x02, 0x0a, 0x03, 0x00, 0x03, 0x11, 0x04, 0x00, 0xff, 0x04, 0x04, 0x11, 0x04, 0x00, 0x08, 0x11, 0xff, 0x0a, 0x05, 0x00, 0x08, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x03, 0x11, 0xff, 0x0a, 0x08, 0x11, 0xfe, 0x04, 0x00, 0x03, 0x11, 0x04, 0x00, 0x05, 0x11, 0x03, 0x00, 0x04, 0x11, 0x03, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x04, 0x11, 0x03, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x0c, 0x11, 0xfe, 0x0a, 0x00, 0x03, 0x11, 0x02, 0x00, 0xfe, 0x04, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x04, 0x03, 0x00, 0xff, 0x04, 0x03, 0x11, 0x02, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x04, 0x03, 0x00, 0xff, 0x04, 0x03, 0x11, 0x03, 0x00, 0x03, 0x11, 0xfe, 0x0a, 0x04, 0x02, 0x00, 0xff, 0x04, 0x04, 0x11, 0xff, 0x00, 0x03, 0x11, 0x02, 0x00, 0xff, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xfd, 0x0a, 0x00, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x00, 0x08, 0x11, 0xff, 0x0a, 0x05, 0x00, 0x03, 0x11, 0xff, 0x04, 0x05, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xfe, 0x0a, 0x00, 0x03, 0x11, 0xff, 0x04, 0x05, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x00, 0x07, 0x11, 0xff, 0x0a, 0x06, 0x00, 0x0c, 0x11, 0xfe, 0x0a, 0x00, 0x0c, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0xff, 0x00, 0x07, 0x11, 0xff, 0x0a, 0x06, 0x00, 0x0c, 0x11, 0xfe, 0x0a, 0x00, 0x0c, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0xff, 0x00, 0x03, 0x11, 0xfe, 0x00, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x05, 0x00, 0x03, 0x11, 0x0b, 0x00, 0x03, 0x11, 0x0c, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x00, 0x03, 0x11, 0x02, 0x00, 0xff, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x11, 0x0b, 0x00, 0xff, 0x0a, 0x02, 0x11, 0x0c, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x00, 0x03, 0x11, 0x03, 0x00, 0xff, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x05, 0x00, 0xfe, 0x04, 0x0a, 0x03, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x05, 0x00, 0xfe, 0x04, 0x0a, 0x04, 0x00, 0x03, 0x11, 0xfe, 0x0a, 0x04, 0x02, 0x00, 0xff, 0x04, 0x04, 0x11, 0xff, 0x00, 0x03, 0x11, 0x04, 0x00, 0x05, 0x11, 0x03, 0x00, 0x04, 0x11, 0x03, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x04, 0x11, 0x03, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x0b, 0x11, 0xfe, 0x0a, 0x00, 0x03, 0x11, 0x04, 0x00, 0xff, 0x04, 0x04, 0x11, 0x03, 0x00, 0xff, 0x04, 0x09, 0x11, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x09, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x0b, 0x11, 0x02, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0x04, 0x00, 0xfe, 0x04, 0x0a, 0x04, 0x11, 0x02, 0x0a, 0xff, 0x04, 0x05, 0x00, 0xfe, 0x04, 0x0a, 0x04, 0x11, 0x02, 0x0a, 0xff, 0x04, 0x04, 0x00, 0x03, 0x11, 0xfe, 0x00, 0x0a, 0x03, 0x11, 0x02, 0x0a, 0x03, 0x00, 0x03, 0x11, 0x28, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x28, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x28, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x28, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0x05, 0x00, 0xff, 0x0a, 0x05, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x05, 0x11, 0x04, 0x00, 0x05, 0x11, 0x02, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x04, 0x00, 0xff, 0x04, 0x04, 0x11, 0x04, 0x00, 0x08, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x05, 0x11, 0x04, 0x00, 0x05, 0x11, 0x02, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x04, 0x00, 0x05, 0x11, 0x03, 0x00, 0x04, 0x11, 0x03, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x02, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x03, 0x11, 0x02, 0x00, 0xfe, 0x04, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x11, 0xff, 0x04, 0x03, 0x00, 0xff, 0x04, 0x03, 0x11, 0x03, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x03, 0x11, 0x02, 0x00, 0xff, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x08, 0x11, 0xff, 0x0a, 0x05, 0x00, 0x03, 0x11, 0xff, 0x04, 0x05, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x07, 0x11, 0xff, 0x0a, 0x06, 0x00, 0x0c, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x07, 0x11, 0xff, 0x0a, 0x06, 0x00, 0x0c, 0x11, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x03, 0x11, 0xfe, 0x00, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x05, 0x00, 0x03, 0x11, 0x0c, 0x00, 0x03, 0x11, 0x06, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x03, 0x11, 0x02, 0x00, 0xff, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x11, 0x0c, 0x00, 0x03, 0x11, 0xff, 0x04, 0x05, 0x00, 0x03, 0x11, 0x0f, 0x00, 0x03, 0x11, 0x03, 0x00, 0xff, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x05, 0x00, 0xfe, 0x04, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x11, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x03, 0x11, 0x0f, 0x00, 0x03, 0x11, 0x04, 0x00, 0x05, 0x11, 0x03, 0x00, 0x04, 0x11, 0x03, 0x0a, 0x03, 0x11, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x0a, 0x03, 0x11, 0x03, 0x0a, 0x05, 0x11, 0x0f, 0x00, 0x03, 0x11, 0x04, 0x00, 0xff, 0x04, 0x04, 0x11, 0x03, 0x00, 0xff, 0x04, 0x09, 0x11, 0xff, 0x0a, 0x04, 0x00, 0x07, 0x11, 0xff, 0x0a, 0x03, 0x11, 0x0f, 0x00, 0x03, 0x11, 0x05, 0x00, 0xff, 0x04, 0x03, 0x11, 0x04, 0x00, 0xfe, 0x04, 0x0a, 0x04, 0x11, 0x02, 0x0a, 0xff, 0x04, 0x06, 0x00, 0xff, 0x0a, 0x03, 0x11, 0x02, 0x0a, 0xff, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x35, 0x00, 0x03, 0x11, 0x34, 0x00, 0x04, 0x11, 0x34, 0x00, 0x04, 0x11, 0x0e, 0x00
+};
+static const Image logo_2_image = {logo_2_data, 56, 49};
 
-static void logo_3(uint8_t *data)
+static const uint8_t logo_3_data[1154] =
 {
-    const uint8_t image_data[1154] =
-    {
-        0x7f, 0x00, 0x29, 0x00, 0xfc, 0x16, 0x22, 0x1c, 0x0a, 0x34, 0x00, 0x03, 0x22, 0xff, 0x1c, 0x34, 0x00, 0xff, 0x1c, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x22, 0x04, 0x00, 0xfd, 0x04, 0x11, 0x1c, 0x03, 0x22, 0xfe, 0x1c, 0x11, 0x06, 0x00, 0xfd, 0x04, 0x11, 0x1c, 0x03, 0x22, 0xfe, 0x1c, 0x11, 0x04, 0x00, 0xf8, 0x16, 0x22, 0x1c, 0x0a, 0x04, 0x11, 0x1c, 0x22, 0x02, 0x1c, 0xfe, 0x11, 0x04, 0x02, 0x00, 0x03, 0x22, 0x04, 0x00, 0xfe, 0x04, 0x1c, 0x03, 0x22, 0x03, 0x00, 0xfe, 0x04, 0x1c, 0x07, 0x22, 0xff, 0x1c, 0x04, 0x00, 0xfe, 0x04, 0x1c, 0x07, 0x22, 0xff, 0x1c, 0x03, 0x00, 0x03, 0x22, 0x02, 0x1c, 0x06, 0x22, 0xfd, 0x1c, 0x04, 0x00, 0x03, 0x22, 0x03, 0x00, 0xfe, 0x04, 0x1c, 0x04, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0x03, 0x16, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0x03, 0x16, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x02, 0x00, 0xff, 0x1c, 0x0b, 0x22, 0xfe, 0x16, 0x00, 0x03, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0xff, 0x11, 0x03, 0x00, 0xff, 0x0a, 0x03, 0x22, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x22, 0xfd, 0x04, 0x00, 0x0a, 0x03, 0x22, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x22, 0xff, 0x04, 0x02, 0x00, 0x03, 0x22, 0xfe, 0x16, 0x0a, 0x02, 0x00, 0xfe, 0x04, 0x1c, 0x03, 0x22, 0xff, 0x00, 0x03, 0x22, 0x02, 0x00, 0xff, 0x16, 0x03, 0x22, 0xff, 0x11, 0x04, 0x00, 0xff, 0x16, 0x02, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x16, 0x02, 0x22, 0xfd, 0x0a, 0x00, 0x16, 0x02, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x16, 0x02, 0x22, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x22, 0xff, 0x00, 0x08, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x05, 0x00, 0xff, 0x11, 0x02, 0x22, 0xfd, 0x11, 0x00, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x05, 0x00, 0xff, 0x11, 0x02, 0x22, 0xff, 0x11, 0x02, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x04, 0x03, 0x22, 0xff, 0x00, 0x07, 0x22, 0xff, 0x11, 0x06, 0x00, 0x0c, 0x22, 0xfe, 0x16, 0x00, 0x0c, 0x22, 0xff, 0x16, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0xff, 0x00, 0x07, 0x22, 0xff, 0x11, 0x06, 0x00, 0x0c, 0x22, 0xfe, 0x16, 0x00, 0x0c, 0x22, 0xff, 0x16, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0xff, 0x00, 0x03, 0x22, 0xfe, 0x00, 0x16, 0x03, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x22, 0x0b, 0x00, 0xff, 0x1c, 0x02, 0x22, 0x0c, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x04, 0x03, 0x22, 0xff, 0x00, 0x03, 0x22, 0x02, 0x00, 0xff, 0x16, 0x03, 0x22, 0xff, 0x11, 0x04, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x0a, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x0b, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x22, 0xff, 0x00, 0x03, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0xff, 0x11, 0x03, 0x00, 0xff, 0x11, 0x02, 0x22, 0xff, 0x11, 0x05, 0x00, 0xfd, 0x0a, 0x16, 0x04, 0x02, 0x00, 0xff, 0x11, 0x02, 0x22, 0xff, 0x11, 0x05, 0x00, 0xfd, 0x0a, 0x16, 0x04, 0x03, 0x00, 0x03, 0x22, 0xfd, 0x16, 0x0a, 0x00, 0x02, 0x04, 0xff, 0x1c, 0x03, 0x22, 0xff, 0x00, 0x03, 0x22, 0x03, 0x00, 0xfe, 0x04, 0x1c, 0x04, 0x22, 0x02, 0x00, 0xfe, 0x04, 0x1c, 0x02, 0x22, 0xff, 0x1c, 0x03, 0x16, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x02, 0x00, 0xfe, 0x04, 0x1c, 0x02, 0x22, 0xff, 0x1c, 0x03, 0x16, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x03, 0x00, 0x0b, 0x22, 0xfe, 0x16, 0x00, 0x03, 0x22, 0x04, 0x00, 0xfe, 0x04, 0x1c, 0x03, 0x22, 0x03, 0x00, 0xff, 0x0a, 0x09, 0x22, 0xff, 0x16, 0x03, 0x00, 0xff, 0x0a, 0x09, 0x22, 0xff, 0x16, 0x03, 0x00, 0x03, 0x22, 0xff, 0x1c, 0x06, 0x22, 0xfd, 0x1c, 0x04, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x22, 0x04, 0x00, 0xfd, 0x04, 0x16, 0x1c, 0x02, 0x22, 0x02, 0x1c, 0xfe, 0x11, 0x0a, 0x05, 0x00, 0xfd, 0x04, 0x16, 0x1c, 0x02, 0x22, 0x02, 0x1c, 0xfe, 0x11, 0x0a, 0x04, 0x00, 0x03, 0x22, 0xfd, 0x04, 0x11, 0x1c, 0x02, 0x22, 0xfe, 0x1c, 0x11, 0x03, 0x00, 0x03, 0x22, 0x28, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x28, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x28, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x28, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x22, 0x04, 0x00, 0xfd, 0x04, 0x11, 0x1c, 0x03, 0x22, 0xfe, 0x1c, 0x11, 0x03, 0x00, 0x05, 0x22, 0x04, 0x00, 0x05, 0x22, 0x02, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x04, 0x00, 0xfe, 0x04, 0x1c, 0x03, 0x22, 0x03, 0x00, 0xfe, 0x04, 0x1c, 0x07, 0x22, 0xff, 0x1c, 0x02, 0x00, 0x05, 0x22, 0x04, 0x00, 0x05, 0x22, 0x02, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x03, 0x00, 0xfe, 0x04, 0x1c, 0x04, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0x03, 0x16, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x03, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x02, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0xff, 0x11, 0x03, 0x00, 0xff, 0x0a, 0x03, 0x22, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x22, 0xff, 0x04, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x0f, 0x00, 0x03, 0x22, 0x02, 0x00, 0xff, 0x16, 0x03, 0x22, 0xff, 0x11, 0x04, 0x00, 0xff, 0x16, 0x02, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x16, 0x02, 0x22, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x0f, 0x00, 0x08, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x05, 0x00, 0xff, 0x11, 0x02, 0x22, 0xff, 0x11, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x0f, 0x00, 0x07, 0x22, 0xff, 0x11, 0x06, 0x00, 0x0c, 0x22, 0xff, 0x16, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x0f, 0x00, 0x07, 0x22, 0xff, 0x11, 0x06, 0x00, 0x0c, 0x22, 0xff, 0x16, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x0f, 0x00, 0x03, 0x22, 0xfe, 0x00, 0x16, 0x03, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x22, 0x0c, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x0f, 0x00, 0x03, 0x22, 0x02, 0x00, 0xff, 0x16, 0x03, 0x22, 0xff, 0x11, 0x04, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x0b, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x04, 0x00, 0xff, 0x04, 0x03, 0x22, 0x0f, 0x00, 0x03, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0xff, 0x11, 0x03, 0x00, 0xff, 0x11, 0x02, 0x22, 0xff, 0x11, 0x05, 0x00, 0xfd, 0x0a, 0x16, 0x04, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x03, 0x00, 0xfe, 0x04, 0x16, 0x03, 0x22, 0x0f, 0x00, 0x03, 0x22, 0x03, 0x00, 0xfe, 0x04, 0x1c, 0x04, 0x22, 0x02, 0x00, 0xfe, 0x04, 0x1c, 0x02, 0x22, 0xff, 0x1c, 0x03, 0x16, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x03, 0x00, 0xff, 0x11, 0x03, 0x22, 0x03, 0x16, 0xff, 0x1c, 0x04, 0x22, 0x0f, 0x00, 0x03, 0x22, 0x04, 0x00, 0xfe, 0x04, 0x1c, 0x03, 0x22, 0x03, 0x00, 0xff, 0x0a, 0x09, 0x22, 0xff, 0x16, 0x04, 0x00, 0xff, 0x1c, 0x06, 0x22, 0xff, 0x16, 0x03, 0x22, 0x0f, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x22, 0x04, 0x00, 0xfd, 0x04, 0x16, 0x1c, 0x02, 0x22, 0x02, 0x1c, 0xfe, 0x11, 0x0a, 0x05, 0x00, 0xfc, 0x04, 0x16, 0x1c, 0x22, 0x02, 0x1c, 0xfe, 0x0a, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x34, 0x00, 0xff, 0x1c, 0x03, 0x22, 0x34, 0x00, 0x03, 0x22, 0xff, 0x1c, 0x34, 0x00, 0xfc, 0x16, 0x22, 0x1c, 0x0a, 0x0e, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_3_image = {(void *) &logo_3, 56, 49};
+    0x7f, 0x00, 0x29, 0x00, 0xfc, 0x16, 0x22, 0x1c, 0x0a, 0x34, 0x00, 0x03, 0x22, 0xff, 0x1c, 0x34, 0x00, 0xff, 0x1c, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x22, 0x04, 0x00, 0xfd, 0x04, 0x11, 0x1c, 0x03, 0x22, 0xfe, 0x1c, 0x11, 0x06, 0x00, 0xfd, 0x04, 0x11, 0x1c, 0x03, 0x22, 0xfe, 0x1c, 0x11, 0x04, 0x00, 0xf8, 0x16, 0x22, 0x1c, 0x0a, 0x04, 0x11, 0x1c, 0x22, 0x02, 0x1c, 0xfe, 0x11, 0x04, 0x02, 0x00, 0x03, 0x22, 0x04, 0x00, 0xfe, 0x04, 0x1c, 0x03, 0x22, 0x03, 0x00, 0xfe, 0x04, 0x1c, 0x07, 0x22, 0xff, 0x1c, 0x04, 0x00, 0xfe, 0x04, 0x1c, 0x07, 0x22, 0xff, 0x1c, 0x03, 0x00, 0x03, 0x22, 0x02, 0x1c, 0x06, 0x22, 0xfd, 0x1c, 0x04, 0x00, 0x03, 0x22, 0x03, 0x00, 0xfe, 0x04, 0x1c, 0x04, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0x03, 0x16, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0x03, 0x16, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x02, 0x00, 0xff, 0x1c, 0x0b, 0x22, 0xfe, 0x16, 0x00, 0x03, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0xff, 0x11, 0x03, 0x00, 0xff, 0x0a, 0x03, 0x22, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x22, 0xfd, 0x04, 0x00, 0x0a, 0x03, 0x22, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x22, 0xff, 0x04, 0x02, 0x00, 0x03, 0x22, 0xfe, 0x16, 0x0a, 0x02, 0x00, 0xfe, 0x04, 0x1c, 0x03, 0x22, 0xff, 0x00, 0x03, 0x22, 0x02, 0x00, 0xff, 0x16, 0x03, 0x22, 0xff, 0x11, 0x04, 0x00, 0xff, 0x16, 0x02, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x16, 0x02, 0x22, 0xfd, 0x0a, 0x00, 0x16, 0x02, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x16, 0x02, 0x22, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x22, 0xff, 0x00, 0x08, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x05, 0x00, 0xff, 0x11, 0x02, 0x22, 0xfd, 0x11, 0x00, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x05, 0x00, 0xff, 0x11, 0x02, 0x22, 0xff, 0x11, 0x02, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x04, 0x03, 0x22, 0xff, 0x00, 0x07, 0x22, 0xff, 0x11, 0x06, 0x00, 0x0c, 0x22, 0xfe, 0x16, 0x00, 0x0c, 0x22, 0xff, 0x16, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0xff, 0x00, 0x07, 0x22, 0xff, 0x11, 0x06, 0x00, 0x0c, 0x22, 0xfe, 0x16, 0x00, 0x0c, 0x22, 0xff, 0x16, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0xff, 0x00, 0x03, 0x22, 0xfe, 0x00, 0x16, 0x03, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x22, 0x0b, 0x00, 0xff, 0x1c, 0x02, 0x22, 0x0c, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x04, 0x03, 0x22, 0xff, 0x00, 0x03, 0x22, 0x02, 0x00, 0xff, 0x16, 0x03, 0x22, 0xff, 0x11, 0x04, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x0a, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x0b, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x22, 0xff, 0x00, 0x03, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0xff, 0x11, 0x03, 0x00, 0xff, 0x11, 0x02, 0x22, 0xff, 0x11, 0x05, 0x00, 0xfd, 0x0a, 0x16, 0x04, 0x02, 0x00, 0xff, 0x11, 0x02, 0x22, 0xff, 0x11, 0x05, 0x00, 0xfd, 0x0a, 0x16, 0x04, 0x03, 0x00, 0x03, 0x22, 0xfd, 0x16, 0x0a, 0x00, 0x02, 0x04, 0xff, 0x1c, 0x03, 0x22, 0xff, 0x00, 0x03, 0x22, 0x03, 0x00, 0xfe, 0x04, 0x1c, 0x04, 0x22, 0x02, 0x00, 0xfe, 0x04, 0x1c, 0x02, 0x22, 0xff, 0x1c, 0x03, 0x16, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x02, 0x00, 0xfe, 0x04, 0x1c, 0x02, 0x22, 0xff, 0x1c, 0x03, 0x16, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x03, 0x00, 0x0b, 0x22, 0xfe, 0x16, 0x00, 0x03, 0x22, 0x04, 0x00, 0xfe, 0x04, 0x1c, 0x03, 0x22, 0x03, 0x00, 0xff, 0x0a, 0x09, 0x22, 0xff, 0x16, 0x03, 0x00, 0xff, 0x0a, 0x09, 0x22, 0xff, 0x16, 0x03, 0x00, 0x03, 0x22, 0xff, 0x1c, 0x06, 0x22, 0xfd, 0x1c, 0x04, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x22, 0x04, 0x00, 0xfd, 0x04, 0x16, 0x1c, 0x02, 0x22, 0x02, 0x1c, 0xfe, 0x11, 0x0a, 0x05, 0x00, 0xfd, 0x04, 0x16, 0x1c, 0x02, 0x22, 0x02, 0x1c, 0xfe, 0x11, 0x0a, 0x04, 0x00, 0x03, 0x22, 0xfd, 0x04, 0x11, 0x1c, 0x02, 0x22, 0xfe, 0x1c, 0x11, 0x03, 0x00, 0x03, 0x22, 0x28, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x28, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x28, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x28, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x22, 0x04, 0x00, 0xfd, 0x04, 0x11, 0x1c, 0x03, 0x22, 0xfe, 0x1c, 0x11, 0x03, 0x00, 0x05, 0x22, 0x04, 0x00, 0x05, 0x22, 0x02, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x04, 0x00, 0xfe, 0x04, 0x1c, 0x03, 0x22, 0x03, 0x00, 0xfe, 0x04, 0x1c, 0x07, 0x22, 0xff, 0x1c, 0x02, 0x00, 0x05, 0x22, 0x04, 0x00, 0x05, 0x22, 0x02, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x03, 0x00, 0xfe, 0x04, 0x1c, 0x04, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0x03, 0x16, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x03, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x02, 0x00, 0x03, 0x22, 0x0a, 0x00, 0x03, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0xff, 0x11, 0x03, 0x00, 0xff, 0x0a, 0x03, 0x22, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x22, 0xff, 0x04, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x0f, 0x00, 0x03, 0x22, 0x02, 0x00, 0xff, 0x16, 0x03, 0x22, 0xff, 0x11, 0x04, 0x00, 0xff, 0x16, 0x02, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x16, 0x02, 0x22, 0xff, 0x0a, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x0f, 0x00, 0x08, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x05, 0x00, 0xff, 0x11, 0x02, 0x22, 0xff, 0x11, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x0f, 0x00, 0x07, 0x22, 0xff, 0x11, 0x06, 0x00, 0x0c, 0x22, 0xff, 0x16, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x0f, 0x00, 0x07, 0x22, 0xff, 0x11, 0x06, 0x00, 0x0c, 0x22, 0xff, 0x16, 0x02, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x0f, 0x00, 0x03, 0x22, 0xfe, 0x00, 0x16, 0x03, 0x22, 0xff, 0x11, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x22, 0x0c, 0x00, 0x03, 0x22, 0x06, 0x00, 0x03, 0x22, 0x0f, 0x00, 0x03, 0x22, 0x02, 0x00, 0xff, 0x16, 0x03, 0x22, 0xff, 0x11, 0x04, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x0b, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x04, 0x04, 0x00, 0xff, 0x04, 0x03, 0x22, 0x0f, 0x00, 0x03, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x22, 0xff, 0x11, 0x03, 0x00, 0xff, 0x11, 0x02, 0x22, 0xff, 0x11, 0x05, 0x00, 0xfd, 0x0a, 0x16, 0x04, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x03, 0x00, 0xfe, 0x04, 0x16, 0x03, 0x22, 0x0f, 0x00, 0x03, 0x22, 0x03, 0x00, 0xfe, 0x04, 0x1c, 0x04, 0x22, 0x02, 0x00, 0xfe, 0x04, 0x1c, 0x02, 0x22, 0xff, 0x1c, 0x03, 0x16, 0xff, 0x1c, 0x02, 0x22, 0xff, 0x11, 0x03, 0x00, 0xff, 0x11, 0x03, 0x22, 0x03, 0x16, 0xff, 0x1c, 0x04, 0x22, 0x0f, 0x00, 0x03, 0x22, 0x04, 0x00, 0xfe, 0x04, 0x1c, 0x03, 0x22, 0x03, 0x00, 0xff, 0x0a, 0x09, 0x22, 0xff, 0x16, 0x04, 0x00, 0xff, 0x1c, 0x06, 0x22, 0xff, 0x16, 0x03, 0x22, 0x0f, 0x00, 0x03, 0x22, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x22, 0x04, 0x00, 0xfd, 0x04, 0x16, 0x1c, 0x02, 0x22, 0x02, 0x1c, 0xfe, 0x11, 0x0a, 0x05, 0x00, 0xfc, 0x04, 0x16, 0x1c, 0x22, 0x02, 0x1c, 0xfe, 0x0a, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x35, 0x00, 0x03, 0x22, 0x34, 0x00, 0xff, 0x1c, 0x03, 0x22, 0x34, 0x00, 0x03, 0x22, 0xff, 0x1c, 0x34, 0x00, 0xfc, 0x16, 0x22, 0x1c, 0x0a, 0x0e, 0x00
+};
+static const Image logo_3_image = {logo_3_data, 56, 49};
 
-static void logo_4(uint8_t *data)
+static const uint8_t logo_4_data[1167] =
 {
-    const uint8_t image_data[1167] =
-    {
-        0x7f, 0x00, 0x29, 0x00, 0xfc, 0x22, 0x33, 0x2d, 0x11, 0x34, 0x00, 0x03, 0x33, 0xff, 0x2d, 0x34, 0x00, 0xff, 0x2d, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x33, 0x04, 0x00, 0xfd, 0x04, 0x1c, 0x2d, 0x03, 0x33, 0xfd, 0x2d, 0x16, 0x04, 0x05, 0x00, 0xfd, 0x04, 0x1c, 0x2d, 0x03, 0x33, 0xfd, 0x2d, 0x16, 0x04, 0x03, 0x00, 0xf4, 0x22, 0x33, 0x2d, 0x11, 0x04, 0x1c, 0x2d, 0x33, 0x2d, 0x28, 0x16, 0x04, 0x02, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x0a, 0x2d, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x07, 0x33, 0xfe, 0x28, 0x04, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x07, 0x33, 0xfe, 0x28, 0x04, 0x02, 0x00, 0x03, 0x33, 0x02, 0x2d, 0x06, 0x33, 0xfd, 0x2d, 0x04, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x04, 0x33, 0x03, 0x00, 0xff, 0x28, 0x03, 0x33, 0xfc, 0x25, 0x1c, 0x22, 0x2d, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x28, 0x03, 0x33, 0xfc, 0x25, 0x1c, 0x22, 0x2d, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x2d, 0x0b, 0x33, 0xfe, 0x22, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x04, 0x28, 0x03, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x11, 0x03, 0x33, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x33, 0xfd, 0x04, 0x00, 0x11, 0x03, 0x33, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x33, 0xff, 0x04, 0x02, 0x00, 0x03, 0x33, 0xfa, 0x22, 0x0a, 0x04, 0x00, 0x0a, 0x2d, 0x03, 0x33, 0xff, 0x00, 0x03, 0x33, 0x02, 0x00, 0xff, 0x22, 0x03, 0x33, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x22, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x22, 0x02, 0x33, 0xfd, 0x16, 0x00, 0x22, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x22, 0x02, 0x33, 0xff, 0x16, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x11, 0x03, 0x33, 0xff, 0x00, 0x08, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x33, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x16, 0x02, 0x33, 0xfd, 0x1c, 0x00, 0x2d, 0x02, 0x33, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x16, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x04, 0x03, 0x33, 0xff, 0x00, 0x07, 0x33, 0xff, 0x1c, 0x06, 0x00, 0x0c, 0x33, 0xfe, 0x22, 0x00, 0x0c, 0x33, 0xff, 0x22, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0xff, 0x00, 0x07, 0x33, 0xff, 0x1c, 0x06, 0x00, 0x0c, 0x33, 0xfe, 0x22, 0x00, 0x0c, 0x33, 0xff, 0x22, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0xff, 0x00, 0x03, 0x33, 0xfe, 0x00, 0x1c, 0x03, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x33, 0x0b, 0x00, 0xff, 0x2d, 0x02, 0x33, 0x0c, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x04, 0x03, 0x33, 0xff, 0x00, 0x03, 0x33, 0x02, 0x00, 0xff, 0x22, 0x03, 0x33, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x04, 0x0a, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x04, 0x0b, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x11, 0x03, 0x33, 0xff, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x04, 0x28, 0x03, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x16, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x11, 0x1c, 0x04, 0x02, 0x00, 0xff, 0x16, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x11, 0x1c, 0x04, 0x03, 0x00, 0x03, 0x33, 0xfa, 0x22, 0x0a, 0x04, 0x00, 0x0a, 0x2d, 0x03, 0x33, 0xff, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x04, 0x33, 0x02, 0x00, 0xfe, 0x04, 0x2d, 0x02, 0x33, 0xfb, 0x2d, 0x22, 0x1c, 0x25, 0x2d, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0xfe, 0x04, 0x2d, 0x02, 0x33, 0xfb, 0x2d, 0x22, 0x1c, 0x25, 0x2d, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x0b, 0x33, 0xfe, 0x22, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x0a, 0x2d, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x11, 0x2d, 0x08, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xfe, 0x11, 0x2d, 0x08, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x03, 0x33, 0xff, 0x2d, 0x06, 0x33, 0xfd, 0x2d, 0x04, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x33, 0x04, 0x00, 0xfd, 0x0a, 0x1c, 0x2d, 0x02, 0x33, 0xfc, 0x2d, 0x25, 0x1c, 0x11, 0x05, 0x00, 0xfd, 0x0a, 0x1c, 0x2d, 0x02, 0x33, 0xfc, 0x2d, 0x25, 0x1c, 0x11, 0x04, 0x00, 0x03, 0x33, 0xf8, 0x04, 0x1c, 0x2d, 0x33, 0x2d, 0x28, 0x16, 0x04, 0x02, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x33, 0x04, 0x00, 0xfd, 0x04, 0x1c, 0x2d, 0x03, 0x33, 0xfd, 0x2d, 0x16, 0x04, 0x02, 0x00, 0x05, 0x33, 0x04, 0x00, 0x05, 0x33, 0x02, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x0a, 0x2d, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x07, 0x33, 0xfd, 0x28, 0x04, 0x00, 0x05, 0x33, 0x04, 0x00, 0x05, 0x33, 0x02, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x04, 0x33, 0x03, 0x00, 0xff, 0x28, 0x03, 0x33, 0xfc, 0x25, 0x1c, 0x22, 0x2d, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x02, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x04, 0x28, 0x03, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x11, 0x03, 0x33, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x33, 0xff, 0x04, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x0f, 0x00, 0x03, 0x33, 0x02, 0x00, 0xff, 0x22, 0x03, 0x33, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x22, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x22, 0x02, 0x33, 0xff, 0x16, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x0f, 0x00, 0x08, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x33, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x16, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x0f, 0x00, 0x07, 0x33, 0xff, 0x1c, 0x06, 0x00, 0x0c, 0x33, 0xff, 0x22, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x0f, 0x00, 0x07, 0x33, 0xff, 0x1c, 0x06, 0x00, 0x0c, 0x33, 0xff, 0x22, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x0f, 0x00, 0x03, 0x33, 0xfe, 0x00, 0x1c, 0x03, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x33, 0x0c, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x0f, 0x00, 0x03, 0x33, 0x02, 0x00, 0xff, 0x22, 0x03, 0x33, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x04, 0x0b, 0x00, 0xff, 0x2d, 0x02, 0x33, 0xff, 0x04, 0x04, 0x00, 0xff, 0x04, 0x03, 0x33, 0x0f, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x04, 0x28, 0x03, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x16, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x11, 0x1c, 0x04, 0x03, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x16, 0x04, 0x00, 0xff, 0x25, 0x03, 0x33, 0x0f, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x04, 0x33, 0x02, 0x00, 0xfe, 0x04, 0x2d, 0x02, 0x33, 0xfb, 0x2d, 0x22, 0x1c, 0x25, 0x2d, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x16, 0x02, 0x33, 0xfb, 0x2d, 0x22, 0x1c, 0x25, 0x2d, 0x04, 0x33, 0x0f, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x0a, 0x2d, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x11, 0x2d, 0x08, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xfe, 0x04, 0x28, 0x06, 0x33, 0xff, 0x1c, 0x03, 0x33, 0x0f, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x33, 0x04, 0x00, 0xfd, 0x0a, 0x1c, 0x2d, 0x02, 0x33, 0xfc, 0x2d, 0x25, 0x1c, 0x11, 0x05, 0x00, 0xf8, 0x04, 0x1c, 0x2d, 0x33, 0x2d, 0x28, 0x16, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x34, 0x00, 0xff, 0x2d, 0x03, 0x33, 0x34, 0x00, 0x03, 0x33, 0xff, 0x2d, 0x34, 0x00, 0xfc, 0x22, 0x33, 0x2d, 0x11, 0x0e, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_4_image = {(void *) &logo_4, 56, 49};
+    0x7f, 0x00, 0x29, 0x00, 0xfc, 0x22, 0x33, 0x2d, 0x11, 0x34, 0x00, 0x03, 0x33, 0xff, 0x2d, 0x34, 0x00, 0xff, 0x2d, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x33, 0x04, 0x00, 0xfd, 0x04, 0x1c, 0x2d, 0x03, 0x33, 0xfd, 0x2d, 0x16, 0x04, 0x05, 0x00, 0xfd, 0x04, 0x1c, 0x2d, 0x03, 0x33, 0xfd, 0x2d, 0x16, 0x04, 0x03, 0x00, 0xf4, 0x22, 0x33, 0x2d, 0x11, 0x04, 0x1c, 0x2d, 0x33, 0x2d, 0x28, 0x16, 0x04, 0x02, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x0a, 0x2d, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x07, 0x33, 0xfe, 0x28, 0x04, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x07, 0x33, 0xfe, 0x28, 0x04, 0x02, 0x00, 0x03, 0x33, 0x02, 0x2d, 0x06, 0x33, 0xfd, 0x2d, 0x04, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x04, 0x33, 0x03, 0x00, 0xff, 0x28, 0x03, 0x33, 0xfc, 0x25, 0x1c, 0x22, 0x2d, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x28, 0x03, 0x33, 0xfc, 0x25, 0x1c, 0x22, 0x2d, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x2d, 0x0b, 0x33, 0xfe, 0x22, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x04, 0x28, 0x03, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x11, 0x03, 0x33, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x33, 0xfd, 0x04, 0x00, 0x11, 0x03, 0x33, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x33, 0xff, 0x04, 0x02, 0x00, 0x03, 0x33, 0xfa, 0x22, 0x0a, 0x04, 0x00, 0x0a, 0x2d, 0x03, 0x33, 0xff, 0x00, 0x03, 0x33, 0x02, 0x00, 0xff, 0x22, 0x03, 0x33, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x22, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x22, 0x02, 0x33, 0xfd, 0x16, 0x00, 0x22, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x22, 0x02, 0x33, 0xff, 0x16, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x11, 0x03, 0x33, 0xff, 0x00, 0x08, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x33, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x16, 0x02, 0x33, 0xfd, 0x1c, 0x00, 0x2d, 0x02, 0x33, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x16, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x04, 0x03, 0x33, 0xff, 0x00, 0x07, 0x33, 0xff, 0x1c, 0x06, 0x00, 0x0c, 0x33, 0xfe, 0x22, 0x00, 0x0c, 0x33, 0xff, 0x22, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0xff, 0x00, 0x07, 0x33, 0xff, 0x1c, 0x06, 0x00, 0x0c, 0x33, 0xfe, 0x22, 0x00, 0x0c, 0x33, 0xff, 0x22, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0xff, 0x00, 0x03, 0x33, 0xfe, 0x00, 0x1c, 0x03, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x33, 0x0b, 0x00, 0xff, 0x2d, 0x02, 0x33, 0x0c, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x04, 0x03, 0x33, 0xff, 0x00, 0x03, 0x33, 0x02, 0x00, 0xff, 0x22, 0x03, 0x33, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x04, 0x0a, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x04, 0x0b, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x11, 0x03, 0x33, 0xff, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x04, 0x28, 0x03, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x16, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x11, 0x1c, 0x04, 0x02, 0x00, 0xff, 0x16, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x11, 0x1c, 0x04, 0x03, 0x00, 0x03, 0x33, 0xfa, 0x22, 0x0a, 0x04, 0x00, 0x0a, 0x2d, 0x03, 0x33, 0xff, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x04, 0x33, 0x02, 0x00, 0xfe, 0x04, 0x2d, 0x02, 0x33, 0xfb, 0x2d, 0x22, 0x1c, 0x25, 0x2d, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0xfe, 0x04, 0x2d, 0x02, 0x33, 0xfb, 0x2d, 0x22, 0x1c, 0x25, 0x2d, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x0b, 0x33, 0xfe, 0x22, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x0a, 0x2d, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x11, 0x2d, 0x08, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xfe, 0x11, 0x2d, 0x08, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x03, 0x33, 0xff, 0x2d, 0x06, 0x33, 0xfd, 0x2d, 0x04, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x33, 0x04, 0x00, 0xfd, 0x0a, 0x1c, 0x2d, 0x02, 0x33, 0xfc, 0x2d, 0x25, 0x1c, 0x11, 0x05, 0x00, 0xfd, 0x0a, 0x1c, 0x2d, 0x02, 0x33, 0xfc, 0x2d, 0x25, 0x1c, 0x11, 0x04, 0x00, 0x03, 0x33, 0xf8, 0x04, 0x1c, 0x2d, 0x33, 0x2d, 0x28, 0x16, 0x04, 0x02, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x33, 0x04, 0x00, 0xfd, 0x04, 0x1c, 0x2d, 0x03, 0x33, 0xfd, 0x2d, 0x16, 0x04, 0x02, 0x00, 0x05, 0x33, 0x04, 0x00, 0x05, 0x33, 0x02, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x0a, 0x2d, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x07, 0x33, 0xfd, 0x28, 0x04, 0x00, 0x05, 0x33, 0x04, 0x00, 0x05, 0x33, 0x02, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x04, 0x33, 0x03, 0x00, 0xff, 0x28, 0x03, 0x33, 0xfc, 0x25, 0x1c, 0x22, 0x2d, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x02, 0x00, 0x03, 0x33, 0x0a, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x04, 0x28, 0x03, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x11, 0x03, 0x33, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x03, 0x33, 0xff, 0x04, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x0f, 0x00, 0x03, 0x33, 0x02, 0x00, 0xff, 0x22, 0x03, 0x33, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x22, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x22, 0x02, 0x33, 0xff, 0x16, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x0f, 0x00, 0x08, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x33, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x16, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x0f, 0x00, 0x07, 0x33, 0xff, 0x1c, 0x06, 0x00, 0x0c, 0x33, 0xff, 0x22, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x0f, 0x00, 0x07, 0x33, 0xff, 0x1c, 0x06, 0x00, 0x0c, 0x33, 0xff, 0x22, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x0f, 0x00, 0x03, 0x33, 0xfe, 0x00, 0x1c, 0x03, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x33, 0x0c, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x0f, 0x00, 0x03, 0x33, 0x02, 0x00, 0xff, 0x22, 0x03, 0x33, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x04, 0x0b, 0x00, 0xff, 0x2d, 0x02, 0x33, 0xff, 0x04, 0x04, 0x00, 0xff, 0x04, 0x03, 0x33, 0x0f, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x04, 0x28, 0x03, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x16, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x11, 0x1c, 0x04, 0x03, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x16, 0x04, 0x00, 0xff, 0x25, 0x03, 0x33, 0x0f, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x04, 0x33, 0x02, 0x00, 0xfe, 0x04, 0x2d, 0x02, 0x33, 0xfb, 0x2d, 0x22, 0x1c, 0x25, 0x2d, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x16, 0x02, 0x33, 0xfb, 0x2d, 0x22, 0x1c, 0x25, 0x2d, 0x04, 0x33, 0x0f, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x0a, 0x2d, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x11, 0x2d, 0x08, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xfe, 0x04, 0x28, 0x06, 0x33, 0xff, 0x1c, 0x03, 0x33, 0x0f, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x33, 0x04, 0x00, 0xfd, 0x0a, 0x1c, 0x2d, 0x02, 0x33, 0xfc, 0x2d, 0x25, 0x1c, 0x11, 0x05, 0x00, 0xf8, 0x04, 0x1c, 0x2d, 0x33, 0x2d, 0x28, 0x16, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x35, 0x00, 0x03, 0x33, 0x34, 0x00, 0xff, 0x2d, 0x03, 0x33, 0x34, 0x00, 0x03, 0x33, 0xff, 0x2d, 0x34, 0x00, 0xfc, 0x22, 0x33, 0x2d, 0x11, 0x0e, 0x00
+};
+static const Image logo_4_image = {logo_4_data, 56, 49};
 
-static void logo_5(uint8_t *data)
+static const uint8_t logo_5_data[1184] =
 {
-    const uint8_t image_data[1184] =
-    {
-        0x7f, 0x00, 0x29, 0x00, 0xfc, 0x2d, 0x41, 0x3d, 0x16, 0x34, 0x00, 0x03, 0x44, 0xff, 0x38, 0x34, 0x00, 0xff, 0x3d, 0x02, 0x44, 0xff, 0x41, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x05, 0x00, 0xfe, 0x11, 0x41, 0x02, 0x44, 0x04, 0x00, 0xfd, 0x04, 0x25, 0x3d, 0x03, 0x44, 0xfd, 0x38, 0x22, 0x04, 0x05, 0x00, 0xfd, 0x04, 0x25, 0x3d, 0x03, 0x44, 0xfd, 0x38, 0x22, 0x04, 0x03, 0x00, 0xf4, 0x2d, 0x41, 0x3d, 0x16, 0x04, 0x25, 0x38, 0x44, 0x41, 0x33, 0x1c, 0x04, 0x02, 0x00, 0x03, 0x44, 0x04, 0x00, 0xfe, 0x0a, 0x3d, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x0a, 0x38, 0x07, 0x44, 0xfe, 0x33, 0x04, 0x03, 0x00, 0xfe, 0x0a, 0x38, 0x07, 0x44, 0xfe, 0x33, 0x04, 0x02, 0x00, 0x03, 0x44, 0xfe, 0x38, 0x3d, 0x06, 0x44, 0xfd, 0x3d, 0x0a, 0x00, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x0a, 0x38, 0x04, 0x44, 0x03, 0x00, 0xff, 0x38, 0x02, 0x44, 0xfb, 0x41, 0x33, 0x28, 0x2d, 0x3d, 0x02, 0x44, 0xff, 0x25, 0x03, 0x00, 0xff, 0x38, 0x02, 0x44, 0xfb, 0x41, 0x33, 0x28, 0x2d, 0x3d, 0x02, 0x44, 0xff, 0x25, 0x02, 0x00, 0xff, 0x3d, 0x0b, 0x44, 0xfe, 0x2d, 0x00, 0x03, 0x44, 0x02, 0x00, 0xfe, 0x04, 0x33, 0x03, 0x44, 0xff, 0x22, 0x03, 0x00, 0xff, 0x16, 0x02, 0x44, 0xfe, 0x41, 0x11, 0x03, 0x00, 0xf9, 0x0a, 0x3d, 0x44, 0x41, 0x04, 0x00, 0x16, 0x02, 0x44, 0xfe, 0x41, 0x11, 0x03, 0x00, 0xfb, 0x0a, 0x3d, 0x44, 0x41, 0x04, 0x02, 0x00, 0x03, 0x44, 0xfa, 0x2d, 0x11, 0x04, 0x00, 0x0a, 0x38, 0x02, 0x44, 0xfe, 0x41, 0x00, 0x03, 0x44, 0xfd, 0x00, 0x04, 0x2d, 0x03, 0x44, 0xff, 0x22, 0x04, 0x00, 0xff, 0x2d, 0x02, 0x44, 0xff, 0x22, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x44, 0xfd, 0x1c, 0x00, 0x2d, 0x02, 0x44, 0xff, 0x22, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x44, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x44, 0x05, 0x00, 0xff, 0x16, 0x03, 0x44, 0xff, 0x00, 0x08, 0x44, 0xff, 0x22, 0x05, 0x00, 0xff, 0x3d, 0x02, 0x44, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xfd, 0x25, 0x00, 0x3d, 0x02, 0x44, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xff, 0x25, 0x02, 0x00, 0x03, 0x44, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x44, 0xff, 0x00, 0x07, 0x44, 0xff, 0x22, 0x06, 0x00, 0x0c, 0x44, 0xfe, 0x2d, 0x00, 0x0c, 0x44, 0xff, 0x2d, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0xff, 0x00, 0x07, 0x44, 0xff, 0x22, 0x06, 0x00, 0x0c, 0x44, 0xfe, 0x2d, 0x00, 0x0c, 0x44, 0xff, 0x2d, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0xff, 0x00, 0x03, 0x44, 0xfe, 0x00, 0x28, 0x03, 0x44, 0xff, 0x22, 0x05, 0x00, 0xfd, 0x3d, 0x44, 0x41, 0x0b, 0x00, 0xfd, 0x3d, 0x44, 0x41, 0x0c, 0x00, 0x03, 0x44, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x44, 0xff, 0x00, 0x03, 0x44, 0x02, 0x00, 0xff, 0x2d, 0x03, 0x44, 0xff, 0x22, 0x04, 0x00, 0xff, 0x33, 0x02, 0x44, 0xff, 0x04, 0x0a, 0x00, 0xff, 0x33, 0x02, 0x44, 0xff, 0x04, 0x0b, 0x00, 0x03, 0x44, 0x05, 0x00, 0xff, 0x16, 0x03, 0x44, 0xff, 0x00, 0x03, 0x44, 0x02, 0x00, 0xfe, 0x04, 0x33, 0x03, 0x44, 0xff, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xff, 0x28, 0x05, 0x00, 0xfd, 0x16, 0x28, 0x04, 0x02, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xff, 0x28, 0x05, 0x00, 0xfd, 0x16, 0x28, 0x04, 0x03, 0x00, 0x03, 0x44, 0xfe, 0x2d, 0x11, 0x02, 0x04, 0xfe, 0x0a, 0x38, 0x02, 0x44, 0xfe, 0x41, 0x00, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x04, 0x3d, 0x04, 0x44, 0x02, 0x00, 0xfe, 0x04, 0x3d, 0x02, 0x44, 0xfb, 0x38, 0x2d, 0x28, 0x2d, 0x3d, 0x02, 0x44, 0xff, 0x25, 0x02, 0x00, 0xfe, 0x04, 0x3d, 0x02, 0x44, 0xfb, 0x38, 0x2d, 0x28, 0x2d, 0x3d, 0x02, 0x44, 0xff, 0x25, 0x03, 0x00, 0x0b, 0x44, 0xfe, 0x2d, 0x00, 0x03, 0x44, 0x04, 0x00, 0xfe, 0x0a, 0x3d, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x11, 0x41, 0x08, 0x44, 0xff, 0x28, 0x03, 0x00, 0xfe, 0x11, 0x41, 0x08, 0x44, 0xff, 0x28, 0x03, 0x00, 0x03, 0x44, 0xff, 0x38, 0x06, 0x44, 0xfd, 0x38, 0x0a, 0x00, 0x03, 0x44, 0x05, 0x00, 0xfe, 0x11, 0x41, 0x02, 0x44, 0x04, 0x00, 0xf7, 0x0a, 0x28, 0x3d, 0x44, 0x41, 0x3d, 0x33, 0x28, 0x11, 0x05, 0x00, 0xf7, 0x0a, 0x28, 0x3d, 0x44, 0x41, 0x3d, 0x33, 0x28, 0x11, 0x04, 0x00, 0x03, 0x44, 0xf8, 0x04, 0x25, 0x3d, 0x44, 0x41, 0x33, 0x1c, 0x04, 0x02, 0x00, 0x03, 0x44, 0x28, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x28, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x28, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x28, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x05, 0x00, 0xfe, 0x11, 0x41, 0x02, 0x44, 0x04, 0x00, 0xfd, 0x04, 0x25, 0x3d, 0x03, 0x44, 0xfd, 0x38, 0x22, 0x04, 0x02, 0x00, 0x05, 0x44, 0x04, 0x00, 0x05, 0x44, 0x02, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x04, 0x00, 0xfe, 0x0a, 0x3d, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x0a, 0x38, 0x07, 0x44, 0xfd, 0x33, 0x04, 0x00, 0x05, 0x44, 0x04, 0x00, 0x05, 0x44, 0x02, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x0a, 0x38, 0x04, 0x44, 0x03, 0x00, 0xff, 0x38, 0x02, 0x44, 0xfb, 0x41, 0x33, 0x28, 0x2d, 0x3d, 0x02, 0x44, 0xff, 0x25, 0x03, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x02, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x02, 0x00, 0xfe, 0x04, 0x33, 0x03, 0x44, 0xff, 0x22, 0x03, 0x00, 0xff, 0x16, 0x02, 0x44, 0xfe, 0x41, 0x11, 0x03, 0x00, 0xfb, 0x0a, 0x3d, 0x44, 0x41, 0x04, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x0f, 0x00, 0x03, 0x44, 0xfd, 0x00, 0x04, 0x2d, 0x03, 0x44, 0xff, 0x22, 0x04, 0x00, 0xff, 0x2d, 0x02, 0x44, 0xff, 0x22, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x44, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x0f, 0x00, 0x08, 0x44, 0xff, 0x22, 0x05, 0x00, 0xff, 0x3d, 0x02, 0x44, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xff, 0x25, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x0f, 0x00, 0x07, 0x44, 0xff, 0x22, 0x06, 0x00, 0x0c, 0x44, 0xff, 0x2d, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x0f, 0x00, 0x07, 0x44, 0xff, 0x22, 0x06, 0x00, 0x0c, 0x44, 0xff, 0x2d, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x0f, 0x00, 0x03, 0x44, 0xfe, 0x00, 0x28, 0x03, 0x44, 0xff, 0x22, 0x05, 0x00, 0xfd, 0x3d, 0x44, 0x41, 0x0c, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x0f, 0x00, 0x03, 0x44, 0x02, 0x00, 0xff, 0x2d, 0x03, 0x44, 0xff, 0x22, 0x04, 0x00, 0xff, 0x33, 0x02, 0x44, 0xff, 0x04, 0x0b, 0x00, 0xff, 0x3d, 0x02, 0x44, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x04, 0x03, 0x44, 0x0f, 0x00, 0x03, 0x44, 0x02, 0x00, 0xfe, 0x04, 0x33, 0x03, 0x44, 0xff, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xff, 0x28, 0x05, 0x00, 0xfd, 0x16, 0x28, 0x04, 0x03, 0x00, 0xff, 0x33, 0x02, 0x44, 0xff, 0x1c, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x03, 0x44, 0x0f, 0x00, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x04, 0x3d, 0x04, 0x44, 0x02, 0x00, 0xfe, 0x04, 0x3d, 0x02, 0x44, 0xfb, 0x38, 0x2d, 0x28, 0x2d, 0x3d, 0x02, 0x44, 0xff, 0x25, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xff, 0x41, 0x02, 0x28, 0xfe, 0x2d, 0x3d, 0x04, 0x44, 0x0f, 0x00, 0x03, 0x44, 0x04, 0x00, 0xfe, 0x0a, 0x3d, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x11, 0x41, 0x08, 0x44, 0xff, 0x28, 0x03, 0x00, 0xfe, 0x04, 0x38, 0x06, 0x44, 0xff, 0x28, 0x03, 0x44, 0x0f, 0x00, 0x03, 0x44, 0x05, 0x00, 0xfe, 0x11, 0x41, 0x02, 0x44, 0x04, 0x00, 0xf7, 0x0a, 0x28, 0x3d, 0x44, 0x41, 0x3d, 0x33, 0x28, 0x11, 0x05, 0x00, 0xf8, 0x04, 0x2d, 0x3d, 0x44, 0x3d, 0x33, 0x1c, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x34, 0x00, 0xff, 0x3d, 0x02, 0x44, 0xff, 0x41, 0x34, 0x00, 0x03, 0x44, 0xff, 0x38, 0x34, 0x00, 0xfc, 0x2d, 0x41, 0x3d, 0x16, 0x0e, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_5_image = {(void *) &logo_5, 56, 49};
+    0x7f, 0x00, 0x29, 0x00, 0xfc, 0x2d, 0x41, 0x3d, 0x16, 0x34, 0x00, 0x03, 0x44, 0xff, 0x38, 0x34, 0x00, 0xff, 0x3d, 0x02, 0x44, 0xff, 0x41, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x05, 0x00, 0xfe, 0x11, 0x41, 0x02, 0x44, 0x04, 0x00, 0xfd, 0x04, 0x25, 0x3d, 0x03, 0x44, 0xfd, 0x38, 0x22, 0x04, 0x05, 0x00, 0xfd, 0x04, 0x25, 0x3d, 0x03, 0x44, 0xfd, 0x38, 0x22, 0x04, 0x03, 0x00, 0xf4, 0x2d, 0x41, 0x3d, 0x16, 0x04, 0x25, 0x38, 0x44, 0x41, 0x33, 0x1c, 0x04, 0x02, 0x00, 0x03, 0x44, 0x04, 0x00, 0xfe, 0x0a, 0x3d, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x0a, 0x38, 0x07, 0x44, 0xfe, 0x33, 0x04, 0x03, 0x00, 0xfe, 0x0a, 0x38, 0x07, 0x44, 0xfe, 0x33, 0x04, 0x02, 0x00, 0x03, 0x44, 0xfe, 0x38, 0x3d, 0x06, 0x44, 0xfd, 0x3d, 0x0a, 0x00, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x0a, 0x38, 0x04, 0x44, 0x03, 0x00, 0xff, 0x38, 0x02, 0x44, 0xfb, 0x41, 0x33, 0x28, 0x2d, 0x3d, 0x02, 0x44, 0xff, 0x25, 0x03, 0x00, 0xff, 0x38, 0x02, 0x44, 0xfb, 0x41, 0x33, 0x28, 0x2d, 0x3d, 0x02, 0x44, 0xff, 0x25, 0x02, 0x00, 0xff, 0x3d, 0x0b, 0x44, 0xfe, 0x2d, 0x00, 0x03, 0x44, 0x02, 0x00, 0xfe, 0x04, 0x33, 0x03, 0x44, 0xff, 0x22, 0x03, 0x00, 0xff, 0x16, 0x02, 0x44, 0xfe, 0x41, 0x11, 0x03, 0x00, 0xf9, 0x0a, 0x3d, 0x44, 0x41, 0x04, 0x00, 0x16, 0x02, 0x44, 0xfe, 0x41, 0x11, 0x03, 0x00, 0xfb, 0x0a, 0x3d, 0x44, 0x41, 0x04, 0x02, 0x00, 0x03, 0x44, 0xfa, 0x2d, 0x11, 0x04, 0x00, 0x0a, 0x38, 0x02, 0x44, 0xfe, 0x41, 0x00, 0x03, 0x44, 0xfd, 0x00, 0x04, 0x2d, 0x03, 0x44, 0xff, 0x22, 0x04, 0x00, 0xff, 0x2d, 0x02, 0x44, 0xff, 0x22, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x44, 0xfd, 0x1c, 0x00, 0x2d, 0x02, 0x44, 0xff, 0x22, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x44, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x44, 0x05, 0x00, 0xff, 0x16, 0x03, 0x44, 0xff, 0x00, 0x08, 0x44, 0xff, 0x22, 0x05, 0x00, 0xff, 0x3d, 0x02, 0x44, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xfd, 0x25, 0x00, 0x3d, 0x02, 0x44, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xff, 0x25, 0x02, 0x00, 0x03, 0x44, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x44, 0xff, 0x00, 0x07, 0x44, 0xff, 0x22, 0x06, 0x00, 0x0c, 0x44, 0xfe, 0x2d, 0x00, 0x0c, 0x44, 0xff, 0x2d, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0xff, 0x00, 0x07, 0x44, 0xff, 0x22, 0x06, 0x00, 0x0c, 0x44, 0xfe, 0x2d, 0x00, 0x0c, 0x44, 0xff, 0x2d, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0xff, 0x00, 0x03, 0x44, 0xfe, 0x00, 0x28, 0x03, 0x44, 0xff, 0x22, 0x05, 0x00, 0xfd, 0x3d, 0x44, 0x41, 0x0b, 0x00, 0xfd, 0x3d, 0x44, 0x41, 0x0c, 0x00, 0x03, 0x44, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x44, 0xff, 0x00, 0x03, 0x44, 0x02, 0x00, 0xff, 0x2d, 0x03, 0x44, 0xff, 0x22, 0x04, 0x00, 0xff, 0x33, 0x02, 0x44, 0xff, 0x04, 0x0a, 0x00, 0xff, 0x33, 0x02, 0x44, 0xff, 0x04, 0x0b, 0x00, 0x03, 0x44, 0x05, 0x00, 0xff, 0x16, 0x03, 0x44, 0xff, 0x00, 0x03, 0x44, 0x02, 0x00, 0xfe, 0x04, 0x33, 0x03, 0x44, 0xff, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xff, 0x28, 0x05, 0x00, 0xfd, 0x16, 0x28, 0x04, 0x02, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xff, 0x28, 0x05, 0x00, 0xfd, 0x16, 0x28, 0x04, 0x03, 0x00, 0x03, 0x44, 0xfe, 0x2d, 0x11, 0x02, 0x04, 0xfe, 0x0a, 0x38, 0x02, 0x44, 0xfe, 0x41, 0x00, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x04, 0x3d, 0x04, 0x44, 0x02, 0x00, 0xfe, 0x04, 0x3d, 0x02, 0x44, 0xfb, 0x38, 0x2d, 0x28, 0x2d, 0x3d, 0x02, 0x44, 0xff, 0x25, 0x02, 0x00, 0xfe, 0x04, 0x3d, 0x02, 0x44, 0xfb, 0x38, 0x2d, 0x28, 0x2d, 0x3d, 0x02, 0x44, 0xff, 0x25, 0x03, 0x00, 0x0b, 0x44, 0xfe, 0x2d, 0x00, 0x03, 0x44, 0x04, 0x00, 0xfe, 0x0a, 0x3d, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x11, 0x41, 0x08, 0x44, 0xff, 0x28, 0x03, 0x00, 0xfe, 0x11, 0x41, 0x08, 0x44, 0xff, 0x28, 0x03, 0x00, 0x03, 0x44, 0xff, 0x38, 0x06, 0x44, 0xfd, 0x38, 0x0a, 0x00, 0x03, 0x44, 0x05, 0x00, 0xfe, 0x11, 0x41, 0x02, 0x44, 0x04, 0x00, 0xf7, 0x0a, 0x28, 0x3d, 0x44, 0x41, 0x3d, 0x33, 0x28, 0x11, 0x05, 0x00, 0xf7, 0x0a, 0x28, 0x3d, 0x44, 0x41, 0x3d, 0x33, 0x28, 0x11, 0x04, 0x00, 0x03, 0x44, 0xf8, 0x04, 0x25, 0x3d, 0x44, 0x41, 0x33, 0x1c, 0x04, 0x02, 0x00, 0x03, 0x44, 0x28, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x28, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x28, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x28, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x05, 0x00, 0xfe, 0x11, 0x41, 0x02, 0x44, 0x04, 0x00, 0xfd, 0x04, 0x25, 0x3d, 0x03, 0x44, 0xfd, 0x38, 0x22, 0x04, 0x02, 0x00, 0x05, 0x44, 0x04, 0x00, 0x05, 0x44, 0x02, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x04, 0x00, 0xfe, 0x0a, 0x3d, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x0a, 0x38, 0x07, 0x44, 0xfd, 0x33, 0x04, 0x00, 0x05, 0x44, 0x04, 0x00, 0x05, 0x44, 0x02, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x0a, 0x38, 0x04, 0x44, 0x03, 0x00, 0xff, 0x38, 0x02, 0x44, 0xfb, 0x41, 0x33, 0x28, 0x2d, 0x3d, 0x02, 0x44, 0xff, 0x25, 0x03, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x02, 0x00, 0x03, 0x44, 0x0a, 0x00, 0x03, 0x44, 0x02, 0x00, 0xfe, 0x04, 0x33, 0x03, 0x44, 0xff, 0x22, 0x03, 0x00, 0xff, 0x16, 0x02, 0x44, 0xfe, 0x41, 0x11, 0x03, 0x00, 0xfb, 0x0a, 0x3d, 0x44, 0x41, 0x04, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x0f, 0x00, 0x03, 0x44, 0xfd, 0x00, 0x04, 0x2d, 0x03, 0x44, 0xff, 0x22, 0x04, 0x00, 0xff, 0x2d, 0x02, 0x44, 0xff, 0x22, 0x05, 0x00, 0xff, 0x2d, 0x02, 0x44, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x0f, 0x00, 0x08, 0x44, 0xff, 0x22, 0x05, 0x00, 0xff, 0x3d, 0x02, 0x44, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xff, 0x25, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x0f, 0x00, 0x07, 0x44, 0xff, 0x22, 0x06, 0x00, 0x0c, 0x44, 0xff, 0x2d, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x0f, 0x00, 0x07, 0x44, 0xff, 0x22, 0x06, 0x00, 0x0c, 0x44, 0xff, 0x2d, 0x02, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x0f, 0x00, 0x03, 0x44, 0xfe, 0x00, 0x28, 0x03, 0x44, 0xff, 0x22, 0x05, 0x00, 0xfd, 0x3d, 0x44, 0x41, 0x0c, 0x00, 0x03, 0x44, 0x06, 0x00, 0x03, 0x44, 0x0f, 0x00, 0x03, 0x44, 0x02, 0x00, 0xff, 0x2d, 0x03, 0x44, 0xff, 0x22, 0x04, 0x00, 0xff, 0x33, 0x02, 0x44, 0xff, 0x04, 0x0b, 0x00, 0xff, 0x3d, 0x02, 0x44, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x04, 0x03, 0x44, 0x0f, 0x00, 0x03, 0x44, 0x02, 0x00, 0xfe, 0x04, 0x33, 0x03, 0x44, 0xff, 0x22, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xff, 0x28, 0x05, 0x00, 0xfd, 0x16, 0x28, 0x04, 0x03, 0x00, 0xff, 0x33, 0x02, 0x44, 0xff, 0x1c, 0x03, 0x00, 0xfe, 0x04, 0x2d, 0x03, 0x44, 0x0f, 0x00, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x04, 0x3d, 0x04, 0x44, 0x02, 0x00, 0xfe, 0x04, 0x3d, 0x02, 0x44, 0xfb, 0x38, 0x2d, 0x28, 0x2d, 0x3d, 0x02, 0x44, 0xff, 0x25, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x44, 0xff, 0x41, 0x02, 0x28, 0xfe, 0x2d, 0x3d, 0x04, 0x44, 0x0f, 0x00, 0x03, 0x44, 0x04, 0x00, 0xfe, 0x0a, 0x3d, 0x03, 0x44, 0x03, 0x00, 0xfe, 0x11, 0x41, 0x08, 0x44, 0xff, 0x28, 0x03, 0x00, 0xfe, 0x04, 0x38, 0x06, 0x44, 0xff, 0x28, 0x03, 0x44, 0x0f, 0x00, 0x03, 0x44, 0x05, 0x00, 0xfe, 0x11, 0x41, 0x02, 0x44, 0x04, 0x00, 0xf7, 0x0a, 0x28, 0x3d, 0x44, 0x41, 0x3d, 0x33, 0x28, 0x11, 0x05, 0x00, 0xf8, 0x04, 0x2d, 0x3d, 0x44, 0x3d, 0x33, 0x1c, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x35, 0x00, 0x03, 0x44, 0x34, 0x00, 0xff, 0x3d, 0x02, 0x44, 0xff, 0x41, 0x34, 0x00, 0x03, 0x44, 0xff, 0x38, 0x34, 0x00, 0xfc, 0x2d, 0x41, 0x3d, 0x16, 0x0e, 0x00
+};
+static const Image logo_5_image = {logo_5_data, 56, 49};
 
-static void logo_6(uint8_t *data)
+static const uint8_t logo_6_data[1181] =
 {
-    const uint8_t image_data[1181] =
-    {
-        0x7f, 0x00, 0x29, 0x00, 0xfc, 0x38, 0x51, 0x4d, 0x1c, 0x34, 0x00, 0x03, 0x55, 0xff, 0x49, 0x34, 0x00, 0xff, 0x4d, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x05, 0x00, 0xfe, 0x13, 0x51, 0x02, 0x55, 0x04, 0x00, 0xfd, 0x04, 0x2d, 0x4d, 0x03, 0x55, 0xfd, 0x49, 0x28, 0x04, 0x05, 0x00, 0xfd, 0x04, 0x2d, 0x4d, 0x03, 0x55, 0xfd, 0x49, 0x28, 0x04, 0x03, 0x00, 0xf4, 0x38, 0x51, 0x4d, 0x1c, 0x04, 0x2d, 0x49, 0x55, 0x51, 0x3f, 0x28, 0x04, 0x02, 0x00, 0x03, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0x4d, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x07, 0x55, 0xfe, 0x3f, 0x04, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x07, 0x55, 0xfe, 0x3f, 0x04, 0x02, 0x00, 0x03, 0x55, 0x02, 0x49, 0x06, 0x55, 0xfd, 0x49, 0x0a, 0x00, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x04, 0x55, 0x03, 0x00, 0xff, 0x44, 0x03, 0x55, 0xfc, 0x3f, 0x33, 0x38, 0x4d, 0x02, 0x55, 0xff, 0x2d, 0x03, 0x00, 0xff, 0x44, 0x03, 0x55, 0xfc, 0x3f, 0x33, 0x38, 0x4d, 0x02, 0x55, 0xff, 0x2d, 0x02, 0x00, 0xff, 0x4d, 0x0b, 0x55, 0xfe, 0x38, 0x00, 0x03, 0x55, 0x02, 0x00, 0xfe, 0x04, 0x44, 0x03, 0x55, 0xff, 0x2d, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x55, 0xfe, 0x51, 0x13, 0x03, 0x00, 0xfe, 0x0a, 0x51, 0x02, 0x55, 0xfd, 0x04, 0x00, 0x1c, 0x02, 0x55, 0xfe, 0x51, 0x13, 0x03, 0x00, 0xfe, 0x0a, 0x51, 0x02, 0x55, 0xff, 0x04, 0x02, 0x00, 0x03, 0x55, 0xfa, 0x38, 0x13, 0x04, 0x00, 0x13, 0x49, 0x02, 0x55, 0xfe, 0x51, 0x00, 0x03, 0x55, 0x02, 0x00, 0xff, 0x3f, 0x03, 0x55, 0xff, 0x2d, 0x04, 0x00, 0xff, 0x38, 0x02, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xff, 0x33, 0x02, 0x55, 0xfd, 0x23, 0x00, 0x38, 0x02, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xff, 0x33, 0x02, 0x55, 0xff, 0x23, 0x02, 0x00, 0x03, 0x55, 0x05, 0x00, 0xff, 0x1c, 0x03, 0x55, 0xff, 0x00, 0x08, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xff, 0x49, 0x02, 0x55, 0xff, 0x13, 0x05, 0x00, 0xff, 0x23, 0x02, 0x55, 0xfd, 0x2d, 0x00, 0x49, 0x02, 0x55, 0xff, 0x13, 0x05, 0x00, 0xff, 0x23, 0x02, 0x55, 0xff, 0x2d, 0x02, 0x00, 0x03, 0x55, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x55, 0xff, 0x00, 0x07, 0x55, 0xff, 0x2d, 0x06, 0x00, 0x0c, 0x55, 0xfe, 0x38, 0x00, 0x0c, 0x55, 0xff, 0x38, 0x02, 0x00, 0x03, 0x55, 0x05, 0x00, 0xff, 0x04, 0x03, 0x55, 0xff, 0x00, 0x07, 0x55, 0xff, 0x28, 0x06, 0x00, 0x0c, 0x55, 0xfe, 0x38, 0x00, 0x0c, 0x55, 0xff, 0x38, 0x02, 0x00, 0x03, 0x55, 0x05, 0x00, 0xff, 0x04, 0x03, 0x55, 0xff, 0x00, 0x03, 0x55, 0xfe, 0x00, 0x33, 0x03, 0x55, 0xff, 0x28, 0x05, 0x00, 0xfd, 0x4d, 0x55, 0x51, 0x0b, 0x00, 0xfd, 0x4d, 0x55, 0x51, 0x0c, 0x00, 0x03, 0x55, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x55, 0xff, 0x00, 0x03, 0x55, 0x02, 0x00, 0xff, 0x3f, 0x03, 0x55, 0xff, 0x28, 0x04, 0x00, 0xff, 0x3f, 0x02, 0x55, 0xff, 0x04, 0x0a, 0x00, 0xff, 0x3f, 0x02, 0x55, 0xff, 0x04, 0x0b, 0x00, 0x03, 0x55, 0x05, 0x00, 0xff, 0x1c, 0x03, 0x55, 0xff, 0x00, 0x03, 0x55, 0x02, 0x00, 0xfe, 0x04, 0x44, 0x03, 0x55, 0xff, 0x28, 0x03, 0x00, 0xff, 0x23, 0x02, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xfd, 0x1c, 0x33, 0x04, 0x02, 0x00, 0xff, 0x23, 0x02, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xfd, 0x1c, 0x33, 0x04, 0x03, 0x00, 0x03, 0x55, 0xfa, 0x38, 0x13, 0x04, 0x00, 0x13, 0x49, 0x02, 0x55, 0xfe, 0x51, 0x00, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x04, 0x55, 0x02, 0x00, 0xfe, 0x04, 0x4d, 0x02, 0x55, 0xfb, 0x49, 0x38, 0x33, 0x38, 0x4d, 0x02, 0x55, 0xff, 0x2d, 0x02, 0x00, 0xfe, 0x04, 0x4d, 0x02, 0x55, 0xfb, 0x49, 0x38, 0x33, 0x38, 0x4d, 0x02, 0x55, 0xff, 0x2d, 0x03, 0x00, 0x0b, 0x55, 0xfe, 0x38, 0x00, 0x03, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0x4d, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x13, 0x51, 0x08, 0x55, 0xff, 0x33, 0x03, 0x00, 0xfe, 0x13, 0x51, 0x08, 0x55, 0xff, 0x33, 0x03, 0x00, 0x03, 0x55, 0xff, 0x49, 0x06, 0x55, 0xfd, 0x49, 0x0a, 0x00, 0x03, 0x55, 0x05, 0x00, 0xfe, 0x13, 0x51, 0x02, 0x55, 0x04, 0x00, 0xf7, 0x0a, 0x33, 0x4d, 0x55, 0x51, 0x4d, 0x3f, 0x33, 0x13, 0x05, 0x00, 0xf7, 0x0a, 0x33, 0x4d, 0x55, 0x51, 0x4d, 0x3f, 0x33, 0x13, 0x04, 0x00, 0x03, 0x55, 0xf8, 0x04, 0x2d, 0x49, 0x55, 0x51, 0x3f, 0x28, 0x04, 0x02, 0x00, 0x03, 0x55, 0x28, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x28, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x28, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x28, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x05, 0x00, 0xfe, 0x13, 0x51, 0x02, 0x55, 0x04, 0x00, 0xfd, 0x04, 0x2d, 0x4d, 0x03, 0x55, 0xfd, 0x49, 0x28, 0x04, 0x02, 0x00, 0x05, 0x55, 0x04, 0x00, 0x05, 0x55, 0x02, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0x4d, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x07, 0x55, 0xfd, 0x3f, 0x04, 0x00, 0x05, 0x55, 0x04, 0x00, 0x05, 0x55, 0x02, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x04, 0x55, 0x03, 0x00, 0xff, 0x44, 0x03, 0x55, 0xfc, 0x3f, 0x33, 0x38, 0x4d, 0x02, 0x55, 0xff, 0x2d, 0x03, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x02, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x02, 0x00, 0xfe, 0x04, 0x44, 0x03, 0x55, 0xff, 0x2d, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x55, 0xfe, 0x51, 0x13, 0x03, 0x00, 0xfe, 0x0a, 0x51, 0x02, 0x55, 0xff, 0x04, 0x02, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x0f, 0x00, 0x03, 0x55, 0x02, 0x00, 0xff, 0x3f, 0x03, 0x55, 0xff, 0x2d, 0x04, 0x00, 0xff, 0x38, 0x02, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xff, 0x33, 0x02, 0x55, 0xff, 0x23, 0x02, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x0f, 0x00, 0x08, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xff, 0x49, 0x02, 0x55, 0xff, 0x13, 0x05, 0x00, 0xff, 0x23, 0x02, 0x55, 0xff, 0x2d, 0x02, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x0f, 0x00, 0x07, 0x55, 0xff, 0x2d, 0x06, 0x00, 0x0c, 0x55, 0xff, 0x38, 0x02, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x0f, 0x00, 0x07, 0x55, 0xff, 0x28, 0x06, 0x00, 0x0c, 0x55, 0xff, 0x38, 0x02, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x0f, 0x00, 0x03, 0x55, 0xfe, 0x00, 0x33, 0x03, 0x55, 0xff, 0x28, 0x05, 0x00, 0xfd, 0x4d, 0x55, 0x51, 0x0c, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x0f, 0x00, 0x03, 0x55, 0x02, 0x00, 0xff, 0x3f, 0x03, 0x55, 0xff, 0x28, 0x04, 0x00, 0xff, 0x3f, 0x02, 0x55, 0xff, 0x04, 0x0b, 0x00, 0xff, 0x4d, 0x02, 0x55, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x04, 0x03, 0x55, 0x0f, 0x00, 0x03, 0x55, 0x02, 0x00, 0xfe, 0x04, 0x44, 0x03, 0x55, 0xff, 0x28, 0x03, 0x00, 0xff, 0x23, 0x02, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xfd, 0x1c, 0x33, 0x04, 0x03, 0x00, 0xff, 0x3f, 0x02, 0x55, 0xff, 0x23, 0x04, 0x00, 0xff, 0x3f, 0x03, 0x55, 0x0f, 0x00, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x04, 0x55, 0x02, 0x00, 0xfe, 0x04, 0x4d, 0x02, 0x55, 0xfb, 0x49, 0x38, 0x33, 0x38, 0x4d, 0x02, 0x55, 0xff, 0x2d, 0x03, 0x00, 0xff, 0x23, 0x02, 0x55, 0xff, 0x51, 0x02, 0x33, 0xfe, 0x38, 0x4d, 0x04, 0x55, 0x0f, 0x00, 0x03, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0x4d, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x13, 0x51, 0x08, 0x55, 0xff, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x49, 0x06, 0x55, 0xff, 0x33, 0x03, 0x55, 0x0f, 0x00, 0x03, 0x55, 0x05, 0x00, 0xfe, 0x13, 0x51, 0x02, 0x55, 0x04, 0x00, 0xf7, 0x0a, 0x33, 0x4d, 0x55, 0x51, 0x4d, 0x3f, 0x33, 0x13, 0x05, 0x00, 0xf8, 0x0a, 0x33, 0x4d, 0x55, 0x4d, 0x3f, 0x23, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x34, 0x00, 0xff, 0x4d, 0x03, 0x55, 0x34, 0x00, 0x03, 0x55, 0xff, 0x49, 0x34, 0x00, 0xfc, 0x38, 0x51, 0x4d, 0x1c, 0x0e, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_6_image = {(void *) &logo_6, 56, 49};
+    0x7f, 0x00, 0x29, 0x00, 0xfc, 0x38, 0x51, 0x4d, 0x1c, 0x34, 0x00, 0x03, 0x55, 0xff, 0x49, 0x34, 0x00, 0xff, 0x4d, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x05, 0x00, 0xfe, 0x13, 0x51, 0x02, 0x55, 0x04, 0x00, 0xfd, 0x04, 0x2d, 0x4d, 0x03, 0x55, 0xfd, 0x49, 0x28, 0x04, 0x05, 0x00, 0xfd, 0x04, 0x2d, 0x4d, 0x03, 0x55, 0xfd, 0x49, 0x28, 0x04, 0x03, 0x00, 0xf4, 0x38, 0x51, 0x4d, 0x1c, 0x04, 0x2d, 0x49, 0x55, 0x51, 0x3f, 0x28, 0x04, 0x02, 0x00, 0x03, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0x4d, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x07, 0x55, 0xfe, 0x3f, 0x04, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x07, 0x55, 0xfe, 0x3f, 0x04, 0x02, 0x00, 0x03, 0x55, 0x02, 0x49, 0x06, 0x55, 0xfd, 0x49, 0x0a, 0x00, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x04, 0x55, 0x03, 0x00, 0xff, 0x44, 0x03, 0x55, 0xfc, 0x3f, 0x33, 0x38, 0x4d, 0x02, 0x55, 0xff, 0x2d, 0x03, 0x00, 0xff, 0x44, 0x03, 0x55, 0xfc, 0x3f, 0x33, 0x38, 0x4d, 0x02, 0x55, 0xff, 0x2d, 0x02, 0x00, 0xff, 0x4d, 0x0b, 0x55, 0xfe, 0x38, 0x00, 0x03, 0x55, 0x02, 0x00, 0xfe, 0x04, 0x44, 0x03, 0x55, 0xff, 0x2d, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x55, 0xfe, 0x51, 0x13, 0x03, 0x00, 0xfe, 0x0a, 0x51, 0x02, 0x55, 0xfd, 0x04, 0x00, 0x1c, 0x02, 0x55, 0xfe, 0x51, 0x13, 0x03, 0x00, 0xfe, 0x0a, 0x51, 0x02, 0x55, 0xff, 0x04, 0x02, 0x00, 0x03, 0x55, 0xfa, 0x38, 0x13, 0x04, 0x00, 0x13, 0x49, 0x02, 0x55, 0xfe, 0x51, 0x00, 0x03, 0x55, 0x02, 0x00, 0xff, 0x3f, 0x03, 0x55, 0xff, 0x2d, 0x04, 0x00, 0xff, 0x38, 0x02, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xff, 0x33, 0x02, 0x55, 0xfd, 0x23, 0x00, 0x38, 0x02, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xff, 0x33, 0x02, 0x55, 0xff, 0x23, 0x02, 0x00, 0x03, 0x55, 0x05, 0x00, 0xff, 0x1c, 0x03, 0x55, 0xff, 0x00, 0x08, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xff, 0x49, 0x02, 0x55, 0xff, 0x13, 0x05, 0x00, 0xff, 0x23, 0x02, 0x55, 0xfd, 0x2d, 0x00, 0x49, 0x02, 0x55, 0xff, 0x13, 0x05, 0x00, 0xff, 0x23, 0x02, 0x55, 0xff, 0x2d, 0x02, 0x00, 0x03, 0x55, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x55, 0xff, 0x00, 0x07, 0x55, 0xff, 0x2d, 0x06, 0x00, 0x0c, 0x55, 0xfe, 0x38, 0x00, 0x0c, 0x55, 0xff, 0x38, 0x02, 0x00, 0x03, 0x55, 0x05, 0x00, 0xff, 0x04, 0x03, 0x55, 0xff, 0x00, 0x07, 0x55, 0xff, 0x28, 0x06, 0x00, 0x0c, 0x55, 0xfe, 0x38, 0x00, 0x0c, 0x55, 0xff, 0x38, 0x02, 0x00, 0x03, 0x55, 0x05, 0x00, 0xff, 0x04, 0x03, 0x55, 0xff, 0x00, 0x03, 0x55, 0xfe, 0x00, 0x33, 0x03, 0x55, 0xff, 0x28, 0x05, 0x00, 0xfd, 0x4d, 0x55, 0x51, 0x0b, 0x00, 0xfd, 0x4d, 0x55, 0x51, 0x0c, 0x00, 0x03, 0x55, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x55, 0xff, 0x00, 0x03, 0x55, 0x02, 0x00, 0xff, 0x3f, 0x03, 0x55, 0xff, 0x28, 0x04, 0x00, 0xff, 0x3f, 0x02, 0x55, 0xff, 0x04, 0x0a, 0x00, 0xff, 0x3f, 0x02, 0x55, 0xff, 0x04, 0x0b, 0x00, 0x03, 0x55, 0x05, 0x00, 0xff, 0x1c, 0x03, 0x55, 0xff, 0x00, 0x03, 0x55, 0x02, 0x00, 0xfe, 0x04, 0x44, 0x03, 0x55, 0xff, 0x28, 0x03, 0x00, 0xff, 0x23, 0x02, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xfd, 0x1c, 0x33, 0x04, 0x02, 0x00, 0xff, 0x23, 0x02, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xfd, 0x1c, 0x33, 0x04, 0x03, 0x00, 0x03, 0x55, 0xfa, 0x38, 0x13, 0x04, 0x00, 0x13, 0x49, 0x02, 0x55, 0xfe, 0x51, 0x00, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x04, 0x55, 0x02, 0x00, 0xfe, 0x04, 0x4d, 0x02, 0x55, 0xfb, 0x49, 0x38, 0x33, 0x38, 0x4d, 0x02, 0x55, 0xff, 0x2d, 0x02, 0x00, 0xfe, 0x04, 0x4d, 0x02, 0x55, 0xfb, 0x49, 0x38, 0x33, 0x38, 0x4d, 0x02, 0x55, 0xff, 0x2d, 0x03, 0x00, 0x0b, 0x55, 0xfe, 0x38, 0x00, 0x03, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0x4d, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x13, 0x51, 0x08, 0x55, 0xff, 0x33, 0x03, 0x00, 0xfe, 0x13, 0x51, 0x08, 0x55, 0xff, 0x33, 0x03, 0x00, 0x03, 0x55, 0xff, 0x49, 0x06, 0x55, 0xfd, 0x49, 0x0a, 0x00, 0x03, 0x55, 0x05, 0x00, 0xfe, 0x13, 0x51, 0x02, 0x55, 0x04, 0x00, 0xf7, 0x0a, 0x33, 0x4d, 0x55, 0x51, 0x4d, 0x3f, 0x33, 0x13, 0x05, 0x00, 0xf7, 0x0a, 0x33, 0x4d, 0x55, 0x51, 0x4d, 0x3f, 0x33, 0x13, 0x04, 0x00, 0x03, 0x55, 0xf8, 0x04, 0x2d, 0x49, 0x55, 0x51, 0x3f, 0x28, 0x04, 0x02, 0x00, 0x03, 0x55, 0x28, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x28, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x28, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x28, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x05, 0x00, 0xfe, 0x13, 0x51, 0x02, 0x55, 0x04, 0x00, 0xfd, 0x04, 0x2d, 0x4d, 0x03, 0x55, 0xfd, 0x49, 0x28, 0x04, 0x02, 0x00, 0x05, 0x55, 0x04, 0x00, 0x05, 0x55, 0x02, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0x4d, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x07, 0x55, 0xfd, 0x3f, 0x04, 0x00, 0x05, 0x55, 0x04, 0x00, 0x05, 0x55, 0x02, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x04, 0x55, 0x03, 0x00, 0xff, 0x44, 0x03, 0x55, 0xfc, 0x3f, 0x33, 0x38, 0x4d, 0x02, 0x55, 0xff, 0x2d, 0x03, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x02, 0x00, 0x03, 0x55, 0x0a, 0x00, 0x03, 0x55, 0x02, 0x00, 0xfe, 0x04, 0x44, 0x03, 0x55, 0xff, 0x2d, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x55, 0xfe, 0x51, 0x13, 0x03, 0x00, 0xfe, 0x0a, 0x51, 0x02, 0x55, 0xff, 0x04, 0x02, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x0f, 0x00, 0x03, 0x55, 0x02, 0x00, 0xff, 0x3f, 0x03, 0x55, 0xff, 0x2d, 0x04, 0x00, 0xff, 0x38, 0x02, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xff, 0x33, 0x02, 0x55, 0xff, 0x23, 0x02, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x0f, 0x00, 0x08, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xff, 0x49, 0x02, 0x55, 0xff, 0x13, 0x05, 0x00, 0xff, 0x23, 0x02, 0x55, 0xff, 0x2d, 0x02, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x0f, 0x00, 0x07, 0x55, 0xff, 0x2d, 0x06, 0x00, 0x0c, 0x55, 0xff, 0x38, 0x02, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x0f, 0x00, 0x07, 0x55, 0xff, 0x28, 0x06, 0x00, 0x0c, 0x55, 0xff, 0x38, 0x02, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x0f, 0x00, 0x03, 0x55, 0xfe, 0x00, 0x33, 0x03, 0x55, 0xff, 0x28, 0x05, 0x00, 0xfd, 0x4d, 0x55, 0x51, 0x0c, 0x00, 0x03, 0x55, 0x06, 0x00, 0x03, 0x55, 0x0f, 0x00, 0x03, 0x55, 0x02, 0x00, 0xff, 0x3f, 0x03, 0x55, 0xff, 0x28, 0x04, 0x00, 0xff, 0x3f, 0x02, 0x55, 0xff, 0x04, 0x0b, 0x00, 0xff, 0x4d, 0x02, 0x55, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x04, 0x03, 0x55, 0x0f, 0x00, 0x03, 0x55, 0x02, 0x00, 0xfe, 0x04, 0x44, 0x03, 0x55, 0xff, 0x28, 0x03, 0x00, 0xff, 0x23, 0x02, 0x55, 0xff, 0x2d, 0x05, 0x00, 0xfd, 0x1c, 0x33, 0x04, 0x03, 0x00, 0xff, 0x3f, 0x02, 0x55, 0xff, 0x23, 0x04, 0x00, 0xff, 0x3f, 0x03, 0x55, 0x0f, 0x00, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x0a, 0x49, 0x04, 0x55, 0x02, 0x00, 0xfe, 0x04, 0x4d, 0x02, 0x55, 0xfb, 0x49, 0x38, 0x33, 0x38, 0x4d, 0x02, 0x55, 0xff, 0x2d, 0x03, 0x00, 0xff, 0x23, 0x02, 0x55, 0xff, 0x51, 0x02, 0x33, 0xfe, 0x38, 0x4d, 0x04, 0x55, 0x0f, 0x00, 0x03, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0x4d, 0x03, 0x55, 0x03, 0x00, 0xfe, 0x13, 0x51, 0x08, 0x55, 0xff, 0x33, 0x03, 0x00, 0xfe, 0x04, 0x49, 0x06, 0x55, 0xff, 0x33, 0x03, 0x55, 0x0f, 0x00, 0x03, 0x55, 0x05, 0x00, 0xfe, 0x13, 0x51, 0x02, 0x55, 0x04, 0x00, 0xf7, 0x0a, 0x33, 0x4d, 0x55, 0x51, 0x4d, 0x3f, 0x33, 0x13, 0x05, 0x00, 0xf8, 0x0a, 0x33, 0x4d, 0x55, 0x4d, 0x3f, 0x23, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x55, 0x34, 0x00, 0xff, 0x4d, 0x03, 0x55, 0x34, 0x00, 0x03, 0x55, 0xff, 0x49, 0x34, 0x00, 0xfc, 0x38, 0x51, 0x4d, 0x1c, 0x0e, 0x00
+};
+static const Image logo_6_image = {logo_6_data, 56, 49};
 
-static void logo_7(uint8_t *data)
+static const uint8_t logo_7_data[1194] =
 {
-    const uint8_t image_data[1194] =
-    {
-        0x70, 0x00, 0xfc, 0x42, 0x61, 0x5d, 0x16, 0x34, 0x00, 0x03, 0x66, 0xff, 0x53, 0x34, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x16, 0x61, 0x02, 0x66, 0x04, 0x00, 0xfd, 0x0a, 0x38, 0x59, 0x02, 0x66, 0xfc, 0x64, 0x59, 0x33, 0x04, 0x05, 0x00, 0xfd, 0x0a, 0x38, 0x59, 0x02, 0x66, 0xfc, 0x64, 0x59, 0x33, 0x04, 0x03, 0x00, 0xf4, 0x42, 0x61, 0x5d, 0x16, 0x0a, 0x33, 0x53, 0x66, 0x61, 0x4b, 0x27, 0x04, 0x02, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x16, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0a, 0x59, 0x07, 0x66, 0xfe, 0x4b, 0x04, 0x03, 0x00, 0xfe, 0x0a, 0x59, 0x07, 0x66, 0xfe, 0x4b, 0x04, 0x02, 0x00, 0x03, 0x66, 0xfe, 0x59, 0x53, 0x06, 0x66, 0xfd, 0x59, 0x0a, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0a, 0x53, 0x04, 0x66, 0x03, 0x00, 0xff, 0x53, 0x02, 0x66, 0xfb, 0x64, 0x4b, 0x3d, 0x42, 0x5d, 0x02, 0x66, 0xff, 0x38, 0x03, 0x00, 0xff, 0x53, 0x02, 0x66, 0xfb, 0x64, 0x4b, 0x3d, 0x42, 0x5d, 0x02, 0x66, 0xff, 0x38, 0x02, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x08, 0x66, 0xfe, 0x42, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x04, 0x53, 0x03, 0x66, 0xff, 0x33, 0x03, 0x00, 0xff, 0x27, 0x02, 0x66, 0xfe, 0x61, 0x16, 0x03, 0x00, 0xf9, 0x0a, 0x61, 0x66, 0x61, 0x0a, 0x00, 0x27, 0x02, 0x66, 0xfe, 0x61, 0x16, 0x03, 0x00, 0xfb, 0x0a, 0x61, 0x66, 0x61, 0x0a, 0x02, 0x00, 0x03, 0x66, 0xfe, 0x42, 0x16, 0x02, 0x04, 0xfe, 0x16, 0x53, 0x02, 0x66, 0xfe, 0x61, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x4b, 0x03, 0x66, 0xff, 0x33, 0x04, 0x00, 0xff, 0x42, 0x02, 0x66, 0xff, 0x33, 0x05, 0x00, 0xff, 0x42, 0x02, 0x66, 0xfd, 0x27, 0x00, 0x42, 0x02, 0x66, 0xff, 0x33, 0x05, 0x00, 0xff, 0x42, 0x02, 0x66, 0xff, 0x27, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x27, 0x03, 0x66, 0xff, 0x00, 0x08, 0x66, 0xff, 0x33, 0x05, 0x00, 0xff, 0x59, 0x02, 0x66, 0xff, 0x16, 0x05, 0x00, 0xff, 0x27, 0x02, 0x66, 0xfd, 0x38, 0x00, 0x59, 0x02, 0x66, 0xff, 0x16, 0x05, 0x00, 0xff, 0x27, 0x02, 0x66, 0xff, 0x38, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x66, 0xff, 0x00, 0x07, 0x66, 0xff, 0x33, 0x06, 0x00, 0x0c, 0x66, 0xfe, 0x42, 0x00, 0x0c, 0x66, 0xff, 0x42, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x04, 0x03, 0x66, 0xff, 0x00, 0x07, 0x66, 0xff, 0x33, 0x06, 0x00, 0x0c, 0x66, 0xfe, 0x42, 0x00, 0x0c, 0x66, 0xff, 0x42, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x04, 0x03, 0x66, 0xff, 0x00, 0x03, 0x66, 0xfe, 0x00, 0x3d, 0x03, 0x66, 0xff, 0x33, 0x05, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0b, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0c, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x66, 0xff, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x4b, 0x03, 0x66, 0xff, 0x33, 0x04, 0x00, 0xff, 0x4b, 0x02, 0x66, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x4b, 0x02, 0x66, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x27, 0x03, 0x66, 0xff, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x04, 0x53, 0x03, 0x66, 0xff, 0x33, 0x03, 0x00, 0xff, 0x27, 0x02, 0x66, 0xff, 0x38, 0x05, 0x00, 0xfd, 0x27, 0x3d, 0x0a, 0x02, 0x00, 0xff, 0x27, 0x02, 0x66, 0xff, 0x38, 0x05, 0x00, 0xfd, 0x27, 0x3d, 0x0a, 0x03, 0x00, 0x03, 0x66, 0xfe, 0x42, 0x16, 0x02, 0x04, 0xfe, 0x16, 0x53, 0x02, 0x66, 0xfe, 0x61, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0a, 0x59, 0x04, 0x66, 0x02, 0x00, 0xfe, 0x04, 0x5d, 0x02, 0x66, 0xfb, 0x53, 0x42, 0x3d, 0x42, 0x5d, 0x02, 0x66, 0xff, 0x38, 0x02, 0x00, 0xfe, 0x04, 0x5d, 0x02, 0x66, 0xfb, 0x53, 0x42, 0x3d, 0x42, 0x5d, 0x02, 0x66, 0xff, 0x38, 0x03, 0x00, 0x0b, 0x66, 0xfe, 0x42, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x16, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x16, 0x5d, 0x08, 0x66, 0xff, 0x3d, 0x03, 0x00, 0xfe, 0x16, 0x5d, 0x08, 0x66, 0xff, 0x3d, 0x03, 0x00, 0x03, 0x66, 0xff, 0x59, 0x06, 0x66, 0xfd, 0x59, 0x0a, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x16, 0x61, 0x02, 0x66, 0x04, 0x00, 0xf7, 0x16, 0x3d, 0x5d, 0x66, 0x61, 0x5d, 0x4b, 0x38, 0x16, 0x05, 0x00, 0xf7, 0x16, 0x3d, 0x5d, 0x66, 0x61, 0x5d, 0x4b, 0x38, 0x16, 0x04, 0x00, 0x03, 0x66, 0xf8, 0x04, 0x38, 0x59, 0x66, 0x61, 0x4b, 0x27, 0x04, 0x02, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x16, 0x61, 0x02, 0x66, 0x04, 0x00, 0xfd, 0x0a, 0x38, 0x59, 0x02, 0x66, 0xfc, 0x64, 0x59, 0x33, 0x04, 0x02, 0x00, 0x05, 0x66, 0x04, 0x00, 0x05, 0x66, 0x02, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x16, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0a, 0x59, 0x07, 0x66, 0xfd, 0x4b, 0x04, 0x00, 0x05, 0x66, 0x04, 0x00, 0x05, 0x66, 0x02, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0a, 0x53, 0x04, 0x66, 0x03, 0x00, 0xff, 0x53, 0x02, 0x66, 0xfb, 0x64, 0x4b, 0x3d, 0x42, 0x5d, 0x02, 0x66, 0xff, 0x38, 0x03, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x02, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x04, 0x53, 0x03, 0x66, 0xff, 0x33, 0x03, 0x00, 0xff, 0x27, 0x02, 0x66, 0xfe, 0x61, 0x16, 0x03, 0x00, 0xfb, 0x0a, 0x61, 0x66, 0x61, 0x0a, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x0f, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x4b, 0x03, 0x66, 0xff, 0x33, 0x04, 0x00, 0xff, 0x42, 0x02, 0x66, 0xff, 0x33, 0x05, 0x00, 0xff, 0x42, 0x02, 0x66, 0xff, 0x27, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x0f, 0x00, 0x08, 0x66, 0xff, 0x33, 0x05, 0x00, 0xff, 0x59, 0x02, 0x66, 0xff, 0x16, 0x05, 0x00, 0xff, 0x27, 0x02, 0x66, 0xff, 0x38, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x0f, 0x00, 0x07, 0x66, 0xff, 0x33, 0x06, 0x00, 0x0c, 0x66, 0xff, 0x42, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x0f, 0x00, 0x07, 0x66, 0xff, 0x33, 0x06, 0x00, 0x0c, 0x66, 0xff, 0x42, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x0f, 0x00, 0x03, 0x66, 0xfe, 0x00, 0x3d, 0x03, 0x66, 0xff, 0x33, 0x05, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0c, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x0f, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x4b, 0x03, 0x66, 0xff, 0x33, 0x04, 0x00, 0xff, 0x4b, 0x02, 0x66, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x03, 0x66, 0x0f, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x04, 0x53, 0x03, 0x66, 0xff, 0x33, 0x03, 0x00, 0xff, 0x27, 0x02, 0x66, 0xff, 0x38, 0x05, 0x00, 0xfd, 0x27, 0x3d, 0x0a, 0x03, 0x00, 0xff, 0x4b, 0x02, 0x66, 0xff, 0x27, 0x03, 0x00, 0xfe, 0x04, 0x42, 0x03, 0x66, 0x0f, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0a, 0x59, 0x04, 0x66, 0x02, 0x00, 0xfe, 0x04, 0x5d, 0x02, 0x66, 0xfb, 0x53, 0x42, 0x3d, 0x42, 0x5d, 0x02, 0x66, 0xff, 0x38, 0x03, 0x00, 0xff, 0x27, 0x02, 0x66, 0xff, 0x61, 0x02, 0x3d, 0xfe, 0x42, 0x5d, 0x04, 0x66, 0x0f, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x16, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x16, 0x5d, 0x08, 0x66, 0xff, 0x3d, 0x03, 0x00, 0xfe, 0x04, 0x53, 0x06, 0x66, 0xff, 0x3d, 0x03, 0x66, 0x0f, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x16, 0x61, 0x02, 0x66, 0x04, 0x00, 0xf7, 0x16, 0x3d, 0x5d, 0x66, 0x61, 0x5d, 0x4b, 0x38, 0x16, 0x05, 0x00, 0xf8, 0x0a, 0x3d, 0x5d, 0x64, 0x5d, 0x4b, 0x27, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x34, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x34, 0x00, 0x03, 0x66, 0xff, 0x53, 0x34, 0x00, 0xfc, 0x42, 0x64, 0x5d, 0x16, 0x46, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_7_image = {(void *) &logo_7, 56, 49};
+    0x70, 0x00, 0xfc, 0x42, 0x61, 0x5d, 0x16, 0x34, 0x00, 0x03, 0x66, 0xff, 0x53, 0x34, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x16, 0x61, 0x02, 0x66, 0x04, 0x00, 0xfd, 0x0a, 0x38, 0x59, 0x02, 0x66, 0xfc, 0x64, 0x59, 0x33, 0x04, 0x05, 0x00, 0xfd, 0x0a, 0x38, 0x59, 0x02, 0x66, 0xfc, 0x64, 0x59, 0x33, 0x04, 0x03, 0x00, 0xf4, 0x42, 0x61, 0x5d, 0x16, 0x0a, 0x33, 0x53, 0x66, 0x61, 0x4b, 0x27, 0x04, 0x02, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x16, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0a, 0x59, 0x07, 0x66, 0xfe, 0x4b, 0x04, 0x03, 0x00, 0xfe, 0x0a, 0x59, 0x07, 0x66, 0xfe, 0x4b, 0x04, 0x02, 0x00, 0x03, 0x66, 0xfe, 0x59, 0x53, 0x06, 0x66, 0xfd, 0x59, 0x0a, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0a, 0x53, 0x04, 0x66, 0x03, 0x00, 0xff, 0x53, 0x02, 0x66, 0xfb, 0x64, 0x4b, 0x3d, 0x42, 0x5d, 0x02, 0x66, 0xff, 0x38, 0x03, 0x00, 0xff, 0x53, 0x02, 0x66, 0xfb, 0x64, 0x4b, 0x3d, 0x42, 0x5d, 0x02, 0x66, 0xff, 0x38, 0x02, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x08, 0x66, 0xfe, 0x42, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x04, 0x53, 0x03, 0x66, 0xff, 0x33, 0x03, 0x00, 0xff, 0x27, 0x02, 0x66, 0xfe, 0x61, 0x16, 0x03, 0x00, 0xf9, 0x0a, 0x61, 0x66, 0x61, 0x0a, 0x00, 0x27, 0x02, 0x66, 0xfe, 0x61, 0x16, 0x03, 0x00, 0xfb, 0x0a, 0x61, 0x66, 0x61, 0x0a, 0x02, 0x00, 0x03, 0x66, 0xfe, 0x42, 0x16, 0x02, 0x04, 0xfe, 0x16, 0x53, 0x02, 0x66, 0xfe, 0x61, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x4b, 0x03, 0x66, 0xff, 0x33, 0x04, 0x00, 0xff, 0x42, 0x02, 0x66, 0xff, 0x33, 0x05, 0x00, 0xff, 0x42, 0x02, 0x66, 0xfd, 0x27, 0x00, 0x42, 0x02, 0x66, 0xff, 0x33, 0x05, 0x00, 0xff, 0x42, 0x02, 0x66, 0xff, 0x27, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x27, 0x03, 0x66, 0xff, 0x00, 0x08, 0x66, 0xff, 0x33, 0x05, 0x00, 0xff, 0x59, 0x02, 0x66, 0xff, 0x16, 0x05, 0x00, 0xff, 0x27, 0x02, 0x66, 0xfd, 0x38, 0x00, 0x59, 0x02, 0x66, 0xff, 0x16, 0x05, 0x00, 0xff, 0x27, 0x02, 0x66, 0xff, 0x38, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x66, 0xff, 0x00, 0x07, 0x66, 0xff, 0x33, 0x06, 0x00, 0x0c, 0x66, 0xfe, 0x42, 0x00, 0x0c, 0x66, 0xff, 0x42, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x04, 0x03, 0x66, 0xff, 0x00, 0x07, 0x66, 0xff, 0x33, 0x06, 0x00, 0x0c, 0x66, 0xfe, 0x42, 0x00, 0x0c, 0x66, 0xff, 0x42, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x04, 0x03, 0x66, 0xff, 0x00, 0x03, 0x66, 0xfe, 0x00, 0x3d, 0x03, 0x66, 0xff, 0x33, 0x05, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0b, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0c, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x66, 0xff, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x4b, 0x03, 0x66, 0xff, 0x33, 0x04, 0x00, 0xff, 0x4b, 0x02, 0x66, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x4b, 0x02, 0x66, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x27, 0x03, 0x66, 0xff, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x04, 0x53, 0x03, 0x66, 0xff, 0x33, 0x03, 0x00, 0xff, 0x27, 0x02, 0x66, 0xff, 0x38, 0x05, 0x00, 0xfd, 0x27, 0x3d, 0x0a, 0x02, 0x00, 0xff, 0x27, 0x02, 0x66, 0xff, 0x38, 0x05, 0x00, 0xfd, 0x27, 0x3d, 0x0a, 0x03, 0x00, 0x03, 0x66, 0xfe, 0x42, 0x16, 0x02, 0x04, 0xfe, 0x16, 0x53, 0x02, 0x66, 0xfe, 0x61, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0a, 0x59, 0x04, 0x66, 0x02, 0x00, 0xfe, 0x04, 0x5d, 0x02, 0x66, 0xfb, 0x53, 0x42, 0x3d, 0x42, 0x5d, 0x02, 0x66, 0xff, 0x38, 0x02, 0x00, 0xfe, 0x04, 0x5d, 0x02, 0x66, 0xfb, 0x53, 0x42, 0x3d, 0x42, 0x5d, 0x02, 0x66, 0xff, 0x38, 0x03, 0x00, 0x0b, 0x66, 0xfe, 0x42, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x16, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x16, 0x5d, 0x08, 0x66, 0xff, 0x3d, 0x03, 0x00, 0xfe, 0x16, 0x5d, 0x08, 0x66, 0xff, 0x3d, 0x03, 0x00, 0x03, 0x66, 0xff, 0x59, 0x06, 0x66, 0xfd, 0x59, 0x0a, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x16, 0x61, 0x02, 0x66, 0x04, 0x00, 0xf7, 0x16, 0x3d, 0x5d, 0x66, 0x61, 0x5d, 0x4b, 0x38, 0x16, 0x05, 0x00, 0xf7, 0x16, 0x3d, 0x5d, 0x66, 0x61, 0x5d, 0x4b, 0x38, 0x16, 0x04, 0x00, 0x03, 0x66, 0xf8, 0x04, 0x38, 0x59, 0x66, 0x61, 0x4b, 0x27, 0x04, 0x02, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x16, 0x61, 0x02, 0x66, 0x04, 0x00, 0xfd, 0x0a, 0x38, 0x59, 0x02, 0x66, 0xfc, 0x64, 0x59, 0x33, 0x04, 0x02, 0x00, 0x05, 0x66, 0x04, 0x00, 0x05, 0x66, 0x02, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x16, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0a, 0x59, 0x07, 0x66, 0xfd, 0x4b, 0x04, 0x00, 0x05, 0x66, 0x04, 0x00, 0x05, 0x66, 0x02, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0a, 0x53, 0x04, 0x66, 0x03, 0x00, 0xff, 0x53, 0x02, 0x66, 0xfb, 0x64, 0x4b, 0x3d, 0x42, 0x5d, 0x02, 0x66, 0xff, 0x38, 0x03, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x02, 0x00, 0x03, 0x66, 0x0a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x04, 0x53, 0x03, 0x66, 0xff, 0x33, 0x03, 0x00, 0xff, 0x27, 0x02, 0x66, 0xfe, 0x61, 0x16, 0x03, 0x00, 0xfb, 0x0a, 0x61, 0x66, 0x61, 0x0a, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x0f, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x4b, 0x03, 0x66, 0xff, 0x33, 0x04, 0x00, 0xff, 0x42, 0x02, 0x66, 0xff, 0x33, 0x05, 0x00, 0xff, 0x42, 0x02, 0x66, 0xff, 0x27, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x0f, 0x00, 0x08, 0x66, 0xff, 0x33, 0x05, 0x00, 0xff, 0x59, 0x02, 0x66, 0xff, 0x16, 0x05, 0x00, 0xff, 0x27, 0x02, 0x66, 0xff, 0x38, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x0f, 0x00, 0x07, 0x66, 0xff, 0x33, 0x06, 0x00, 0x0c, 0x66, 0xff, 0x42, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x0f, 0x00, 0x07, 0x66, 0xff, 0x33, 0x06, 0x00, 0x0c, 0x66, 0xff, 0x42, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x0f, 0x00, 0x03, 0x66, 0xfe, 0x00, 0x3d, 0x03, 0x66, 0xff, 0x33, 0x05, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0c, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x0f, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x4b, 0x03, 0x66, 0xff, 0x33, 0x04, 0x00, 0xff, 0x4b, 0x02, 0x66, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x03, 0x66, 0x0f, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x04, 0x53, 0x03, 0x66, 0xff, 0x33, 0x03, 0x00, 0xff, 0x27, 0x02, 0x66, 0xff, 0x38, 0x05, 0x00, 0xfd, 0x27, 0x3d, 0x0a, 0x03, 0x00, 0xff, 0x4b, 0x02, 0x66, 0xff, 0x27, 0x03, 0x00, 0xfe, 0x04, 0x42, 0x03, 0x66, 0x0f, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0a, 0x59, 0x04, 0x66, 0x02, 0x00, 0xfe, 0x04, 0x5d, 0x02, 0x66, 0xfb, 0x53, 0x42, 0x3d, 0x42, 0x5d, 0x02, 0x66, 0xff, 0x38, 0x03, 0x00, 0xff, 0x27, 0x02, 0x66, 0xff, 0x61, 0x02, 0x3d, 0xfe, 0x42, 0x5d, 0x04, 0x66, 0x0f, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x16, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x16, 0x5d, 0x08, 0x66, 0xff, 0x3d, 0x03, 0x00, 0xfe, 0x04, 0x53, 0x06, 0x66, 0xff, 0x3d, 0x03, 0x66, 0x0f, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x16, 0x61, 0x02, 0x66, 0x04, 0x00, 0xf7, 0x16, 0x3d, 0x5d, 0x66, 0x61, 0x5d, 0x4b, 0x38, 0x16, 0x05, 0x00, 0xf8, 0x0a, 0x3d, 0x5d, 0x64, 0x5d, 0x4b, 0x27, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x35, 0x00, 0x03, 0x66, 0x34, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x34, 0x00, 0x03, 0x66, 0xff, 0x53, 0x34, 0x00, 0xfc, 0x42, 0x64, 0x5d, 0x16, 0x46, 0x00
+};
+static const Image logo_7_image = {logo_7_data, 56, 49};
 
-static void logo_8(uint8_t *data)
+static const uint8_t logo_8_data[1183] =
 {
-    const uint8_t image_data[1183] =
-    {
-        0x70, 0x00, 0xfc, 0x4f, 0x72, 0x6d, 0x23, 0x34, 0x00, 0x03, 0x77, 0xff, 0x66, 0x34, 0x00, 0xff, 0x6a, 0x02, 0x77, 0xff, 0x72, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x05, 0x00, 0xfe, 0x16, 0x72, 0x02, 0x77, 0x04, 0x00, 0xfd, 0x0a, 0x3d, 0x6a, 0x03, 0x77, 0xfd, 0x66, 0x3d, 0x04, 0x05, 0x00, 0xfd, 0x0a, 0x3d, 0x6a, 0x03, 0x77, 0xfd, 0x66, 0x3d, 0x04, 0x03, 0x00, 0xf4, 0x4f, 0x72, 0x6d, 0x23, 0x0a, 0x3d, 0x66, 0x77, 0x72, 0x60, 0x3d, 0x04, 0x02, 0x00, 0x03, 0x77, 0x04, 0x00, 0xfe, 0x16, 0x6d, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x0a, 0x6a, 0x07, 0x77, 0xfe, 0x60, 0x04, 0x03, 0x00, 0xfe, 0x0a, 0x6a, 0x07, 0x77, 0xfe, 0x60, 0x04, 0x02, 0x00, 0x03, 0x77, 0x02, 0x66, 0x06, 0x77, 0xfd, 0x66, 0x16, 0x00, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x0a, 0x66, 0x04, 0x77, 0x03, 0x00, 0xff, 0x60, 0x03, 0x77, 0xfc, 0x57, 0x45, 0x4f, 0x6d, 0x02, 0x77, 0xff, 0x45, 0x03, 0x00, 0xff, 0x60, 0x03, 0x77, 0xfc, 0x57, 0x45, 0x4f, 0x6d, 0x02, 0x77, 0xff, 0x45, 0x02, 0x00, 0xff, 0x6a, 0x0b, 0x77, 0xfe, 0x4f, 0x00, 0x03, 0x77, 0x02, 0x00, 0xfe, 0x04, 0x60, 0x03, 0x77, 0xff, 0x3d, 0x03, 0x00, 0xff, 0x23, 0x02, 0x77, 0xfe, 0x72, 0x16, 0x03, 0x00, 0xf9, 0x16, 0x72, 0x77, 0x72, 0x0a, 0x00, 0x23, 0x02, 0x77, 0xfe, 0x72, 0x16, 0x03, 0x00, 0xfb, 0x16, 0x72, 0x77, 0x72, 0x0a, 0x02, 0x00, 0x03, 0x77, 0xfe, 0x4f, 0x16, 0x02, 0x04, 0xfe, 0x16, 0x66, 0x02, 0x77, 0xfe, 0x72, 0x00, 0x03, 0x77, 0x02, 0x00, 0xff, 0x57, 0x03, 0x77, 0xff, 0x3d, 0x04, 0x00, 0xff, 0x4f, 0x02, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xff, 0x4f, 0x02, 0x77, 0xfd, 0x30, 0x00, 0x4f, 0x02, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xff, 0x4f, 0x02, 0x77, 0xff, 0x30, 0x02, 0x00, 0x03, 0x77, 0x05, 0x00, 0xff, 0x23, 0x03, 0x77, 0xff, 0x00, 0x08, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xff, 0x66, 0x02, 0x77, 0xff, 0x16, 0x05, 0x00, 0xff, 0x30, 0x02, 0x77, 0xfd, 0x3d, 0x00, 0x66, 0x02, 0x77, 0xff, 0x16, 0x05, 0x00, 0xff, 0x30, 0x02, 0x77, 0xff, 0x3d, 0x02, 0x00, 0x03, 0x77, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x77, 0xff, 0x00, 0x07, 0x77, 0xff, 0x3d, 0x06, 0x00, 0x0c, 0x77, 0xfe, 0x4f, 0x00, 0x0c, 0x77, 0xff, 0x4f, 0x02, 0x00, 0x03, 0x77, 0x05, 0x00, 0xff, 0x04, 0x03, 0x77, 0xff, 0x00, 0x07, 0x77, 0xff, 0x3d, 0x06, 0x00, 0x0c, 0x77, 0xfe, 0x4f, 0x00, 0x0c, 0x77, 0xff, 0x4f, 0x02, 0x00, 0x03, 0x77, 0x05, 0x00, 0xff, 0x04, 0x03, 0x77, 0xff, 0x00, 0x03, 0x77, 0xfe, 0x00, 0x45, 0x03, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xfd, 0x6d, 0x77, 0x72, 0x0b, 0x00, 0xfd, 0x6d, 0x77, 0x72, 0x0c, 0x00, 0x03, 0x77, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x77, 0xff, 0x00, 0x03, 0x77, 0x02, 0x00, 0xff, 0x57, 0x03, 0x77, 0xff, 0x3d, 0x04, 0x00, 0xff, 0x57, 0x02, 0x77, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x57, 0x02, 0x77, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0x77, 0x05, 0x00, 0xff, 0x23, 0x03, 0x77, 0xff, 0x00, 0x03, 0x77, 0x02, 0x00, 0xfe, 0x04, 0x60, 0x03, 0x77, 0xff, 0x3d, 0x03, 0x00, 0xff, 0x30, 0x02, 0x77, 0xff, 0x45, 0x05, 0x00, 0xfd, 0x23, 0x45, 0x0a, 0x02, 0x00, 0xff, 0x30, 0x02, 0x77, 0xff, 0x45, 0x05, 0x00, 0xfd, 0x23, 0x45, 0x0a, 0x03, 0x00, 0x03, 0x77, 0xfe, 0x4f, 0x16, 0x02, 0x04, 0xfe, 0x16, 0x66, 0x02, 0x77, 0xfe, 0x72, 0x00, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x0a, 0x66, 0x04, 0x77, 0x02, 0x00, 0xfe, 0x04, 0x6d, 0x02, 0x77, 0xfb, 0x66, 0x4f, 0x45, 0x4f, 0x6a, 0x02, 0x77, 0xff, 0x3d, 0x02, 0x00, 0xfe, 0x04, 0x6d, 0x02, 0x77, 0xfb, 0x66, 0x4f, 0x45, 0x4f, 0x6a, 0x02, 0x77, 0xff, 0x3d, 0x03, 0x00, 0x0b, 0x77, 0xfe, 0x4f, 0x00, 0x03, 0x77, 0x04, 0x00, 0xfe, 0x16, 0x6d, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x16, 0x72, 0x08, 0x77, 0xff, 0x45, 0x03, 0x00, 0xfe, 0x16, 0x72, 0x08, 0x77, 0xff, 0x45, 0x03, 0x00, 0x03, 0x77, 0xff, 0x66, 0x06, 0x77, 0xfd, 0x6a, 0x0a, 0x00, 0x03, 0x77, 0x05, 0x00, 0xfe, 0x16, 0x72, 0x02, 0x77, 0x04, 0x00, 0xf7, 0x16, 0x45, 0x6a, 0x77, 0x72, 0x6a, 0x57, 0x45, 0x23, 0x05, 0x00, 0xf7, 0x16, 0x45, 0x6a, 0x77, 0x72, 0x6a, 0x57, 0x45, 0x23, 0x04, 0x00, 0x03, 0x77, 0xf8, 0x0a, 0x3d, 0x6a, 0x77, 0x72, 0x60, 0x3d, 0x04, 0x02, 0x00, 0x03, 0x77, 0x28, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x28, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x28, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x28, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x05, 0x00, 0xfe, 0x16, 0x72, 0x02, 0x77, 0x04, 0x00, 0xfd, 0x0a, 0x3d, 0x6a, 0x03, 0x77, 0xfd, 0x66, 0x3d, 0x04, 0x02, 0x00, 0x05, 0x77, 0x04, 0x00, 0x05, 0x77, 0x02, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x04, 0x00, 0xfe, 0x16, 0x6d, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x0a, 0x6a, 0x07, 0x77, 0xfd, 0x60, 0x04, 0x00, 0x05, 0x77, 0x04, 0x00, 0x05, 0x77, 0x02, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x0a, 0x66, 0x04, 0x77, 0x03, 0x00, 0xff, 0x60, 0x03, 0x77, 0xfc, 0x57, 0x45, 0x4f, 0x6d, 0x02, 0x77, 0xff, 0x45, 0x03, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x02, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x02, 0x00, 0xfe, 0x04, 0x60, 0x03, 0x77, 0xff, 0x3d, 0x03, 0x00, 0xff, 0x23, 0x02, 0x77, 0xfe, 0x72, 0x16, 0x03, 0x00, 0xfb, 0x16, 0x72, 0x77, 0x72, 0x0a, 0x02, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x0f, 0x00, 0x03, 0x77, 0x02, 0x00, 0xff, 0x57, 0x03, 0x77, 0xff, 0x3d, 0x04, 0x00, 0xff, 0x4f, 0x02, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xff, 0x4f, 0x02, 0x77, 0xff, 0x30, 0x02, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x0f, 0x00, 0x08, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xff, 0x66, 0x02, 0x77, 0xff, 0x16, 0x05, 0x00, 0xff, 0x30, 0x02, 0x77, 0xff, 0x3d, 0x02, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x0f, 0x00, 0x07, 0x77, 0xff, 0x3d, 0x06, 0x00, 0x0c, 0x77, 0xff, 0x4f, 0x02, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x0f, 0x00, 0x07, 0x77, 0xff, 0x3d, 0x06, 0x00, 0x0c, 0x77, 0xff, 0x4f, 0x02, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x0f, 0x00, 0x03, 0x77, 0xfe, 0x00, 0x45, 0x03, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xfd, 0x6d, 0x77, 0x72, 0x0c, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x0f, 0x00, 0x03, 0x77, 0x02, 0x00, 0xff, 0x57, 0x03, 0x77, 0xff, 0x3d, 0x04, 0x00, 0xff, 0x57, 0x02, 0x77, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0x6d, 0x02, 0x77, 0xff, 0x16, 0x04, 0x00, 0xff, 0x0a, 0x03, 0x77, 0x0f, 0x00, 0x03, 0x77, 0x02, 0x00, 0xfe, 0x04, 0x60, 0x03, 0x77, 0xff, 0x3d, 0x03, 0x00, 0xff, 0x30, 0x02, 0x77, 0xff, 0x45, 0x05, 0x00, 0xfd, 0x23, 0x45, 0x0a, 0x03, 0x00, 0xff, 0x57, 0x02, 0x77, 0xff, 0x30, 0x03, 0x00, 0xfe, 0x04, 0x57, 0x03, 0x77, 0x0f, 0x00, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x0a, 0x66, 0x04, 0x77, 0x02, 0x00, 0xfe, 0x04, 0x6d, 0x02, 0x77, 0xfb, 0x66, 0x4f, 0x45, 0x4f, 0x6a, 0x02, 0x77, 0xff, 0x3d, 0x03, 0x00, 0xff, 0x30, 0x02, 0x77, 0xff, 0x72, 0x02, 0x45, 0xfe, 0x4f, 0x6a, 0x04, 0x77, 0x0f, 0x00, 0x03, 0x77, 0x04, 0x00, 0xfe, 0x16, 0x6d, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x16, 0x72, 0x08, 0x77, 0xff, 0x45, 0x03, 0x00, 0xfe, 0x04, 0x66, 0x06, 0x77, 0xff, 0x45, 0x03, 0x77, 0x0f, 0x00, 0x03, 0x77, 0x05, 0x00, 0xfe, 0x16, 0x72, 0x02, 0x77, 0x04, 0x00, 0xf7, 0x16, 0x45, 0x6a, 0x77, 0x72, 0x6a, 0x57, 0x45, 0x23, 0x05, 0x00, 0xf8, 0x0a, 0x45, 0x6d, 0x77, 0x6d, 0x60, 0x30, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x34, 0x00, 0xff, 0x6a, 0x02, 0x77, 0xff, 0x72, 0x34, 0x00, 0x03, 0x77, 0xff, 0x66, 0x34, 0x00, 0xfc, 0x4f, 0x72, 0x6d, 0x23, 0x46, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_8_image = {(void *) &logo_8, 56, 49};
+    0x70, 0x00, 0xfc, 0x4f, 0x72, 0x6d, 0x23, 0x34, 0x00, 0x03, 0x77, 0xff, 0x66, 0x34, 0x00, 0xff, 0x6a, 0x02, 0x77, 0xff, 0x72, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x05, 0x00, 0xfe, 0x16, 0x72, 0x02, 0x77, 0x04, 0x00, 0xfd, 0x0a, 0x3d, 0x6a, 0x03, 0x77, 0xfd, 0x66, 0x3d, 0x04, 0x05, 0x00, 0xfd, 0x0a, 0x3d, 0x6a, 0x03, 0x77, 0xfd, 0x66, 0x3d, 0x04, 0x03, 0x00, 0xf4, 0x4f, 0x72, 0x6d, 0x23, 0x0a, 0x3d, 0x66, 0x77, 0x72, 0x60, 0x3d, 0x04, 0x02, 0x00, 0x03, 0x77, 0x04, 0x00, 0xfe, 0x16, 0x6d, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x0a, 0x6a, 0x07, 0x77, 0xfe, 0x60, 0x04, 0x03, 0x00, 0xfe, 0x0a, 0x6a, 0x07, 0x77, 0xfe, 0x60, 0x04, 0x02, 0x00, 0x03, 0x77, 0x02, 0x66, 0x06, 0x77, 0xfd, 0x66, 0x16, 0x00, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x0a, 0x66, 0x04, 0x77, 0x03, 0x00, 0xff, 0x60, 0x03, 0x77, 0xfc, 0x57, 0x45, 0x4f, 0x6d, 0x02, 0x77, 0xff, 0x45, 0x03, 0x00, 0xff, 0x60, 0x03, 0x77, 0xfc, 0x57, 0x45, 0x4f, 0x6d, 0x02, 0x77, 0xff, 0x45, 0x02, 0x00, 0xff, 0x6a, 0x0b, 0x77, 0xfe, 0x4f, 0x00, 0x03, 0x77, 0x02, 0x00, 0xfe, 0x04, 0x60, 0x03, 0x77, 0xff, 0x3d, 0x03, 0x00, 0xff, 0x23, 0x02, 0x77, 0xfe, 0x72, 0x16, 0x03, 0x00, 0xf9, 0x16, 0x72, 0x77, 0x72, 0x0a, 0x00, 0x23, 0x02, 0x77, 0xfe, 0x72, 0x16, 0x03, 0x00, 0xfb, 0x16, 0x72, 0x77, 0x72, 0x0a, 0x02, 0x00, 0x03, 0x77, 0xfe, 0x4f, 0x16, 0x02, 0x04, 0xfe, 0x16, 0x66, 0x02, 0x77, 0xfe, 0x72, 0x00, 0x03, 0x77, 0x02, 0x00, 0xff, 0x57, 0x03, 0x77, 0xff, 0x3d, 0x04, 0x00, 0xff, 0x4f, 0x02, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xff, 0x4f, 0x02, 0x77, 0xfd, 0x30, 0x00, 0x4f, 0x02, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xff, 0x4f, 0x02, 0x77, 0xff, 0x30, 0x02, 0x00, 0x03, 0x77, 0x05, 0x00, 0xff, 0x23, 0x03, 0x77, 0xff, 0x00, 0x08, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xff, 0x66, 0x02, 0x77, 0xff, 0x16, 0x05, 0x00, 0xff, 0x30, 0x02, 0x77, 0xfd, 0x3d, 0x00, 0x66, 0x02, 0x77, 0xff, 0x16, 0x05, 0x00, 0xff, 0x30, 0x02, 0x77, 0xff, 0x3d, 0x02, 0x00, 0x03, 0x77, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x77, 0xff, 0x00, 0x07, 0x77, 0xff, 0x3d, 0x06, 0x00, 0x0c, 0x77, 0xfe, 0x4f, 0x00, 0x0c, 0x77, 0xff, 0x4f, 0x02, 0x00, 0x03, 0x77, 0x05, 0x00, 0xff, 0x04, 0x03, 0x77, 0xff, 0x00, 0x07, 0x77, 0xff, 0x3d, 0x06, 0x00, 0x0c, 0x77, 0xfe, 0x4f, 0x00, 0x0c, 0x77, 0xff, 0x4f, 0x02, 0x00, 0x03, 0x77, 0x05, 0x00, 0xff, 0x04, 0x03, 0x77, 0xff, 0x00, 0x03, 0x77, 0xfe, 0x00, 0x45, 0x03, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xfd, 0x6d, 0x77, 0x72, 0x0b, 0x00, 0xfd, 0x6d, 0x77, 0x72, 0x0c, 0x00, 0x03, 0x77, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x77, 0xff, 0x00, 0x03, 0x77, 0x02, 0x00, 0xff, 0x57, 0x03, 0x77, 0xff, 0x3d, 0x04, 0x00, 0xff, 0x57, 0x02, 0x77, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x57, 0x02, 0x77, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0x77, 0x05, 0x00, 0xff, 0x23, 0x03, 0x77, 0xff, 0x00, 0x03, 0x77, 0x02, 0x00, 0xfe, 0x04, 0x60, 0x03, 0x77, 0xff, 0x3d, 0x03, 0x00, 0xff, 0x30, 0x02, 0x77, 0xff, 0x45, 0x05, 0x00, 0xfd, 0x23, 0x45, 0x0a, 0x02, 0x00, 0xff, 0x30, 0x02, 0x77, 0xff, 0x45, 0x05, 0x00, 0xfd, 0x23, 0x45, 0x0a, 0x03, 0x00, 0x03, 0x77, 0xfe, 0x4f, 0x16, 0x02, 0x04, 0xfe, 0x16, 0x66, 0x02, 0x77, 0xfe, 0x72, 0x00, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x0a, 0x66, 0x04, 0x77, 0x02, 0x00, 0xfe, 0x04, 0x6d, 0x02, 0x77, 0xfb, 0x66, 0x4f, 0x45, 0x4f, 0x6a, 0x02, 0x77, 0xff, 0x3d, 0x02, 0x00, 0xfe, 0x04, 0x6d, 0x02, 0x77, 0xfb, 0x66, 0x4f, 0x45, 0x4f, 0x6a, 0x02, 0x77, 0xff, 0x3d, 0x03, 0x00, 0x0b, 0x77, 0xfe, 0x4f, 0x00, 0x03, 0x77, 0x04, 0x00, 0xfe, 0x16, 0x6d, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x16, 0x72, 0x08, 0x77, 0xff, 0x45, 0x03, 0x00, 0xfe, 0x16, 0x72, 0x08, 0x77, 0xff, 0x45, 0x03, 0x00, 0x03, 0x77, 0xff, 0x66, 0x06, 0x77, 0xfd, 0x6a, 0x0a, 0x00, 0x03, 0x77, 0x05, 0x00, 0xfe, 0x16, 0x72, 0x02, 0x77, 0x04, 0x00, 0xf7, 0x16, 0x45, 0x6a, 0x77, 0x72, 0x6a, 0x57, 0x45, 0x23, 0x05, 0x00, 0xf7, 0x16, 0x45, 0x6a, 0x77, 0x72, 0x6a, 0x57, 0x45, 0x23, 0x04, 0x00, 0x03, 0x77, 0xf8, 0x0a, 0x3d, 0x6a, 0x77, 0x72, 0x60, 0x3d, 0x04, 0x02, 0x00, 0x03, 0x77, 0x28, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x28, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x28, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x28, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x05, 0x00, 0xfe, 0x16, 0x72, 0x02, 0x77, 0x04, 0x00, 0xfd, 0x0a, 0x3d, 0x6a, 0x03, 0x77, 0xfd, 0x66, 0x3d, 0x04, 0x02, 0x00, 0x05, 0x77, 0x04, 0x00, 0x05, 0x77, 0x02, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x04, 0x00, 0xfe, 0x16, 0x6d, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x0a, 0x6a, 0x07, 0x77, 0xfd, 0x60, 0x04, 0x00, 0x05, 0x77, 0x04, 0x00, 0x05, 0x77, 0x02, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x0a, 0x66, 0x04, 0x77, 0x03, 0x00, 0xff, 0x60, 0x03, 0x77, 0xfc, 0x57, 0x45, 0x4f, 0x6d, 0x02, 0x77, 0xff, 0x45, 0x03, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x02, 0x00, 0x03, 0x77, 0x0a, 0x00, 0x03, 0x77, 0x02, 0x00, 0xfe, 0x04, 0x60, 0x03, 0x77, 0xff, 0x3d, 0x03, 0x00, 0xff, 0x23, 0x02, 0x77, 0xfe, 0x72, 0x16, 0x03, 0x00, 0xfb, 0x16, 0x72, 0x77, 0x72, 0x0a, 0x02, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x0f, 0x00, 0x03, 0x77, 0x02, 0x00, 0xff, 0x57, 0x03, 0x77, 0xff, 0x3d, 0x04, 0x00, 0xff, 0x4f, 0x02, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xff, 0x4f, 0x02, 0x77, 0xff, 0x30, 0x02, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x0f, 0x00, 0x08, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xff, 0x66, 0x02, 0x77, 0xff, 0x16, 0x05, 0x00, 0xff, 0x30, 0x02, 0x77, 0xff, 0x3d, 0x02, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x0f, 0x00, 0x07, 0x77, 0xff, 0x3d, 0x06, 0x00, 0x0c, 0x77, 0xff, 0x4f, 0x02, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x0f, 0x00, 0x07, 0x77, 0xff, 0x3d, 0x06, 0x00, 0x0c, 0x77, 0xff, 0x4f, 0x02, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x0f, 0x00, 0x03, 0x77, 0xfe, 0x00, 0x45, 0x03, 0x77, 0xff, 0x3d, 0x05, 0x00, 0xfd, 0x6d, 0x77, 0x72, 0x0c, 0x00, 0x03, 0x77, 0x06, 0x00, 0x03, 0x77, 0x0f, 0x00, 0x03, 0x77, 0x02, 0x00, 0xff, 0x57, 0x03, 0x77, 0xff, 0x3d, 0x04, 0x00, 0xff, 0x57, 0x02, 0x77, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0x6d, 0x02, 0x77, 0xff, 0x16, 0x04, 0x00, 0xff, 0x0a, 0x03, 0x77, 0x0f, 0x00, 0x03, 0x77, 0x02, 0x00, 0xfe, 0x04, 0x60, 0x03, 0x77, 0xff, 0x3d, 0x03, 0x00, 0xff, 0x30, 0x02, 0x77, 0xff, 0x45, 0x05, 0x00, 0xfd, 0x23, 0x45, 0x0a, 0x03, 0x00, 0xff, 0x57, 0x02, 0x77, 0xff, 0x30, 0x03, 0x00, 0xfe, 0x04, 0x57, 0x03, 0x77, 0x0f, 0x00, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x0a, 0x66, 0x04, 0x77, 0x02, 0x00, 0xfe, 0x04, 0x6d, 0x02, 0x77, 0xfb, 0x66, 0x4f, 0x45, 0x4f, 0x6a, 0x02, 0x77, 0xff, 0x3d, 0x03, 0x00, 0xff, 0x30, 0x02, 0x77, 0xff, 0x72, 0x02, 0x45, 0xfe, 0x4f, 0x6a, 0x04, 0x77, 0x0f, 0x00, 0x03, 0x77, 0x04, 0x00, 0xfe, 0x16, 0x6d, 0x03, 0x77, 0x03, 0x00, 0xfe, 0x16, 0x72, 0x08, 0x77, 0xff, 0x45, 0x03, 0x00, 0xfe, 0x04, 0x66, 0x06, 0x77, 0xff, 0x45, 0x03, 0x77, 0x0f, 0x00, 0x03, 0x77, 0x05, 0x00, 0xfe, 0x16, 0x72, 0x02, 0x77, 0x04, 0x00, 0xf7, 0x16, 0x45, 0x6a, 0x77, 0x72, 0x6a, 0x57, 0x45, 0x23, 0x05, 0x00, 0xf8, 0x0a, 0x45, 0x6d, 0x77, 0x6d, 0x60, 0x30, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x35, 0x00, 0x03, 0x77, 0x34, 0x00, 0xff, 0x6a, 0x02, 0x77, 0xff, 0x72, 0x34, 0x00, 0x03, 0x77, 0xff, 0x66, 0x34, 0x00, 0xfc, 0x4f, 0x72, 0x6d, 0x23, 0x46, 0x00
+};
+static const Image logo_8_image = {logo_8_data, 56, 49};
 
-static void logo_9(uint8_t *data)
+static const uint8_t logo_9_data[1185] =
 {
-    const uint8_t image_data[1185] =
-    {
-        0x70, 0x00, 0xfc, 0x5d, 0x81, 0x7b, 0x32, 0x34, 0x00, 0x03, 0x88, 0xff, 0x6c, 0x34, 0x00, 0xff, 0x77, 0x02, 0x88, 0xff, 0x85, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x05, 0x00, 0xfe, 0x1b, 0x81, 0x02, 0x88, 0x04, 0x00, 0xfd, 0x0a, 0x4d, 0x77, 0x02, 0x88, 0xfc, 0x85, 0x77, 0x42, 0x04, 0x05, 0x00, 0xfd, 0x0a, 0x4d, 0x77, 0x02, 0x88, 0xfc, 0x85, 0x77, 0x42, 0x04, 0x03, 0x00, 0xf4, 0x5d, 0x81, 0x7b, 0x32, 0x0a, 0x4d, 0x6c, 0x85, 0x81, 0x64, 0x42, 0x0a, 0x02, 0x00, 0x03, 0x88, 0x04, 0x00, 0xfe, 0x0a, 0x7b, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x07, 0x88, 0xfe, 0x64, 0x04, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x07, 0x88, 0xfe, 0x64, 0x04, 0x02, 0x00, 0x03, 0x88, 0x02, 0x77, 0x06, 0x88, 0xfd, 0x77, 0x0a, 0x00, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x04, 0x88, 0x03, 0x00, 0xff, 0x6c, 0x03, 0x88, 0xfc, 0x64, 0x4d, 0x57, 0x81, 0x02, 0x88, 0xff, 0x4d, 0x03, 0x00, 0xff, 0x6c, 0x03, 0x88, 0xfc, 0x64, 0x4d, 0x57, 0x81, 0x02, 0x88, 0xff, 0x4d, 0x02, 0x00, 0xff, 0x77, 0x0b, 0x88, 0xfe, 0x5d, 0x00, 0x03, 0x88, 0x02, 0x00, 0xfe, 0x04, 0x6c, 0x03, 0x88, 0xff, 0x42, 0x03, 0x00, 0xff, 0x32, 0x02, 0x88, 0xfe, 0x81, 0x1b, 0x03, 0x00, 0xf9, 0x0a, 0x81, 0x88, 0x85, 0x0a, 0x00, 0x32, 0x02, 0x88, 0xfe, 0x81, 0x1b, 0x03, 0x00, 0xfb, 0x0a, 0x81, 0x88, 0x85, 0x0a, 0x02, 0x00, 0x03, 0x88, 0xfe, 0x57, 0x1b, 0x02, 0x04, 0xfe, 0x1b, 0x77, 0x02, 0x88, 0xfe, 0x81, 0x00, 0x03, 0x88, 0xfd, 0x00, 0x04, 0x5d, 0x03, 0x88, 0xff, 0x42, 0x04, 0x00, 0xff, 0x5d, 0x02, 0x88, 0xff, 0x42, 0x05, 0x00, 0xff, 0x57, 0x02, 0x88, 0xfd, 0x32, 0x00, 0x5d, 0x02, 0x88, 0xff, 0x42, 0x05, 0x00, 0xff, 0x57, 0x02, 0x88, 0xff, 0x32, 0x02, 0x00, 0x03, 0x88, 0x05, 0x00, 0xff, 0x32, 0x03, 0x88, 0xff, 0x00, 0x08, 0x88, 0xff, 0x42, 0x05, 0x00, 0xff, 0x77, 0x02, 0x88, 0xff, 0x1b, 0x05, 0x00, 0xff, 0x42, 0x02, 0x88, 0xfd, 0x4d, 0x00, 0x77, 0x02, 0x88, 0xff, 0x1b, 0x05, 0x00, 0xff, 0x42, 0x02, 0x88, 0xff, 0x4d, 0x02, 0x00, 0x03, 0x88, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x88, 0xff, 0x00, 0x07, 0x88, 0xff, 0x42, 0x06, 0x00, 0x0c, 0x88, 0xfe, 0x5d, 0x00, 0x0c, 0x88, 0xff, 0x5d, 0x02, 0x00, 0x03, 0x88, 0x05, 0x00, 0xff, 0x04, 0x03, 0x88, 0xff, 0x00, 0x07, 0x88, 0xff, 0x42, 0x06, 0x00, 0x0c, 0x88, 0xfe, 0x5d, 0x00, 0x0c, 0x88, 0xff, 0x5d, 0x02, 0x00, 0x03, 0x88, 0x05, 0x00, 0xff, 0x04, 0x03, 0x88, 0xff, 0x00, 0x03, 0x88, 0xfe, 0x00, 0x4d, 0x03, 0x88, 0xff, 0x42, 0x05, 0x00, 0xfd, 0x7b, 0x88, 0x81, 0x0b, 0x00, 0xfd, 0x7b, 0x88, 0x81, 0x0c, 0x00, 0x03, 0x88, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x88, 0xff, 0x00, 0x03, 0x88, 0xfd, 0x00, 0x04, 0x5d, 0x03, 0x88, 0xff, 0x42, 0x04, 0x00, 0xff, 0x64, 0x02, 0x88, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x64, 0x02, 0x88, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0x88, 0x05, 0x00, 0xff, 0x32, 0x03, 0x88, 0xff, 0x00, 0x03, 0x88, 0x02, 0x00, 0xfe, 0x04, 0x6c, 0x03, 0x88, 0xff, 0x42, 0x03, 0x00, 0xff, 0x42, 0x02, 0x88, 0xff, 0x4d, 0x05, 0x00, 0xfd, 0x32, 0x4d, 0x0a, 0x02, 0x00, 0xff, 0x42, 0x02, 0x88, 0xff, 0x4d, 0x05, 0x00, 0xfd, 0x32, 0x4d, 0x0a, 0x03, 0x00, 0x03, 0x88, 0xfe, 0x57, 0x1b, 0x02, 0x04, 0xfe, 0x1b, 0x77, 0x02, 0x88, 0xfe, 0x81, 0x00, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x04, 0x88, 0x02, 0x00, 0xfe, 0x04, 0x7b, 0x02, 0x88, 0xfb, 0x77, 0x57, 0x4d, 0x5d, 0x77, 0x02, 0x88, 0xff, 0x4d, 0x02, 0x00, 0xfe, 0x04, 0x7b, 0x02, 0x88, 0xfb, 0x77, 0x57, 0x4d, 0x5d, 0x77, 0x02, 0x88, 0xff, 0x4d, 0x03, 0x00, 0x0b, 0x88, 0xfe, 0x5d, 0x00, 0x03, 0x88, 0x04, 0x00, 0xfe, 0x0a, 0x7b, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x1b, 0x81, 0x08, 0x88, 0xff, 0x57, 0x03, 0x00, 0xfe, 0x1b, 0x81, 0x08, 0x88, 0xff, 0x57, 0x03, 0x00, 0x03, 0x88, 0xff, 0x77, 0x06, 0x88, 0xfd, 0x77, 0x0a, 0x00, 0x03, 0x88, 0x05, 0x00, 0xfe, 0x1b, 0x81, 0x02, 0x88, 0x04, 0x00, 0xf7, 0x0a, 0x57, 0x77, 0x88, 0x81, 0x77, 0x64, 0x4d, 0x1b, 0x05, 0x00, 0xf7, 0x0a, 0x57, 0x77, 0x88, 0x81, 0x77, 0x64, 0x4d, 0x1b, 0x04, 0x00, 0x03, 0x88, 0xf8, 0x0a, 0x4d, 0x77, 0x88, 0x7b, 0x6c, 0x42, 0x0a, 0x02, 0x00, 0x03, 0x88, 0x28, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x28, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x28, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x28, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x05, 0x00, 0xfe, 0x1b, 0x81, 0x02, 0x88, 0x04, 0x00, 0xfd, 0x0a, 0x4d, 0x77, 0x02, 0x88, 0xfc, 0x85, 0x77, 0x42, 0x04, 0x02, 0x00, 0x05, 0x88, 0x04, 0x00, 0x05, 0x88, 0x02, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x04, 0x00, 0xfe, 0x0a, 0x7b, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x07, 0x88, 0xfd, 0x64, 0x04, 0x00, 0x05, 0x88, 0x04, 0x00, 0x05, 0x88, 0x02, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x04, 0x88, 0x03, 0x00, 0xff, 0x6c, 0x03, 0x88, 0xfc, 0x64, 0x4d, 0x57, 0x81, 0x02, 0x88, 0xff, 0x4d, 0x03, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x02, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x02, 0x00, 0xfe, 0x04, 0x6c, 0x03, 0x88, 0xff, 0x42, 0x03, 0x00, 0xff, 0x32, 0x02, 0x88, 0xfe, 0x81, 0x1b, 0x03, 0x00, 0xfb, 0x0a, 0x81, 0x88, 0x85, 0x0a, 0x02, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x0f, 0x00, 0x03, 0x88, 0xfd, 0x00, 0x04, 0x5d, 0x03, 0x88, 0xff, 0x42, 0x04, 0x00, 0xff, 0x5d, 0x02, 0x88, 0xff, 0x42, 0x05, 0x00, 0xff, 0x57, 0x02, 0x88, 0xff, 0x32, 0x02, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x0f, 0x00, 0x08, 0x88, 0xff, 0x42, 0x05, 0x00, 0xff, 0x77, 0x02, 0x88, 0xff, 0x1b, 0x05, 0x00, 0xff, 0x42, 0x02, 0x88, 0xff, 0x4d, 0x02, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x0f, 0x00, 0x07, 0x88, 0xff, 0x42, 0x06, 0x00, 0x0c, 0x88, 0xff, 0x5d, 0x02, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x0f, 0x00, 0x07, 0x88, 0xff, 0x42, 0x06, 0x00, 0x0c, 0x88, 0xff, 0x5d, 0x02, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x0f, 0x00, 0x03, 0x88, 0xfe, 0x00, 0x4d, 0x03, 0x88, 0xff, 0x42, 0x05, 0x00, 0xfd, 0x7b, 0x88, 0x81, 0x0c, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x0f, 0x00, 0x03, 0x88, 0xfd, 0x00, 0x04, 0x5d, 0x03, 0x88, 0xff, 0x42, 0x04, 0x00, 0xff, 0x64, 0x02, 0x88, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0x7b, 0x02, 0x88, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x03, 0x88, 0x0f, 0x00, 0x03, 0x88, 0x02, 0x00, 0xfe, 0x04, 0x6c, 0x03, 0x88, 0xff, 0x42, 0x03, 0x00, 0xff, 0x42, 0x02, 0x88, 0xff, 0x4d, 0x05, 0x00, 0xfd, 0x32, 0x4d, 0x0a, 0x03, 0x00, 0xff, 0x64, 0x02, 0x88, 0xff, 0x32, 0x03, 0x00, 0xfe, 0x04, 0x5d, 0x03, 0x88, 0x0f, 0x00, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x04, 0x88, 0x02, 0x00, 0xfe, 0x04, 0x7b, 0x02, 0x88, 0xfb, 0x77, 0x57, 0x4d, 0x5d, 0x77, 0x02, 0x88, 0xff, 0x4d, 0x03, 0x00, 0xff, 0x42, 0x02, 0x88, 0xfb, 0x81, 0x57, 0x4d, 0x5d, 0x77, 0x04, 0x88, 0x0f, 0x00, 0x03, 0x88, 0x04, 0x00, 0xfe, 0x0a, 0x7b, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x1b, 0x81, 0x08, 0x88, 0xff, 0x57, 0x03, 0x00, 0xfe, 0x04, 0x6c, 0x06, 0x88, 0xff, 0x4d, 0x03, 0x88, 0x0f, 0x00, 0x03, 0x88, 0x05, 0x00, 0xfe, 0x1b, 0x81, 0x02, 0x88, 0x04, 0x00, 0xf7, 0x0a, 0x57, 0x77, 0x88, 0x81, 0x77, 0x64, 0x4d, 0x1b, 0x05, 0x00, 0xf8, 0x0a, 0x4d, 0x7b, 0x88, 0x7b, 0x6c, 0x32, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x34, 0x00, 0xff, 0x77, 0x02, 0x88, 0xff, 0x85, 0x34, 0x00, 0x03, 0x88, 0xff, 0x6c, 0x34, 0x00, 0xfc, 0x5d, 0x81, 0x7b, 0x32, 0x46, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_9_image = {(void *) &logo_9, 56, 49};
+    0x70, 0x00, 0xfc, 0x5d, 0x81, 0x7b, 0x32, 0x34, 0x00, 0x03, 0x88, 0xff, 0x6c, 0x34, 0x00, 0xff, 0x77, 0x02, 0x88, 0xff, 0x85, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x05, 0x00, 0xfe, 0x1b, 0x81, 0x02, 0x88, 0x04, 0x00, 0xfd, 0x0a, 0x4d, 0x77, 0x02, 0x88, 0xfc, 0x85, 0x77, 0x42, 0x04, 0x05, 0x00, 0xfd, 0x0a, 0x4d, 0x77, 0x02, 0x88, 0xfc, 0x85, 0x77, 0x42, 0x04, 0x03, 0x00, 0xf4, 0x5d, 0x81, 0x7b, 0x32, 0x0a, 0x4d, 0x6c, 0x85, 0x81, 0x64, 0x42, 0x0a, 0x02, 0x00, 0x03, 0x88, 0x04, 0x00, 0xfe, 0x0a, 0x7b, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x07, 0x88, 0xfe, 0x64, 0x04, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x07, 0x88, 0xfe, 0x64, 0x04, 0x02, 0x00, 0x03, 0x88, 0x02, 0x77, 0x06, 0x88, 0xfd, 0x77, 0x0a, 0x00, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x04, 0x88, 0x03, 0x00, 0xff, 0x6c, 0x03, 0x88, 0xfc, 0x64, 0x4d, 0x57, 0x81, 0x02, 0x88, 0xff, 0x4d, 0x03, 0x00, 0xff, 0x6c, 0x03, 0x88, 0xfc, 0x64, 0x4d, 0x57, 0x81, 0x02, 0x88, 0xff, 0x4d, 0x02, 0x00, 0xff, 0x77, 0x0b, 0x88, 0xfe, 0x5d, 0x00, 0x03, 0x88, 0x02, 0x00, 0xfe, 0x04, 0x6c, 0x03, 0x88, 0xff, 0x42, 0x03, 0x00, 0xff, 0x32, 0x02, 0x88, 0xfe, 0x81, 0x1b, 0x03, 0x00, 0xf9, 0x0a, 0x81, 0x88, 0x85, 0x0a, 0x00, 0x32, 0x02, 0x88, 0xfe, 0x81, 0x1b, 0x03, 0x00, 0xfb, 0x0a, 0x81, 0x88, 0x85, 0x0a, 0x02, 0x00, 0x03, 0x88, 0xfe, 0x57, 0x1b, 0x02, 0x04, 0xfe, 0x1b, 0x77, 0x02, 0x88, 0xfe, 0x81, 0x00, 0x03, 0x88, 0xfd, 0x00, 0x04, 0x5d, 0x03, 0x88, 0xff, 0x42, 0x04, 0x00, 0xff, 0x5d, 0x02, 0x88, 0xff, 0x42, 0x05, 0x00, 0xff, 0x57, 0x02, 0x88, 0xfd, 0x32, 0x00, 0x5d, 0x02, 0x88, 0xff, 0x42, 0x05, 0x00, 0xff, 0x57, 0x02, 0x88, 0xff, 0x32, 0x02, 0x00, 0x03, 0x88, 0x05, 0x00, 0xff, 0x32, 0x03, 0x88, 0xff, 0x00, 0x08, 0x88, 0xff, 0x42, 0x05, 0x00, 0xff, 0x77, 0x02, 0x88, 0xff, 0x1b, 0x05, 0x00, 0xff, 0x42, 0x02, 0x88, 0xfd, 0x4d, 0x00, 0x77, 0x02, 0x88, 0xff, 0x1b, 0x05, 0x00, 0xff, 0x42, 0x02, 0x88, 0xff, 0x4d, 0x02, 0x00, 0x03, 0x88, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x88, 0xff, 0x00, 0x07, 0x88, 0xff, 0x42, 0x06, 0x00, 0x0c, 0x88, 0xfe, 0x5d, 0x00, 0x0c, 0x88, 0xff, 0x5d, 0x02, 0x00, 0x03, 0x88, 0x05, 0x00, 0xff, 0x04, 0x03, 0x88, 0xff, 0x00, 0x07, 0x88, 0xff, 0x42, 0x06, 0x00, 0x0c, 0x88, 0xfe, 0x5d, 0x00, 0x0c, 0x88, 0xff, 0x5d, 0x02, 0x00, 0x03, 0x88, 0x05, 0x00, 0xff, 0x04, 0x03, 0x88, 0xff, 0x00, 0x03, 0x88, 0xfe, 0x00, 0x4d, 0x03, 0x88, 0xff, 0x42, 0x05, 0x00, 0xfd, 0x7b, 0x88, 0x81, 0x0b, 0x00, 0xfd, 0x7b, 0x88, 0x81, 0x0c, 0x00, 0x03, 0x88, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x88, 0xff, 0x00, 0x03, 0x88, 0xfd, 0x00, 0x04, 0x5d, 0x03, 0x88, 0xff, 0x42, 0x04, 0x00, 0xff, 0x64, 0x02, 0x88, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x64, 0x02, 0x88, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0x88, 0x05, 0x00, 0xff, 0x32, 0x03, 0x88, 0xff, 0x00, 0x03, 0x88, 0x02, 0x00, 0xfe, 0x04, 0x6c, 0x03, 0x88, 0xff, 0x42, 0x03, 0x00, 0xff, 0x42, 0x02, 0x88, 0xff, 0x4d, 0x05, 0x00, 0xfd, 0x32, 0x4d, 0x0a, 0x02, 0x00, 0xff, 0x42, 0x02, 0x88, 0xff, 0x4d, 0x05, 0x00, 0xfd, 0x32, 0x4d, 0x0a, 0x03, 0x00, 0x03, 0x88, 0xfe, 0x57, 0x1b, 0x02, 0x04, 0xfe, 0x1b, 0x77, 0x02, 0x88, 0xfe, 0x81, 0x00, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x04, 0x88, 0x02, 0x00, 0xfe, 0x04, 0x7b, 0x02, 0x88, 0xfb, 0x77, 0x57, 0x4d, 0x5d, 0x77, 0x02, 0x88, 0xff, 0x4d, 0x02, 0x00, 0xfe, 0x04, 0x7b, 0x02, 0x88, 0xfb, 0x77, 0x57, 0x4d, 0x5d, 0x77, 0x02, 0x88, 0xff, 0x4d, 0x03, 0x00, 0x0b, 0x88, 0xfe, 0x5d, 0x00, 0x03, 0x88, 0x04, 0x00, 0xfe, 0x0a, 0x7b, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x1b, 0x81, 0x08, 0x88, 0xff, 0x57, 0x03, 0x00, 0xfe, 0x1b, 0x81, 0x08, 0x88, 0xff, 0x57, 0x03, 0x00, 0x03, 0x88, 0xff, 0x77, 0x06, 0x88, 0xfd, 0x77, 0x0a, 0x00, 0x03, 0x88, 0x05, 0x00, 0xfe, 0x1b, 0x81, 0x02, 0x88, 0x04, 0x00, 0xf7, 0x0a, 0x57, 0x77, 0x88, 0x81, 0x77, 0x64, 0x4d, 0x1b, 0x05, 0x00, 0xf7, 0x0a, 0x57, 0x77, 0x88, 0x81, 0x77, 0x64, 0x4d, 0x1b, 0x04, 0x00, 0x03, 0x88, 0xf8, 0x0a, 0x4d, 0x77, 0x88, 0x7b, 0x6c, 0x42, 0x0a, 0x02, 0x00, 0x03, 0x88, 0x28, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x28, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x28, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x28, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x05, 0x00, 0xfe, 0x1b, 0x81, 0x02, 0x88, 0x04, 0x00, 0xfd, 0x0a, 0x4d, 0x77, 0x02, 0x88, 0xfc, 0x85, 0x77, 0x42, 0x04, 0x02, 0x00, 0x05, 0x88, 0x04, 0x00, 0x05, 0x88, 0x02, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x04, 0x00, 0xfe, 0x0a, 0x7b, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x07, 0x88, 0xfd, 0x64, 0x04, 0x00, 0x05, 0x88, 0x04, 0x00, 0x05, 0x88, 0x02, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x04, 0x88, 0x03, 0x00, 0xff, 0x6c, 0x03, 0x88, 0xfc, 0x64, 0x4d, 0x57, 0x81, 0x02, 0x88, 0xff, 0x4d, 0x03, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x02, 0x00, 0x03, 0x88, 0x0a, 0x00, 0x03, 0x88, 0x02, 0x00, 0xfe, 0x04, 0x6c, 0x03, 0x88, 0xff, 0x42, 0x03, 0x00, 0xff, 0x32, 0x02, 0x88, 0xfe, 0x81, 0x1b, 0x03, 0x00, 0xfb, 0x0a, 0x81, 0x88, 0x85, 0x0a, 0x02, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x0f, 0x00, 0x03, 0x88, 0xfd, 0x00, 0x04, 0x5d, 0x03, 0x88, 0xff, 0x42, 0x04, 0x00, 0xff, 0x5d, 0x02, 0x88, 0xff, 0x42, 0x05, 0x00, 0xff, 0x57, 0x02, 0x88, 0xff, 0x32, 0x02, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x0f, 0x00, 0x08, 0x88, 0xff, 0x42, 0x05, 0x00, 0xff, 0x77, 0x02, 0x88, 0xff, 0x1b, 0x05, 0x00, 0xff, 0x42, 0x02, 0x88, 0xff, 0x4d, 0x02, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x0f, 0x00, 0x07, 0x88, 0xff, 0x42, 0x06, 0x00, 0x0c, 0x88, 0xff, 0x5d, 0x02, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x0f, 0x00, 0x07, 0x88, 0xff, 0x42, 0x06, 0x00, 0x0c, 0x88, 0xff, 0x5d, 0x02, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x0f, 0x00, 0x03, 0x88, 0xfe, 0x00, 0x4d, 0x03, 0x88, 0xff, 0x42, 0x05, 0x00, 0xfd, 0x7b, 0x88, 0x81, 0x0c, 0x00, 0x03, 0x88, 0x06, 0x00, 0x03, 0x88, 0x0f, 0x00, 0x03, 0x88, 0xfd, 0x00, 0x04, 0x5d, 0x03, 0x88, 0xff, 0x42, 0x04, 0x00, 0xff, 0x64, 0x02, 0x88, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0x7b, 0x02, 0x88, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x03, 0x88, 0x0f, 0x00, 0x03, 0x88, 0x02, 0x00, 0xfe, 0x04, 0x6c, 0x03, 0x88, 0xff, 0x42, 0x03, 0x00, 0xff, 0x42, 0x02, 0x88, 0xff, 0x4d, 0x05, 0x00, 0xfd, 0x32, 0x4d, 0x0a, 0x03, 0x00, 0xff, 0x64, 0x02, 0x88, 0xff, 0x32, 0x03, 0x00, 0xfe, 0x04, 0x5d, 0x03, 0x88, 0x0f, 0x00, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x0a, 0x77, 0x04, 0x88, 0x02, 0x00, 0xfe, 0x04, 0x7b, 0x02, 0x88, 0xfb, 0x77, 0x57, 0x4d, 0x5d, 0x77, 0x02, 0x88, 0xff, 0x4d, 0x03, 0x00, 0xff, 0x42, 0x02, 0x88, 0xfb, 0x81, 0x57, 0x4d, 0x5d, 0x77, 0x04, 0x88, 0x0f, 0x00, 0x03, 0x88, 0x04, 0x00, 0xfe, 0x0a, 0x7b, 0x03, 0x88, 0x03, 0x00, 0xfe, 0x1b, 0x81, 0x08, 0x88, 0xff, 0x57, 0x03, 0x00, 0xfe, 0x04, 0x6c, 0x06, 0x88, 0xff, 0x4d, 0x03, 0x88, 0x0f, 0x00, 0x03, 0x88, 0x05, 0x00, 0xfe, 0x1b, 0x81, 0x02, 0x88, 0x04, 0x00, 0xf7, 0x0a, 0x57, 0x77, 0x88, 0x81, 0x77, 0x64, 0x4d, 0x1b, 0x05, 0x00, 0xf8, 0x0a, 0x4d, 0x7b, 0x88, 0x7b, 0x6c, 0x32, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x88, 0x34, 0x00, 0xff, 0x77, 0x02, 0x88, 0xff, 0x85, 0x34, 0x00, 0x03, 0x88, 0xff, 0x6c, 0x34, 0x00, 0xfc, 0x5d, 0x81, 0x7b, 0x32, 0x46, 0x00
+};
+static const Image logo_9_image = {logo_9_data, 56, 49};
 
-static void logo_10(uint8_t *data)
+static const uint8_t logo_10_data[1192] =
 {
-    const uint8_t image_data[1192] =
-    {
-        0x70, 0x00, 0xfc, 0x65, 0x91, 0x8a, 0x38, 0x34, 0x00, 0x03, 0x99, 0xff, 0x85, 0x34, 0x00, 0xff, 0x8a, 0x02, 0x99, 0xff, 0x95, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1c, 0x91, 0x02, 0x99, 0x04, 0x00, 0xfd, 0x0a, 0x55, 0x85, 0x02, 0x99, 0xfc, 0x95, 0x85, 0x4b, 0x04, 0x05, 0x00, 0xfd, 0x0a, 0x55, 0x85, 0x02, 0x99, 0xfc, 0x95, 0x85, 0x4b, 0x04, 0x03, 0x00, 0xf4, 0x65, 0x91, 0x8a, 0x38, 0x0a, 0x55, 0x85, 0x95, 0x91, 0x72, 0x4b, 0x0a, 0x02, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1c, 0x8a, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x07, 0x99, 0xfe, 0x72, 0x04, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x07, 0x99, 0xfe, 0x72, 0x04, 0x02, 0x00, 0x03, 0x99, 0x02, 0x85, 0x06, 0x99, 0xfd, 0x85, 0x0a, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x04, 0x99, 0x03, 0x00, 0xff, 0x7c, 0x03, 0x99, 0xff, 0x72, 0x02, 0x5d, 0xff, 0x8a, 0x02, 0x99, 0xff, 0x55, 0x03, 0x00, 0xff, 0x7c, 0x03, 0x99, 0xff, 0x72, 0x02, 0x5d, 0xff, 0x8a, 0x02, 0x99, 0xff, 0x55, 0x02, 0x00, 0xff, 0x8a, 0x0b, 0x99, 0xfe, 0x65, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x04, 0x72, 0x03, 0x99, 0xff, 0x4b, 0x03, 0x00, 0xff, 0x38, 0x02, 0x99, 0xfe, 0x95, 0x1c, 0x03, 0x00, 0xf9, 0x0a, 0x91, 0x99, 0x95, 0x0a, 0x00, 0x38, 0x02, 0x99, 0xfe, 0x95, 0x1c, 0x03, 0x00, 0xfb, 0x0a, 0x91, 0x99, 0x95, 0x0a, 0x02, 0x00, 0x03, 0x99, 0xfe, 0x65, 0x1c, 0x02, 0x04, 0xfe, 0x1c, 0x85, 0x02, 0x99, 0xfe, 0x91, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x04, 0x65, 0x03, 0x99, 0xff, 0x4b, 0x04, 0x00, 0xff, 0x65, 0x02, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xff, 0x5d, 0x02, 0x99, 0xfd, 0x38, 0x00, 0x65, 0x02, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xff, 0x5d, 0x02, 0x99, 0xff, 0x38, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x38, 0x03, 0x99, 0xff, 0x00, 0x08, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xff, 0x85, 0x02, 0x99, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x4b, 0x02, 0x99, 0xfd, 0x55, 0x00, 0x85, 0x02, 0x99, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x4b, 0x02, 0x99, 0xff, 0x55, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x99, 0xff, 0x00, 0x07, 0x99, 0xff, 0x4b, 0x06, 0x00, 0x0c, 0x99, 0xfe, 0x65, 0x00, 0x0c, 0x99, 0xff, 0x65, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x04, 0x03, 0x99, 0xff, 0x00, 0x07, 0x99, 0xff, 0x4b, 0x06, 0x00, 0x0c, 0x99, 0xfe, 0x65, 0x00, 0x0c, 0x99, 0xff, 0x65, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x04, 0x03, 0x99, 0xff, 0x00, 0x03, 0x99, 0xfe, 0x00, 0x5d, 0x03, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xfd, 0x8a, 0x99, 0x91, 0x0b, 0x00, 0xfd, 0x8a, 0x99, 0x91, 0x0c, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x99, 0xff, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x04, 0x65, 0x03, 0x99, 0xff, 0x4b, 0x04, 0x00, 0xff, 0x72, 0x02, 0x99, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x72, 0x02, 0x99, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x38, 0x03, 0x99, 0xff, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x04, 0x7c, 0x03, 0x99, 0xff, 0x4b, 0x03, 0x00, 0xff, 0x38, 0x02, 0x99, 0xfe, 0x55, 0x04, 0x04, 0x00, 0xfd, 0x38, 0x5d, 0x0a, 0x02, 0x00, 0xff, 0x38, 0x02, 0x99, 0xfe, 0x55, 0x04, 0x04, 0x00, 0xfd, 0x38, 0x5d, 0x0a, 0x03, 0x00, 0x03, 0x99, 0xfe, 0x65, 0x1c, 0x02, 0x04, 0xfe, 0x1c, 0x85, 0x02, 0x99, 0xfe, 0x91, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x04, 0x99, 0x02, 0x00, 0xfe, 0x0a, 0x8a, 0x02, 0x99, 0xfb, 0x85, 0x65, 0x5d, 0x65, 0x8a, 0x02, 0x99, 0xff, 0x55, 0x02, 0x00, 0xfe, 0x0a, 0x8a, 0x02, 0x99, 0xfb, 0x85, 0x65, 0x5d, 0x65, 0x8a, 0x02, 0x99, 0xff, 0x55, 0x03, 0x00, 0x0b, 0x99, 0xfe, 0x65, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1c, 0x8a, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x1c, 0x91, 0x08, 0x99, 0xff, 0x5d, 0x03, 0x00, 0xfe, 0x1c, 0x91, 0x08, 0x99, 0xff, 0x5d, 0x03, 0x00, 0x03, 0x99, 0xff, 0x85, 0x06, 0x99, 0xfd, 0x85, 0x0a, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1c, 0x91, 0x02, 0x99, 0x04, 0x00, 0xf7, 0x1c, 0x5d, 0x8a, 0x99, 0x95, 0x8a, 0x72, 0x5d, 0x1c, 0x05, 0x00, 0xf7, 0x1c, 0x5d, 0x8a, 0x99, 0x95, 0x8a, 0x72, 0x5d, 0x1c, 0x04, 0x00, 0x03, 0x99, 0xf8, 0x0a, 0x55, 0x85, 0x99, 0x91, 0x72, 0x4b, 0x0a, 0x02, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1c, 0x91, 0x02, 0x99, 0x04, 0x00, 0xfd, 0x0a, 0x55, 0x85, 0x02, 0x99, 0xfc, 0x95, 0x85, 0x4b, 0x04, 0x02, 0x00, 0x05, 0x99, 0x04, 0x00, 0x05, 0x99, 0x02, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1c, 0x8a, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x07, 0x99, 0xfd, 0x72, 0x04, 0x00, 0x05, 0x99, 0x04, 0x00, 0x05, 0x99, 0x02, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x04, 0x99, 0x03, 0x00, 0xff, 0x7c, 0x03, 0x99, 0xff, 0x72, 0x02, 0x5d, 0xff, 0x8a, 0x02, 0x99, 0xff, 0x55, 0x03, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x02, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x04, 0x72, 0x03, 0x99, 0xff, 0x4b, 0x03, 0x00, 0xff, 0x38, 0x02, 0x99, 0xfe, 0x95, 0x1c, 0x03, 0x00, 0xfb, 0x0a, 0x91, 0x99, 0x95, 0x0a, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x0f, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x04, 0x65, 0x03, 0x99, 0xff, 0x4b, 0x04, 0x00, 0xff, 0x65, 0x02, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xff, 0x5d, 0x02, 0x99, 0xff, 0x38, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x0f, 0x00, 0x08, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xff, 0x85, 0x02, 0x99, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x4b, 0x02, 0x99, 0xff, 0x55, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x0f, 0x00, 0x07, 0x99, 0xff, 0x4b, 0x06, 0x00, 0x0c, 0x99, 0xff, 0x65, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x0f, 0x00, 0x07, 0x99, 0xff, 0x4b, 0x06, 0x00, 0x0c, 0x99, 0xff, 0x65, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x0f, 0x00, 0x03, 0x99, 0xfe, 0x00, 0x5d, 0x03, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xfd, 0x8a, 0x99, 0x91, 0x0c, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x0f, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x04, 0x65, 0x03, 0x99, 0xff, 0x4b, 0x04, 0x00, 0xff, 0x72, 0x02, 0x99, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0x8a, 0x02, 0x99, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x03, 0x99, 0x0f, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x04, 0x7c, 0x03, 0x99, 0xff, 0x4b, 0x03, 0x00, 0xff, 0x38, 0x02, 0x99, 0xfe, 0x55, 0x04, 0x04, 0x00, 0xfd, 0x38, 0x5d, 0x0a, 0x03, 0x00, 0xff, 0x72, 0x02, 0x99, 0xff, 0x38, 0x03, 0x00, 0xfe, 0x04, 0x65, 0x03, 0x99, 0x0f, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x04, 0x99, 0x02, 0x00, 0xfe, 0x0a, 0x8a, 0x02, 0x99, 0xfb, 0x85, 0x65, 0x5d, 0x65, 0x8a, 0x02, 0x99, 0xff, 0x55, 0x03, 0x00, 0xff, 0x38, 0x02, 0x99, 0xff, 0x91, 0x02, 0x5d, 0xfe, 0x65, 0x8a, 0x04, 0x99, 0x0f, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1c, 0x8a, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x1c, 0x91, 0x08, 0x99, 0xff, 0x5d, 0x03, 0x00, 0xfe, 0x04, 0x85, 0x06, 0x99, 0xff, 0x5d, 0x03, 0x99, 0x0f, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1c, 0x91, 0x02, 0x99, 0x04, 0x00, 0xf7, 0x1c, 0x5d, 0x8a, 0x99, 0x95, 0x8a, 0x72, 0x5d, 0x1c, 0x05, 0x00, 0xf8, 0x0a, 0x5d, 0x8a, 0x99, 0x8a, 0x72, 0x38, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x34, 0x00, 0xff, 0x8a, 0x02, 0x99, 0xff, 0x95, 0x34, 0x00, 0x03, 0x99, 0xff, 0x85, 0x34, 0x00, 0xfc, 0x65, 0x91, 0x8a, 0x38, 0x46, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_10_image = {(void *) &logo_10, 56, 49};
+    0x70, 0x00, 0xfc, 0x65, 0x91, 0x8a, 0x38, 0x34, 0x00, 0x03, 0x99, 0xff, 0x85, 0x34, 0x00, 0xff, 0x8a, 0x02, 0x99, 0xff, 0x95, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1c, 0x91, 0x02, 0x99, 0x04, 0x00, 0xfd, 0x0a, 0x55, 0x85, 0x02, 0x99, 0xfc, 0x95, 0x85, 0x4b, 0x04, 0x05, 0x00, 0xfd, 0x0a, 0x55, 0x85, 0x02, 0x99, 0xfc, 0x95, 0x85, 0x4b, 0x04, 0x03, 0x00, 0xf4, 0x65, 0x91, 0x8a, 0x38, 0x0a, 0x55, 0x85, 0x95, 0x91, 0x72, 0x4b, 0x0a, 0x02, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1c, 0x8a, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x07, 0x99, 0xfe, 0x72, 0x04, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x07, 0x99, 0xfe, 0x72, 0x04, 0x02, 0x00, 0x03, 0x99, 0x02, 0x85, 0x06, 0x99, 0xfd, 0x85, 0x0a, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x04, 0x99, 0x03, 0x00, 0xff, 0x7c, 0x03, 0x99, 0xff, 0x72, 0x02, 0x5d, 0xff, 0x8a, 0x02, 0x99, 0xff, 0x55, 0x03, 0x00, 0xff, 0x7c, 0x03, 0x99, 0xff, 0x72, 0x02, 0x5d, 0xff, 0x8a, 0x02, 0x99, 0xff, 0x55, 0x02, 0x00, 0xff, 0x8a, 0x0b, 0x99, 0xfe, 0x65, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x04, 0x72, 0x03, 0x99, 0xff, 0x4b, 0x03, 0x00, 0xff, 0x38, 0x02, 0x99, 0xfe, 0x95, 0x1c, 0x03, 0x00, 0xf9, 0x0a, 0x91, 0x99, 0x95, 0x0a, 0x00, 0x38, 0x02, 0x99, 0xfe, 0x95, 0x1c, 0x03, 0x00, 0xfb, 0x0a, 0x91, 0x99, 0x95, 0x0a, 0x02, 0x00, 0x03, 0x99, 0xfe, 0x65, 0x1c, 0x02, 0x04, 0xfe, 0x1c, 0x85, 0x02, 0x99, 0xfe, 0x91, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x04, 0x65, 0x03, 0x99, 0xff, 0x4b, 0x04, 0x00, 0xff, 0x65, 0x02, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xff, 0x5d, 0x02, 0x99, 0xfd, 0x38, 0x00, 0x65, 0x02, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xff, 0x5d, 0x02, 0x99, 0xff, 0x38, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x38, 0x03, 0x99, 0xff, 0x00, 0x08, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xff, 0x85, 0x02, 0x99, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x4b, 0x02, 0x99, 0xfd, 0x55, 0x00, 0x85, 0x02, 0x99, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x4b, 0x02, 0x99, 0xff, 0x55, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x99, 0xff, 0x00, 0x07, 0x99, 0xff, 0x4b, 0x06, 0x00, 0x0c, 0x99, 0xfe, 0x65, 0x00, 0x0c, 0x99, 0xff, 0x65, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x04, 0x03, 0x99, 0xff, 0x00, 0x07, 0x99, 0xff, 0x4b, 0x06, 0x00, 0x0c, 0x99, 0xfe, 0x65, 0x00, 0x0c, 0x99, 0xff, 0x65, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x04, 0x03, 0x99, 0xff, 0x00, 0x03, 0x99, 0xfe, 0x00, 0x5d, 0x03, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xfd, 0x8a, 0x99, 0x91, 0x0b, 0x00, 0xfd, 0x8a, 0x99, 0x91, 0x0c, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x0a, 0x03, 0x99, 0xff, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x04, 0x65, 0x03, 0x99, 0xff, 0x4b, 0x04, 0x00, 0xff, 0x72, 0x02, 0x99, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x72, 0x02, 0x99, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x38, 0x03, 0x99, 0xff, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x04, 0x7c, 0x03, 0x99, 0xff, 0x4b, 0x03, 0x00, 0xff, 0x38, 0x02, 0x99, 0xfe, 0x55, 0x04, 0x04, 0x00, 0xfd, 0x38, 0x5d, 0x0a, 0x02, 0x00, 0xff, 0x38, 0x02, 0x99, 0xfe, 0x55, 0x04, 0x04, 0x00, 0xfd, 0x38, 0x5d, 0x0a, 0x03, 0x00, 0x03, 0x99, 0xfe, 0x65, 0x1c, 0x02, 0x04, 0xfe, 0x1c, 0x85, 0x02, 0x99, 0xfe, 0x91, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x04, 0x99, 0x02, 0x00, 0xfe, 0x0a, 0x8a, 0x02, 0x99, 0xfb, 0x85, 0x65, 0x5d, 0x65, 0x8a, 0x02, 0x99, 0xff, 0x55, 0x02, 0x00, 0xfe, 0x0a, 0x8a, 0x02, 0x99, 0xfb, 0x85, 0x65, 0x5d, 0x65, 0x8a, 0x02, 0x99, 0xff, 0x55, 0x03, 0x00, 0x0b, 0x99, 0xfe, 0x65, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1c, 0x8a, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x1c, 0x91, 0x08, 0x99, 0xff, 0x5d, 0x03, 0x00, 0xfe, 0x1c, 0x91, 0x08, 0x99, 0xff, 0x5d, 0x03, 0x00, 0x03, 0x99, 0xff, 0x85, 0x06, 0x99, 0xfd, 0x85, 0x0a, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1c, 0x91, 0x02, 0x99, 0x04, 0x00, 0xf7, 0x1c, 0x5d, 0x8a, 0x99, 0x95, 0x8a, 0x72, 0x5d, 0x1c, 0x05, 0x00, 0xf7, 0x1c, 0x5d, 0x8a, 0x99, 0x95, 0x8a, 0x72, 0x5d, 0x1c, 0x04, 0x00, 0x03, 0x99, 0xf8, 0x0a, 0x55, 0x85, 0x99, 0x91, 0x72, 0x4b, 0x0a, 0x02, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1c, 0x91, 0x02, 0x99, 0x04, 0x00, 0xfd, 0x0a, 0x55, 0x85, 0x02, 0x99, 0xfc, 0x95, 0x85, 0x4b, 0x04, 0x02, 0x00, 0x05, 0x99, 0x04, 0x00, 0x05, 0x99, 0x02, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1c, 0x8a, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x07, 0x99, 0xfd, 0x72, 0x04, 0x00, 0x05, 0x99, 0x04, 0x00, 0x05, 0x99, 0x02, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x04, 0x99, 0x03, 0x00, 0xff, 0x7c, 0x03, 0x99, 0xff, 0x72, 0x02, 0x5d, 0xff, 0x8a, 0x02, 0x99, 0xff, 0x55, 0x03, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x02, 0x00, 0x03, 0x99, 0x0a, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x04, 0x72, 0x03, 0x99, 0xff, 0x4b, 0x03, 0x00, 0xff, 0x38, 0x02, 0x99, 0xfe, 0x95, 0x1c, 0x03, 0x00, 0xfb, 0x0a, 0x91, 0x99, 0x95, 0x0a, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x0f, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x04, 0x65, 0x03, 0x99, 0xff, 0x4b, 0x04, 0x00, 0xff, 0x65, 0x02, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xff, 0x5d, 0x02, 0x99, 0xff, 0x38, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x0f, 0x00, 0x08, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xff, 0x85, 0x02, 0x99, 0xff, 0x1c, 0x05, 0x00, 0xff, 0x4b, 0x02, 0x99, 0xff, 0x55, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x0f, 0x00, 0x07, 0x99, 0xff, 0x4b, 0x06, 0x00, 0x0c, 0x99, 0xff, 0x65, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x0f, 0x00, 0x07, 0x99, 0xff, 0x4b, 0x06, 0x00, 0x0c, 0x99, 0xff, 0x65, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x0f, 0x00, 0x03, 0x99, 0xfe, 0x00, 0x5d, 0x03, 0x99, 0xff, 0x4b, 0x05, 0x00, 0xfd, 0x8a, 0x99, 0x91, 0x0c, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x0f, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x04, 0x65, 0x03, 0x99, 0xff, 0x4b, 0x04, 0x00, 0xff, 0x72, 0x02, 0x99, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0x8a, 0x02, 0x99, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x03, 0x99, 0x0f, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x04, 0x7c, 0x03, 0x99, 0xff, 0x4b, 0x03, 0x00, 0xff, 0x38, 0x02, 0x99, 0xfe, 0x55, 0x04, 0x04, 0x00, 0xfd, 0x38, 0x5d, 0x0a, 0x03, 0x00, 0xff, 0x72, 0x02, 0x99, 0xff, 0x38, 0x03, 0x00, 0xfe, 0x04, 0x65, 0x03, 0x99, 0x0f, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0a, 0x85, 0x04, 0x99, 0x02, 0x00, 0xfe, 0x0a, 0x8a, 0x02, 0x99, 0xfb, 0x85, 0x65, 0x5d, 0x65, 0x8a, 0x02, 0x99, 0xff, 0x55, 0x03, 0x00, 0xff, 0x38, 0x02, 0x99, 0xff, 0x91, 0x02, 0x5d, 0xfe, 0x65, 0x8a, 0x04, 0x99, 0x0f, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1c, 0x8a, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x1c, 0x91, 0x08, 0x99, 0xff, 0x5d, 0x03, 0x00, 0xfe, 0x04, 0x85, 0x06, 0x99, 0xff, 0x5d, 0x03, 0x99, 0x0f, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1c, 0x91, 0x02, 0x99, 0x04, 0x00, 0xf7, 0x1c, 0x5d, 0x8a, 0x99, 0x95, 0x8a, 0x72, 0x5d, 0x1c, 0x05, 0x00, 0xf8, 0x0a, 0x5d, 0x8a, 0x99, 0x8a, 0x72, 0x38, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x35, 0x00, 0x03, 0x99, 0x34, 0x00, 0xff, 0x8a, 0x02, 0x99, 0xff, 0x95, 0x34, 0x00, 0x03, 0x99, 0xff, 0x85, 0x34, 0x00, 0xfc, 0x65, 0x91, 0x8a, 0x38, 0x46, 0x00
+};
+static const Image logo_10_image = {logo_10_data, 56, 49};
 
-static void logo_11(uint8_t *data)
+static const uint8_t logo_11_data[1189] =
 {
-    const uint8_t image_data[1189] =
-    {
-        0x38, 0x00, 0xfc, 0x72, 0xa1, 0x9a, 0x24, 0x34, 0x00, 0x03, 0xaa, 0xff, 0x8b, 0x34, 0x00, 0xff, 0x9a, 0x02, 0xaa, 0xff, 0xa5, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xfe, 0x24, 0xa1, 0x02, 0xaa, 0x04, 0x00, 0xfd, 0x07, 0x61, 0x95, 0x02, 0xaa, 0xfc, 0xa5, 0x95, 0x57, 0x07, 0x05, 0x00, 0xfd, 0x07, 0x61, 0x95, 0x02, 0xaa, 0xfc, 0xa5, 0x95, 0x57, 0x07, 0x03, 0x00, 0xf4, 0x72, 0xa1, 0x9a, 0x24, 0x07, 0x57, 0x95, 0xa5, 0xa1, 0x7f, 0x44, 0x07, 0x02, 0x00, 0x03, 0xaa, 0x04, 0x00, 0xfe, 0x11, 0x9a, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x07, 0xaa, 0xfe, 0x7f, 0x07, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x07, 0xaa, 0xfe, 0x7f, 0x07, 0x02, 0x00, 0x03, 0xaa, 0x02, 0x95, 0x06, 0xaa, 0xfd, 0x95, 0x11, 0x00, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x04, 0xaa, 0x03, 0x00, 0xff, 0x8b, 0x03, 0xaa, 0xff, 0x7f, 0x02, 0x6a, 0xff, 0x9a, 0x02, 0xaa, 0xff, 0x61, 0x03, 0x00, 0xff, 0x8b, 0x03, 0xaa, 0xff, 0x7f, 0x02, 0x6a, 0xff, 0x9a, 0x02, 0xaa, 0xff, 0x61, 0x02, 0x00, 0xff, 0x9a, 0x0b, 0xaa, 0xfe, 0x72, 0x00, 0x03, 0xaa, 0x02, 0x00, 0xfe, 0x07, 0x7f, 0x03, 0xaa, 0xff, 0x57, 0x03, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xfe, 0xa5, 0x24, 0x03, 0x00, 0xf9, 0x11, 0xa1, 0xaa, 0xa5, 0x11, 0x00, 0x44, 0x02, 0xaa, 0xfe, 0xa5, 0x24, 0x03, 0x00, 0xfb, 0x11, 0xa1, 0xaa, 0xa5, 0x11, 0x02, 0x00, 0x03, 0xaa, 0xfe, 0x72, 0x24, 0x02, 0x07, 0xfe, 0x24, 0x95, 0x02, 0xaa, 0xfe, 0xa1, 0x00, 0x03, 0xaa, 0xfd, 0x00, 0x07, 0x72, 0x03, 0xaa, 0xff, 0x57, 0x04, 0x00, 0xff, 0x72, 0x02, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xff, 0x6a, 0x02, 0xaa, 0xfd, 0x44, 0x00, 0x72, 0x02, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xff, 0x6a, 0x02, 0xaa, 0xff, 0x44, 0x02, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xff, 0x44, 0x03, 0xaa, 0xff, 0x00, 0x08, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xff, 0x95, 0x02, 0xaa, 0xff, 0x24, 0x05, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xfd, 0x57, 0x00, 0x95, 0x02, 0xaa, 0xff, 0x24, 0x05, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xff, 0x57, 0x02, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xff, 0x11, 0x03, 0xaa, 0xff, 0x00, 0x07, 0xaa, 0xff, 0x57, 0x06, 0x00, 0x0c, 0xaa, 0xfe, 0x72, 0x00, 0x0c, 0xaa, 0xff, 0x72, 0x02, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xff, 0x07, 0x03, 0xaa, 0xff, 0x00, 0x07, 0xaa, 0xff, 0x57, 0x06, 0x00, 0x0c, 0xaa, 0xfe, 0x72, 0x00, 0x0c, 0xaa, 0xff, 0x72, 0x02, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xff, 0x07, 0x03, 0xaa, 0xff, 0x00, 0x03, 0xaa, 0xfe, 0x00, 0x61, 0x03, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xfd, 0x9a, 0xaa, 0xa1, 0x0b, 0x00, 0xfd, 0x9a, 0xaa, 0xa1, 0x0c, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xff, 0x11, 0x03, 0xaa, 0xff, 0x00, 0x03, 0xaa, 0xfd, 0x00, 0x07, 0x72, 0x03, 0xaa, 0xff, 0x57, 0x04, 0x00, 0xff, 0x7f, 0x02, 0xaa, 0xff, 0x07, 0x0a, 0x00, 0xff, 0x7f, 0x02, 0xaa, 0xff, 0x07, 0x0b, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xff, 0x44, 0x03, 0xaa, 0xff, 0x00, 0x03, 0xaa, 0x02, 0x00, 0xfe, 0x07, 0x7f, 0x03, 0xaa, 0xff, 0x57, 0x03, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xff, 0x61, 0x05, 0x00, 0xfd, 0x44, 0x6a, 0x07, 0x02, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xff, 0x61, 0x05, 0x00, 0xfd, 0x44, 0x6a, 0x07, 0x03, 0x00, 0x03, 0xaa, 0xfe, 0x72, 0x24, 0x02, 0x07, 0xfe, 0x24, 0x95, 0x02, 0xaa, 0xfe, 0xa1, 0x00, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x04, 0xaa, 0x02, 0x00, 0xfe, 0x07, 0x9a, 0x02, 0xaa, 0xfb, 0x95, 0x72, 0x6a, 0x72, 0x9a, 0x02, 0xaa, 0xff, 0x61, 0x02, 0x00, 0xfe, 0x07, 0x9a, 0x02, 0xaa, 0xfb, 0x95, 0x72, 0x6a, 0x72, 0x9a, 0x02, 0xaa, 0xff, 0x61, 0x03, 0x00, 0x0b, 0xaa, 0xfe, 0x72, 0x00, 0x03, 0xaa, 0x04, 0x00, 0xfe, 0x11, 0x9a, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x24, 0xa1, 0x08, 0xaa, 0xff, 0x6a, 0x03, 0x00, 0xfe, 0x24, 0xa1, 0x08, 0xaa, 0xff, 0x6a, 0x03, 0x00, 0x03, 0xaa, 0xff, 0x95, 0x06, 0xaa, 0xfd, 0x95, 0x11, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xfe, 0x24, 0xa1, 0x02, 0xaa, 0x04, 0x00, 0xf7, 0x11, 0x6a, 0x9a, 0xaa, 0xa5, 0x9a, 0x7f, 0x61, 0x24, 0x05, 0x00, 0xf7, 0x11, 0x6a, 0x9a, 0xaa, 0xa5, 0x9a, 0x7f, 0x61, 0x24, 0x04, 0x00, 0x03, 0xaa, 0xf8, 0x07, 0x57, 0x95, 0xaa, 0xa1, 0x7f, 0x44, 0x07, 0x02, 0x00, 0x03, 0xaa, 0x28, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x28, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x28, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x28, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xfe, 0x24, 0xa1, 0x02, 0xaa, 0x04, 0x00, 0xfd, 0x07, 0x61, 0x95, 0x02, 0xaa, 0xfc, 0xa5, 0x95, 0x57, 0x07, 0x02, 0x00, 0x05, 0xaa, 0x04, 0x00, 0x05, 0xaa, 0x02, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x04, 0x00, 0xfe, 0x11, 0x9a, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x07, 0xaa, 0xfd, 0x7f, 0x07, 0x00, 0x05, 0xaa, 0x04, 0x00, 0x05, 0xaa, 0x02, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x04, 0xaa, 0x03, 0x00, 0xff, 0x8b, 0x03, 0xaa, 0xff, 0x7f, 0x02, 0x6a, 0xff, 0x9a, 0x02, 0xaa, 0xff, 0x61, 0x03, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x02, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x02, 0x00, 0xfe, 0x07, 0x7f, 0x03, 0xaa, 0xff, 0x57, 0x03, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xfe, 0xa5, 0x24, 0x03, 0x00, 0xfb, 0x11, 0xa1, 0xaa, 0xa5, 0x11, 0x02, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0xfd, 0x00, 0x07, 0x72, 0x03, 0xaa, 0xff, 0x57, 0x04, 0x00, 0xff, 0x72, 0x02, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xff, 0x6a, 0x02, 0xaa, 0xff, 0x44, 0x02, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x0f, 0x00, 0x08, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xff, 0x95, 0x02, 0xaa, 0xff, 0x24, 0x05, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xff, 0x57, 0x02, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x0f, 0x00, 0x07, 0xaa, 0xff, 0x57, 0x06, 0x00, 0x0c, 0xaa, 0xff, 0x72, 0x02, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x0f, 0x00, 0x07, 0xaa, 0xff, 0x57, 0x06, 0x00, 0x0c, 0xaa, 0xff, 0x72, 0x02, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0xfe, 0x00, 0x61, 0x03, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xfd, 0x9a, 0xaa, 0xa1, 0x0c, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0xfd, 0x00, 0x07, 0x72, 0x03, 0xaa, 0xff, 0x57, 0x04, 0x00, 0xff, 0x7f, 0x02, 0xaa, 0xff, 0x07, 0x0b, 0x00, 0xff, 0x9a, 0x02, 0xaa, 0xff, 0x11, 0x04, 0x00, 0xff, 0x07, 0x03, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0x02, 0x00, 0xfe, 0x07, 0x7f, 0x03, 0xaa, 0xff, 0x57, 0x03, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xff, 0x61, 0x05, 0x00, 0xfd, 0x44, 0x6a, 0x07, 0x03, 0x00, 0xff, 0x7f, 0x02, 0xaa, 0xff, 0x44, 0x03, 0x00, 0xfe, 0x07, 0x72, 0x03, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x04, 0xaa, 0x02, 0x00, 0xfe, 0x07, 0x9a, 0x02, 0xaa, 0xfb, 0x95, 0x72, 0x6a, 0x72, 0x9a, 0x02, 0xaa, 0xff, 0x61, 0x03, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xff, 0xa1, 0x02, 0x6a, 0xfe, 0x72, 0x95, 0x04, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0x04, 0x00, 0xfe, 0x11, 0x9a, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x24, 0xa1, 0x08, 0xaa, 0xff, 0x6a, 0x03, 0x00, 0xfe, 0x07, 0x8b, 0x06, 0xaa, 0xff, 0x61, 0x03, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xfe, 0x24, 0xa1, 0x02, 0xaa, 0x04, 0x00, 0xf7, 0x11, 0x6a, 0x9a, 0xaa, 0xa5, 0x9a, 0x7f, 0x61, 0x24, 0x05, 0x00, 0xf8, 0x11, 0x6a, 0x9a, 0xaa, 0x9a, 0x7f, 0x44, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x34, 0x00, 0xff, 0x9a, 0x02, 0xaa, 0xff, 0xa5, 0x34, 0x00, 0x03, 0xaa, 0xff, 0x8b, 0x34, 0x00, 0xfc, 0x72, 0xa1, 0x9a, 0x24, 0x7e, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_11_image = {(void *) &logo_11, 56, 49};
+    0x38, 0x00, 0xfc, 0x72, 0xa1, 0x9a, 0x24, 0x34, 0x00, 0x03, 0xaa, 0xff, 0x8b, 0x34, 0x00, 0xff, 0x9a, 0x02, 0xaa, 0xff, 0xa5, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xfe, 0x24, 0xa1, 0x02, 0xaa, 0x04, 0x00, 0xfd, 0x07, 0x61, 0x95, 0x02, 0xaa, 0xfc, 0xa5, 0x95, 0x57, 0x07, 0x05, 0x00, 0xfd, 0x07, 0x61, 0x95, 0x02, 0xaa, 0xfc, 0xa5, 0x95, 0x57, 0x07, 0x03, 0x00, 0xf4, 0x72, 0xa1, 0x9a, 0x24, 0x07, 0x57, 0x95, 0xa5, 0xa1, 0x7f, 0x44, 0x07, 0x02, 0x00, 0x03, 0xaa, 0x04, 0x00, 0xfe, 0x11, 0x9a, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x07, 0xaa, 0xfe, 0x7f, 0x07, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x07, 0xaa, 0xfe, 0x7f, 0x07, 0x02, 0x00, 0x03, 0xaa, 0x02, 0x95, 0x06, 0xaa, 0xfd, 0x95, 0x11, 0x00, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x04, 0xaa, 0x03, 0x00, 0xff, 0x8b, 0x03, 0xaa, 0xff, 0x7f, 0x02, 0x6a, 0xff, 0x9a, 0x02, 0xaa, 0xff, 0x61, 0x03, 0x00, 0xff, 0x8b, 0x03, 0xaa, 0xff, 0x7f, 0x02, 0x6a, 0xff, 0x9a, 0x02, 0xaa, 0xff, 0x61, 0x02, 0x00, 0xff, 0x9a, 0x0b, 0xaa, 0xfe, 0x72, 0x00, 0x03, 0xaa, 0x02, 0x00, 0xfe, 0x07, 0x7f, 0x03, 0xaa, 0xff, 0x57, 0x03, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xfe, 0xa5, 0x24, 0x03, 0x00, 0xf9, 0x11, 0xa1, 0xaa, 0xa5, 0x11, 0x00, 0x44, 0x02, 0xaa, 0xfe, 0xa5, 0x24, 0x03, 0x00, 0xfb, 0x11, 0xa1, 0xaa, 0xa5, 0x11, 0x02, 0x00, 0x03, 0xaa, 0xfe, 0x72, 0x24, 0x02, 0x07, 0xfe, 0x24, 0x95, 0x02, 0xaa, 0xfe, 0xa1, 0x00, 0x03, 0xaa, 0xfd, 0x00, 0x07, 0x72, 0x03, 0xaa, 0xff, 0x57, 0x04, 0x00, 0xff, 0x72, 0x02, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xff, 0x6a, 0x02, 0xaa, 0xfd, 0x44, 0x00, 0x72, 0x02, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xff, 0x6a, 0x02, 0xaa, 0xff, 0x44, 0x02, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xff, 0x44, 0x03, 0xaa, 0xff, 0x00, 0x08, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xff, 0x95, 0x02, 0xaa, 0xff, 0x24, 0x05, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xfd, 0x57, 0x00, 0x95, 0x02, 0xaa, 0xff, 0x24, 0x05, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xff, 0x57, 0x02, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xff, 0x11, 0x03, 0xaa, 0xff, 0x00, 0x07, 0xaa, 0xff, 0x57, 0x06, 0x00, 0x0c, 0xaa, 0xfe, 0x72, 0x00, 0x0c, 0xaa, 0xff, 0x72, 0x02, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xff, 0x07, 0x03, 0xaa, 0xff, 0x00, 0x07, 0xaa, 0xff, 0x57, 0x06, 0x00, 0x0c, 0xaa, 0xfe, 0x72, 0x00, 0x0c, 0xaa, 0xff, 0x72, 0x02, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xff, 0x07, 0x03, 0xaa, 0xff, 0x00, 0x03, 0xaa, 0xfe, 0x00, 0x61, 0x03, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xfd, 0x9a, 0xaa, 0xa1, 0x0b, 0x00, 0xfd, 0x9a, 0xaa, 0xa1, 0x0c, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xff, 0x11, 0x03, 0xaa, 0xff, 0x00, 0x03, 0xaa, 0xfd, 0x00, 0x07, 0x72, 0x03, 0xaa, 0xff, 0x57, 0x04, 0x00, 0xff, 0x7f, 0x02, 0xaa, 0xff, 0x07, 0x0a, 0x00, 0xff, 0x7f, 0x02, 0xaa, 0xff, 0x07, 0x0b, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xff, 0x44, 0x03, 0xaa, 0xff, 0x00, 0x03, 0xaa, 0x02, 0x00, 0xfe, 0x07, 0x7f, 0x03, 0xaa, 0xff, 0x57, 0x03, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xff, 0x61, 0x05, 0x00, 0xfd, 0x44, 0x6a, 0x07, 0x02, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xff, 0x61, 0x05, 0x00, 0xfd, 0x44, 0x6a, 0x07, 0x03, 0x00, 0x03, 0xaa, 0xfe, 0x72, 0x24, 0x02, 0x07, 0xfe, 0x24, 0x95, 0x02, 0xaa, 0xfe, 0xa1, 0x00, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x04, 0xaa, 0x02, 0x00, 0xfe, 0x07, 0x9a, 0x02, 0xaa, 0xfb, 0x95, 0x72, 0x6a, 0x72, 0x9a, 0x02, 0xaa, 0xff, 0x61, 0x02, 0x00, 0xfe, 0x07, 0x9a, 0x02, 0xaa, 0xfb, 0x95, 0x72, 0x6a, 0x72, 0x9a, 0x02, 0xaa, 0xff, 0x61, 0x03, 0x00, 0x0b, 0xaa, 0xfe, 0x72, 0x00, 0x03, 0xaa, 0x04, 0x00, 0xfe, 0x11, 0x9a, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x24, 0xa1, 0x08, 0xaa, 0xff, 0x6a, 0x03, 0x00, 0xfe, 0x24, 0xa1, 0x08, 0xaa, 0xff, 0x6a, 0x03, 0x00, 0x03, 0xaa, 0xff, 0x95, 0x06, 0xaa, 0xfd, 0x95, 0x11, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xfe, 0x24, 0xa1, 0x02, 0xaa, 0x04, 0x00, 0xf7, 0x11, 0x6a, 0x9a, 0xaa, 0xa5, 0x9a, 0x7f, 0x61, 0x24, 0x05, 0x00, 0xf7, 0x11, 0x6a, 0x9a, 0xaa, 0xa5, 0x9a, 0x7f, 0x61, 0x24, 0x04, 0x00, 0x03, 0xaa, 0xf8, 0x07, 0x57, 0x95, 0xaa, 0xa1, 0x7f, 0x44, 0x07, 0x02, 0x00, 0x03, 0xaa, 0x28, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x28, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x28, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x28, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xfe, 0x24, 0xa1, 0x02, 0xaa, 0x04, 0x00, 0xfd, 0x07, 0x61, 0x95, 0x02, 0xaa, 0xfc, 0xa5, 0x95, 0x57, 0x07, 0x02, 0x00, 0x05, 0xaa, 0x04, 0x00, 0x05, 0xaa, 0x02, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x04, 0x00, 0xfe, 0x11, 0x9a, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x07, 0xaa, 0xfd, 0x7f, 0x07, 0x00, 0x05, 0xaa, 0x04, 0x00, 0x05, 0xaa, 0x02, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x04, 0xaa, 0x03, 0x00, 0xff, 0x8b, 0x03, 0xaa, 0xff, 0x7f, 0x02, 0x6a, 0xff, 0x9a, 0x02, 0xaa, 0xff, 0x61, 0x03, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x02, 0x00, 0x03, 0xaa, 0x0a, 0x00, 0x03, 0xaa, 0x02, 0x00, 0xfe, 0x07, 0x7f, 0x03, 0xaa, 0xff, 0x57, 0x03, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xfe, 0xa5, 0x24, 0x03, 0x00, 0xfb, 0x11, 0xa1, 0xaa, 0xa5, 0x11, 0x02, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0xfd, 0x00, 0x07, 0x72, 0x03, 0xaa, 0xff, 0x57, 0x04, 0x00, 0xff, 0x72, 0x02, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xff, 0x6a, 0x02, 0xaa, 0xff, 0x44, 0x02, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x0f, 0x00, 0x08, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xff, 0x95, 0x02, 0xaa, 0xff, 0x24, 0x05, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xff, 0x57, 0x02, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x0f, 0x00, 0x07, 0xaa, 0xff, 0x57, 0x06, 0x00, 0x0c, 0xaa, 0xff, 0x72, 0x02, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x0f, 0x00, 0x07, 0xaa, 0xff, 0x57, 0x06, 0x00, 0x0c, 0xaa, 0xff, 0x72, 0x02, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0xfe, 0x00, 0x61, 0x03, 0xaa, 0xff, 0x57, 0x05, 0x00, 0xfd, 0x9a, 0xaa, 0xa1, 0x0c, 0x00, 0x03, 0xaa, 0x06, 0x00, 0x03, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0xfd, 0x00, 0x07, 0x72, 0x03, 0xaa, 0xff, 0x57, 0x04, 0x00, 0xff, 0x7f, 0x02, 0xaa, 0xff, 0x07, 0x0b, 0x00, 0xff, 0x9a, 0x02, 0xaa, 0xff, 0x11, 0x04, 0x00, 0xff, 0x07, 0x03, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0x02, 0x00, 0xfe, 0x07, 0x7f, 0x03, 0xaa, 0xff, 0x57, 0x03, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xff, 0x61, 0x05, 0x00, 0xfd, 0x44, 0x6a, 0x07, 0x03, 0x00, 0xff, 0x7f, 0x02, 0xaa, 0xff, 0x44, 0x03, 0x00, 0xfe, 0x07, 0x72, 0x03, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x11, 0x95, 0x04, 0xaa, 0x02, 0x00, 0xfe, 0x07, 0x9a, 0x02, 0xaa, 0xfb, 0x95, 0x72, 0x6a, 0x72, 0x9a, 0x02, 0xaa, 0xff, 0x61, 0x03, 0x00, 0xff, 0x44, 0x02, 0xaa, 0xff, 0xa1, 0x02, 0x6a, 0xfe, 0x72, 0x95, 0x04, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0x04, 0x00, 0xfe, 0x11, 0x9a, 0x03, 0xaa, 0x03, 0x00, 0xfe, 0x24, 0xa1, 0x08, 0xaa, 0xff, 0x6a, 0x03, 0x00, 0xfe, 0x07, 0x8b, 0x06, 0xaa, 0xff, 0x61, 0x03, 0xaa, 0x0f, 0x00, 0x03, 0xaa, 0x05, 0x00, 0xfe, 0x24, 0xa1, 0x02, 0xaa, 0x04, 0x00, 0xf7, 0x11, 0x6a, 0x9a, 0xaa, 0xa5, 0x9a, 0x7f, 0x61, 0x24, 0x05, 0x00, 0xf8, 0x11, 0x6a, 0x9a, 0xaa, 0x9a, 0x7f, 0x44, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x35, 0x00, 0x03, 0xaa, 0x34, 0x00, 0xff, 0x9a, 0x02, 0xaa, 0xff, 0xa5, 0x34, 0x00, 0x03, 0xaa, 0xff, 0x8b, 0x34, 0x00, 0xfc, 0x72, 0xa1, 0x9a, 0x24, 0x7e, 0x00
+};
+static const Image logo_11_image = {logo_11_data, 56, 49};
 
-static void logo_12(uint8_t *data)
+static const uint8_t logo_12_data[1185] =
 {
-    const uint8_t image_data[1185] =
-    {
-        0x38, 0x00, 0xfc, 0x84, 0xb3, 0xa9, 0x46, 0x34, 0x00, 0x03, 0xbb, 0xff, 0xa1, 0x34, 0x00, 0xff, 0xa9, 0x02, 0xbb, 0xff, 0xb3, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xfe, 0x24, 0xb3, 0x02, 0xbb, 0x04, 0x00, 0xfd, 0x0a, 0x65, 0xa1, 0x02, 0xbb, 0xfc, 0xb3, 0xa1, 0x5d, 0x04, 0x05, 0x00, 0xfd, 0x0a, 0x65, 0xa1, 0x02, 0xbb, 0xfc, 0xb3, 0xa1, 0x5d, 0x04, 0x03, 0x00, 0xf4, 0x84, 0xb3, 0xa9, 0x46, 0x0a, 0x5d, 0xa1, 0xbb, 0xb3, 0x94, 0x5d, 0x0a, 0x02, 0x00, 0x03, 0xbb, 0x04, 0x00, 0xfe, 0x24, 0xa9, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x07, 0xbb, 0xfe, 0x94, 0x0a, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x07, 0xbb, 0xfe, 0x94, 0x0a, 0x02, 0x00, 0x03, 0xbb, 0x02, 0xa1, 0x06, 0xbb, 0xfd, 0xa1, 0x11, 0x00, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x04, 0xbb, 0x03, 0x00, 0xff, 0x94, 0x03, 0xbb, 0xfc, 0x84, 0x6f, 0x78, 0xb3, 0x02, 0xbb, 0xff, 0x6f, 0x03, 0x00, 0xff, 0x94, 0x03, 0xbb, 0xfc, 0x84, 0x6f, 0x78, 0xb3, 0x02, 0xbb, 0xff, 0x6f, 0x02, 0x00, 0xff, 0xa9, 0x0b, 0xbb, 0xfe, 0x84, 0x00, 0x03, 0xbb, 0x02, 0x00, 0xfe, 0x0a, 0x94, 0x03, 0xbb, 0xff, 0x5d, 0x03, 0x00, 0xff, 0x46, 0x02, 0xbb, 0xfe, 0xb3, 0x24, 0x03, 0x00, 0xf9, 0x11, 0xb3, 0xbb, 0xb3, 0x11, 0x00, 0x46, 0x02, 0xbb, 0xfe, 0xb3, 0x24, 0x03, 0x00, 0xfb, 0x11, 0xb3, 0xbb, 0xb3, 0x11, 0x02, 0x00, 0x03, 0xbb, 0xfa, 0x78, 0x24, 0x0a, 0x04, 0x24, 0xa1, 0x02, 0xbb, 0xfe, 0xb3, 0x00, 0x03, 0xbb, 0xfd, 0x00, 0x04, 0x84, 0x03, 0xbb, 0xff, 0x5d, 0x04, 0x00, 0xff, 0x78, 0x02, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xff, 0x78, 0x02, 0xbb, 0xfd, 0x46, 0x00, 0x78, 0x02, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xff, 0x78, 0x02, 0xbb, 0xff, 0x46, 0x02, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xff, 0x46, 0x03, 0xbb, 0xff, 0x00, 0x08, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xff, 0xa1, 0x02, 0xbb, 0xff, 0x24, 0x05, 0x00, 0xff, 0x5d, 0x02, 0xbb, 0xfd, 0x65, 0x00, 0xa1, 0x02, 0xbb, 0xff, 0x24, 0x05, 0x00, 0xff, 0x5d, 0x02, 0xbb, 0xff, 0x65, 0x02, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xff, 0x11, 0x03, 0xbb, 0xff, 0x00, 0x07, 0xbb, 0xff, 0x5d, 0x06, 0x00, 0x0c, 0xbb, 0xfe, 0x78, 0x00, 0x0c, 0xbb, 0xff, 0x78, 0x02, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xff, 0x04, 0x03, 0xbb, 0xff, 0x00, 0x07, 0xbb, 0xff, 0x5d, 0x06, 0x00, 0x0c, 0xbb, 0xfe, 0x78, 0x00, 0x0c, 0xbb, 0xff, 0x78, 0x02, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xff, 0x04, 0x03, 0xbb, 0xff, 0x00, 0x03, 0xbb, 0xfe, 0x00, 0x6f, 0x03, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xfd, 0xa9, 0xbb, 0xb3, 0x0b, 0x00, 0xfd, 0xa9, 0xbb, 0xb3, 0x0c, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xff, 0x11, 0x03, 0xbb, 0xff, 0x00, 0x03, 0xbb, 0xfd, 0x00, 0x04, 0x84, 0x03, 0xbb, 0xff, 0x5d, 0x04, 0x00, 0xff, 0x94, 0x02, 0xbb, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x94, 0x02, 0xbb, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xff, 0x46, 0x03, 0xbb, 0xff, 0x00, 0x03, 0xbb, 0x02, 0x00, 0xfe, 0x0a, 0x94, 0x03, 0xbb, 0xff, 0x5d, 0x03, 0x00, 0xff, 0x46, 0x02, 0xbb, 0xff, 0x6f, 0x05, 0x00, 0xfd, 0x46, 0x6f, 0x0a, 0x02, 0x00, 0xff, 0x46, 0x02, 0xbb, 0xff, 0x6f, 0x05, 0x00, 0xfd, 0x46, 0x6f, 0x0a, 0x03, 0x00, 0x03, 0xbb, 0xfa, 0x78, 0x24, 0x0a, 0x04, 0x24, 0xa1, 0x02, 0xbb, 0xfe, 0xb3, 0x00, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x04, 0xbb, 0x02, 0x00, 0xfe, 0x0a, 0xa9, 0x02, 0xbb, 0xfb, 0xa1, 0x78, 0x6f, 0x84, 0xa9, 0x02, 0xbb, 0xff, 0x65, 0x02, 0x00, 0xfe, 0x0a, 0xa9, 0x02, 0xbb, 0xfb, 0xa1, 0x78, 0x6f, 0x84, 0xa9, 0x02, 0xbb, 0xff, 0x65, 0x03, 0x00, 0x0b, 0xbb, 0xfe, 0x84, 0x00, 0x03, 0xbb, 0x04, 0x00, 0xfe, 0x24, 0xb3, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x24, 0xb3, 0x08, 0xbb, 0xff, 0x6f, 0x03, 0x00, 0xfe, 0x24, 0xb3, 0x08, 0xbb, 0xff, 0x6f, 0x03, 0x00, 0x03, 0xbb, 0xff, 0xa1, 0x06, 0xbb, 0xfd, 0xa1, 0x11, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xfe, 0x24, 0xb3, 0x02, 0xbb, 0x04, 0x00, 0xf7, 0x24, 0x6f, 0xa1, 0xbb, 0xb3, 0xa9, 0x84, 0x6f, 0x24, 0x05, 0x00, 0xf7, 0x24, 0x6f, 0xa1, 0xbb, 0xb3, 0xa9, 0x84, 0x6f, 0x24, 0x04, 0x00, 0x03, 0xbb, 0xf8, 0x0a, 0x65, 0xa1, 0xbb, 0xb3, 0x94, 0x5d, 0x0a, 0x02, 0x00, 0x03, 0xbb, 0x28, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x28, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x28, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x28, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xfe, 0x24, 0xb3, 0x02, 0xbb, 0x04, 0x00, 0xfd, 0x0a, 0x65, 0xa1, 0x02, 0xbb, 0xfc, 0xb3, 0xa1, 0x5d, 0x04, 0x02, 0x00, 0x05, 0xbb, 0x04, 0x00, 0x05, 0xbb, 0x02, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x04, 0x00, 0xfe, 0x24, 0xa9, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x07, 0xbb, 0xfd, 0x94, 0x0a, 0x00, 0x05, 0xbb, 0x04, 0x00, 0x05, 0xbb, 0x02, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x04, 0xbb, 0x03, 0x00, 0xff, 0x94, 0x03, 0xbb, 0xfc, 0x84, 0x6f, 0x78, 0xb3, 0x02, 0xbb, 0xff, 0x6f, 0x03, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x02, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x02, 0x00, 0xfe, 0x0a, 0x94, 0x03, 0xbb, 0xff, 0x5d, 0x03, 0x00, 0xff, 0x46, 0x02, 0xbb, 0xfe, 0xb3, 0x24, 0x03, 0x00, 0xfb, 0x11, 0xb3, 0xbb, 0xb3, 0x11, 0x02, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0xfd, 0x00, 0x04, 0x84, 0x03, 0xbb, 0xff, 0x5d, 0x04, 0x00, 0xff, 0x78, 0x02, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xff, 0x78, 0x02, 0xbb, 0xff, 0x46, 0x02, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x0f, 0x00, 0x08, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xff, 0xa1, 0x02, 0xbb, 0xff, 0x24, 0x05, 0x00, 0xff, 0x5d, 0x02, 0xbb, 0xff, 0x65, 0x02, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x0f, 0x00, 0x07, 0xbb, 0xff, 0x5d, 0x06, 0x00, 0x0c, 0xbb, 0xff, 0x78, 0x02, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x0f, 0x00, 0x07, 0xbb, 0xff, 0x5d, 0x06, 0x00, 0x0c, 0xbb, 0xff, 0x78, 0x02, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0xfe, 0x00, 0x6f, 0x03, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xfd, 0xa9, 0xbb, 0xb3, 0x0c, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0xfd, 0x00, 0x04, 0x84, 0x03, 0xbb, 0xff, 0x5d, 0x04, 0x00, 0xff, 0x94, 0x02, 0xbb, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0xa9, 0x02, 0xbb, 0xff, 0x11, 0x04, 0x00, 0xff, 0x0a, 0x03, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0x02, 0x00, 0xfe, 0x0a, 0x94, 0x03, 0xbb, 0xff, 0x5d, 0x03, 0x00, 0xff, 0x46, 0x02, 0xbb, 0xff, 0x6f, 0x05, 0x00, 0xfd, 0x46, 0x6f, 0x0a, 0x03, 0x00, 0xff, 0x94, 0x02, 0xbb, 0xff, 0x46, 0x03, 0x00, 0xfe, 0x04, 0x84, 0x03, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x04, 0xbb, 0x02, 0x00, 0xfe, 0x0a, 0xa9, 0x02, 0xbb, 0xfb, 0xa1, 0x78, 0x6f, 0x84, 0xa9, 0x02, 0xbb, 0xff, 0x65, 0x03, 0x00, 0xff, 0x46, 0x02, 0xbb, 0xff, 0xb3, 0x02, 0x6f, 0xfe, 0x84, 0xa1, 0x04, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0x04, 0x00, 0xfe, 0x24, 0xb3, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x24, 0xb3, 0x08, 0xbb, 0xff, 0x6f, 0x03, 0x00, 0xfe, 0x0a, 0xa1, 0x06, 0xbb, 0xff, 0x6f, 0x03, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xfe, 0x24, 0xb3, 0x02, 0xbb, 0x04, 0x00, 0xf7, 0x24, 0x6f, 0xa1, 0xbb, 0xb3, 0xa9, 0x84, 0x6f, 0x24, 0x05, 0x00, 0xf8, 0x11, 0x6f, 0xa9, 0xbb, 0xb3, 0x94, 0x46, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x34, 0x00, 0xff, 0xa1, 0x02, 0xbb, 0xff, 0xb3, 0x34, 0x00, 0x03, 0xbb, 0xff, 0xa1, 0x34, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x46, 0x7e, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_12_image = {(void *) &logo_12, 56, 49};
+    0x38, 0x00, 0xfc, 0x84, 0xb3, 0xa9, 0x46, 0x34, 0x00, 0x03, 0xbb, 0xff, 0xa1, 0x34, 0x00, 0xff, 0xa9, 0x02, 0xbb, 0xff, 0xb3, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xfe, 0x24, 0xb3, 0x02, 0xbb, 0x04, 0x00, 0xfd, 0x0a, 0x65, 0xa1, 0x02, 0xbb, 0xfc, 0xb3, 0xa1, 0x5d, 0x04, 0x05, 0x00, 0xfd, 0x0a, 0x65, 0xa1, 0x02, 0xbb, 0xfc, 0xb3, 0xa1, 0x5d, 0x04, 0x03, 0x00, 0xf4, 0x84, 0xb3, 0xa9, 0x46, 0x0a, 0x5d, 0xa1, 0xbb, 0xb3, 0x94, 0x5d, 0x0a, 0x02, 0x00, 0x03, 0xbb, 0x04, 0x00, 0xfe, 0x24, 0xa9, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x07, 0xbb, 0xfe, 0x94, 0x0a, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x07, 0xbb, 0xfe, 0x94, 0x0a, 0x02, 0x00, 0x03, 0xbb, 0x02, 0xa1, 0x06, 0xbb, 0xfd, 0xa1, 0x11, 0x00, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x04, 0xbb, 0x03, 0x00, 0xff, 0x94, 0x03, 0xbb, 0xfc, 0x84, 0x6f, 0x78, 0xb3, 0x02, 0xbb, 0xff, 0x6f, 0x03, 0x00, 0xff, 0x94, 0x03, 0xbb, 0xfc, 0x84, 0x6f, 0x78, 0xb3, 0x02, 0xbb, 0xff, 0x6f, 0x02, 0x00, 0xff, 0xa9, 0x0b, 0xbb, 0xfe, 0x84, 0x00, 0x03, 0xbb, 0x02, 0x00, 0xfe, 0x0a, 0x94, 0x03, 0xbb, 0xff, 0x5d, 0x03, 0x00, 0xff, 0x46, 0x02, 0xbb, 0xfe, 0xb3, 0x24, 0x03, 0x00, 0xf9, 0x11, 0xb3, 0xbb, 0xb3, 0x11, 0x00, 0x46, 0x02, 0xbb, 0xfe, 0xb3, 0x24, 0x03, 0x00, 0xfb, 0x11, 0xb3, 0xbb, 0xb3, 0x11, 0x02, 0x00, 0x03, 0xbb, 0xfa, 0x78, 0x24, 0x0a, 0x04, 0x24, 0xa1, 0x02, 0xbb, 0xfe, 0xb3, 0x00, 0x03, 0xbb, 0xfd, 0x00, 0x04, 0x84, 0x03, 0xbb, 0xff, 0x5d, 0x04, 0x00, 0xff, 0x78, 0x02, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xff, 0x78, 0x02, 0xbb, 0xfd, 0x46, 0x00, 0x78, 0x02, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xff, 0x78, 0x02, 0xbb, 0xff, 0x46, 0x02, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xff, 0x46, 0x03, 0xbb, 0xff, 0x00, 0x08, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xff, 0xa1, 0x02, 0xbb, 0xff, 0x24, 0x05, 0x00, 0xff, 0x5d, 0x02, 0xbb, 0xfd, 0x65, 0x00, 0xa1, 0x02, 0xbb, 0xff, 0x24, 0x05, 0x00, 0xff, 0x5d, 0x02, 0xbb, 0xff, 0x65, 0x02, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xff, 0x11, 0x03, 0xbb, 0xff, 0x00, 0x07, 0xbb, 0xff, 0x5d, 0x06, 0x00, 0x0c, 0xbb, 0xfe, 0x78, 0x00, 0x0c, 0xbb, 0xff, 0x78, 0x02, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xff, 0x04, 0x03, 0xbb, 0xff, 0x00, 0x07, 0xbb, 0xff, 0x5d, 0x06, 0x00, 0x0c, 0xbb, 0xfe, 0x78, 0x00, 0x0c, 0xbb, 0xff, 0x78, 0x02, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xff, 0x04, 0x03, 0xbb, 0xff, 0x00, 0x03, 0xbb, 0xfe, 0x00, 0x6f, 0x03, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xfd, 0xa9, 0xbb, 0xb3, 0x0b, 0x00, 0xfd, 0xa9, 0xbb, 0xb3, 0x0c, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xff, 0x11, 0x03, 0xbb, 0xff, 0x00, 0x03, 0xbb, 0xfd, 0x00, 0x04, 0x84, 0x03, 0xbb, 0xff, 0x5d, 0x04, 0x00, 0xff, 0x94, 0x02, 0xbb, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x94, 0x02, 0xbb, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xff, 0x46, 0x03, 0xbb, 0xff, 0x00, 0x03, 0xbb, 0x02, 0x00, 0xfe, 0x0a, 0x94, 0x03, 0xbb, 0xff, 0x5d, 0x03, 0x00, 0xff, 0x46, 0x02, 0xbb, 0xff, 0x6f, 0x05, 0x00, 0xfd, 0x46, 0x6f, 0x0a, 0x02, 0x00, 0xff, 0x46, 0x02, 0xbb, 0xff, 0x6f, 0x05, 0x00, 0xfd, 0x46, 0x6f, 0x0a, 0x03, 0x00, 0x03, 0xbb, 0xfa, 0x78, 0x24, 0x0a, 0x04, 0x24, 0xa1, 0x02, 0xbb, 0xfe, 0xb3, 0x00, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x04, 0xbb, 0x02, 0x00, 0xfe, 0x0a, 0xa9, 0x02, 0xbb, 0xfb, 0xa1, 0x78, 0x6f, 0x84, 0xa9, 0x02, 0xbb, 0xff, 0x65, 0x02, 0x00, 0xfe, 0x0a, 0xa9, 0x02, 0xbb, 0xfb, 0xa1, 0x78, 0x6f, 0x84, 0xa9, 0x02, 0xbb, 0xff, 0x65, 0x03, 0x00, 0x0b, 0xbb, 0xfe, 0x84, 0x00, 0x03, 0xbb, 0x04, 0x00, 0xfe, 0x24, 0xb3, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x24, 0xb3, 0x08, 0xbb, 0xff, 0x6f, 0x03, 0x00, 0xfe, 0x24, 0xb3, 0x08, 0xbb, 0xff, 0x6f, 0x03, 0x00, 0x03, 0xbb, 0xff, 0xa1, 0x06, 0xbb, 0xfd, 0xa1, 0x11, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xfe, 0x24, 0xb3, 0x02, 0xbb, 0x04, 0x00, 0xf7, 0x24, 0x6f, 0xa1, 0xbb, 0xb3, 0xa9, 0x84, 0x6f, 0x24, 0x05, 0x00, 0xf7, 0x24, 0x6f, 0xa1, 0xbb, 0xb3, 0xa9, 0x84, 0x6f, 0x24, 0x04, 0x00, 0x03, 0xbb, 0xf8, 0x0a, 0x65, 0xa1, 0xbb, 0xb3, 0x94, 0x5d, 0x0a, 0x02, 0x00, 0x03, 0xbb, 0x28, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x28, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x28, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x28, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xfe, 0x24, 0xb3, 0x02, 0xbb, 0x04, 0x00, 0xfd, 0x0a, 0x65, 0xa1, 0x02, 0xbb, 0xfc, 0xb3, 0xa1, 0x5d, 0x04, 0x02, 0x00, 0x05, 0xbb, 0x04, 0x00, 0x05, 0xbb, 0x02, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x04, 0x00, 0xfe, 0x24, 0xa9, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x07, 0xbb, 0xfd, 0x94, 0x0a, 0x00, 0x05, 0xbb, 0x04, 0x00, 0x05, 0xbb, 0x02, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x04, 0xbb, 0x03, 0x00, 0xff, 0x94, 0x03, 0xbb, 0xfc, 0x84, 0x6f, 0x78, 0xb3, 0x02, 0xbb, 0xff, 0x6f, 0x03, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x02, 0x00, 0x03, 0xbb, 0x0a, 0x00, 0x03, 0xbb, 0x02, 0x00, 0xfe, 0x0a, 0x94, 0x03, 0xbb, 0xff, 0x5d, 0x03, 0x00, 0xff, 0x46, 0x02, 0xbb, 0xfe, 0xb3, 0x24, 0x03, 0x00, 0xfb, 0x11, 0xb3, 0xbb, 0xb3, 0x11, 0x02, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0xfd, 0x00, 0x04, 0x84, 0x03, 0xbb, 0xff, 0x5d, 0x04, 0x00, 0xff, 0x78, 0x02, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xff, 0x78, 0x02, 0xbb, 0xff, 0x46, 0x02, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x0f, 0x00, 0x08, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xff, 0xa1, 0x02, 0xbb, 0xff, 0x24, 0x05, 0x00, 0xff, 0x5d, 0x02, 0xbb, 0xff, 0x65, 0x02, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x0f, 0x00, 0x07, 0xbb, 0xff, 0x5d, 0x06, 0x00, 0x0c, 0xbb, 0xff, 0x78, 0x02, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x0f, 0x00, 0x07, 0xbb, 0xff, 0x5d, 0x06, 0x00, 0x0c, 0xbb, 0xff, 0x78, 0x02, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0xfe, 0x00, 0x6f, 0x03, 0xbb, 0xff, 0x5d, 0x05, 0x00, 0xfd, 0xa9, 0xbb, 0xb3, 0x0c, 0x00, 0x03, 0xbb, 0x06, 0x00, 0x03, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0xfd, 0x00, 0x04, 0x84, 0x03, 0xbb, 0xff, 0x5d, 0x04, 0x00, 0xff, 0x94, 0x02, 0xbb, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0xa9, 0x02, 0xbb, 0xff, 0x11, 0x04, 0x00, 0xff, 0x0a, 0x03, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0x02, 0x00, 0xfe, 0x0a, 0x94, 0x03, 0xbb, 0xff, 0x5d, 0x03, 0x00, 0xff, 0x46, 0x02, 0xbb, 0xff, 0x6f, 0x05, 0x00, 0xfd, 0x46, 0x6f, 0x0a, 0x03, 0x00, 0xff, 0x94, 0x02, 0xbb, 0xff, 0x46, 0x03, 0x00, 0xfe, 0x04, 0x84, 0x03, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x11, 0xa1, 0x04, 0xbb, 0x02, 0x00, 0xfe, 0x0a, 0xa9, 0x02, 0xbb, 0xfb, 0xa1, 0x78, 0x6f, 0x84, 0xa9, 0x02, 0xbb, 0xff, 0x65, 0x03, 0x00, 0xff, 0x46, 0x02, 0xbb, 0xff, 0xb3, 0x02, 0x6f, 0xfe, 0x84, 0xa1, 0x04, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0x04, 0x00, 0xfe, 0x24, 0xb3, 0x03, 0xbb, 0x03, 0x00, 0xfe, 0x24, 0xb3, 0x08, 0xbb, 0xff, 0x6f, 0x03, 0x00, 0xfe, 0x0a, 0xa1, 0x06, 0xbb, 0xff, 0x6f, 0x03, 0xbb, 0x0f, 0x00, 0x03, 0xbb, 0x05, 0x00, 0xfe, 0x24, 0xb3, 0x02, 0xbb, 0x04, 0x00, 0xf7, 0x24, 0x6f, 0xa1, 0xbb, 0xb3, 0xa9, 0x84, 0x6f, 0x24, 0x05, 0x00, 0xf8, 0x11, 0x6f, 0xa9, 0xbb, 0xb3, 0x94, 0x46, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x35, 0x00, 0x03, 0xbb, 0x34, 0x00, 0xff, 0xa1, 0x02, 0xbb, 0xff, 0xb3, 0x34, 0x00, 0x03, 0xbb, 0xff, 0xa1, 0x34, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x46, 0x7e, 0x00
+};
+static const Image logo_12_image = {logo_12_data, 56, 49};
 
-static void logo_13(uint8_t *data)
+static const uint8_t logo_13_data[1202] =
 {
-    const uint8_t image_data[1202] =
-    {
-        0x38, 0x00, 0xfc, 0x90, 0xbf, 0xb8, 0x4d, 0x34, 0x00, 0x03, 0xcc, 0xff, 0xa3, 0x34, 0x00, 0xff, 0xb8, 0x02, 0xcc, 0xff, 0xc7, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x24, 0xc7, 0x02, 0xcc, 0x04, 0x00, 0xfd, 0x11, 0x71, 0xb8, 0x02, 0xcc, 0xfc, 0xc7, 0xb1, 0x65, 0x04, 0x05, 0x00, 0xfd, 0x11, 0x71, 0xb8, 0x02, 0xcc, 0xfc, 0xc7, 0xb1, 0x65, 0x04, 0x03, 0x00, 0xf4, 0x90, 0xbf, 0xb8, 0x4d, 0x0a, 0x65, 0xb1, 0xc7, 0xbf, 0xa3, 0x65, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x24, 0xb8, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x07, 0xcc, 0xfe, 0xa3, 0x0a, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x07, 0xcc, 0xfe, 0xa3, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x02, 0xb1, 0x06, 0xcc, 0xfd, 0xb1, 0x11, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x04, 0xa3, 0x02, 0xcc, 0xfb, 0xc7, 0x90, 0x71, 0x82, 0xbf, 0x02, 0xcc, 0xff, 0x71, 0x02, 0x00, 0xfe, 0x04, 0xa3, 0x02, 0xcc, 0xfb, 0xc7, 0x90, 0x71, 0x82, 0xbf, 0x02, 0xcc, 0xff, 0x71, 0x02, 0x00, 0xff, 0xb8, 0x02, 0xcc, 0xff, 0xc7, 0x08, 0xcc, 0xfe, 0x90, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xa3, 0x03, 0xcc, 0xff, 0x65, 0x03, 0x00, 0xff, 0x4d, 0x02, 0xcc, 0xfe, 0xc7, 0x24, 0x03, 0x00, 0xf9, 0x11, 0xbf, 0xcc, 0xc7, 0x11, 0x00, 0x4d, 0x02, 0xcc, 0xfe, 0xc7, 0x24, 0x03, 0x00, 0xfb, 0x11, 0xbf, 0xcc, 0xc7, 0x11, 0x02, 0x00, 0x03, 0xcc, 0xfa, 0x82, 0x24, 0x0a, 0x04, 0x24, 0xb1, 0x02, 0xcc, 0xfe, 0xbf, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x04, 0x90, 0x03, 0xcc, 0xff, 0x65, 0x04, 0x00, 0xff, 0x82, 0x02, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xff, 0x82, 0x02, 0xcc, 0xfd, 0x4d, 0x00, 0x82, 0x02, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xff, 0x82, 0x02, 0xcc, 0xff, 0x4d, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x4d, 0x03, 0xcc, 0xff, 0x00, 0x08, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xff, 0xb1, 0x02, 0xcc, 0xff, 0x24, 0x05, 0x00, 0xff, 0x65, 0x02, 0xcc, 0xfd, 0x71, 0x00, 0xb1, 0x02, 0xcc, 0xff, 0x24, 0x05, 0x00, 0xff, 0x65, 0x02, 0xcc, 0xff, 0x71, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x11, 0x03, 0xcc, 0xff, 0x00, 0x07, 0xcc, 0xff, 0x65, 0x06, 0x00, 0x0c, 0xcc, 0xfe, 0x82, 0x00, 0x0c, 0xcc, 0xff, 0x82, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x04, 0x03, 0xcc, 0xff, 0x00, 0x07, 0xcc, 0xff, 0x65, 0x06, 0x00, 0x0c, 0xcc, 0xfe, 0x82, 0x00, 0x0c, 0xcc, 0xff, 0x82, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x04, 0x03, 0xcc, 0xff, 0x00, 0x03, 0xcc, 0xfe, 0x00, 0x71, 0x03, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xfd, 0xb8, 0xcc, 0xbf, 0x0b, 0x00, 0xfd, 0xb8, 0xcc, 0xbf, 0x0c, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x11, 0x03, 0xcc, 0xff, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x04, 0x90, 0x03, 0xcc, 0xff, 0x65, 0x04, 0x00, 0xff, 0x90, 0x02, 0xcc, 0xff, 0x11, 0x0a, 0x00, 0xff, 0x90, 0x02, 0xcc, 0xff, 0x11, 0x0b, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x4d, 0x03, 0xcc, 0xff, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xa3, 0x03, 0xcc, 0xff, 0x65, 0x03, 0x00, 0xff, 0x4d, 0x02, 0xcc, 0xff, 0x71, 0x04, 0x00, 0xfc, 0x04, 0x4d, 0x71, 0x11, 0x02, 0x00, 0xff, 0x4d, 0x02, 0xcc, 0xff, 0x71, 0x04, 0x00, 0xfc, 0x04, 0x4d, 0x71, 0x11, 0x03, 0x00, 0x03, 0xcc, 0xfa, 0x82, 0x24, 0x0a, 0x04, 0x24, 0xb1, 0x02, 0xcc, 0xfe, 0xbf, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xb8, 0x02, 0xcc, 0xfb, 0xb1, 0x82, 0x71, 0x90, 0xb8, 0x02, 0xcc, 0xff, 0x71, 0x02, 0x00, 0xfe, 0x0a, 0xb8, 0x02, 0xcc, 0xfb, 0xb1, 0x82, 0x71, 0x90, 0xb8, 0x02, 0xcc, 0xff, 0x71, 0x03, 0x00, 0x0b, 0xcc, 0xfe, 0x90, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x24, 0xb8, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x24, 0xbf, 0x08, 0xcc, 0xff, 0x82, 0x03, 0x00, 0xfe, 0x24, 0xbf, 0x08, 0xcc, 0xff, 0x82, 0x03, 0x00, 0x03, 0xcc, 0xff, 0xb1, 0x06, 0xcc, 0xfd, 0xb1, 0x24, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x24, 0xc7, 0x02, 0xcc, 0x04, 0x00, 0xf6, 0x24, 0x82, 0xb8, 0xcc, 0xc7, 0xb8, 0x90, 0x71, 0x24, 0x04, 0x04, 0x00, 0xf6, 0x24, 0x82, 0xb8, 0xcc, 0xc7, 0xb8, 0x90, 0x71, 0x24, 0x04, 0x03, 0x00, 0x03, 0xcc, 0xf8, 0x0a, 0x71, 0xb1, 0xcc, 0xbf, 0xa3, 0x65, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x24, 0xc7, 0x02, 0xcc, 0x04, 0x00, 0xfd, 0x11, 0x71, 0xb8, 0x02, 0xcc, 0xfc, 0xc7, 0xb1, 0x65, 0x04, 0x02, 0x00, 0x05, 0xcc, 0x04, 0x00, 0x05, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x24, 0xb8, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x07, 0xcc, 0xfd, 0xa3, 0x0a, 0x00, 0x05, 0xcc, 0x04, 0x00, 0x05, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x04, 0xa3, 0x02, 0xcc, 0xfb, 0xc7, 0x90, 0x71, 0x82, 0xbf, 0x02, 0xcc, 0xff, 0x71, 0x03, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xa3, 0x03, 0xcc, 0xff, 0x65, 0x03, 0x00, 0xff, 0x4d, 0x02, 0xcc, 0xfe, 0xc7, 0x24, 0x03, 0x00, 0xfb, 0x11, 0xbf, 0xcc, 0xc7, 0x11, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x04, 0x90, 0x03, 0xcc, 0xff, 0x65, 0x04, 0x00, 0xff, 0x82, 0x02, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xff, 0x82, 0x02, 0xcc, 0xff, 0x4d, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x08, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xff, 0xb1, 0x02, 0xcc, 0xff, 0x24, 0x05, 0x00, 0xff, 0x65, 0x02, 0xcc, 0xff, 0x71, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x07, 0xcc, 0xff, 0x65, 0x06, 0x00, 0x0c, 0xcc, 0xff, 0x82, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x07, 0xcc, 0xff, 0x65, 0x06, 0x00, 0x0c, 0xcc, 0xff, 0x82, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0xfe, 0x00, 0x71, 0x03, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xfd, 0xb8, 0xcc, 0xbf, 0x0c, 0x00, 0x03, 0xcc, 0xff, 0x04, 0x05, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x04, 0x90, 0x03, 0xcc, 0xff, 0x65, 0x04, 0x00, 0xff, 0x90, 0x02, 0xcc, 0xff, 0x11, 0x0b, 0x00, 0xff, 0xb8, 0x02, 0xcc, 0xff, 0x24, 0x04, 0x00, 0xff, 0x11, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xa3, 0x03, 0xcc, 0xff, 0x65, 0x03, 0x00, 0xff, 0x4d, 0x02, 0xcc, 0xff, 0x71, 0x04, 0x00, 0xfc, 0x04, 0x4d, 0x71, 0x11, 0x03, 0x00, 0xff, 0x90, 0x02, 0xcc, 0xff, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x90, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xb8, 0x02, 0xcc, 0xfb, 0xb1, 0x82, 0x71, 0x90, 0xb8, 0x02, 0xcc, 0xff, 0x71, 0x03, 0x00, 0xff, 0x4d, 0x02, 0xcc, 0xff, 0xbf, 0x03, 0x82, 0xff, 0xb8, 0x04, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x24, 0xb8, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x24, 0xbf, 0x08, 0xcc, 0xff, 0x82, 0x03, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xcc, 0xff, 0x71, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x24, 0xc7, 0x02, 0xcc, 0x04, 0x00, 0xf6, 0x24, 0x82, 0xb8, 0xcc, 0xc7, 0xb8, 0x90, 0x71, 0x24, 0x04, 0x04, 0x00, 0xf8, 0x11, 0x82, 0xb8, 0xc7, 0xb8, 0xa3, 0x4d, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x34, 0x00, 0xff, 0xb8, 0x02, 0xcc, 0xff, 0xc7, 0x34, 0x00, 0x03, 0xcc, 0xff, 0xa3, 0x34, 0x00, 0xff, 0x90, 0x02, 0xbf, 0xff, 0x4d, 0x7e, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_13_image = {(void *) &logo_13, 56, 49};
+    0x38, 0x00, 0xfc, 0x90, 0xbf, 0xb8, 0x4d, 0x34, 0x00, 0x03, 0xcc, 0xff, 0xa3, 0x34, 0x00, 0xff, 0xb8, 0x02, 0xcc, 0xff, 0xc7, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x24, 0xc7, 0x02, 0xcc, 0x04, 0x00, 0xfd, 0x11, 0x71, 0xb8, 0x02, 0xcc, 0xfc, 0xc7, 0xb1, 0x65, 0x04, 0x05, 0x00, 0xfd, 0x11, 0x71, 0xb8, 0x02, 0xcc, 0xfc, 0xc7, 0xb1, 0x65, 0x04, 0x03, 0x00, 0xf4, 0x90, 0xbf, 0xb8, 0x4d, 0x0a, 0x65, 0xb1, 0xc7, 0xbf, 0xa3, 0x65, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x24, 0xb8, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x07, 0xcc, 0xfe, 0xa3, 0x0a, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x07, 0xcc, 0xfe, 0xa3, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x02, 0xb1, 0x06, 0xcc, 0xfd, 0xb1, 0x11, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x04, 0xa3, 0x02, 0xcc, 0xfb, 0xc7, 0x90, 0x71, 0x82, 0xbf, 0x02, 0xcc, 0xff, 0x71, 0x02, 0x00, 0xfe, 0x04, 0xa3, 0x02, 0xcc, 0xfb, 0xc7, 0x90, 0x71, 0x82, 0xbf, 0x02, 0xcc, 0xff, 0x71, 0x02, 0x00, 0xff, 0xb8, 0x02, 0xcc, 0xff, 0xc7, 0x08, 0xcc, 0xfe, 0x90, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xa3, 0x03, 0xcc, 0xff, 0x65, 0x03, 0x00, 0xff, 0x4d, 0x02, 0xcc, 0xfe, 0xc7, 0x24, 0x03, 0x00, 0xf9, 0x11, 0xbf, 0xcc, 0xc7, 0x11, 0x00, 0x4d, 0x02, 0xcc, 0xfe, 0xc7, 0x24, 0x03, 0x00, 0xfb, 0x11, 0xbf, 0xcc, 0xc7, 0x11, 0x02, 0x00, 0x03, 0xcc, 0xfa, 0x82, 0x24, 0x0a, 0x04, 0x24, 0xb1, 0x02, 0xcc, 0xfe, 0xbf, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x04, 0x90, 0x03, 0xcc, 0xff, 0x65, 0x04, 0x00, 0xff, 0x82, 0x02, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xff, 0x82, 0x02, 0xcc, 0xfd, 0x4d, 0x00, 0x82, 0x02, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xff, 0x82, 0x02, 0xcc, 0xff, 0x4d, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x4d, 0x03, 0xcc, 0xff, 0x00, 0x08, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xff, 0xb1, 0x02, 0xcc, 0xff, 0x24, 0x05, 0x00, 0xff, 0x65, 0x02, 0xcc, 0xfd, 0x71, 0x00, 0xb1, 0x02, 0xcc, 0xff, 0x24, 0x05, 0x00, 0xff, 0x65, 0x02, 0xcc, 0xff, 0x71, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x11, 0x03, 0xcc, 0xff, 0x00, 0x07, 0xcc, 0xff, 0x65, 0x06, 0x00, 0x0c, 0xcc, 0xfe, 0x82, 0x00, 0x0c, 0xcc, 0xff, 0x82, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x04, 0x03, 0xcc, 0xff, 0x00, 0x07, 0xcc, 0xff, 0x65, 0x06, 0x00, 0x0c, 0xcc, 0xfe, 0x82, 0x00, 0x0c, 0xcc, 0xff, 0x82, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x04, 0x03, 0xcc, 0xff, 0x00, 0x03, 0xcc, 0xfe, 0x00, 0x71, 0x03, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xfd, 0xb8, 0xcc, 0xbf, 0x0b, 0x00, 0xfd, 0xb8, 0xcc, 0xbf, 0x0c, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x11, 0x03, 0xcc, 0xff, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x04, 0x90, 0x03, 0xcc, 0xff, 0x65, 0x04, 0x00, 0xff, 0x90, 0x02, 0xcc, 0xff, 0x11, 0x0a, 0x00, 0xff, 0x90, 0x02, 0xcc, 0xff, 0x11, 0x0b, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x4d, 0x03, 0xcc, 0xff, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xa3, 0x03, 0xcc, 0xff, 0x65, 0x03, 0x00, 0xff, 0x4d, 0x02, 0xcc, 0xff, 0x71, 0x04, 0x00, 0xfc, 0x04, 0x4d, 0x71, 0x11, 0x02, 0x00, 0xff, 0x4d, 0x02, 0xcc, 0xff, 0x71, 0x04, 0x00, 0xfc, 0x04, 0x4d, 0x71, 0x11, 0x03, 0x00, 0x03, 0xcc, 0xfa, 0x82, 0x24, 0x0a, 0x04, 0x24, 0xb1, 0x02, 0xcc, 0xfe, 0xbf, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xb8, 0x02, 0xcc, 0xfb, 0xb1, 0x82, 0x71, 0x90, 0xb8, 0x02, 0xcc, 0xff, 0x71, 0x02, 0x00, 0xfe, 0x0a, 0xb8, 0x02, 0xcc, 0xfb, 0xb1, 0x82, 0x71, 0x90, 0xb8, 0x02, 0xcc, 0xff, 0x71, 0x03, 0x00, 0x0b, 0xcc, 0xfe, 0x90, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x24, 0xb8, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x24, 0xbf, 0x08, 0xcc, 0xff, 0x82, 0x03, 0x00, 0xfe, 0x24, 0xbf, 0x08, 0xcc, 0xff, 0x82, 0x03, 0x00, 0x03, 0xcc, 0xff, 0xb1, 0x06, 0xcc, 0xfd, 0xb1, 0x24, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x24, 0xc7, 0x02, 0xcc, 0x04, 0x00, 0xf6, 0x24, 0x82, 0xb8, 0xcc, 0xc7, 0xb8, 0x90, 0x71, 0x24, 0x04, 0x04, 0x00, 0xf6, 0x24, 0x82, 0xb8, 0xcc, 0xc7, 0xb8, 0x90, 0x71, 0x24, 0x04, 0x03, 0x00, 0x03, 0xcc, 0xf8, 0x0a, 0x71, 0xb1, 0xcc, 0xbf, 0xa3, 0x65, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x24, 0xc7, 0x02, 0xcc, 0x04, 0x00, 0xfd, 0x11, 0x71, 0xb8, 0x02, 0xcc, 0xfc, 0xc7, 0xb1, 0x65, 0x04, 0x02, 0x00, 0x05, 0xcc, 0x04, 0x00, 0x05, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x24, 0xb8, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x07, 0xcc, 0xfd, 0xa3, 0x0a, 0x00, 0x05, 0xcc, 0x04, 0x00, 0x05, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x04, 0xa3, 0x02, 0xcc, 0xfb, 0xc7, 0x90, 0x71, 0x82, 0xbf, 0x02, 0xcc, 0xff, 0x71, 0x03, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x0a, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xa3, 0x03, 0xcc, 0xff, 0x65, 0x03, 0x00, 0xff, 0x4d, 0x02, 0xcc, 0xfe, 0xc7, 0x24, 0x03, 0x00, 0xfb, 0x11, 0xbf, 0xcc, 0xc7, 0x11, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x04, 0x90, 0x03, 0xcc, 0xff, 0x65, 0x04, 0x00, 0xff, 0x82, 0x02, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xff, 0x82, 0x02, 0xcc, 0xff, 0x4d, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x08, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xff, 0xb1, 0x02, 0xcc, 0xff, 0x24, 0x05, 0x00, 0xff, 0x65, 0x02, 0xcc, 0xff, 0x71, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x07, 0xcc, 0xff, 0x65, 0x06, 0x00, 0x0c, 0xcc, 0xff, 0x82, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x07, 0xcc, 0xff, 0x65, 0x06, 0x00, 0x0c, 0xcc, 0xff, 0x82, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0xfe, 0x00, 0x71, 0x03, 0xcc, 0xff, 0x65, 0x05, 0x00, 0xfd, 0xb8, 0xcc, 0xbf, 0x0c, 0x00, 0x03, 0xcc, 0xff, 0x04, 0x05, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x04, 0x90, 0x03, 0xcc, 0xff, 0x65, 0x04, 0x00, 0xff, 0x90, 0x02, 0xcc, 0xff, 0x11, 0x0b, 0x00, 0xff, 0xb8, 0x02, 0xcc, 0xff, 0x24, 0x04, 0x00, 0xff, 0x11, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xa3, 0x03, 0xcc, 0xff, 0x65, 0x03, 0x00, 0xff, 0x4d, 0x02, 0xcc, 0xff, 0x71, 0x04, 0x00, 0xfc, 0x04, 0x4d, 0x71, 0x11, 0x03, 0x00, 0xff, 0x90, 0x02, 0xcc, 0xff, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x90, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x11, 0xb1, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xb8, 0x02, 0xcc, 0xfb, 0xb1, 0x82, 0x71, 0x90, 0xb8, 0x02, 0xcc, 0xff, 0x71, 0x03, 0x00, 0xff, 0x4d, 0x02, 0xcc, 0xff, 0xbf, 0x03, 0x82, 0xff, 0xb8, 0x04, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x24, 0xb8, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x24, 0xbf, 0x08, 0xcc, 0xff, 0x82, 0x03, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xcc, 0xff, 0x71, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x24, 0xc7, 0x02, 0xcc, 0x04, 0x00, 0xf6, 0x24, 0x82, 0xb8, 0xcc, 0xc7, 0xb8, 0x90, 0x71, 0x24, 0x04, 0x04, 0x00, 0xf8, 0x11, 0x82, 0xb8, 0xc7, 0xb8, 0xa3, 0x4d, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x35, 0x00, 0x03, 0xcc, 0x34, 0x00, 0xff, 0xb8, 0x02, 0xcc, 0xff, 0xc7, 0x34, 0x00, 0x03, 0xcc, 0xff, 0xa3, 0x34, 0x00, 0xff, 0x90, 0x02, 0xbf, 0xff, 0x4d, 0x7e, 0x00
+};
+static const Image logo_13_image = {logo_13_data, 56, 49};
 
-static void logo_14(uint8_t *data)
+static const uint8_t logo_14_data[1190] =
 {
-    const uint8_t image_data[1190] =
-    {
-        0x38, 0x00, 0xfc, 0x8e, 0xd5, 0xc9, 0x52, 0x34, 0x00, 0x03, 0xdd, 0xff, 0xbf, 0x34, 0x00, 0xff, 0xc9, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xfe, 0x30, 0xd5, 0x02, 0xdd, 0x04, 0x00, 0xfd, 0x11, 0x7c, 0xbf, 0x03, 0xdd, 0xfd, 0xbf, 0x6b, 0x0a, 0x05, 0x00, 0xfd, 0x11, 0x7c, 0xbf, 0x03, 0xdd, 0xfd, 0xbf, 0x6b, 0x0a, 0x03, 0x00, 0xf4, 0x8e, 0xd5, 0xc9, 0x52, 0x11, 0x6b, 0xbf, 0xdd, 0xc9, 0xb2, 0x6b, 0x0a, 0x02, 0x00, 0x03, 0xdd, 0x04, 0x00, 0xfe, 0x1d, 0xc9, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x07, 0xdd, 0xfe, 0xb2, 0x0a, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x07, 0xdd, 0xfe, 0xb2, 0x0a, 0x02, 0x00, 0x03, 0xdd, 0x02, 0xbf, 0x06, 0xdd, 0xfd, 0xbf, 0x1d, 0x00, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x04, 0xdd, 0x02, 0x00, 0xfe, 0x04, 0xb2, 0x03, 0xdd, 0xfc, 0x9f, 0x7c, 0x8e, 0xc9, 0x02, 0xdd, 0xff, 0x7c, 0x02, 0x00, 0xfe, 0x04, 0xb2, 0x03, 0xdd, 0xfc, 0x9f, 0x7c, 0x8e, 0xc9, 0x02, 0xdd, 0xff, 0x7c, 0x02, 0x00, 0xff, 0xc9, 0x0b, 0xdd, 0xfe, 0x9f, 0x00, 0x03, 0xdd, 0x02, 0x00, 0xfe, 0x0a, 0xb2, 0x03, 0xdd, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x52, 0x02, 0xdd, 0xfe, 0xd5, 0x30, 0x03, 0x00, 0xfe, 0x1d, 0xc9, 0x02, 0xdd, 0xfd, 0x11, 0x00, 0x52, 0x02, 0xdd, 0xfe, 0xd5, 0x30, 0x03, 0x00, 0xfe, 0x1d, 0xc9, 0x02, 0xdd, 0xff, 0x11, 0x02, 0x00, 0x03, 0xdd, 0xfa, 0x8e, 0x30, 0x0a, 0x04, 0x30, 0xbf, 0x02, 0xdd, 0xfe, 0xd5, 0x00, 0x03, 0xdd, 0xfd, 0x00, 0x04, 0x9f, 0x03, 0xdd, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x8e, 0x02, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xff, 0x8e, 0x02, 0xdd, 0xfd, 0x52, 0x00, 0x8e, 0x02, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xff, 0x8e, 0x02, 0xdd, 0xff, 0x52, 0x02, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xff, 0x52, 0x03, 0xdd, 0xff, 0x00, 0x08, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xff, 0xbf, 0x02, 0xdd, 0xff, 0x1d, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xdd, 0xfd, 0x7c, 0x00, 0xbf, 0x02, 0xdd, 0xff, 0x1d, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xdd, 0xff, 0x7c, 0x02, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xff, 0x11, 0x03, 0xdd, 0xff, 0x00, 0x07, 0xdd, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xdd, 0xfe, 0x8e, 0x00, 0x0c, 0xdd, 0xff, 0x8e, 0x02, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xff, 0x04, 0x03, 0xdd, 0xff, 0x00, 0x07, 0xdd, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xdd, 0xfe, 0x8e, 0x00, 0x0c, 0xdd, 0xff, 0x8e, 0x02, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xff, 0x04, 0x03, 0xdd, 0xff, 0x00, 0x03, 0xdd, 0xfe, 0x00, 0x7c, 0x03, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xfd, 0xc9, 0xdd, 0xd5, 0x0b, 0x00, 0xfd, 0xc9, 0xdd, 0xd5, 0x0c, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xff, 0x11, 0x03, 0xdd, 0xff, 0x00, 0x03, 0xdd, 0xfd, 0x00, 0x04, 0x9f, 0x03, 0xdd, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x9f, 0x02, 0xdd, 0xff, 0x11, 0x0a, 0x00, 0xff, 0x9f, 0x02, 0xdd, 0xff, 0x11, 0x0b, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xff, 0x52, 0x03, 0xdd, 0xff, 0x00, 0x03, 0xdd, 0x02, 0x00, 0xfe, 0x0a, 0xb2, 0x03, 0xdd, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x52, 0x02, 0xdd, 0xff, 0x7c, 0x04, 0x00, 0xfc, 0x04, 0x52, 0x7c, 0x11, 0x02, 0x00, 0xff, 0x52, 0x02, 0xdd, 0xff, 0x7c, 0x04, 0x00, 0xfc, 0x04, 0x52, 0x7c, 0x11, 0x03, 0x00, 0x03, 0xdd, 0xfa, 0x8e, 0x30, 0x0a, 0x04, 0x30, 0xbf, 0x02, 0xdd, 0xfe, 0xd5, 0x00, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x04, 0xdd, 0x02, 0x00, 0xfe, 0x0a, 0xc9, 0x02, 0xdd, 0xfb, 0xbf, 0x8e, 0x7c, 0x9f, 0xc9, 0x02, 0xdd, 0xff, 0x7c, 0x02, 0x00, 0xfe, 0x0a, 0xc9, 0x02, 0xdd, 0xfb, 0xbf, 0x8e, 0x7c, 0x9f, 0xc9, 0x02, 0xdd, 0xff, 0x7c, 0x03, 0x00, 0x0b, 0xdd, 0xfe, 0x9f, 0x00, 0x03, 0xdd, 0x04, 0x00, 0xfe, 0x1d, 0xc9, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x30, 0xd5, 0x08, 0xdd, 0xff, 0x8e, 0x03, 0x00, 0xfe, 0x30, 0xd5, 0x08, 0xdd, 0xff, 0x8e, 0x03, 0x00, 0x03, 0xdd, 0xff, 0xbf, 0x06, 0xdd, 0xfd, 0xbf, 0x1d, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xfe, 0x30, 0xd5, 0x02, 0xdd, 0x04, 0x00, 0xf6, 0x1d, 0x8e, 0xc9, 0xdd, 0xd5, 0xc9, 0x9f, 0x7c, 0x30, 0x04, 0x04, 0x00, 0xf6, 0x1d, 0x8e, 0xc9, 0xdd, 0xd5, 0xc9, 0x9f, 0x7c, 0x30, 0x04, 0x03, 0x00, 0x03, 0xdd, 0xf8, 0x11, 0x6b, 0xbf, 0xdd, 0xc9, 0xb2, 0x6b, 0x0a, 0x02, 0x00, 0x03, 0xdd, 0x28, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x28, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x28, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x28, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xfe, 0x30, 0xd5, 0x02, 0xdd, 0x04, 0x00, 0xfd, 0x11, 0x7c, 0xbf, 0x03, 0xdd, 0xfd, 0xbf, 0x6b, 0x0a, 0x02, 0x00, 0x05, 0xdd, 0x04, 0x00, 0x05, 0xdd, 0x02, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x04, 0x00, 0xfe, 0x1d, 0xc9, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x07, 0xdd, 0xfd, 0xb2, 0x0a, 0x00, 0x05, 0xdd, 0x04, 0x00, 0x05, 0xdd, 0x02, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x04, 0xdd, 0x02, 0x00, 0xfe, 0x04, 0xb2, 0x03, 0xdd, 0xfc, 0x9f, 0x7c, 0x8e, 0xc9, 0x02, 0xdd, 0xff, 0x7c, 0x03, 0x00, 0x03, 0xdd, 0x06, 0x00, 0x03, 0xdd, 0x02, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x02, 0x00, 0xfe, 0x0a, 0xb2, 0x03, 0xdd, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x52, 0x02, 0xdd, 0xfe, 0xd5, 0x30, 0x03, 0x00, 0xfe, 0x1d, 0xc9, 0x02, 0xdd, 0xff, 0x11, 0x02, 0x00, 0x03, 0xdd, 0x06, 0x00, 0x03, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0xfd, 0x00, 0x04, 0x9f, 0x03, 0xdd, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x8e, 0x02, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xff, 0x8e, 0x02, 0xdd, 0xff, 0x52, 0x02, 0x00, 0x03, 0xdd, 0x06, 0x00, 0x03, 0xdd, 0x0f, 0x00, 0x08, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xff, 0xbf, 0x02, 0xdd, 0xff, 0x1d, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xdd, 0xff, 0x7c, 0x02, 0x00, 0x03, 0xdd, 0x06, 0x00, 0x03, 0xdd, 0x0f, 0x00, 0x07, 0xdd, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xdd, 0xff, 0x8e, 0x02, 0x00, 0x03, 0xdd, 0x06, 0x00, 0x03, 0xdd, 0x0f, 0x00, 0x07, 0xdd, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xdd, 0xff, 0x8e, 0x02, 0x00, 0x03, 0xdd, 0x06, 0x00, 0x03, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0xfe, 0x00, 0x7c, 0x03, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xfd, 0xc9, 0xdd, 0xd5, 0x0c, 0x00, 0x03, 0xdd, 0xff, 0x04, 0x05, 0x00, 0x03, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0xfd, 0x00, 0x04, 0x9f, 0x03, 0xdd, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x9f, 0x02, 0xdd, 0xff, 0x11, 0x0b, 0x00, 0xff, 0xc9, 0x02, 0xdd, 0xff, 0x1d, 0x04, 0x00, 0xff, 0x11, 0x03, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0x02, 0x00, 0xfe, 0x0a, 0xb2, 0x03, 0xdd, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x52, 0x02, 0xdd, 0xff, 0x7c, 0x04, 0x00, 0xfc, 0x04, 0x52, 0x7c, 0x11, 0x03, 0x00, 0xff, 0x9f, 0x02, 0xdd, 0xff, 0x52, 0x03, 0x00, 0xfe, 0x04, 0x9f, 0x03, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x04, 0xdd, 0x02, 0x00, 0xfe, 0x0a, 0xc9, 0x02, 0xdd, 0xfb, 0xbf, 0x8e, 0x7c, 0x9f, 0xc9, 0x02, 0xdd, 0xff, 0x7c, 0x03, 0x00, 0xff, 0x52, 0x02, 0xdd, 0xfb, 0xd5, 0x8e, 0x7c, 0x8e, 0xc9, 0x04, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0x04, 0x00, 0xfe, 0x1d, 0xc9, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x30, 0xd5, 0x08, 0xdd, 0xff, 0x8e, 0x03, 0x00, 0xfe, 0x0a, 0xbf, 0x06, 0xdd, 0xff, 0x7c, 0x03, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xfe, 0x30, 0xd5, 0x02, 0xdd, 0x04, 0x00, 0xf6, 0x1d, 0x8e, 0xc9, 0xdd, 0xd5, 0xc9, 0x9f, 0x7c, 0x30, 0x04, 0x04, 0x00, 0xf8, 0x11, 0x8e, 0xc9, 0xdd, 0xc9, 0xb2, 0x52, 0x04, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x34, 0x00, 0xff, 0xc9, 0x03, 0xdd, 0x34, 0x00, 0x03, 0xdd, 0xff, 0xbf, 0x34, 0x00, 0xfc, 0x8e, 0xd5, 0xc9, 0x52, 0x7e, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_14_image = {(void *) &logo_14, 56, 49};
+    0x38, 0x00, 0xfc, 0x8e, 0xd5, 0xc9, 0x52, 0x34, 0x00, 0x03, 0xdd, 0xff, 0xbf, 0x34, 0x00, 0xff, 0xc9, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xfe, 0x30, 0xd5, 0x02, 0xdd, 0x04, 0x00, 0xfd, 0x11, 0x7c, 0xbf, 0x03, 0xdd, 0xfd, 0xbf, 0x6b, 0x0a, 0x05, 0x00, 0xfd, 0x11, 0x7c, 0xbf, 0x03, 0xdd, 0xfd, 0xbf, 0x6b, 0x0a, 0x03, 0x00, 0xf4, 0x8e, 0xd5, 0xc9, 0x52, 0x11, 0x6b, 0xbf, 0xdd, 0xc9, 0xb2, 0x6b, 0x0a, 0x02, 0x00, 0x03, 0xdd, 0x04, 0x00, 0xfe, 0x1d, 0xc9, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x07, 0xdd, 0xfe, 0xb2, 0x0a, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x07, 0xdd, 0xfe, 0xb2, 0x0a, 0x02, 0x00, 0x03, 0xdd, 0x02, 0xbf, 0x06, 0xdd, 0xfd, 0xbf, 0x1d, 0x00, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x04, 0xdd, 0x02, 0x00, 0xfe, 0x04, 0xb2, 0x03, 0xdd, 0xfc, 0x9f, 0x7c, 0x8e, 0xc9, 0x02, 0xdd, 0xff, 0x7c, 0x02, 0x00, 0xfe, 0x04, 0xb2, 0x03, 0xdd, 0xfc, 0x9f, 0x7c, 0x8e, 0xc9, 0x02, 0xdd, 0xff, 0x7c, 0x02, 0x00, 0xff, 0xc9, 0x0b, 0xdd, 0xfe, 0x9f, 0x00, 0x03, 0xdd, 0x02, 0x00, 0xfe, 0x0a, 0xb2, 0x03, 0xdd, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x52, 0x02, 0xdd, 0xfe, 0xd5, 0x30, 0x03, 0x00, 0xfe, 0x1d, 0xc9, 0x02, 0xdd, 0xfd, 0x11, 0x00, 0x52, 0x02, 0xdd, 0xfe, 0xd5, 0x30, 0x03, 0x00, 0xfe, 0x1d, 0xc9, 0x02, 0xdd, 0xff, 0x11, 0x02, 0x00, 0x03, 0xdd, 0xfa, 0x8e, 0x30, 0x0a, 0x04, 0x30, 0xbf, 0x02, 0xdd, 0xfe, 0xd5, 0x00, 0x03, 0xdd, 0xfd, 0x00, 0x04, 0x9f, 0x03, 0xdd, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x8e, 0x02, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xff, 0x8e, 0x02, 0xdd, 0xfd, 0x52, 0x00, 0x8e, 0x02, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xff, 0x8e, 0x02, 0xdd, 0xff, 0x52, 0x02, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xff, 0x52, 0x03, 0xdd, 0xff, 0x00, 0x08, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xff, 0xbf, 0x02, 0xdd, 0xff, 0x1d, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xdd, 0xfd, 0x7c, 0x00, 0xbf, 0x02, 0xdd, 0xff, 0x1d, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xdd, 0xff, 0x7c, 0x02, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xff, 0x11, 0x03, 0xdd, 0xff, 0x00, 0x07, 0xdd, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xdd, 0xfe, 0x8e, 0x00, 0x0c, 0xdd, 0xff, 0x8e, 0x02, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xff, 0x04, 0x03, 0xdd, 0xff, 0x00, 0x07, 0xdd, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xdd, 0xfe, 0x8e, 0x00, 0x0c, 0xdd, 0xff, 0x8e, 0x02, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xff, 0x04, 0x03, 0xdd, 0xff, 0x00, 0x03, 0xdd, 0xfe, 0x00, 0x7c, 0x03, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xfd, 0xc9, 0xdd, 0xd5, 0x0b, 0x00, 0xfd, 0xc9, 0xdd, 0xd5, 0x0c, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xff, 0x11, 0x03, 0xdd, 0xff, 0x00, 0x03, 0xdd, 0xfd, 0x00, 0x04, 0x9f, 0x03, 0xdd, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x9f, 0x02, 0xdd, 0xff, 0x11, 0x0a, 0x00, 0xff, 0x9f, 0x02, 0xdd, 0xff, 0x11, 0x0b, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xff, 0x52, 0x03, 0xdd, 0xff, 0x00, 0x03, 0xdd, 0x02, 0x00, 0xfe, 0x0a, 0xb2, 0x03, 0xdd, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x52, 0x02, 0xdd, 0xff, 0x7c, 0x04, 0x00, 0xfc, 0x04, 0x52, 0x7c, 0x11, 0x02, 0x00, 0xff, 0x52, 0x02, 0xdd, 0xff, 0x7c, 0x04, 0x00, 0xfc, 0x04, 0x52, 0x7c, 0x11, 0x03, 0x00, 0x03, 0xdd, 0xfa, 0x8e, 0x30, 0x0a, 0x04, 0x30, 0xbf, 0x02, 0xdd, 0xfe, 0xd5, 0x00, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x04, 0xdd, 0x02, 0x00, 0xfe, 0x0a, 0xc9, 0x02, 0xdd, 0xfb, 0xbf, 0x8e, 0x7c, 0x9f, 0xc9, 0x02, 0xdd, 0xff, 0x7c, 0x02, 0x00, 0xfe, 0x0a, 0xc9, 0x02, 0xdd, 0xfb, 0xbf, 0x8e, 0x7c, 0x9f, 0xc9, 0x02, 0xdd, 0xff, 0x7c, 0x03, 0x00, 0x0b, 0xdd, 0xfe, 0x9f, 0x00, 0x03, 0xdd, 0x04, 0x00, 0xfe, 0x1d, 0xc9, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x30, 0xd5, 0x08, 0xdd, 0xff, 0x8e, 0x03, 0x00, 0xfe, 0x30, 0xd5, 0x08, 0xdd, 0xff, 0x8e, 0x03, 0x00, 0x03, 0xdd, 0xff, 0xbf, 0x06, 0xdd, 0xfd, 0xbf, 0x1d, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xfe, 0x30, 0xd5, 0x02, 0xdd, 0x04, 0x00, 0xf6, 0x1d, 0x8e, 0xc9, 0xdd, 0xd5, 0xc9, 0x9f, 0x7c, 0x30, 0x04, 0x04, 0x00, 0xf6, 0x1d, 0x8e, 0xc9, 0xdd, 0xd5, 0xc9, 0x9f, 0x7c, 0x30, 0x04, 0x03, 0x00, 0x03, 0xdd, 0xf8, 0x11, 0x6b, 0xbf, 0xdd, 0xc9, 0xb2, 0x6b, 0x0a, 0x02, 0x00, 0x03, 0xdd, 0x28, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x28, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x28, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x28, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xfe, 0x30, 0xd5, 0x02, 0xdd, 0x04, 0x00, 0xfd, 0x11, 0x7c, 0xbf, 0x03, 0xdd, 0xfd, 0xbf, 0x6b, 0x0a, 0x02, 0x00, 0x05, 0xdd, 0x04, 0x00, 0x05, 0xdd, 0x02, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x04, 0x00, 0xfe, 0x1d, 0xc9, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x07, 0xdd, 0xfd, 0xb2, 0x0a, 0x00, 0x05, 0xdd, 0x04, 0x00, 0x05, 0xdd, 0x02, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x04, 0xdd, 0x02, 0x00, 0xfe, 0x04, 0xb2, 0x03, 0xdd, 0xfc, 0x9f, 0x7c, 0x8e, 0xc9, 0x02, 0xdd, 0xff, 0x7c, 0x03, 0x00, 0x03, 0xdd, 0x06, 0x00, 0x03, 0xdd, 0x02, 0x00, 0x03, 0xdd, 0x0a, 0x00, 0x03, 0xdd, 0x02, 0x00, 0xfe, 0x0a, 0xb2, 0x03, 0xdd, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x52, 0x02, 0xdd, 0xfe, 0xd5, 0x30, 0x03, 0x00, 0xfe, 0x1d, 0xc9, 0x02, 0xdd, 0xff, 0x11, 0x02, 0x00, 0x03, 0xdd, 0x06, 0x00, 0x03, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0xfd, 0x00, 0x04, 0x9f, 0x03, 0xdd, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x8e, 0x02, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xff, 0x8e, 0x02, 0xdd, 0xff, 0x52, 0x02, 0x00, 0x03, 0xdd, 0x06, 0x00, 0x03, 0xdd, 0x0f, 0x00, 0x08, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xff, 0xbf, 0x02, 0xdd, 0xff, 0x1d, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xdd, 0xff, 0x7c, 0x02, 0x00, 0x03, 0xdd, 0x06, 0x00, 0x03, 0xdd, 0x0f, 0x00, 0x07, 0xdd, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xdd, 0xff, 0x8e, 0x02, 0x00, 0x03, 0xdd, 0x06, 0x00, 0x03, 0xdd, 0x0f, 0x00, 0x07, 0xdd, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xdd, 0xff, 0x8e, 0x02, 0x00, 0x03, 0xdd, 0x06, 0x00, 0x03, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0xfe, 0x00, 0x7c, 0x03, 0xdd, 0xff, 0x6b, 0x05, 0x00, 0xfd, 0xc9, 0xdd, 0xd5, 0x0c, 0x00, 0x03, 0xdd, 0xff, 0x04, 0x05, 0x00, 0x03, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0xfd, 0x00, 0x04, 0x9f, 0x03, 0xdd, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x9f, 0x02, 0xdd, 0xff, 0x11, 0x0b, 0x00, 0xff, 0xc9, 0x02, 0xdd, 0xff, 0x1d, 0x04, 0x00, 0xff, 0x11, 0x03, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0x02, 0x00, 0xfe, 0x0a, 0xb2, 0x03, 0xdd, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x52, 0x02, 0xdd, 0xff, 0x7c, 0x04, 0x00, 0xfc, 0x04, 0x52, 0x7c, 0x11, 0x03, 0x00, 0xff, 0x9f, 0x02, 0xdd, 0xff, 0x52, 0x03, 0x00, 0xfe, 0x04, 0x9f, 0x03, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x11, 0xbf, 0x04, 0xdd, 0x02, 0x00, 0xfe, 0x0a, 0xc9, 0x02, 0xdd, 0xfb, 0xbf, 0x8e, 0x7c, 0x9f, 0xc9, 0x02, 0xdd, 0xff, 0x7c, 0x03, 0x00, 0xff, 0x52, 0x02, 0xdd, 0xfb, 0xd5, 0x8e, 0x7c, 0x8e, 0xc9, 0x04, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0x04, 0x00, 0xfe, 0x1d, 0xc9, 0x03, 0xdd, 0x03, 0x00, 0xfe, 0x30, 0xd5, 0x08, 0xdd, 0xff, 0x8e, 0x03, 0x00, 0xfe, 0x0a, 0xbf, 0x06, 0xdd, 0xff, 0x7c, 0x03, 0xdd, 0x0f, 0x00, 0x03, 0xdd, 0x05, 0x00, 0xfe, 0x30, 0xd5, 0x02, 0xdd, 0x04, 0x00, 0xf6, 0x1d, 0x8e, 0xc9, 0xdd, 0xd5, 0xc9, 0x9f, 0x7c, 0x30, 0x04, 0x04, 0x00, 0xf8, 0x11, 0x8e, 0xc9, 0xdd, 0xc9, 0xb2, 0x52, 0x04, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x35, 0x00, 0x03, 0xdd, 0x34, 0x00, 0xff, 0xc9, 0x03, 0xdd, 0x34, 0x00, 0x03, 0xdd, 0xff, 0xbf, 0x34, 0x00, 0xfc, 0x8e, 0xd5, 0xc9, 0x52, 0x7e, 0x00
+};
+static const Image logo_14_image = {logo_14_data, 56, 49};
 
-static void logo_15(uint8_t *data)
+static const uint8_t logo_15_data[1194] =
 {
-    const uint8_t image_data[1194] =
-    {
-        0xfc, 0x9b, 0xe7, 0xd5, 0x59, 0x34, 0x00, 0x03, 0xee, 0xff, 0xc1, 0x34, 0x00, 0xff, 0xd5, 0x02, 0xee, 0xff, 0xe7, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x05, 0x00, 0xfe, 0x32, 0xe7, 0x02, 0xee, 0x04, 0x00, 0xfd, 0x11, 0x82, 0xd5, 0x02, 0xee, 0xfc, 0xe7, 0xd5, 0x72, 0x07, 0x05, 0x00, 0xfd, 0x11, 0x82, 0xd5, 0x02, 0xee, 0xfc, 0xe7, 0xd5, 0x72, 0x07, 0x03, 0x00, 0xf4, 0x9b, 0xe7, 0xd5, 0x59, 0x11, 0x82, 0xc1, 0xe7, 0xde, 0xab, 0x72, 0x07, 0x02, 0x00, 0x03, 0xee, 0x04, 0x00, 0xfe, 0x1c, 0xd5, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x1c, 0xd5, 0x07, 0xee, 0xfe, 0xab, 0x07, 0x03, 0x00, 0xfe, 0x1c, 0xd5, 0x07, 0xee, 0xfe, 0xab, 0x07, 0x02, 0x00, 0x03, 0xee, 0x02, 0xd5, 0x06, 0xee, 0xfd, 0xd5, 0x1c, 0x00, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x11, 0xd5, 0x04, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xfc, 0xab, 0x8e, 0x9b, 0xde, 0x02, 0xee, 0xff, 0x82, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xfc, 0xab, 0x8e, 0x9b, 0xde, 0x02, 0xee, 0xff, 0x82, 0x02, 0x00, 0xff, 0xd5, 0x0b, 0xee, 0xfe, 0x9b, 0x00, 0x03, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xff, 0x72, 0x03, 0x00, 0xff, 0x59, 0x02, 0xee, 0xfe, 0xe7, 0x32, 0x03, 0x00, 0xf9, 0x1c, 0xde, 0xee, 0xe7, 0x11, 0x00, 0x59, 0x02, 0xee, 0xfe, 0xe7, 0x32, 0x03, 0x00, 0xfb, 0x1c, 0xde, 0xee, 0xe7, 0x11, 0x02, 0x00, 0x03, 0xee, 0xfe, 0x9b, 0x32, 0x02, 0x07, 0xfe, 0x32, 0xc1, 0x02, 0xee, 0xfe, 0xe7, 0x00, 0x03, 0xee, 0xfd, 0x00, 0x07, 0xab, 0x03, 0xee, 0xff, 0x72, 0x04, 0x00, 0xff, 0x9b, 0x02, 0xee, 0xff, 0x82, 0x05, 0x00, 0xff, 0x9b, 0x02, 0xee, 0xfd, 0x59, 0x00, 0x9b, 0x02, 0xee, 0xff, 0x82, 0x05, 0x00, 0xff, 0x9b, 0x02, 0xee, 0xff, 0x59, 0x02, 0x00, 0x03, 0xee, 0x05, 0x00, 0xff, 0x59, 0x03, 0xee, 0xff, 0x00, 0x08, 0xee, 0xff, 0x72, 0x05, 0x00, 0xff, 0xd5, 0x02, 0xee, 0xff, 0x32, 0x05, 0x00, 0xff, 0x72, 0x02, 0xee, 0xfd, 0x82, 0x00, 0xd5, 0x02, 0xee, 0xff, 0x32, 0x05, 0x00, 0xff, 0x72, 0x02, 0xee, 0xff, 0x82, 0x02, 0x00, 0x03, 0xee, 0x05, 0x00, 0xff, 0x11, 0x03, 0xee, 0xff, 0x00, 0x07, 0xee, 0xff, 0x72, 0x06, 0x00, 0x0c, 0xee, 0xfe, 0x9b, 0x00, 0x0c, 0xee, 0xff, 0x9b, 0x02, 0x00, 0x03, 0xee, 0x05, 0x00, 0xff, 0x07, 0x03, 0xee, 0xff, 0x00, 0x07, 0xee, 0xff, 0x72, 0x06, 0x00, 0x0c, 0xee, 0xfe, 0x9b, 0x00, 0x0c, 0xee, 0xff, 0x9b, 0x02, 0x00, 0x03, 0xee, 0x05, 0x00, 0xff, 0x07, 0x03, 0xee, 0xff, 0x00, 0x03, 0xee, 0xfe, 0x00, 0x8e, 0x03, 0xee, 0xff, 0x72, 0x05, 0x00, 0xfd, 0xd5, 0xee, 0xe7, 0x0b, 0x00, 0xfd, 0xd5, 0xee, 0xe7, 0x0c, 0x00, 0x03, 0xee, 0x05, 0x00, 0xff, 0x11, 0x03, 0xee, 0xff, 0x00, 0x03, 0xee, 0xfd, 0x00, 0x07, 0xab, 0x03, 0xee, 0xff, 0x72, 0x04, 0x00, 0xff, 0xab, 0x02, 0xee, 0xff, 0x11, 0x0a, 0x00, 0xff, 0xab, 0x02, 0xee, 0xff, 0x11, 0x0b, 0x00, 0x03, 0xee, 0x05, 0x00, 0xff, 0x59, 0x03, 0xee, 0xff, 0x00, 0x03, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xff, 0x72, 0x03, 0x00, 0xff, 0x72, 0x02, 0xee, 0xff, 0x82, 0x04, 0x00, 0xfc, 0x07, 0x59, 0x8e, 0x11, 0x02, 0x00, 0xff, 0x72, 0x02, 0xee, 0xff, 0x82, 0x04, 0x00, 0xfc, 0x07, 0x59, 0x8e, 0x11, 0x03, 0x00, 0x03, 0xee, 0xfe, 0x9b, 0x32, 0x02, 0x07, 0xfe, 0x32, 0xc1, 0x02, 0xee, 0xfe, 0xe7, 0x00, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x11, 0xd5, 0x04, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xd5, 0x02, 0xee, 0xfb, 0xd5, 0x9b, 0x8e, 0x9b, 0xd5, 0x02, 0xee, 0xff, 0x82, 0x02, 0x00, 0xfe, 0x07, 0xd5, 0x02, 0xee, 0xfb, 0xd5, 0x9b, 0x8e, 0x9b, 0xd5, 0x02, 0xee, 0xff, 0x82, 0x03, 0x00, 0x0b, 0xee, 0xfe, 0x9b, 0x00, 0x03, 0xee, 0x04, 0x00, 0xfe, 0x1c, 0xd5, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x32, 0xde, 0x08, 0xee, 0xff, 0x8e, 0x03, 0x00, 0xfe, 0x32, 0xde, 0x08, 0xee, 0xff, 0x8e, 0x03, 0x00, 0x03, 0xee, 0xff, 0xd5, 0x06, 0xee, 0xfd, 0xd5, 0x1c, 0x00, 0x03, 0xee, 0x05, 0x00, 0xfe, 0x32, 0xe7, 0x02, 0xee, 0x04, 0x00, 0xf7, 0x1c, 0x8e, 0xd5, 0xee, 0xe7, 0xd5, 0xab, 0x82, 0x32, 0x05, 0x00, 0xf7, 0x1c, 0x8e, 0xd5, 0xee, 0xe7, 0xd5, 0xab, 0x82, 0x32, 0x04, 0x00, 0x03, 0xee, 0xf8, 0x11, 0x82, 0xd5, 0xee, 0xde, 0xab, 0x72, 0x07, 0x02, 0x00, 0x03, 0xee, 0x28, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x28, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x28, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x28, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x05, 0x00, 0xfe, 0x32, 0xe7, 0x02, 0xee, 0x04, 0x00, 0xfd, 0x11, 0x82, 0xd5, 0x02, 0xee, 0xfc, 0xe7, 0xd5, 0x72, 0x07, 0x02, 0x00, 0x05, 0xee, 0x04, 0x00, 0x05, 0xee, 0x02, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x04, 0x00, 0xfe, 0x1c, 0xd5, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x1c, 0xd5, 0x07, 0xee, 0xfd, 0xab, 0x07, 0x00, 0x05, 0xee, 0x04, 0x00, 0x05, 0xee, 0x02, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x11, 0xd5, 0x04, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xfc, 0xab, 0x8e, 0x9b, 0xde, 0x02, 0xee, 0xff, 0x82, 0x03, 0x00, 0x03, 0xee, 0x06, 0x00, 0x03, 0xee, 0x02, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xff, 0x72, 0x03, 0x00, 0xff, 0x59, 0x02, 0xee, 0xfe, 0xe7, 0x32, 0x03, 0x00, 0xfb, 0x1c, 0xde, 0xee, 0xe7, 0x11, 0x02, 0x00, 0x03, 0xee, 0x06, 0x00, 0x03, 0xee, 0x0f, 0x00, 0x03, 0xee, 0xfd, 0x00, 0x07, 0xab, 0x03, 0xee, 0xff, 0x72, 0x04, 0x00, 0xff, 0x9b, 0x02, 0xee, 0xff, 0x82, 0x05, 0x00, 0xff, 0x9b, 0x02, 0xee, 0xff, 0x59, 0x02, 0x00, 0x03, 0xee, 0x06, 0x00, 0x03, 0xee, 0x0f, 0x00, 0x08, 0xee, 0xff, 0x72, 0x05, 0x00, 0xff, 0xd5, 0x02, 0xee, 0xff, 0x32, 0x05, 0x00, 0xff, 0x72, 0x02, 0xee, 0xff, 0x82, 0x02, 0x00, 0x03, 0xee, 0x06, 0x00, 0x03, 0xee, 0x0f, 0x00, 0x07, 0xee, 0xff, 0x72, 0x06, 0x00, 0x0c, 0xee, 0xff, 0x9b, 0x02, 0x00, 0x03, 0xee, 0x06, 0x00, 0x03, 0xee, 0x0f, 0x00, 0x07, 0xee, 0xff, 0x72, 0x06, 0x00, 0x0c, 0xee, 0xff, 0x9b, 0x02, 0x00, 0x03, 0xee, 0x06, 0x00, 0x03, 0xee, 0x0f, 0x00, 0x03, 0xee, 0xfe, 0x00, 0x8e, 0x03, 0xee, 0xff, 0x72, 0x05, 0x00, 0xfd, 0xd5, 0xee, 0xe7, 0x0c, 0x00, 0x03, 0xee, 0xff, 0x07, 0x05, 0x00, 0x03, 0xee, 0x0f, 0x00, 0x03, 0xee, 0xfd, 0x00, 0x07, 0xab, 0x03, 0xee, 0xff, 0x72, 0x04, 0x00, 0xff, 0xab, 0x02, 0xee, 0xff, 0x11, 0x0b, 0x00, 0xff, 0xd5, 0x02, 0xee, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x11, 0x03, 0xee, 0x0f, 0x00, 0x03, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xff, 0x72, 0x03, 0x00, 0xff, 0x72, 0x02, 0xee, 0xff, 0x82, 0x04, 0x00, 0xfc, 0x07, 0x59, 0x8e, 0x11, 0x03, 0x00, 0xff, 0xab, 0x02, 0xee, 0xff, 0x59, 0x03, 0x00, 0xfe, 0x07, 0xab, 0x03, 0xee, 0x0f, 0x00, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x11, 0xd5, 0x04, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xd5, 0x02, 0xee, 0xfb, 0xd5, 0x9b, 0x8e, 0x9b, 0xd5, 0x02, 0xee, 0xff, 0x82, 0x03, 0x00, 0xff, 0x72, 0x02, 0xee, 0xff, 0xde, 0x02, 0x8e, 0xfe, 0x9b, 0xd5, 0x04, 0xee, 0x0f, 0x00, 0x03, 0xee, 0x04, 0x00, 0xfe, 0x1c, 0xd5, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x32, 0xde, 0x08, 0xee, 0xff, 0x8e, 0x03, 0x00, 0xfe, 0x07, 0xc1, 0x06, 0xee, 0xff, 0x8e, 0x03, 0xee, 0x0f, 0x00, 0x03, 0xee, 0x05, 0x00, 0xfe, 0x32, 0xe7, 0x02, 0xee, 0x04, 0x00, 0xf7, 0x1c, 0x8e, 0xd5, 0xee, 0xe7, 0xd5, 0xab, 0x82, 0x32, 0x05, 0x00, 0xf8, 0x11, 0x8e, 0xd5, 0xe7, 0xde, 0xab, 0x59, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x34, 0x00, 0xff, 0xd5, 0x02, 0xee, 0xff, 0xe7, 0x34, 0x00, 0x03, 0xee, 0xff, 0xc1, 0x34, 0x00, 0xfc, 0x9b, 0xe7, 0xde, 0x59, 0x7f, 0x00, 0x37, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_15_image = {(void *) &logo_15, 56, 49};
+    0xfc, 0x9b, 0xe7, 0xd5, 0x59, 0x34, 0x00, 0x03, 0xee, 0xff, 0xc1, 0x34, 0x00, 0xff, 0xd5, 0x02, 0xee, 0xff, 0xe7, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x05, 0x00, 0xfe, 0x32, 0xe7, 0x02, 0xee, 0x04, 0x00, 0xfd, 0x11, 0x82, 0xd5, 0x02, 0xee, 0xfc, 0xe7, 0xd5, 0x72, 0x07, 0x05, 0x00, 0xfd, 0x11, 0x82, 0xd5, 0x02, 0xee, 0xfc, 0xe7, 0xd5, 0x72, 0x07, 0x03, 0x00, 0xf4, 0x9b, 0xe7, 0xd5, 0x59, 0x11, 0x82, 0xc1, 0xe7, 0xde, 0xab, 0x72, 0x07, 0x02, 0x00, 0x03, 0xee, 0x04, 0x00, 0xfe, 0x1c, 0xd5, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x1c, 0xd5, 0x07, 0xee, 0xfe, 0xab, 0x07, 0x03, 0x00, 0xfe, 0x1c, 0xd5, 0x07, 0xee, 0xfe, 0xab, 0x07, 0x02, 0x00, 0x03, 0xee, 0x02, 0xd5, 0x06, 0xee, 0xfd, 0xd5, 0x1c, 0x00, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x11, 0xd5, 0x04, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xfc, 0xab, 0x8e, 0x9b, 0xde, 0x02, 0xee, 0xff, 0x82, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xfc, 0xab, 0x8e, 0x9b, 0xde, 0x02, 0xee, 0xff, 0x82, 0x02, 0x00, 0xff, 0xd5, 0x0b, 0xee, 0xfe, 0x9b, 0x00, 0x03, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xff, 0x72, 0x03, 0x00, 0xff, 0x59, 0x02, 0xee, 0xfe, 0xe7, 0x32, 0x03, 0x00, 0xf9, 0x1c, 0xde, 0xee, 0xe7, 0x11, 0x00, 0x59, 0x02, 0xee, 0xfe, 0xe7, 0x32, 0x03, 0x00, 0xfb, 0x1c, 0xde, 0xee, 0xe7, 0x11, 0x02, 0x00, 0x03, 0xee, 0xfe, 0x9b, 0x32, 0x02, 0x07, 0xfe, 0x32, 0xc1, 0x02, 0xee, 0xfe, 0xe7, 0x00, 0x03, 0xee, 0xfd, 0x00, 0x07, 0xab, 0x03, 0xee, 0xff, 0x72, 0x04, 0x00, 0xff, 0x9b, 0x02, 0xee, 0xff, 0x82, 0x05, 0x00, 0xff, 0x9b, 0x02, 0xee, 0xfd, 0x59, 0x00, 0x9b, 0x02, 0xee, 0xff, 0x82, 0x05, 0x00, 0xff, 0x9b, 0x02, 0xee, 0xff, 0x59, 0x02, 0x00, 0x03, 0xee, 0x05, 0x00, 0xff, 0x59, 0x03, 0xee, 0xff, 0x00, 0x08, 0xee, 0xff, 0x72, 0x05, 0x00, 0xff, 0xd5, 0x02, 0xee, 0xff, 0x32, 0x05, 0x00, 0xff, 0x72, 0x02, 0xee, 0xfd, 0x82, 0x00, 0xd5, 0x02, 0xee, 0xff, 0x32, 0x05, 0x00, 0xff, 0x72, 0x02, 0xee, 0xff, 0x82, 0x02, 0x00, 0x03, 0xee, 0x05, 0x00, 0xff, 0x11, 0x03, 0xee, 0xff, 0x00, 0x07, 0xee, 0xff, 0x72, 0x06, 0x00, 0x0c, 0xee, 0xfe, 0x9b, 0x00, 0x0c, 0xee, 0xff, 0x9b, 0x02, 0x00, 0x03, 0xee, 0x05, 0x00, 0xff, 0x07, 0x03, 0xee, 0xff, 0x00, 0x07, 0xee, 0xff, 0x72, 0x06, 0x00, 0x0c, 0xee, 0xfe, 0x9b, 0x00, 0x0c, 0xee, 0xff, 0x9b, 0x02, 0x00, 0x03, 0xee, 0x05, 0x00, 0xff, 0x07, 0x03, 0xee, 0xff, 0x00, 0x03, 0xee, 0xfe, 0x00, 0x8e, 0x03, 0xee, 0xff, 0x72, 0x05, 0x00, 0xfd, 0xd5, 0xee, 0xe7, 0x0b, 0x00, 0xfd, 0xd5, 0xee, 0xe7, 0x0c, 0x00, 0x03, 0xee, 0x05, 0x00, 0xff, 0x11, 0x03, 0xee, 0xff, 0x00, 0x03, 0xee, 0xfd, 0x00, 0x07, 0xab, 0x03, 0xee, 0xff, 0x72, 0x04, 0x00, 0xff, 0xab, 0x02, 0xee, 0xff, 0x11, 0x0a, 0x00, 0xff, 0xab, 0x02, 0xee, 0xff, 0x11, 0x0b, 0x00, 0x03, 0xee, 0x05, 0x00, 0xff, 0x59, 0x03, 0xee, 0xff, 0x00, 0x03, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xff, 0x72, 0x03, 0x00, 0xff, 0x72, 0x02, 0xee, 0xff, 0x82, 0x04, 0x00, 0xfc, 0x07, 0x59, 0x8e, 0x11, 0x02, 0x00, 0xff, 0x72, 0x02, 0xee, 0xff, 0x82, 0x04, 0x00, 0xfc, 0x07, 0x59, 0x8e, 0x11, 0x03, 0x00, 0x03, 0xee, 0xfe, 0x9b, 0x32, 0x02, 0x07, 0xfe, 0x32, 0xc1, 0x02, 0xee, 0xfe, 0xe7, 0x00, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x11, 0xd5, 0x04, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xd5, 0x02, 0xee, 0xfb, 0xd5, 0x9b, 0x8e, 0x9b, 0xd5, 0x02, 0xee, 0xff, 0x82, 0x02, 0x00, 0xfe, 0x07, 0xd5, 0x02, 0xee, 0xfb, 0xd5, 0x9b, 0x8e, 0x9b, 0xd5, 0x02, 0xee, 0xff, 0x82, 0x03, 0x00, 0x0b, 0xee, 0xfe, 0x9b, 0x00, 0x03, 0xee, 0x04, 0x00, 0xfe, 0x1c, 0xd5, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x32, 0xde, 0x08, 0xee, 0xff, 0x8e, 0x03, 0x00, 0xfe, 0x32, 0xde, 0x08, 0xee, 0xff, 0x8e, 0x03, 0x00, 0x03, 0xee, 0xff, 0xd5, 0x06, 0xee, 0xfd, 0xd5, 0x1c, 0x00, 0x03, 0xee, 0x05, 0x00, 0xfe, 0x32, 0xe7, 0x02, 0xee, 0x04, 0x00, 0xf7, 0x1c, 0x8e, 0xd5, 0xee, 0xe7, 0xd5, 0xab, 0x82, 0x32, 0x05, 0x00, 0xf7, 0x1c, 0x8e, 0xd5, 0xee, 0xe7, 0xd5, 0xab, 0x82, 0x32, 0x04, 0x00, 0x03, 0xee, 0xf8, 0x11, 0x82, 0xd5, 0xee, 0xde, 0xab, 0x72, 0x07, 0x02, 0x00, 0x03, 0xee, 0x28, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x28, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x28, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x28, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x05, 0x00, 0xfe, 0x32, 0xe7, 0x02, 0xee, 0x04, 0x00, 0xfd, 0x11, 0x82, 0xd5, 0x02, 0xee, 0xfc, 0xe7, 0xd5, 0x72, 0x07, 0x02, 0x00, 0x05, 0xee, 0x04, 0x00, 0x05, 0xee, 0x02, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x04, 0x00, 0xfe, 0x1c, 0xd5, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x1c, 0xd5, 0x07, 0xee, 0xfd, 0xab, 0x07, 0x00, 0x05, 0xee, 0x04, 0x00, 0x05, 0xee, 0x02, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x11, 0xd5, 0x04, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xfc, 0xab, 0x8e, 0x9b, 0xde, 0x02, 0xee, 0xff, 0x82, 0x03, 0x00, 0x03, 0xee, 0x06, 0x00, 0x03, 0xee, 0x02, 0x00, 0x03, 0xee, 0x0a, 0x00, 0x03, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xff, 0x72, 0x03, 0x00, 0xff, 0x59, 0x02, 0xee, 0xfe, 0xe7, 0x32, 0x03, 0x00, 0xfb, 0x1c, 0xde, 0xee, 0xe7, 0x11, 0x02, 0x00, 0x03, 0xee, 0x06, 0x00, 0x03, 0xee, 0x0f, 0x00, 0x03, 0xee, 0xfd, 0x00, 0x07, 0xab, 0x03, 0xee, 0xff, 0x72, 0x04, 0x00, 0xff, 0x9b, 0x02, 0xee, 0xff, 0x82, 0x05, 0x00, 0xff, 0x9b, 0x02, 0xee, 0xff, 0x59, 0x02, 0x00, 0x03, 0xee, 0x06, 0x00, 0x03, 0xee, 0x0f, 0x00, 0x08, 0xee, 0xff, 0x72, 0x05, 0x00, 0xff, 0xd5, 0x02, 0xee, 0xff, 0x32, 0x05, 0x00, 0xff, 0x72, 0x02, 0xee, 0xff, 0x82, 0x02, 0x00, 0x03, 0xee, 0x06, 0x00, 0x03, 0xee, 0x0f, 0x00, 0x07, 0xee, 0xff, 0x72, 0x06, 0x00, 0x0c, 0xee, 0xff, 0x9b, 0x02, 0x00, 0x03, 0xee, 0x06, 0x00, 0x03, 0xee, 0x0f, 0x00, 0x07, 0xee, 0xff, 0x72, 0x06, 0x00, 0x0c, 0xee, 0xff, 0x9b, 0x02, 0x00, 0x03, 0xee, 0x06, 0x00, 0x03, 0xee, 0x0f, 0x00, 0x03, 0xee, 0xfe, 0x00, 0x8e, 0x03, 0xee, 0xff, 0x72, 0x05, 0x00, 0xfd, 0xd5, 0xee, 0xe7, 0x0c, 0x00, 0x03, 0xee, 0xff, 0x07, 0x05, 0x00, 0x03, 0xee, 0x0f, 0x00, 0x03, 0xee, 0xfd, 0x00, 0x07, 0xab, 0x03, 0xee, 0xff, 0x72, 0x04, 0x00, 0xff, 0xab, 0x02, 0xee, 0xff, 0x11, 0x0b, 0x00, 0xff, 0xd5, 0x02, 0xee, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x11, 0x03, 0xee, 0x0f, 0x00, 0x03, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xc1, 0x03, 0xee, 0xff, 0x72, 0x03, 0x00, 0xff, 0x72, 0x02, 0xee, 0xff, 0x82, 0x04, 0x00, 0xfc, 0x07, 0x59, 0x8e, 0x11, 0x03, 0x00, 0xff, 0xab, 0x02, 0xee, 0xff, 0x59, 0x03, 0x00, 0xfe, 0x07, 0xab, 0x03, 0xee, 0x0f, 0x00, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x11, 0xd5, 0x04, 0xee, 0x02, 0x00, 0xfe, 0x07, 0xd5, 0x02, 0xee, 0xfb, 0xd5, 0x9b, 0x8e, 0x9b, 0xd5, 0x02, 0xee, 0xff, 0x82, 0x03, 0x00, 0xff, 0x72, 0x02, 0xee, 0xff, 0xde, 0x02, 0x8e, 0xfe, 0x9b, 0xd5, 0x04, 0xee, 0x0f, 0x00, 0x03, 0xee, 0x04, 0x00, 0xfe, 0x1c, 0xd5, 0x03, 0xee, 0x03, 0x00, 0xfe, 0x32, 0xde, 0x08, 0xee, 0xff, 0x8e, 0x03, 0x00, 0xfe, 0x07, 0xc1, 0x06, 0xee, 0xff, 0x8e, 0x03, 0xee, 0x0f, 0x00, 0x03, 0xee, 0x05, 0x00, 0xfe, 0x32, 0xe7, 0x02, 0xee, 0x04, 0x00, 0xf7, 0x1c, 0x8e, 0xd5, 0xee, 0xe7, 0xd5, 0xab, 0x82, 0x32, 0x05, 0x00, 0xf8, 0x11, 0x8e, 0xd5, 0xe7, 0xde, 0xab, 0x59, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x35, 0x00, 0x03, 0xee, 0x34, 0x00, 0xff, 0xd5, 0x02, 0xee, 0xff, 0xe7, 0x34, 0x00, 0x03, 0xee, 0xff, 0xc1, 0x34, 0x00, 0xfc, 0x9b, 0xe7, 0xde, 0x59, 0x7f, 0x00, 0x37, 0x00
+};
+static const Image logo_15_image = {logo_15_data, 56, 49};
 
-static void logo_16(uint8_t *data)
+static const uint8_t logo_16_data[1189] =
 {
-    const uint8_t image_data[1189] =
-    {
-        0xfc, 0xb5, 0xf7, 0xeb, 0x58, 0x34, 0x00, 0x03, 0xff, 0xff, 0xdd, 0x34, 0x00, 0xff, 0xe2, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x33, 0xf7, 0x02, 0xff, 0x04, 0x00, 0xfd, 0x11, 0x8f, 0xe2, 0x03, 0xff, 0xfd, 0xdd, 0x79, 0x07, 0x05, 0x00, 0xfd, 0x11, 0x8f, 0xe2, 0x03, 0xff, 0xfd, 0xdd, 0x79, 0x07, 0x03, 0x00, 0xf4, 0xb5, 0xf7, 0xeb, 0x58, 0x11, 0x8f, 0xdd, 0xff, 0xeb, 0xb5, 0x79, 0x07, 0x02, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x1c, 0xeb, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x1c, 0xdd, 0x07, 0xff, 0xfe, 0xb5, 0x07, 0x03, 0x00, 0xfe, 0x1c, 0xdd, 0x07, 0xff, 0xfe, 0xb5, 0x07, 0x02, 0x00, 0x03, 0xff, 0x02, 0xdd, 0x06, 0xff, 0xfd, 0xdd, 0x1c, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x11, 0xdd, 0x04, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xfc, 0xb5, 0x8f, 0xa3, 0xeb, 0x02, 0xff, 0xff, 0x8f, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xfc, 0xb5, 0x8f, 0xa3, 0xeb, 0x02, 0xff, 0xff, 0x8f, 0x02, 0x00, 0xff, 0xe2, 0x0b, 0xff, 0xfe, 0xb5, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xff, 0x79, 0x03, 0x00, 0xff, 0x58, 0x02, 0xff, 0xfe, 0xf7, 0x33, 0x03, 0x00, 0xfe, 0x1c, 0xeb, 0x02, 0xff, 0xfd, 0x11, 0x00, 0x58, 0x02, 0xff, 0xfe, 0xf7, 0x33, 0x03, 0x00, 0xfe, 0x1c, 0xeb, 0x02, 0xff, 0xff, 0x11, 0x02, 0x00, 0x03, 0xff, 0xfe, 0xa3, 0x33, 0x02, 0x07, 0xfe, 0x33, 0xdd, 0x02, 0xff, 0xfe, 0xf7, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x07, 0xb5, 0x03, 0xff, 0xff, 0x79, 0x04, 0x00, 0xff, 0xa3, 0x02, 0xff, 0xff, 0x8f, 0x05, 0x00, 0xff, 0xa3, 0x02, 0xff, 0xfd, 0x58, 0x00, 0xa3, 0x02, 0xff, 0xff, 0x8f, 0x05, 0x00, 0xff, 0xa3, 0x02, 0xff, 0xff, 0x58, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x58, 0x03, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x79, 0x05, 0x00, 0xff, 0xdd, 0x02, 0xff, 0xff, 0x33, 0x05, 0x00, 0xff, 0x79, 0x02, 0xff, 0xfd, 0x8f, 0x00, 0xdd, 0x02, 0xff, 0xff, 0x33, 0x05, 0x00, 0xff, 0x79, 0x02, 0xff, 0xff, 0x8f, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x1c, 0x03, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x79, 0x06, 0x00, 0x0c, 0xff, 0xfe, 0xb5, 0x00, 0x0c, 0xff, 0xff, 0xb5, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x07, 0x03, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x79, 0x06, 0x00, 0x0c, 0xff, 0xfe, 0xa3, 0x00, 0x0c, 0xff, 0xff, 0xa3, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x07, 0x03, 0xff, 0xff, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x8f, 0x03, 0xff, 0xff, 0x79, 0x05, 0x00, 0xfd, 0xe2, 0xff, 0xf7, 0x0b, 0x00, 0xfd, 0xe2, 0xff, 0xf7, 0x0c, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x1c, 0x03, 0xff, 0xff, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x07, 0xb5, 0x03, 0xff, 0xff, 0x79, 0x04, 0x00, 0xff, 0xb5, 0x02, 0xff, 0xff, 0x11, 0x0a, 0x00, 0xff, 0xb5, 0x02, 0xff, 0xff, 0x11, 0x0b, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x58, 0x03, 0xff, 0xff, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xff, 0x79, 0x03, 0x00, 0xff, 0x79, 0x02, 0xff, 0xff, 0x8f, 0x04, 0x00, 0xfc, 0x07, 0x58, 0x8f, 0x11, 0x02, 0x00, 0xff, 0x79, 0x02, 0xff, 0xff, 0x8f, 0x04, 0x00, 0xfc, 0x07, 0x58, 0x8f, 0x11, 0x03, 0x00, 0x03, 0xff, 0xfe, 0xa3, 0x33, 0x02, 0x07, 0xfe, 0x33, 0xdd, 0x02, 0xff, 0xfe, 0xf7, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x11, 0xdd, 0x04, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xeb, 0x02, 0xff, 0xfb, 0xdd, 0xa3, 0x8f, 0xb5, 0xe2, 0x02, 0xff, 0xff, 0x8f, 0x02, 0x00, 0xfe, 0x07, 0xeb, 0x02, 0xff, 0xfb, 0xdd, 0xa3, 0x8f, 0xb5, 0xe2, 0x02, 0xff, 0xff, 0x8f, 0x03, 0x00, 0x0b, 0xff, 0xfe, 0xb5, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x1c, 0xeb, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x33, 0xf7, 0x08, 0xff, 0xff, 0xa3, 0x03, 0x00, 0xfe, 0x33, 0xf7, 0x08, 0xff, 0xff, 0xa3, 0x03, 0x00, 0x03, 0xff, 0xff, 0xdd, 0x06, 0xff, 0xfd, 0xdd, 0x1c, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x33, 0xf7, 0x02, 0xff, 0x04, 0x00, 0xf7, 0x1c, 0xa3, 0xe2, 0xff, 0xf7, 0xe2, 0xb5, 0x8f, 0x33, 0x05, 0x00, 0xf7, 0x1c, 0xa3, 0xe2, 0xff, 0xf7, 0xe2, 0xb5, 0x8f, 0x33, 0x04, 0x00, 0x03, 0xff, 0xf8, 0x11, 0x8f, 0xdd, 0xff, 0xeb, 0xb5, 0x79, 0x07, 0x02, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x33, 0xf7, 0x02, 0xff, 0x04, 0x00, 0xfd, 0x11, 0x8f, 0xe2, 0x03, 0xff, 0xfd, 0xdd, 0x79, 0x07, 0x02, 0x00, 0x05, 0xff, 0x04, 0x00, 0x05, 0xff, 0x02, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x1c, 0xeb, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x1c, 0xdd, 0x07, 0xff, 0xfd, 0xb5, 0x07, 0x00, 0x05, 0xff, 0x04, 0x00, 0x05, 0xff, 0x02, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x11, 0xdd, 0x04, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xfc, 0xb5, 0x8f, 0xa3, 0xeb, 0x02, 0xff, 0xff, 0x8f, 0x03, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x02, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xff, 0x79, 0x03, 0x00, 0xff, 0x58, 0x02, 0xff, 0xfe, 0xf7, 0x33, 0x03, 0x00, 0xfe, 0x1c, 0xeb, 0x02, 0xff, 0xff, 0x11, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x07, 0xb5, 0x03, 0xff, 0xff, 0x79, 0x04, 0x00, 0xff, 0xa3, 0x02, 0xff, 0xff, 0x8f, 0x05, 0x00, 0xff, 0xa3, 0x02, 0xff, 0xff, 0x58, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x00, 0x08, 0xff, 0xff, 0x79, 0x05, 0x00, 0xff, 0xdd, 0x02, 0xff, 0xff, 0x33, 0x05, 0x00, 0xff, 0x79, 0x02, 0xff, 0xff, 0x8f, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x00, 0x07, 0xff, 0xff, 0x79, 0x06, 0x00, 0x0c, 0xff, 0xff, 0xb5, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x00, 0x07, 0xff, 0xff, 0x79, 0x06, 0x00, 0x0c, 0xff, 0xff, 0xa3, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x8f, 0x03, 0xff, 0xff, 0x79, 0x05, 0x00, 0xfd, 0xe2, 0xff, 0xf7, 0x0c, 0x00, 0x03, 0xff, 0xff, 0x07, 0x05, 0x00, 0x03, 0xff, 0x0f, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x07, 0xb5, 0x03, 0xff, 0xff, 0x79, 0x04, 0x00, 0xff, 0xb5, 0x02, 0xff, 0xff, 0x11, 0x0b, 0x00, 0xff, 0xeb, 0x02, 0xff, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x11, 0x03, 0xff, 0x0f, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xff, 0x79, 0x03, 0x00, 0xff, 0x79, 0x02, 0xff, 0xff, 0x8f, 0x04, 0x00, 0xfc, 0x07, 0x58, 0x8f, 0x11, 0x03, 0x00, 0xff, 0xb5, 0x02, 0xff, 0xff, 0x58, 0x03, 0x00, 0xfe, 0x07, 0xb5, 0x03, 0xff, 0x0f, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x11, 0xdd, 0x04, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xeb, 0x02, 0xff, 0xfb, 0xdd, 0xa3, 0x8f, 0xb5, 0xe2, 0x02, 0xff, 0xff, 0x8f, 0x03, 0x00, 0xff, 0x79, 0x02, 0xff, 0xfb, 0xf7, 0xa3, 0x8f, 0xb5, 0xe2, 0x04, 0xff, 0x0f, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x1c, 0xeb, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x33, 0xf7, 0x08, 0xff, 0xff, 0xa3, 0x03, 0x00, 0xfe, 0x07, 0xdd, 0x06, 0xff, 0xff, 0x8f, 0x03, 0xff, 0x0f, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x33, 0xf7, 0x02, 0xff, 0x04, 0x00, 0xf7, 0x1c, 0xa3, 0xe2, 0xff, 0xf7, 0xe2, 0xb5, 0x8f, 0x33, 0x05, 0x00, 0xf8, 0x11, 0xa3, 0xe2, 0xff, 0xeb, 0xb5, 0x58, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x34, 0x00, 0xff, 0xe2, 0x03, 0xff, 0x34, 0x00, 0x03, 0xff, 0xff, 0xdd, 0x34, 0x00, 0xfc, 0xb5, 0xf7, 0xeb, 0x58, 0x7f, 0x00, 0x37, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image logo_16_image = {(void *) &logo_16, 56, 49};
+    0xfc, 0xb5, 0xf7, 0xeb, 0x58, 0x34, 0x00, 0x03, 0xff, 0xff, 0xdd, 0x34, 0x00, 0xff, 0xe2, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x33, 0xf7, 0x02, 0xff, 0x04, 0x00, 0xfd, 0x11, 0x8f, 0xe2, 0x03, 0xff, 0xfd, 0xdd, 0x79, 0x07, 0x05, 0x00, 0xfd, 0x11, 0x8f, 0xe2, 0x03, 0xff, 0xfd, 0xdd, 0x79, 0x07, 0x03, 0x00, 0xf4, 0xb5, 0xf7, 0xeb, 0x58, 0x11, 0x8f, 0xdd, 0xff, 0xeb, 0xb5, 0x79, 0x07, 0x02, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x1c, 0xeb, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x1c, 0xdd, 0x07, 0xff, 0xfe, 0xb5, 0x07, 0x03, 0x00, 0xfe, 0x1c, 0xdd, 0x07, 0xff, 0xfe, 0xb5, 0x07, 0x02, 0x00, 0x03, 0xff, 0x02, 0xdd, 0x06, 0xff, 0xfd, 0xdd, 0x1c, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x11, 0xdd, 0x04, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xfc, 0xb5, 0x8f, 0xa3, 0xeb, 0x02, 0xff, 0xff, 0x8f, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xfc, 0xb5, 0x8f, 0xa3, 0xeb, 0x02, 0xff, 0xff, 0x8f, 0x02, 0x00, 0xff, 0xe2, 0x0b, 0xff, 0xfe, 0xb5, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xff, 0x79, 0x03, 0x00, 0xff, 0x58, 0x02, 0xff, 0xfe, 0xf7, 0x33, 0x03, 0x00, 0xfe, 0x1c, 0xeb, 0x02, 0xff, 0xfd, 0x11, 0x00, 0x58, 0x02, 0xff, 0xfe, 0xf7, 0x33, 0x03, 0x00, 0xfe, 0x1c, 0xeb, 0x02, 0xff, 0xff, 0x11, 0x02, 0x00, 0x03, 0xff, 0xfe, 0xa3, 0x33, 0x02, 0x07, 0xfe, 0x33, 0xdd, 0x02, 0xff, 0xfe, 0xf7, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x07, 0xb5, 0x03, 0xff, 0xff, 0x79, 0x04, 0x00, 0xff, 0xa3, 0x02, 0xff, 0xff, 0x8f, 0x05, 0x00, 0xff, 0xa3, 0x02, 0xff, 0xfd, 0x58, 0x00, 0xa3, 0x02, 0xff, 0xff, 0x8f, 0x05, 0x00, 0xff, 0xa3, 0x02, 0xff, 0xff, 0x58, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x58, 0x03, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x79, 0x05, 0x00, 0xff, 0xdd, 0x02, 0xff, 0xff, 0x33, 0x05, 0x00, 0xff, 0x79, 0x02, 0xff, 0xfd, 0x8f, 0x00, 0xdd, 0x02, 0xff, 0xff, 0x33, 0x05, 0x00, 0xff, 0x79, 0x02, 0xff, 0xff, 0x8f, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x1c, 0x03, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x79, 0x06, 0x00, 0x0c, 0xff, 0xfe, 0xb5, 0x00, 0x0c, 0xff, 0xff, 0xb5, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x07, 0x03, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x79, 0x06, 0x00, 0x0c, 0xff, 0xfe, 0xa3, 0x00, 0x0c, 0xff, 0xff, 0xa3, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x07, 0x03, 0xff, 0xff, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x8f, 0x03, 0xff, 0xff, 0x79, 0x05, 0x00, 0xfd, 0xe2, 0xff, 0xf7, 0x0b, 0x00, 0xfd, 0xe2, 0xff, 0xf7, 0x0c, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x1c, 0x03, 0xff, 0xff, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x07, 0xb5, 0x03, 0xff, 0xff, 0x79, 0x04, 0x00, 0xff, 0xb5, 0x02, 0xff, 0xff, 0x11, 0x0a, 0x00, 0xff, 0xb5, 0x02, 0xff, 0xff, 0x11, 0x0b, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x58, 0x03, 0xff, 0xff, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xff, 0x79, 0x03, 0x00, 0xff, 0x79, 0x02, 0xff, 0xff, 0x8f, 0x04, 0x00, 0xfc, 0x07, 0x58, 0x8f, 0x11, 0x02, 0x00, 0xff, 0x79, 0x02, 0xff, 0xff, 0x8f, 0x04, 0x00, 0xfc, 0x07, 0x58, 0x8f, 0x11, 0x03, 0x00, 0x03, 0xff, 0xfe, 0xa3, 0x33, 0x02, 0x07, 0xfe, 0x33, 0xdd, 0x02, 0xff, 0xfe, 0xf7, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x11, 0xdd, 0x04, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xeb, 0x02, 0xff, 0xfb, 0xdd, 0xa3, 0x8f, 0xb5, 0xe2, 0x02, 0xff, 0xff, 0x8f, 0x02, 0x00, 0xfe, 0x07, 0xeb, 0x02, 0xff, 0xfb, 0xdd, 0xa3, 0x8f, 0xb5, 0xe2, 0x02, 0xff, 0xff, 0x8f, 0x03, 0x00, 0x0b, 0xff, 0xfe, 0xb5, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x1c, 0xeb, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x33, 0xf7, 0x08, 0xff, 0xff, 0xa3, 0x03, 0x00, 0xfe, 0x33, 0xf7, 0x08, 0xff, 0xff, 0xa3, 0x03, 0x00, 0x03, 0xff, 0xff, 0xdd, 0x06, 0xff, 0xfd, 0xdd, 0x1c, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x33, 0xf7, 0x02, 0xff, 0x04, 0x00, 0xf7, 0x1c, 0xa3, 0xe2, 0xff, 0xf7, 0xe2, 0xb5, 0x8f, 0x33, 0x05, 0x00, 0xf7, 0x1c, 0xa3, 0xe2, 0xff, 0xf7, 0xe2, 0xb5, 0x8f, 0x33, 0x04, 0x00, 0x03, 0xff, 0xf8, 0x11, 0x8f, 0xdd, 0xff, 0xeb, 0xb5, 0x79, 0x07, 0x02, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x33, 0xf7, 0x02, 0xff, 0x04, 0x00, 0xfd, 0x11, 0x8f, 0xe2, 0x03, 0xff, 0xfd, 0xdd, 0x79, 0x07, 0x02, 0x00, 0x05, 0xff, 0x04, 0x00, 0x05, 0xff, 0x02, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x1c, 0xeb, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x1c, 0xdd, 0x07, 0xff, 0xfd, 0xb5, 0x07, 0x00, 0x05, 0xff, 0x04, 0x00, 0x05, 0xff, 0x02, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x11, 0xdd, 0x04, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xfc, 0xb5, 0x8f, 0xa3, 0xeb, 0x02, 0xff, 0xff, 0x8f, 0x03, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x02, 0x00, 0x03, 0xff, 0x0a, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xff, 0x79, 0x03, 0x00, 0xff, 0x58, 0x02, 0xff, 0xfe, 0xf7, 0x33, 0x03, 0x00, 0xfe, 0x1c, 0xeb, 0x02, 0xff, 0xff, 0x11, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x07, 0xb5, 0x03, 0xff, 0xff, 0x79, 0x04, 0x00, 0xff, 0xa3, 0x02, 0xff, 0xff, 0x8f, 0x05, 0x00, 0xff, 0xa3, 0x02, 0xff, 0xff, 0x58, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x00, 0x08, 0xff, 0xff, 0x79, 0x05, 0x00, 0xff, 0xdd, 0x02, 0xff, 0xff, 0x33, 0x05, 0x00, 0xff, 0x79, 0x02, 0xff, 0xff, 0x8f, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x00, 0x07, 0xff, 0xff, 0x79, 0x06, 0x00, 0x0c, 0xff, 0xff, 0xb5, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x00, 0x07, 0xff, 0xff, 0x79, 0x06, 0x00, 0x0c, 0xff, 0xff, 0xa3, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x8f, 0x03, 0xff, 0xff, 0x79, 0x05, 0x00, 0xfd, 0xe2, 0xff, 0xf7, 0x0c, 0x00, 0x03, 0xff, 0xff, 0x07, 0x05, 0x00, 0x03, 0xff, 0x0f, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x07, 0xb5, 0x03, 0xff, 0xff, 0x79, 0x04, 0x00, 0xff, 0xb5, 0x02, 0xff, 0xff, 0x11, 0x0b, 0x00, 0xff, 0xeb, 0x02, 0xff, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x11, 0x03, 0xff, 0x0f, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xcd, 0x03, 0xff, 0xff, 0x79, 0x03, 0x00, 0xff, 0x79, 0x02, 0xff, 0xff, 0x8f, 0x04, 0x00, 0xfc, 0x07, 0x58, 0x8f, 0x11, 0x03, 0x00, 0xff, 0xb5, 0x02, 0xff, 0xff, 0x58, 0x03, 0x00, 0xfe, 0x07, 0xb5, 0x03, 0xff, 0x0f, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x11, 0xdd, 0x04, 0xff, 0x02, 0x00, 0xfe, 0x07, 0xeb, 0x02, 0xff, 0xfb, 0xdd, 0xa3, 0x8f, 0xb5, 0xe2, 0x02, 0xff, 0xff, 0x8f, 0x03, 0x00, 0xff, 0x79, 0x02, 0xff, 0xfb, 0xf7, 0xa3, 0x8f, 0xb5, 0xe2, 0x04, 0xff, 0x0f, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x1c, 0xeb, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x33, 0xf7, 0x08, 0xff, 0xff, 0xa3, 0x03, 0x00, 0xfe, 0x07, 0xdd, 0x06, 0xff, 0xff, 0x8f, 0x03, 0xff, 0x0f, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x33, 0xf7, 0x02, 0xff, 0x04, 0x00, 0xf7, 0x1c, 0xa3, 0xe2, 0xff, 0xf7, 0xe2, 0xb5, 0x8f, 0x33, 0x05, 0x00, 0xf8, 0x11, 0xa3, 0xe2, 0xff, 0xeb, 0xb5, 0x58, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x35, 0x00, 0x03, 0xff, 0x34, 0x00, 0xff, 0xe2, 0x03, 0xff, 0x34, 0x00, 0x03, 0xff, 0xff, 0xdd, 0x34, 0x00, 0xfc, 0xb5, 0xf7, 0xeb, 0x58, 0x7f, 0x00, 0x37, 0x00
+};
+static const Image logo_16_image = {logo_16_data, 56, 49};
 
 static const AnimationFrame logo_array[] =
 {
@@ -1839,29 +1201,21 @@ static const ImageAnimation logo_reversed = { 16, logo_reversed_array };
 
 /* --- Unplug Image -------------------------------------------------------- */
 
-static void unplug(uint8_t *data)
+static const uint8_t unplug_data[395] =
 {
-    const uint8_t image_data[395] =
-    {
-        0x2b, 0x00, 0xfe, 0xa5, 0x11, 0x2a, 0x00, 0xfd, 0x21, 0xd2, 0x4d, 0x29, 0x00, 0xfc, 0x21, 0xb7, 0xc6, 0x21, 0x26, 0x00, 0xfa, 0x03, 0x33, 0x88, 0xd2, 0xc6, 0x33, 0x1b, 0x00, 0xfb, 0x07, 0x6b, 0xc6, 0x4d, 0x03, 0x04, 0x00, 0xf7, 0x21, 0x6b, 0x88, 0xc6, 0xd2, 0xc6, 0x88, 0x11, 0x01, 0x18, 0x00, 0xfc, 0x11, 0x01, 0x4d, 0xb7, 0x02, 0xd2, 0xfe, 0xc6, 0x11, 0x02, 0x00, 0xfe, 0x33, 0x88, 0x02, 0xd2, 0xfc, 0xb7, 0x88, 0x4d, 0x07, 0x19, 0x00, 0xfc, 0x03, 0xa5, 0xd2, 0xa5, 0x05, 0xd2, 0xf9, 0x88, 0x07, 0x88, 0xd2, 0xc6, 0x6b, 0x21, 0x1d, 0x00, 0xfe, 0x03, 0xb7, 0x08, 0xd2, 0xfc, 0xb7, 0xd2, 0x6b, 0x07, 0x20, 0x00, 0xff, 0x33, 0x09, 0xd2, 0xfd, 0x4d, 0x00, 0x03, 0x20, 0x00, 0xfe, 0x01, 0x88, 0x08, 0xd2, 0xff, 0x4d, 0x1b, 0x00, 0xfe, 0x11, 0x07, 0x04, 0x00, 0xfd, 0x03, 0x6b, 0xc6, 0x08, 0xd2, 0xfe, 0xc6, 0x11, 0x18, 0x00, 0xfc, 0x01, 0x33, 0xd2, 0xa5, 0x03, 0x00, 0xfb, 0x4d, 0xb7, 0xd2, 0xa5, 0x88, 0x08, 0xd2, 0xff, 0x6b, 0x18, 0x00, 0xfe, 0x07, 0x6b, 0x02, 0xd2, 0xf7, 0x33, 0x00, 0x4d, 0xd2, 0xb7, 0x33, 0x00, 0x07, 0xb7, 0x08, 0xd2, 0xff, 0x21, 0x15, 0x00, 0xfd, 0x01, 0x4d, 0xb7, 0x04, 0xd2, 0xfd, 0x03, 0x07, 0x4d, 0x02, 0x03, 0xfd, 0x00, 0x11, 0x88, 0x07, 0xd2, 0xfe, 0xc6, 0x33, 0x14, 0x00, 0xfe, 0x21, 0xa5, 0x06, 0xd2, 0xff, 0x6b, 0x03, 0x00, 0xfb, 0x03, 0x4d, 0xc6, 0xd2, 0xc6, 0x05, 0xd2, 0xfe, 0x88, 0x11, 0x15, 0x00, 0xff, 0x88, 0x08, 0xd2, 0xf8, 0x07, 0x03, 0x21, 0xa5, 0xd2, 0xa5, 0x33, 0x21, 0x03, 0xd2, 0xfe, 0xa5, 0x33, 0x17, 0x00, 0xfe, 0x21, 0xc6, 0x07, 0xd2, 0xfa, 0x88, 0x03, 0x21, 0xb7, 0x4d, 0x01, 0x02, 0x00, 0xff, 0x88, 0x02, 0xd2, 0xff, 0x07, 0x19, 0x00, 0xff, 0x6b, 0x08, 0xd2, 0xfd, 0x21, 0x00, 0x01, 0x04, 0x00, 0xfd, 0x11, 0xb7, 0x4d, 0x19, 0x00, 0xfd, 0x01, 0x11, 0xb7, 0x07, 0xd2, 0xfe, 0xc6, 0x01, 0x23, 0x00, 0xff, 0x6b, 0x08, 0xd2, 0xff, 0x4d, 0x22, 0x00, 0xfe, 0x33, 0xc6, 0x09, 0xd2, 0xff, 0x03, 0x1f, 0x00, 0xfb, 0x21, 0x88, 0xd2, 0xb7, 0x4d, 0x08, 0xd2, 0xfe, 0x6b, 0x01, 0x1a, 0x00, 0xfc, 0x03, 0x33, 0x6b, 0xa5, 0x02, 0xd2, 0xfc, 0x6b, 0x03, 0x00, 0x88, 0x04, 0xd2, 0xfc, 0x88, 0x4d, 0x6b, 0x07, 0x17, 0x00, 0xfb, 0x03, 0x11, 0x4d, 0xa5, 0xc6, 0x02, 0xd2, 0xfd, 0xa5, 0x6b, 0x11, 0x03, 0x00, 0xfb, 0x11, 0xc6, 0xd2, 0xa5, 0x33, 0x1a, 0x00, 0xfe, 0x11, 0x88, 0x02, 0xd2, 0xfc, 0xa5, 0x6b, 0x4d, 0x11, 0x07, 0x00, 0xfe, 0x33, 0x4d, 0x1c, 0x00, 0xfc, 0x88, 0xd2, 0x6b, 0x21, 0x02, 0x03, 0x27, 0x00, 0xfe, 0x6b, 0x4d, 0x2b, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
+    0x2b, 0x00, 0xfe, 0xa5, 0x11, 0x2a, 0x00, 0xfd, 0x21, 0xd2, 0x4d, 0x29, 0x00, 0xfc, 0x21, 0xb7, 0xc6, 0x21, 0x26, 0x00, 0xfa, 0x03, 0x33, 0x88, 0xd2, 0xc6, 0x33, 0x1b, 0x00, 0xfb, 0x07, 0x6b, 0xc6, 0x4d, 0x03, 0x04, 0x00, 0xf7, 0x21, 0x6b, 0x88, 0xc6, 0xd2, 0xc6, 0x88, 0x11, 0x01, 0x18, 0x00, 0xfc, 0x11, 0x01, 0x4d, 0xb7, 0x02, 0xd2, 0xfe, 0xc6, 0x11, 0x02, 0x00, 0xfe, 0x33, 0x88, 0x02, 0xd2, 0xfc, 0xb7, 0x88, 0x4d, 0x07, 0x19, 0x00, 0xfc, 0x03, 0xa5, 0xd2, 0xa5, 0x05, 0xd2, 0xf9, 0x88, 0x07, 0x88, 0xd2, 0xc6, 0x6b, 0x21, 0x1d, 0x00, 0xfe, 0x03, 0xb7, 0x08, 0xd2, 0xfc, 0xb7, 0xd2, 0x6b, 0x07, 0x20, 0x00, 0xff, 0x33, 0x09, 0xd2, 0xfd, 0x4d, 0x00, 0x03, 0x20, 0x00, 0xfe, 0x01, 0x88, 0x08, 0xd2, 0xff, 0x4d, 0x1b, 0x00, 0xfe, 0x11, 0x07, 0x04, 0x00, 0xfd, 0x03, 0x6b, 0xc6, 0x08, 0xd2, 0xfe, 0xc6, 0x11, 0x18, 0x00, 0xfc, 0x01, 0x33, 0xd2, 0xa5, 0x03, 0x00, 0xfb, 0x4d, 0xb7, 0xd2, 0xa5, 0x88, 0x08, 0xd2, 0xff, 0x6b, 0x18, 0x00, 0xfe, 0x07, 0x6b, 0x02, 0xd2, 0xf7, 0x33, 0x00, 0x4d, 0xd2, 0xb7, 0x33, 0x00, 0x07, 0xb7, 0x08, 0xd2, 0xff, 0x21, 0x15, 0x00, 0xfd, 0x01, 0x4d, 0xb7, 0x04, 0xd2, 0xfd, 0x03, 0x07, 0x4d, 0x02, 0x03, 0xfd, 0x00, 0x11, 0x88, 0x07, 0xd2, 0xfe, 0xc6, 0x33, 0x14, 0x00, 0xfe, 0x21, 0xa5, 0x06, 0xd2, 0xff, 0x6b, 0x03, 0x00, 0xfb, 0x03, 0x4d, 0xc6, 0xd2, 0xc6, 0x05, 0xd2, 0xfe, 0x88, 0x11, 0x15, 0x00, 0xff, 0x88, 0x08, 0xd2, 0xf8, 0x07, 0x03, 0x21, 0xa5, 0xd2, 0xa5, 0x33, 0x21, 0x03, 0xd2, 0xfe, 0xa5, 0x33, 0x17, 0x00, 0xfe, 0x21, 0xc6, 0x07, 0xd2, 0xfa, 0x88, 0x03, 0x21, 0xb7, 0x4d, 0x01, 0x02, 0x00, 0xff, 0x88, 0x02, 0xd2, 0xff, 0x07, 0x19, 0x00, 0xff, 0x6b, 0x08, 0xd2, 0xfd, 0x21, 0x00, 0x01, 0x04, 0x00, 0xfd, 0x11, 0xb7, 0x4d, 0x19, 0x00, 0xfd, 0x01, 0x11, 0xb7, 0x07, 0xd2, 0xfe, 0xc6, 0x01, 0x23, 0x00, 0xff, 0x6b, 0x08, 0xd2, 0xff, 0x4d, 0x22, 0x00, 0xfe, 0x33, 0xc6, 0x09, 0xd2, 0xff, 0x03, 0x1f, 0x00, 0xfb, 0x21, 0x88, 0xd2, 0xb7, 0x4d, 0x08, 0xd2, 0xfe, 0x6b, 0x01, 0x1a, 0x00, 0xfc, 0x03, 0x33, 0x6b, 0xa5, 0x02, 0xd2, 0xfc, 0x6b, 0x03, 0x00, 0x88, 0x04, 0xd2, 0xfc, 0x88, 0x4d, 0x6b, 0x07, 0x17, 0x00, 0xfb, 0x03, 0x11, 0x4d, 0xa5, 0xc6, 0x02, 0xd2, 0xfd, 0xa5, 0x6b, 0x11, 0x03, 0x00, 0xfb, 0x11, 0xc6, 0xd2, 0xa5, 0x33, 0x1a, 0x00, 0xfe, 0x11, 0x88, 0x02, 0xd2, 0xfc, 0xa5, 0x6b, 0x4d, 0x11, 0x07, 0x00, 0xfe, 0x33, 0x4d, 0x1c, 0x00, 0xfc, 0x88, 0xd2, 0x6b, 0x21, 0x02, 0x03, 0x27, 0x00, 0xfe, 0x6b, 0x4d, 0x2b, 0x00
+};
 
-static const Image unplug_image = {(void *) &unplug, 45, 27};
+static const Image unplug_image = {unplug_data, 45, 27};
 
 /* --- Recovery Image ------------------------------------------------------ */
 
-static void recovery(uint8_t *data)
+static const uint8_t recovery_data[372] =
 {
-    const uint8_t image_data[372] =
-    {
-        0xff, 0xc2, 0x08, 0x00, 0xf5, 0x14, 0x6d, 0xb0, 0xd6, 0xf4, 0xff, 0xf4, 0xd6, 0xb0, 0x6d, 0x14, 0x09, 0x00, 0xfe, 0xff, 0xc2, 0x05, 0x00, 0xfd, 0x29, 0xb0, 0xfd, 0x09, 0xff, 0xfd, 0xfd, 0xb0, 0x29, 0x07, 0x00, 0x02, 0xff, 0xff, 0xc2, 0x03, 0x00, 0xfe, 0x96, 0xfd, 0x0d, 0xff, 0xfe, 0xfd, 0x96, 0x06, 0x00, 0x03, 0xff, 0xfd, 0xc2, 0x14, 0xd6, 0x11, 0xff, 0xfe, 0xd6, 0x14, 0x04, 0x00, 0x04, 0xff, 0xff, 0xf4, 0x05, 0xff, 0xfd, 0xf4, 0xba, 0x7d, 0x03, 0x4e, 0xfd, 0x7d, 0xba, 0xf4, 0x05, 0xff, 0xfe, 0xe6, 0x14, 0x03, 0x00, 0x08, 0xff, 0xfd, 0xfd, 0x96, 0x29, 0x07, 0x00, 0xfd, 0x29, 0x96, 0xfd, 0x04, 0xff, 0xff, 0xd6, 0x03, 0x00, 0x07, 0xff, 0xfe, 0xe6, 0x4e, 0x0b, 0x00, 0xfe, 0x4e, 0xe6, 0x04, 0xff, 0xff, 0x96, 0x02, 0x00, 0x07, 0xff, 0xff, 0xc2, 0x0d, 0x00, 0xfe, 0x29, 0xe6, 0x03, 0xff, 0xfd, 0xfd, 0x29, 0x00, 0x08, 0xff, 0xff, 0xc2, 0x0d, 0x00, 0xfe, 0x4e, 0xfd, 0x03, 0xff, 0xfe, 0xb0, 0x00, 0x09, 0xff, 0xff, 0xc2, 0x0d, 0x00, 0xff, 0x96, 0x03, 0xff, 0xfe, 0xfd, 0x14, 0x0a, 0xff, 0xff, 0xc2, 0x0c, 0x00, 0xfe, 0x14, 0xf4, 0x03, 0xff, 0xff, 0x6d, 0x0b, 0xff, 0xff, 0xc2, 0x0c, 0x00, 0xff, 0xba, 0x03, 0xff, 0xff, 0xb0, 0x18, 0x00, 0xff, 0x7d, 0x03, 0xff, 0xff, 0xd6, 0x18, 0x00, 0xff, 0x4e, 0x03, 0xff, 0xff, 0xf4, 0x18, 0x00, 0xff, 0x4e, 0x04, 0xff, 0x18, 0x00, 0xff, 0x4e, 0x03, 0xff, 0xff, 0xf4, 0x18, 0x00, 0xff, 0x7d, 0x03, 0xff, 0xff, 0xd6, 0x18, 0x00, 0xff, 0xba, 0x03, 0xff, 0xff, 0xb0, 0x17, 0x00, 0xfe, 0x14, 0xf4, 0x03, 0xff, 0xff, 0x6d, 0x17, 0x00, 0xff, 0x96, 0x03, 0xff, 0xfe, 0xfd, 0x14, 0x16, 0x00, 0xfe, 0x4e, 0xfd, 0x03, 0xff, 0xff, 0xb0, 0x16, 0x00, 0xfe, 0x29, 0xe6, 0x03, 0xff, 0xfe, 0xfd, 0x29, 0x08, 0x00, 0xfe, 0x96, 0x4e, 0x0b, 0x00, 0xfe, 0x4e, 0xe6, 0x04, 0xff, 0xff, 0x96, 0x08, 0x00, 0xfb, 0xa2, 0xff, 0xfd, 0x96, 0x29, 0x07, 0x00, 0xfd, 0x29, 0x96, 0xfd, 0x04, 0xff, 0xff, 0xd6, 0x08, 0x00, 0xff, 0xa2, 0x04, 0xff, 0xfd, 0xf4, 0xba, 0x7d, 0x03, 0x4e, 0xfd, 0x7d, 0xba, 0xf4, 0x05, 0xff, 0xfe, 0xe6, 0x14, 0x07, 0x00, 0xfe, 0x14, 0xd6, 0x11, 0xff, 0xfe, 0xd6, 0x14, 0x0a, 0x00, 0xfe, 0x96, 0xfd, 0x0d, 0xff, 0xfe, 0xfd, 0x96, 0x0d, 0x00, 0xfd, 0x29, 0xb0, 0xfd, 0x09, 0xff, 0xfd, 0xfd, 0xb0, 0x29, 0x10, 0x00, 0xf5, 0x14, 0x6d, 0xb0, 0xd6, 0xf4, 0xff, 0xf4, 0xd6, 0xb0, 0x6d, 0x14, 0x09, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
+    0xff, 0xc2, 0x08, 0x00, 0xf5, 0x14, 0x6d, 0xb0, 0xd6, 0xf4, 0xff, 0xf4, 0xd6, 0xb0, 0x6d, 0x14, 0x09, 0x00, 0xfe, 0xff, 0xc2, 0x05, 0x00, 0xfd, 0x29, 0xb0, 0xfd, 0x09, 0xff, 0xfd, 0xfd, 0xb0, 0x29, 0x07, 0x00, 0x02, 0xff, 0xff, 0xc2, 0x03, 0x00, 0xfe, 0x96, 0xfd, 0x0d, 0xff, 0xfe, 0xfd, 0x96, 0x06, 0x00, 0x03, 0xff, 0xfd, 0xc2, 0x14, 0xd6, 0x11, 0xff, 0xfe, 0xd6, 0x14, 0x04, 0x00, 0x04, 0xff, 0xff, 0xf4, 0x05, 0xff, 0xfd, 0xf4, 0xba, 0x7d, 0x03, 0x4e, 0xfd, 0x7d, 0xba, 0xf4, 0x05, 0xff, 0xfe, 0xe6, 0x14, 0x03, 0x00, 0x08, 0xff, 0xfd, 0xfd, 0x96, 0x29, 0x07, 0x00, 0xfd, 0x29, 0x96, 0xfd, 0x04, 0xff, 0xff, 0xd6, 0x03, 0x00, 0x07, 0xff, 0xfe, 0xe6, 0x4e, 0x0b, 0x00, 0xfe, 0x4e, 0xe6, 0x04, 0xff, 0xff, 0x96, 0x02, 0x00, 0x07, 0xff, 0xff, 0xc2, 0x0d, 0x00, 0xfe, 0x29, 0xe6, 0x03, 0xff, 0xfd, 0xfd, 0x29, 0x00, 0x08, 0xff, 0xff, 0xc2, 0x0d, 0x00, 0xfe, 0x4e, 0xfd, 0x03, 0xff, 0xfe, 0xb0, 0x00, 0x09, 0xff, 0xff, 0xc2, 0x0d, 0x00, 0xff, 0x96, 0x03, 0xff, 0xfe, 0xfd, 0x14, 0x0a, 0xff, 0xff, 0xc2, 0x0c, 0x00, 0xfe, 0x14, 0xf4, 0x03, 0xff, 0xff, 0x6d, 0x0b, 0xff, 0xff, 0xc2, 0x0c, 0x00, 0xff, 0xba, 0x03, 0xff, 0xff, 0xb0, 0x18, 0x00, 0xff, 0x7d, 0x03, 0xff, 0xff, 0xd6, 0x18, 0x00, 0xff, 0x4e, 0x03, 0xff, 0xff, 0xf4, 0x18, 0x00, 0xff, 0x4e, 0x04, 0xff, 0x18, 0x00, 0xff, 0x4e, 0x03, 0xff, 0xff, 0xf4, 0x18, 0x00, 0xff, 0x7d, 0x03, 0xff, 0xff, 0xd6, 0x18, 0x00, 0xff, 0xba, 0x03, 0xff, 0xff, 0xb0, 0x17, 0x00, 0xfe, 0x14, 0xf4, 0x03, 0xff, 0xff, 0x6d, 0x17, 0x00, 0xff, 0x96, 0x03, 0xff, 0xfe, 0xfd, 0x14, 0x16, 0x00, 0xfe, 0x4e, 0xfd, 0x03, 0xff, 0xff, 0xb0, 0x16, 0x00, 0xfe, 0x29, 0xe6, 0x03, 0xff, 0xfe, 0xfd, 0x29, 0x08, 0x00, 0xfe, 0x96, 0x4e, 0x0b, 0x00, 0xfe, 0x4e, 0xe6, 0x04, 0xff, 0xff, 0x96, 0x08, 0x00, 0xfb, 0xa2, 0xff, 0xfd, 0x96, 0x29, 0x07, 0x00, 0xfd, 0x29, 0x96, 0xfd, 0x04, 0xff, 0xff, 0xd6, 0x08, 0x00, 0xff, 0xa2, 0x04, 0xff, 0xfd, 0xf4, 0xba, 0x7d, 0x03, 0x4e, 0xfd, 0x7d, 0xba, 0xf4, 0x05, 0xff, 0xfe, 0xe6, 0x14, 0x07, 0x00, 0xfe, 0x14, 0xd6, 0x11, 0xff, 0xfe, 0xd6, 0x14, 0x0a, 0x00, 0xfe, 0x96, 0xfd, 0x0d, 0xff, 0xfe, 0xfd, 0x96, 0x0d, 0x00, 0xfd, 0x29, 0xb0, 0xfd, 0x09, 0xff, 0xfd, 0xfd, 0xb0, 0x29, 0x10, 0x00, 0xf5, 0x14, 0x6d, 0xb0, 0xd6, 0xf4, 0xff, 0xf4, 0xd6, 0xb0, 0x6d, 0x14, 0x09, 0x00
+};
 
-static const Image recovery_image = {(void *) &recovery, 29, 29};
+static const Image recovery_image = {recovery_data, 29, 29};
 
 /* === Functions =========================================================== */
 
@@ -0,0 +1,182 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* === Includes ============================================================ */
+
+#include <string.h>
+
+#include "text_layout.h"
+
+/* === Private Variables =================================================== */
+
+/*
+ * Confirm screens lay out the same title and body again on every button
+ * press and release, so recent layouts are kept along with a copy of the
+ * string they were computed for.
+ */
+static TextLayout layout_cache[TEXT_LAYOUT_CACHE_SIZE];
+static int next_victim = 0;
+
+/* === Private Functions =================================================== */
+
+/*
+ * char_width() - Width of a character, 0 when not in the font
+ *
+ * INPUT
+ *     - font: pointer to font structure
+ *     - c: character
+ * OUTPUT
+ *     character width
+ */
+static int char_width(const Font *font, char c)
+{
+    const CharacterImage *img = font_get_char(font, c);
+
+    return (img != NULL) ? img->width : 0;
+}
+
+/*
+ * text_layout_break() - Compute line breaks, words are wrapped at spaces and
+ * split only when wider than a line
+ *
+ * INPUT
+ *     - layout: layout to fill
+ *     - font: pointer to font structure
+ *     - str: string to lay out
+ *     - width: wrap width, 0 for no wrapping
+ * OUTPUT
+ *     none
+ */
+static void text_layout_break(TextLayout *layout, const Font *font, const char *str,
+                              int width)
+{
+    TextRun *run = NULL;
+    uint16_t line = 0;
+    int x_offset = 0;
+    int i;
+
+    layout->font = font;
+    layout->width = width;
+    layout->run_count = 0;
+
+    for(i = 0; str[i] != '\0'; i++)
+    {
+        int character_width, word_width;
+
+        /* Allow line breaks */
+        if(str[i] == '\n')
+        {
+            line++;
+            x_offset = 0;
+            run = NULL;
+            continue;
+        }
+
+        character_width = char_width(font, str[i]);
+        word_width = character_width;
+
+        /* Break before a space if the word after it does not fit */
+        if(str[i] == ' ')
+        {
+            int j;
+
+            for(j = i + 1; str[j] != '\0' && str[j] != ' ' && str[j] != '\n'; j++)
+            {
+                word_width += char_width(font, str[j]);
+            }
+        }
+
+        if((width != 0) && (x_offset + word_width > width))
+        {
+            line++;
+            x_offset = 0;
+            run = NULL;
+        }
+
+        /* Remove spaces from beginning of line */
+        if(x_offset == 0 && str[i] == ' ')
+        {
+            continue;
+        }
+
+        if(run == NULL && layout->run_count < TEXT_LAYOUT_MAX_RUNS)
+        {
+            run = &layout->runs[ layout->run_count++ ];
+            run->start = i;
+            run->length = 0;
+            run->line = line;
+        }
+
+        if(run != NULL)
+        {
+            run->length++;
+        }
+
+        x_offset += character_width;
+    }
+
+    layout->line_count = line + 1;
+}
+
+/* === Functions =========================================================== */
+
+/*
+ * text_layout() - Get the line breaks of a string, from cache when the same
+ * string was laid out before with the same font and width
+ *
+ * INPUT
+ *     - font: pointer to font structure
+ *     - str: string to lay out
+ *     - width: wrap width, 0 for no wrapping
+ * OUTPUT
+ *     layout, valid until the next call
+ */
+const TextLayout *text_layout(const Font *font, const char *str, int width)
+{
+    size_t len = strlen(str);
+    TextLayout *layout;
+    int i;
+
+    for(i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++)
+    {
+        layout = &layout_cache[ i ];
+
+        if(layout->cached && layout->font == font && layout->width == width &&
+                layout->str_len == len && memcmp(layout->str, str, len) == 0)
+        {
+            return layout;
+        }
+    }
+
+    layout = &layout_cache[ next_victim ];
+    next_victim = (next_victim + 1) % TEXT_LAYOUT_CACHE_SIZE;
+
+    text_layout_break(layout, font, str, width);
+
+    /* Strings too long to keep a copy of are laid out every time */
+    layout->cached = (len < TEXT_LAYOUT_MAX_CHARS);
+
+    if(layout->cached)
+    {
+        layout->str_len = len;
+        memcpy(layout->str, str, len);
+    }
+
+    return layout;
+}
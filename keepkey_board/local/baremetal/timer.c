@@ -25,6 +25,7 @@
 #include <libopencm3/stm32/f2/nvic.h>
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/cm3/cortex.h>
+#include <libopencm3/cm3/scb.h>
 
 #include "keepkey_leds.h"
 #include "timer.h"
@@ -32,133 +33,246 @@
 /* === Private Variables =================================================== */
 
 static volatile uint32_t remaining_delay;
+static volatile uint32_t clock_ms = 0;
+
+/*
+ * Runnables live in a hierarchical timer wheel indexed by expiry time.
+ * tim4_isr() only moves expired runnables to the ready list; they are run by
+ * run_runnables() from PendSV at the lowest interrupt priority, so long
+ * runnables never hold off the timer, USB, button or display interrupts.
+ * Runnables therefore stay asynchronous to thread code: they preempt it at
+ * any point, and must not share state with it unless one side masks
+ * interrupts around the access.
+ */
 static RunnableNode runnables[MAX_RUNNABLES];
-static RunnableQueue free_queue = {NULL, 0};
-static RunnableQueue active_queue = {NULL, 0};
+static RunnableNode *wheel[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+static RunnableNode *ready_list = NULL;
 
 /* === Private Functions =================================================== */
 
 /*
- * runnable_queue_peek() - Get pointer to head node in task manager (queue)
+ * runnable_list_insert() - Link node at the head of a list
  *
  * INPUT
- *     - queue: head pointer to linklist (queue)
+ *     - head: list head
+ *     - node: node to link
  * OUTPUT
- *     head node in the queue
+ *     none
  */
-static RunnableNode *runnable_queue_peek(RunnableQueue *queue)
+static void runnable_list_insert(RunnableNode **head, RunnableNode *node)
 {
-    return(queue->head);
+    node->next = *head;
+
+    if(node->next != NULL)
+    {
+        node->next->prev_next = &node->next;
+    }
+
+    *head = node;
+    node->prev_next = head;
 }
 
 /*
- * runnable_queue_get() - Get the pointer to node that contains the
- * callback function (task)
+ * runnable_list_remove() - Unlink node from whichever list it is on
  *
  * INPUT
- *     - queue: head pointer to linklist (queue)
- *     - callback: task function
+ *     - node: node to unlink
  * OUTPUT
- *     pointer to a node containing the requested task function
+ *     none
  */
-static RunnableNode *runnable_queue_get(RunnableQueue *queue, Runnable callback)
+static void runnable_list_remove(RunnableNode *node)
 {
-    RunnableNode *current = queue->head;
-    RunnableNode *result = NULL;
-
-    /* check queue is empty */
-    if(current != NULL)
+    if(node->prev_next != NULL)
     {
-        if(current->runnable == callback)
+        *node->prev_next = node->next;
+
+        if(node->next != NULL)
         {
-            result = current;
-            queue->head = current->next;
+            node->next->prev_next = node->prev_next;
         }
-        else
-        {
-            /* search through the linklist for node that contains the runnable
-               callback function */
-            RunnableNode *previous = current;
-            current = current->next;
+    }
 
-            while((current != NULL) && (result == NULL))
-            {
-                // Found the node!
-                if(current->runnable == callback)
-                {
-                    result = current;
-                    previous->next = current->next;
-                    result->next = NULL;
-                }
-
-                previous = current;
-                current = current->next;
-            }
+    node->next = NULL;
+    node->prev_next = NULL;
+}
+
+/*
+ * runnable_wheel_insert() - Put node in the wheel slot for its expiry time.
+ * Called with interrupts disabled.
+ *
+ * INPUT
+ *     - node: node with expires set
+ * OUTPUT
+ *     none
+ */
+static void runnable_wheel_insert(RunnableNode *node)
+{
+    uint32_t delta = node->expires - clock_ms;
+    int level = 0;
+
+    while((level < TIMER_WHEEL_LEVELS - 1) &&
+            (delta >= (1UL << (TIMER_WHEEL_BITS * (level + 1)))))
+    {
+        level++;
+    }
+
+    runnable_list_insert(
+        &wheel[ level ][ (node->expires >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK ],
+        node);
+    node->state = RUNNABLE_PENDING;
+}
+
+/*
+ * runnable_wheel_cascade() - Redistribute a slot of an upper wheel into the
+ * wheels below it
+ *
+ * INPUT
+ *     - slot: slot head
+ * OUTPUT
+ *     none
+ */
+static void runnable_wheel_cascade(RunnableNode **slot)
+{
+    while(*slot != NULL)
+    {
+        RunnableNode *node = *slot;
+
+        runnable_list_remove(node);
+        runnable_wheel_insert(node);
+    }
+}
+
+/*
+ * runnable_wheel_tick() - Advance the wheel by one millisecond and make the
+ * runnables expiring now ready
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+static void runnable_wheel_tick(void)
+{
+    uint32_t now = ++clock_ms;
+    int level;
+
+    /* Cascade upper wheels, outermost first, as the wheels below wrap */
+    for(level = TIMER_WHEEL_LEVELS - 1; level > 0; level--)
+    {
+        if((now & ((1UL << (TIMER_WHEEL_BITS * level)) - 1)) == 0)
+        {
+            runnable_wheel_cascade(
+                &wheel[ level ][ (now >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK ]);
         }
     }
 
-    if(result != NULL)
+    RunnableNode **slot = &wheel[ 0 ][ now & TIMER_WHEEL_MASK ];
+
+    while(*slot != NULL)
     {
-        queue->size -= 1;
+        RunnableNode *node = *slot;
+
+        runnable_list_remove(node);
+        runnable_list_insert(&ready_list, node);
+        node->state = RUNNABLE_READY;
     }
 
-    return(result);
+    if(ready_list != NULL)
+    {
+        SCB_ICSR = SCB_ICSR_PENDSVSET;
+    }
 }
 
 /*
- * runnable_queue_push() - Push node to the task manger (queue)
+ * runnable_find() - Find the node scheduled for a callback
  *
  * INPUT
- *     - queue: head pointer to the queue
- *     - node: pointer to a new node to be added
+ *     - callback: task function
  * OUTPUT
- *     none
+ *     node, NULL when callback is not scheduled
  */
-static void runnable_queue_push(RunnableQueue *queue, RunnableNode *node)
+static RunnableNode *runnable_find(Runnable callback)
 {
-    cm_disable_interrupts();
+    int i;
 
-    if(queue->head != NULL)
+    for(i = 0; i < MAX_RUNNABLES; i++)
     {
-        node->next = queue->head;
+        if((runnables[ i ].state != RUNNABLE_FREE) && (runnables[ i ].runnable == callback))
+        {
+            return(&runnables[ i ]);
+        }
     }
-    else
+
+    return(NULL);
+}
+
+/*
+ * runnable_alloc() - Get a free node from the pool
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     node, NULL when the pool is exhausted
+ */
+static RunnableNode *runnable_alloc(void)
+{
+    int i;
+
+    for(i = 0; i < MAX_RUNNABLES; i++)
     {
-        node->next = NULL;
+        if(runnables[ i ].state == RUNNABLE_FREE)
+        {
+            return(&runnables[ i ]);
+        }
     }
 
-    queue->head = node;
-    queue->size += 1;
-    cm_enable_interrupts();
+    return(NULL);
 }
 
 /*
- * runnable_queue_pop() - Pop node from task manager (queue)
+ * post_runnable() - Schedule callback, replacing an earlier schedule of it
  *
  * INPUT
- *     - queue: head pointer to task manager
+ *     - callback: task function
+ *     - context: pointer to task arguments
+ *     - delay_ms: delay before task runs
+ *     - period_ms: repeat interval, 0 to run once
  * OUTPUT
- *     pointer to an available node retrieved from the queue
+ *     none
  */
-static RunnableNode *runnable_queue_pop(RunnableQueue *queue)
+static void post_runnable(Runnable callback, void *context, uint32_t delay_ms,
+                          uint32_t period_ms)
 {
     cm_disable_interrupts();
 
-    RunnableNode *runnable_node = queue->head;
+    RunnableNode *runnable_node = runnable_find(callback);
+
+    if(runnable_node == NULL)
+    {
+        runnable_node = runnable_alloc();
+    }
 
     if(runnable_node != NULL)
     {
-        queue->head = runnable_node->next;
-        queue->size -= 1;
+        runnable_list_remove(runnable_node);
+
+        delay_ms = (delay_ms == 0) ? 1 : delay_ms;
+        delay_ms = (delay_ms > TIMER_WHEEL_MAX_MS) ? TIMER_WHEEL_MAX_MS : delay_ms;
+        period_ms = (period_ms > TIMER_WHEEL_MAX_MS) ? TIMER_WHEEL_MAX_MS : period_ms;
+
+        runnable_node->runnable     = callback;
+        runnable_node->context      = context;
+        runnable_node->period       = period_ms;
+        runnable_node->expires      = clock_ms + delay_ms;
+        runnable_wheel_insert(runnable_node);
     }
 
     cm_enable_interrupts();
-
-    return(runnable_node);
 }
 
 /*
- * run_runnables() - Run task (callback function) located in task manager (queue)
+ * run_runnables() - Run expired tasks (callback functions).  Periodic tasks
+ * are rescheduled unless they were removed or reposted while running.
  *
  * INPUT
  *     none
@@ -167,39 +281,34 @@ static RunnableNode *runnable_queue_pop(RunnableQueue *queue)
  */
 static void run_runnables(void)
 {
-    // Do timer function work.
-    RunnableNode *runnable_node = runnable_queue_peek(&active_queue);
+    cm_disable_interrupts();
 
-    while(runnable_node != NULL)
+    while(ready_list != NULL)
     {
-        RunnableNode *next = runnable_node->next;
+        RunnableNode *runnable_node = ready_list;
 
-        if(runnable_node->remaining != 0)
-        {
-            runnable_node->remaining -= 1;
-        }
+        runnable_list_remove(runnable_node);
+        runnable_node->state = RUNNABLE_RUNNING;
 
-        if(runnable_node->remaining == 0)
-        {
-            if(runnable_node->runnable != NULL)
-            {
-                runnable_node->runnable(runnable_node->context);
-            }
+        cm_enable_interrupts();
+        runnable_node->runnable(runnable_node->context);
+        cm_disable_interrupts();
 
-            if(runnable_node->repeating)
+        if(runnable_node->state == RUNNABLE_RUNNING)
+        {
+            if(runnable_node->period != 0)
             {
-                runnable_node->remaining = runnable_node->period;
+                runnable_node->expires = clock_ms + runnable_node->period;
+                runnable_wheel_insert(runnable_node);
             }
             else
             {
-                runnable_queue_push(
-                    &free_queue,
-                    runnable_queue_get(&active_queue, runnable_node->runnable));
+                runnable_node->state = RUNNABLE_FREE;
             }
         }
-
-        runnable_node = next;
     }
+
+    cm_enable_interrupts();
 }
 
 /* === Functions =========================================================== */
@@ -214,12 +323,8 @@ static void run_runnables(void)
  */
 void timer_init(void)
 {
-    int i;
-
-    for(i = 0; i < MAX_RUNNABLES; i++)
-    {
-        runnable_queue_push(&free_queue, &runnables[ i ]);
-    }
+    /* Runnables run below every other interrupt */
+    nvic_set_priority(NVIC_PENDSV_IRQ, 0xFF);
 
     // Set up the timer.
     timer_reset(TIM4);
@@ -312,12 +417,53 @@ void tim4_isr(void)
         remaining_delay--;
     }
 
-    run_runnables();
+    runnable_wheel_tick();
     timer_clear_flag(TIM4, TIM_SR_UIF);
 }
 
 /*
- * post_delayed() - Add delay to existing task (callback function) in task manager (queue)
+ * get_clock_ms() - Milliseconds since timer_init(), wraps every ~49 days
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     millisecond count
+ */
+uint32_t get_clock_ms(void)
+{
+    return(clock_ms);
+}
+
+/*
+ * wait_for_interrupt() - Sleep until the next interrupt.  The 1 ms timer
+ * tick bounds the sleep.
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void wait_for_interrupt(void)
+{
+    __asm__ volatile("wfi");
+}
+
+/*
+ * pend_sv_handler() - PendSV exception, pended by the timer tick when
+ * runnables expire
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void pend_sv_handler(void)
+{
+    run_runnables();
+}
+
+/*
+ * post_delayed() - Schedule task (callback function) to run once after a delay
  *
  * INPUT
  *     - callback: task function
@@ -328,23 +474,11 @@ void tim4_isr(void)
  */
 void post_delayed(Runnable callback, void *context, uint32_t delay_ms)
 {
-    RunnableNode *runnable_node = runnable_queue_get(&active_queue, callback);
-
-    if(runnable_node == NULL)
-    {
-        runnable_node = runnable_queue_pop(&free_queue);
-    }
-
-    runnable_node->runnable     = callback;
-    runnable_node->context      = context;
-    runnable_node->remaining    = delay_ms;
-    runnable_node->period       = 0;
-    runnable_node->repeating    = false;
-    runnable_queue_push(&active_queue, runnable_node);
+    post_runnable(callback, context, delay_ms, 0);
 }
 
 /*
- * post_periodic() - Add repeat and delay to existing task (callback function) in task manager (queue)
+ * post_periodic() - Schedule task (callback function) to repeat
  *
  * INPUT
  *     - callback: task function
@@ -357,24 +491,11 @@ void post_delayed(Runnable callback, void *context, uint32_t delay_ms)
 void post_periodic(Runnable callback, void *context, uint32_t period_ms,
                    uint32_t delay_ms)
 {
-    RunnableNode *runnable_node = runnable_queue_get(&active_queue, callback);
-
-    if(runnable_node == NULL)
-    {
-        runnable_node = runnable_queue_pop(&free_queue);
-    }
-
-    runnable_node->runnable     = callback;
-    runnable_node->context      = context;
-    runnable_node->remaining    = delay_ms;
-    runnable_node->period       = period_ms;
-    runnable_node->repeating    = true;
-
-    runnable_queue_push(&active_queue, runnable_node);
+    post_runnable(callback, context, delay_ms, (period_ms == 0) ? 1 : period_ms);
 }
 
 /*
- * remove_runnable() - Remove task from the task manager (queue)
+ * remove_runnable() - Remove task from the task manager
  *
  * INPUT
  *     - callback: task function
@@ -383,16 +504,21 @@ void post_periodic(Runnable callback, void *context, uint32_t period_ms,
  */
 void remove_runnable(Runnable callback)
 {
-    RunnableNode *runnable_node = runnable_queue_get(&active_queue, callback);
+    cm_disable_interrupts();
+
+    RunnableNode *runnable_node = runnable_find(callback);
 
     if(runnable_node != NULL)
     {
-        runnable_queue_push(&free_queue, runnable_node);
+        runnable_list_remove(runnable_node);
+        runnable_node->state = RUNNABLE_FREE;
     }
+
+    cm_enable_interrupts();
 }
 
 /*
- * clear_runnables() - Reset free_queue and active_queue to initial state
+ * clear_runnables() - Remove all tasks from the task manager
  *
  * INPUT
  *     none
@@ -401,11 +527,15 @@ void remove_runnable(Runnable callback)
  */
 void clear_runnables(void)
 {
-    RunnableNode *runnable_node = runnable_queue_pop(&active_queue);
+    int i;
 
-    while(runnable_node != NULL)
+    cm_disable_interrupts();
+
+    for(i = 0; i < MAX_RUNNABLES; i++)
     {
-        runnable_queue_push(&free_queue, runnable_node);
-        runnable_node = runnable_queue_pop(&active_queue);
+        runnable_list_remove(&runnables[ i ]);
+        runnables[ i ].state = RUNNABLE_FREE;
     }
+
+    cm_enable_interrupts();
 }
@@ -29,6 +29,8 @@
 #include <libopencm3/stm32/desig.h>
 #include <libopencm3/usb/hid.h>
 #include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/otg_fs.h>
+#include <libopencm3/stm32/f2/nvic.h>
 
 #include "keepkey_board.h"
 
@@ -241,6 +243,20 @@ static const char *usb_strings[] = {
 	""
 };
 
+/*
+ * Receive queue filled from the endpoint callbacks, which run in otg_fs_isr(),
+ * and drained by usb_poll() in thread context.  The core is serviced from the
+ * interrupt so the host is answered even while a handler runs long crypto.
+ * When the queue is full the OUT endpoints are NAKed so the host holds
+ * further packets instead of them being dropped.  Thread code touches the
+ * queue and the core only with the OTG interrupt masked.
+ */
+static UsbRxPacket usb_rx_queue[USB_RX_QUEUE_DEPTH];
+static uint32_t usb_rx_head = 0;
+static uint32_t usb_rx_tail = 0;
+static volatile uint32_t usb_rx_count = 0;
+static bool usb_rx_naking = false;
+
 /* === Variables =========================================================== */
 
 /* This optional callback is configured by the user to handle receive events.  */
@@ -270,7 +286,143 @@ static int hid_control_request(usbd_device *dev, struct usb_setup_data *req, uin
 }
 
 /*
- * hid_rx_callback() - Callback function to process received packet from USB host
+ * usb_rx_set_nak() - Force NAK on (or release) the OUT endpoints
+ *
+ * INPUT
+ *     - dev: pointer to USB device handler
+ *     - nak: true to hold off the host, false to accept packets again
+ * OUTPUT
+ *     none
+ */
+static void usb_rx_set_nak(usbd_device *dev, bool nak)
+{
+    usbd_ep_nak_set(dev, ENDPOINT_ADDRESS_OUT, nak);
+#if DEBUG_LINK
+    usbd_ep_nak_set(dev, ENDPOINT_ADDRESS_DEBUG_OUT, nak);
+#endif
+    usb_rx_naking = nak;
+}
+
+/*
+ * usb_rx_enqueue() - Read a packet from an OUT endpoint into the receive queue
+ *
+ * INPUT
+ *     - dev: pointer to USB device handler
+ *     - ep: OUT endpoint address to read from
+ * OUTPUT
+ *     none
+ */
+static void usb_rx_enqueue(usbd_device *dev, uint8_t ep)
+{
+    UsbRxPacket *slot;
+    uint16_t rx;
+
+    if(usb_rx_count >= USB_RX_QUEUE_DEPTH)
+    {
+        /* Should not happen while NAKing, but the FIFO still has to be popped */
+        uint8_t discard[USB_SEGMENT_SIZE];
+        usbd_ep_read_packet(dev, ep, discard, USB_SEGMENT_SIZE);
+        return;
+    }
+
+    /* Taking the last slot, so NAK before the read re-arms the endpoint */
+    if(usb_rx_count == USB_RX_QUEUE_DEPTH - 1)
+    {
+        usb_rx_set_nak(dev, true);
+    }
+
+    slot = &usb_rx_queue[usb_rx_head];
+    rx = usbd_ep_read_packet(dev, ep, slot->msg.message, USB_SEGMENT_SIZE);
+
+    if(rx)
+    {
+        slot->msg.len = rx;
+        slot->ep = ep;
+        usb_rx_head = (usb_rx_head + 1) % USB_RX_QUEUE_DEPTH;
+        usb_rx_count++;
+    }
+    else if(usb_rx_naking)
+    {
+        usb_rx_set_nak(dev, false);
+    }
+}
+
+/*
+ * usb_rx_dequeue() - Pop the oldest packet from the receive queue
+ *
+ * INPUT
+ *     - pkt: destination for the packet
+ * OUTPUT
+ *     true/false whether a packet was available
+ */
+static bool usb_rx_dequeue(UsbRxPacket *pkt)
+{
+    bool ret = false;
+
+    nvic_disable_irq(NVIC_OTG_FS_IRQ);
+
+    if(usb_rx_count != 0)
+    {
+        memcpy(pkt, &usb_rx_queue[usb_rx_tail], sizeof(UsbRxPacket));
+        usb_rx_tail = (usb_rx_tail + 1) % USB_RX_QUEUE_DEPTH;
+        usb_rx_count--;
+
+        /* Room again, let the host resume sending */
+        if(usb_rx_naking)
+        {
+            usb_rx_set_nak(usbd_dev, false);
+        }
+
+        ret = true;
+    }
+
+    nvic_enable_irq(NVIC_OTG_FS_IRQ);
+
+    return(ret);
+}
+
+/*
+ * usb_rx_dispatch() - Hand the oldest queued packet to its receive callback
+ *
+ * Runs in thread context so message handlers (which may block on
+ * confirmations or run long crypto) never execute inside the USB interrupt.
+ * Only one packet is dispatched per call so pollers waiting on a tiny
+ * message see each message in turn.
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+static void usb_rx_dispatch(void)
+{
+    UsbRxPacket pkt;
+
+    if(!usb_rx_dequeue(&pkt))
+    {
+        return;
+    }
+
+#if DEBUG_LINK
+    if(pkt.ep == ENDPOINT_ADDRESS_DEBUG_OUT)
+    {
+        if(user_debug_rx_callback)
+        {
+            user_debug_rx_callback(&pkt.msg);
+        }
+
+        return;
+    }
+#endif
+
+    if(user_rx_callback)
+    {
+        user_rx_callback(&pkt.msg);
+    }
+}
+
+/*
+ * hid_rx_callback() - Callback function to queue received packet from USB host
  *
  * INPUT 
  *     - dev: pointer to USB device handler
@@ -283,22 +435,11 @@ static void hid_rx_callback(usbd_device *dev, uint8_t ep)
 {
     (void)ep;
 
-    /* Receive into the message buffer. */
-    UsbMessage m;
-    uint16_t rx = usbd_ep_read_packet(dev, 
-                                      ENDPOINT_ADDRESS_OUT, 
-                                      m.message, 
-                                      USB_SEGMENT_SIZE);
-
-    if(rx && user_rx_callback)
-    {
-        m.len = rx;
-        user_rx_callback(&m);
-    }
+    usb_rx_enqueue(dev, ENDPOINT_ADDRESS_OUT);
 }
 
 /*
- * hid_debug_rx_callback() - Callback function to process received packet from USB host on debug endpoint
+ * hid_debug_rx_callback() - Callback function to queue received packet from USB host on debug endpoint
  *
  * INPUT
  *     - dev: pointer to USB device handler
@@ -312,18 +453,7 @@ static void hid_debug_rx_callback(usbd_device *dev, uint8_t ep)
 {
     (void)ep;
 
-    /* Receive into the message buffer. */
-    UsbMessage m;
-    uint16_t rx = usbd_ep_read_packet(dev,
-                                      ENDPOINT_ADDRESS_DEBUG_OUT,
-                                      m.message,
-                                      USB_SEGMENT_SIZE);
-
-    if(rx && user_debug_rx_callback)
-    {
-        m.len = rx;
-        user_debug_rx_callback(&m);
-    }
+    usb_rx_enqueue(dev, ENDPOINT_ADDRESS_DEBUG_OUT);
 }
 #endif
 
@@ -369,6 +499,7 @@ static void hid_set_config_callback(usbd_device *dev, uint16_t wValue)
 static bool usb_tx_helper(uint8_t *message, uint32_t len, uint8_t endpoint)
 {
     uint32_t pos = 1;
+    uint16_t written;
 
     /* Chunk out message */
     while(pos < len)
@@ -378,7 +509,18 @@ static bool usb_tx_helper(uint8_t *message, uint32_t len, uint8_t endpoint)
         tmp_buffer[0] = '?';
         memcpy(tmp_buffer + 1, message + pos, USB_SEGMENT_SIZE - 1);
 
-        while(usbd_ep_write_packet(usbd_dev, endpoint, tmp_buffer, USB_SEGMENT_SIZE) == 0) {};
+        /* The interrupt services the core, keep it out while writing the FIFO */
+        while(true)
+        {
+            nvic_disable_irq(NVIC_OTG_FS_IRQ);
+            written = usbd_ep_write_packet(usbd_dev, endpoint, tmp_buffer, USB_SEGMENT_SIZE);
+            nvic_enable_irq(NVIC_OTG_FS_IRQ);
+
+            if(written != 0)
+            {
+                break;
+            }
+        }
 
         pos += USB_SEGMENT_SIZE - 1;
     }
@@ -417,6 +559,10 @@ bool usb_init(void)
                          sizeof(usbd_control_buffer));
         if(usbd_dev != NULL) {
             usbd_register_set_config_callback(usbd_dev, hid_set_config_callback);
+
+            /* No SOF callback, so don't wake up for every 1 ms frame */
+            OTG_FS_GINTMSK &= ~OTG_FS_GINTMSK_SOFM;
+            nvic_enable_irq(NVIC_OTG_FS_IRQ);
         } else {
             /* error: unable init usbd_dev */
             ret_stat = false;
@@ -427,7 +573,7 @@ bool usb_init(void)
 }
 
 /*
- * usb_poll() - Poll USB port for message
+ * usb_poll() - Dispatch the oldest received packet, if any
  *  
  * INPUT
  *     none
@@ -436,6 +582,42 @@ bool usb_init(void)
  */
 void usb_poll(void)
 {
+    usb_rx_dispatch();
+}
+
+/*
+ * usb_event_pending() - Whether received packets are waiting for usb_poll().
+ * A message handler can return with packets left in the queue, and no
+ * interrupt will come for them.
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether usb_poll() has work
+ */
+bool usb_event_pending(void)
+{
+    return(usb_rx_count != 0);
+}
+
+/*
+ * otg_fs_isr() - USB OTG FS interrupt service routine.  Services the core,
+ * received packets are queued for usb_poll().
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void otg_fs_isr(void)
+{
+    /* Left enabled by a previous image before this one set up USB */
+    if(usbd_dev == NULL)
+    {
+        nvic_disable_irq(NVIC_OTG_FS_IRQ);
+        return;
+    }
+
     usbd_poll(usbd_dev);
 }
 
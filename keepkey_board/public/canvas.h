@@ -25,6 +25,11 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/* === Defines ============================================================= */
+
+/* Canvas pixels are packed 4 bits each, two per byte, left pixel in the high nibble */
+#define CANVAS_ROW_BYTES(canvas)	((canvas)->width / 2)
+
 /* === Typedefs ============================================================ */
 
 typedef struct
@@ -33,6 +38,11 @@ typedef struct
 	int 		height;
 	int 		width;
 	bool 		dirty;
+	/* Damaged region, valid when dirty: x0/y0 inclusive, x1/y1 exclusive */
+	int 		dirty_x0;
+	int 		dirty_y0;
+	int 		dirty_x1;
+	int 		dirty_y1;
 } Canvas;
 
 #endif
@@ -54,6 +54,8 @@ typedef struct
 
 /* === Functions =========================================================== */
 
+void draw_mark_dirty(Canvas *canvas, int x, int y, int width, int height);
+
 bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
                           int *x_shift, int *y_shift, const CharacterImage *img);
 void draw_string(Canvas *canvas, const Font *font, const char *c, DrawableParams *p,
@@ -65,6 +67,8 @@ void draw_char_simple(Canvas *canvas, const Font *font, char c, uint8_t color, i
 void draw_box(Canvas *canvas, BoxDrawableParams  *params);
 void draw_box_simple(Canvas *canvas, uint8_t color, int x, int y, int width, int height);
 bool draw_bitmap_mono_rle(Canvas *canvas, DrawableParams *p, const Image *img);
+bool draw_bitmap_mono_scaled(Canvas *canvas, DrawableParams *p, const uint8_t *bits,
+                             int width, int height, int scale);
 
 #endif
 
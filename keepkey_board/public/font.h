@@ -24,9 +24,16 @@
 
 #include <stdint.h>
 
+/* === Defines ============================================================= */
+
+#define GLYPH_ROW_BYTES(img)    (((img)->width + 7) / 8)
+
 /* === Typedefs ============================================================ */
 
-/* Data pertaining to the image of a character */
+/*
+ * Data pertaining to the image of a character.  Glyphs are 1 bpp, each row
+ * padded to whole bytes, most significant bit leftmost, set bits are ink.
+ */
 typedef struct
 {
     const uint8_t  *data;
@@ -43,7 +50,7 @@ typedef struct
 } Character;
 
 
-/* A complete font package. */
+/* A complete font package, characters sorted by consecutive code. */
 typedef struct
 {
     int                 length;
@@ -22,6 +22,8 @@
 
 /* === Includes ============================================================ */
 
+#include <stdbool.h>
+
 #include "canvas.h"
 
 /* === Defines ============================================================= */
@@ -32,14 +34,24 @@
 #define KEEPKEY_DISPLAY_HEIGHT  64
 #define KEEPKEY_DISPLAY_WIDTH   256
 
+/* Pixels per SSD1322 column address (4 bits/pixel, 2 bytes/column) */
+#define KEEPKEY_DISPLAY_COL_PIXELS  4
+
 #define DEFAULT_DISPLAY_BRIGHTNESS  100 /* Percent */
 
+/* GRAM streaming */
+#define DISPLAY_STREAM_CHUNK    64  /* Canvas bytes per DMA chunk */
+#define DISPLAY_STREAM_PHASES   3   /* Bus phases (BSRR words) per byte */
+#define DISPLAY_STREAM_PERIOD   16  /* TIM8 clocks per phase, 133 ns at 120 MHz */
+
 /* === Functions =========================================================== */
 
 void display_hw_init(void);
 Canvas *display_canvas_init(void);
 Canvas *display_canvas(void);
 void display_refresh(void);
+void display_wait(void);
+void display_wait_region(int x, int y, int width, int height);
 void display_set_brightness(int percentage);
 void display_turn_on(void);
 void display_turn_off(void);
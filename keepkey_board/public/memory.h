@@ -64,6 +64,30 @@
  0x0100 |  32K-256 B  |  persistent storage
 
  flags & 0x01 -> restore storage after flashing (if signatures are ok)
+ flags & 0x02 -> Merkle image, signatures are over the Merkle root of the code
+ flags & 0x04 -> delta image (Merkle images only), see below
+ flags & 0x08 -> code is heatshrink compressed (window 2^11, lookahead 2^4)
+
+ Merkle images:
+ --------------
+ The code is split into MERKLE_CHUNK_LEN chunks (the last one may be shorter).
+ Each leaf is SHA256(0x00 || chunk) and each node SHA256(0x01 || left || right).
+ A node without a sibling moves up a level unchanged.  When uploading, the
+ leaves follow the 256 byte meta area in the stream and precede the code.
+ They are not written to flash.
+
+ Delta images:
+ -------------
+ After the leaves comes a 32-bit little endian map of application sectors, bit 0
+ being the sector holding meta.  Only the code in sectors whose bit is set
+ follows, in order.  Code in the other sectors is kept from the installed image
+ and verified against the leaves like transmitted code.  Bit 0 must be set.
+
+ Compressed images:
+ ------------------
+ Everything after meta, leaves and sector map is one heatshrink stream that
+ decodes to the code that would otherwise have been sent.  Leaves and hashes
+ are over the decoded code.
  */
 
 /* === Defines ============================================================= */
@@ -128,6 +152,22 @@
 #define FLASH_APP_LEN           (FLASH_END - FLASH_APP_START)
 
 #define SIG_FLAG                (*( uint8_t const *)FLASH_META_FLAGS)
+#define META_FLAG_RESTORE       0x01
+#define META_FLAG_MERKLE        0x02
+#define META_FLAG_DELTA         0x04
+#define META_FLAG_COMPRESSED    0x08
+
+/* Merkle image */
+#define MERKLE_CHUNK_LEN        0x4000
+#define MERKLE_MAX_CHUNKS       ((FLASH_APP_LEN + MERKLE_CHUNK_LEN - 1) / MERKLE_CHUNK_LEN)
+#define MERKLE_LEAF_PREFIX      0x00
+#define MERKLE_NODE_PREFIX      0x01
+#define MERKLE_DIGEST_TAG       "KPKY-merkle-v1"    /* Signed: tag||codelen||flags||root */
+#define MERKLE_DIGEST_TAG_LEN   14
+
+/* Measured boot: bytes hashed per timer tick by memory_hash_runnable() */
+#define MEMORY_HASH_SLICE_LEN   512
+#define MEMORY_HASH_PERIOD      1
 
 /* Misc Info. */
 #define FLASH_BOOTSTRAP_SECTOR_FIRST 0
@@ -141,6 +181,7 @@
 
 #define FLASH_APP_SECTOR_FIRST  7
 #define FLASH_APP_SECTOR_LAST   11
+#define FLASH_APP_SECTORS       (FLASH_APP_SECTOR_LAST - FLASH_APP_SECTOR_FIRST + 1)
 
 #define STORAGE_SECT_DEFAULT FLASH_STORAGE1
 /* === Typedefs ============================================================ */
@@ -204,6 +245,7 @@ static const FlashSector flash_sector_map[] =
 /* === Functions =========================================================== */
 
 void memory_protect(void);
+void memory_hash_init(void);
 int memory_bootloader_hash(uint8_t *hash);
 int memory_firmware_hash(uint8_t *hash);
 int memory_storage_hash(uint8_t *hash, Allocation storage_location);
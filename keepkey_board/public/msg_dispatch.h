@@ -32,11 +32,18 @@
 #define MSG_TINY_BFR_SZ     64
 #define MSG_TINY_TYPE_ERROR 0xFFFF
 
-#define MSG_IN(ID, FIELDS, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = NORMAL_MSG, [ID].dir = IN_MSG, [ID].fields = FIELDS, [ID].dispatch = PARSABLE, [ID].process_func = PROCESS_FUNC,
-#define MSG_OUT(ID, FIELDS, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = NORMAL_MSG, [ID].dir = OUT_MSG, [ID].fields = FIELDS, [ID].dispatch = PARSABLE, [ID].process_func = PROCESS_FUNC,
-#define RAW_IN(ID, FIELDS, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = NORMAL_MSG, [ID].dir = IN_MSG, [ID].fields = FIELDS, [ID].dispatch = RAW, [ID].process_func = PROCESS_FUNC,
-#define DEBUG_IN(ID, FIELDS, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = DEBUG_MSG, [ID].dir = IN_MSG, [ID].fields = FIELDS, [ID].dispatch = PARSABLE, [ID].process_func = PROCESS_FUNC,
-#define DEBUG_OUT(ID, FIELDS, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = DEBUG_MSG, [ID].dir = OUT_MSG, [ID].fields = FIELDS, [ID].dispatch = PARSABLE, [ID].process_func = PROCESS_FUNC,
+/*
+ * Map entries carry the size of the decoded struct of in messages, which is
+ * checked against the shared decode buffer at compile time.
+ */
+#define MSG_DECODE_SIZE(NAME) (sizeof(NAME) + 0 * sizeof(struct { \
+    _Static_assert(sizeof(NAME) <= MAX_DECODE_SIZE, #NAME " is too large to decode"); char unused; }))
+
+#define MSG_IN(ID, NAME, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = NORMAL_MSG, [ID].dir = IN_MSG, [ID].fields = NAME##_fields, [ID].dispatch = PARSABLE, [ID].process_func = PROCESS_FUNC, [ID].decode_size = MSG_DECODE_SIZE(NAME),
+#define MSG_OUT(ID, NAME, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = NORMAL_MSG, [ID].dir = OUT_MSG, [ID].fields = NAME##_fields, [ID].dispatch = PARSABLE, [ID].process_func = PROCESS_FUNC, [ID].decode_size = 0,
+#define RAW_IN(ID, NAME, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = NORMAL_MSG, [ID].dir = IN_MSG, [ID].fields = NAME##_fields, [ID].dispatch = RAW, [ID].process_func = PROCESS_FUNC, [ID].decode_size = 0,
+#define DEBUG_IN(ID, NAME, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = DEBUG_MSG, [ID].dir = IN_MSG, [ID].fields = NAME##_fields, [ID].dispatch = PARSABLE, [ID].process_func = PROCESS_FUNC, [ID].decode_size = MSG_DECODE_SIZE(NAME),
+#define DEBUG_OUT(ID, NAME, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = DEBUG_MSG, [ID].dir = OUT_MSG, [ID].fields = NAME##_fields, [ID].dispatch = PARSABLE, [ID].process_func = PROCESS_FUNC, [ID].decode_size = 0,
 #define NO_PROCESS_FUNC 0
 
 /* === Typedefs ============================================================ */
@@ -77,6 +84,7 @@ typedef struct
     MessageMapType type;
     MessageMapDirection dir;
     MessageType msg_id;
+    uint32_t decode_size;   /* Size of decoded struct of parsable in messages */
 } MessagesMap_t;
 
 typedef struct
@@ -30,11 +30,12 @@
 
 /* === Typedefs ============================================================ */
 
+/* Run-length encoded image, decoded straight from flash by draw_bitmap_mono_rle() */
 typedef struct
 {
-    const void *(*get_image_data)(uint8_t *);
-    uint16_t    width;
-    uint16_t    height;
+    const uint8_t  *data;
+    uint16_t        width;
+    uint16_t        height;
 } Image;
 
 /* Image frame information */
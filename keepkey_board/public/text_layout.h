@@ -0,0 +1,63 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+/* === Includes ============================================================ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "font.h"
+
+/* === Defines ============================================================= */
+
+#define TEXT_LAYOUT_CACHE_SIZE  3
+#define TEXT_LAYOUT_MAX_CHARS   352     /* Longest string kept in cache (BODY_CHAR_MAX) */
+#define TEXT_LAYOUT_MAX_RUNS    16      /* Lines kept, more than fit on the display */
+
+/* === Typedefs ============================================================ */
+
+/* One line of drawn characters: str[start .. start + length) */
+typedef struct
+{
+    uint16_t    start;
+    uint16_t    length;
+    uint16_t    line;
+} TextRun;
+
+/* Line breaks of a string for a font and wrap width */
+typedef struct
+{
+    const Font *font;
+    int         width;
+    uint32_t    line_count;
+    int         run_count;
+    TextRun     runs[TEXT_LAYOUT_MAX_RUNS];
+    bool        cached;
+    uint16_t    str_len;
+    char        str[TEXT_LAYOUT_MAX_CHARS];
+} TextLayout;
+
+/* === Functions =========================================================== */
+
+const TextLayout *text_layout(const Font *font, const char *str, int width);
+
+#endif
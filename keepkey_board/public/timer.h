@@ -29,7 +29,14 @@
 
 #define ONE_SEC         1100    /* Count for 1 second  */
 #define HALF_SEC        500     /* Count for 0.5 second */
-#define MAX_RUNNABLES   3       /* Max number of queue for task manager */
+#define MAX_RUNNABLES   16      /* Size of the runnable pool */
+
+/* Hierarchical timer wheel: TIMER_WHEEL_LEVELS wheels of 2^TIMER_WHEEL_BITS 1 ms slots */
+#define TIMER_WHEEL_BITS    6
+#define TIMER_WHEEL_SLOTS   (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_MASK    (TIMER_WHEEL_SLOTS - 1)
+#define TIMER_WHEEL_LEVELS  3
+#define TIMER_WHEEL_MAX_MS  ((1UL << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS)) - 1)
 
 /* === Typedefs ============================================================ */
 
@@ -37,27 +44,32 @@ typedef void (*callback_func_t)(void);
 typedef void (*Runnable)(void *context);
 typedef struct RunnableNode RunnableNode;
 
-struct RunnableNode
+typedef enum
 {
-    uint32_t    remaining;
-    Runnable    runnable;
-    void        *context;
-    uint32_t    period;
-    bool        repeating;
-    RunnableNode *next;
-};
+    RUNNABLE_FREE,
+    RUNNABLE_PENDING,       /* In a wheel slot */
+    RUNNABLE_READY,         /* Expired, waiting for run_runnables() */
+    RUNNABLE_RUNNING
+} RunnableState;
 
-typedef struct
+struct RunnableNode
 {
-    RunnableNode   *head;
-    int             size;
-} RunnableQueue;
+    Runnable        runnable;
+    void           *context;
+    uint32_t        expires;
+    uint32_t        period;
+    RunnableState   state;
+    RunnableNode   *next;
+    RunnableNode  **prev_next;  /* Link pointing at this node, for O(1) unlink */
+};
 
 /* === Functions =========================================================== */
 
 void timer_init(void);
 void delay_ms(uint32_t ms);
 void delay_us(uint32_t us);
+uint32_t get_clock_ms(void);
+void wait_for_interrupt(void);
 void delay_ms_with_callback(uint32_t ms, callback_func_t callback_func,
                             uint32_t frequency_ms);
 void post_delayed(Runnable runnable, void *context, uint32_t ms_delay);
@@ -36,6 +36,7 @@
 #define USB_SEGMENT_SIZE 64
 #define MAX_NUM_USB_SEGMENTS 1
 #define MAX_MESSAGE_SIZE (USB_SEGMENT_SIZE * MAX_NUM_USB_SEGMENTS)
+#define USB_RX_QUEUE_DEPTH 8
 #define NUM_USB_STRINGS (sizeof(usb_strings) / sizeof(usb_strings[0]))
 
 /* USB endpoint */
@@ -59,6 +60,12 @@ typedef struct
     uint8_t message[MAX_MESSAGE_SIZE];
 } UsbMessage;
 
+typedef struct
+{
+    UsbMessage msg;
+    uint8_t ep;
+} UsbRxPacket;
+
 typedef void (*usb_rx_callback_t)(UsbMessage* msg);
 
 /* === Functions =========================================================== */
@@ -66,6 +73,7 @@ typedef void (*usb_rx_callback_t)(UsbMessage* msg);
 void usb_set_rx_callback(usb_rx_callback_t callback);
 bool usb_init(void);
 void usb_poll(void);
+bool usb_event_pending(void);
 usbd_device *get_usb_init_stat(void);
 bool usb_tx(uint8_t *message, uint32_t len);
 #if DEBUG_LINK